@@ -151,6 +151,7 @@
 #include "SimTKcommon/SmallMatrix.h"
 
 #include "SimTKcommon/internal/MatrixHelper.h"
+#include "SimTKcommon/internal/MatrixAllocator.h"
 #include "SimTKcommon/internal/MatrixCharacteristics.h"
 
 #include <iostream>
@@ -1129,6 +1130,10 @@ std::istream& readVectorFromStreamHelper
         // if any; istream is good; might be looking at white space.
         assert(in.good());
 
+        // Without brackets, trailing white space is all we might have left;
+        // that's the end of the sequence rather than a missing element.
+        if (!lookForCloser) {std::ws(in); if (!in.good()) break;}
+
         // Now read in an element of type T.
         // The extractor T::operator>>() will ignore leading white space.
         if (!isFixedSize)
@@ -1144,10 +1149,12 @@ std::istream& readVectorFromStreamHelper
     //  - we reached eof
     //  - we saw a closing brace
     //  - we got all the elements we wanted (for a fixed-size read)
-    // Note that it is possible that we consumed everything except some
-    // trailing white space (meaning we're not technically at eof), but
-    // for consistency with built-in operator>>()'s we won't try to absorb
-    // that trailing white space.
+    // If the sequence was bracketed or of fixed size, anything following the
+    // last element, including white space, is left in the stream for
+    // consistency with built-in operator>>()'s. Without brackets a 
+    // variable-size sequence only ends at eof, so we absorbed any trailing
+    // white space when looking for another element rather than mistake it
+    // for a missing one.
 
     if (!in.fail()) {
         if (lookForCloser && !terminatorSeen)
@@ -1462,6 +1469,47 @@ operator ">>" so  this won't work if no such operator is defined for type T.
 template <class T> inline
 std::istream& operator>>(std::istream& in, VectorView_<T>& out) 
 {   return fillVectorViewFromStream<T>(in, out); }
+
+/** @cond **/ // Hide from Doxygen.
+// Same as for Array_; see tryConvertStringToNumberArray() in Array.h.
+template <class T> inline bool
+tryConvertStringToNumberVector(const String& value, Vector_<T>& out) {
+    std::vector<T> elements;
+    if (out.isResizeable() && value.tryConvertToNumbers(elements)) {
+        out.resize((int)elements.size());
+        for (int i=0; i < out.size(); ++i)
+            out[i] = elements[i];
+        return true;
+    }
+    return tryConvertStringTo< Vector_<T> >(value, out);
+}
+
+inline bool tryConvertStringTo(const String& value, Vector_<float>& out)
+{   return tryConvertStringToNumberVector(value, out); }
+inline bool tryConvertStringTo(const String& value, Vector_<double>& out)
+{   return tryConvertStringToNumberVector(value, out); }
+
+// Fixed-size Vecs, like the Vec3s found throughout model files, take the fast
+// path too when it finds exactly M numbers; Vec's operator>>() accepts 
+// everything the fast path does and would read the same values.
+template <int M, class E, int S> inline bool
+tryConvertStringToNumberVec(const String& value, Vec<M,E,S>& out) {
+    std::vector<E> elements;
+    if (value.tryConvertToNumbers(elements) && (int)elements.size() == M) {
+        for (int i=0; i < M; ++i)
+            out[i] = elements[i];
+        return true;
+    }
+    return tryConvertStringTo< Vec<M,E,S> >(value, out);
+}
+
+template <int M, int S> inline bool
+tryConvertStringTo(const String& value, Vec<M,float,S>& out)
+{   return tryConvertStringToNumberVec(value, out); }
+template <int M, int S> inline bool
+tryConvertStringTo(const String& value, Vec<M,double,S>& out)
+{   return tryConvertStringToNumberVec(value, out); }
+/** @endcond **/
 /**@}**/  // End of Matrix serialization.
 
 // Friendly abbreviations for vectors and matrices with scalar elements.
@@ -0,0 +1,125 @@
+#ifndef SimTK_SIMMATRIX_MATRIX_ALLOCATOR_H_
+#define SimTK_SIMMATRIX_MATRIX_ALLOCATOR_H_
+
+/* -------------------------------------------------------------------------- *
+ *                       Simbody(tm): SimTKcommon                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "SimTKcommon/internal/common.h"
+
+#include <cstddef>
+
+namespace SimTK {
+
+/** This is the source of the heap storage used for the elements of
+Vector_, RowVector_ and Matrix_ objects (more precisely, for any owner
+handle managed by MatrixHelper). Every block it hands out is aligned to
+a 64-byte (cache line) boundary.
+
+The default allocator keeps a per-thread pool of recently freed blocks in
+power-of-two size classes up to 64KB, so that the many short-lived
+temporary Vectors created while computing don't each go to the system heap.
+Larger blocks are allocated directly. You can replace the default with your
+own allocator by deriving from this class and calling setAllocator(). You
+can also direct all the allocations made on one thread within a scope to a
+ScopedArena, which is bulk-freed when the scope ends.
+
+Blocks remember where they came from, so a block is always returned to the
+allocator or arena that produced it even if another one is in use by then.
+That means a replacement allocator must outlive every block it allocated.
+
+getStatistics() reports process-wide counts; take the difference across a
+time step to measure allocations per step. **/
+class SimTK_SimTKCOMMON_EXPORT MatrixAllocator {
+public:
+    /** Alignment in bytes of every block returned by allocateBlock(). **/
+    static const std::size_t Alignment = 64;
+
+    virtual ~MatrixAllocator() {}
+
+    /** Return a block of at least \a nBytes aligned to Alignment. **/
+    virtual void* allocate(std::size_t nBytes) = 0;
+    /** Return a block obtained from allocate(); \a nBytes is the size that
+    was requested. **/
+    virtual void deallocate(void* p, std::size_t nBytes) = 0;
+
+    /** Replace the allocator used for subsequent allocations on all threads.
+    The caller retains ownership. Pass null to restore the default. **/
+    static void setAllocator(MatrixAllocator* allocator);
+    /** Return the allocator currently in use for new blocks. **/
+    static MatrixAllocator& getAllocator();
+
+    /** Allocate a 64-byte aligned block of \a nBytes from the current
+    thread's ScopedArena if there is one, otherwise from the current
+    allocator. This is what MatrixHelper uses; memory handed to a Vector
+    through swapOwnedContiguousScalarBlock() must come from here. **/
+    static void* allocateBlock(std::size_t nBytes);
+    /** Return a block obtained from allocateBlock(). Null is ignored. **/
+    static void deallocateBlock(void* p);
+
+    /** Process-wide counts of allocateBlock() activity since the last
+    resetStatistics(). Each thread keeps its own counts, which are only
+    summed here, so counting doesn't slow down allocation on other threads.
+    Counts made on other threads while this runs may or may not be
+    included. **/
+    struct Statistics {
+        long long numAllocations;     ///< calls to allocateBlock()
+        long long numDeallocations;   ///< calls to deallocateBlock()
+        long long numPoolHits;        ///< satisfied from a thread's free list
+        long long numArenaAllocations;///< satisfied from a ScopedArena
+    };
+    static Statistics getStatistics();
+    static void resetStatistics();
+
+    class ScopedArena;
+};
+
+/** While an object of this class exists, all matrix allocations made on the
+thread that created it are carved sequentially out of large chunks, and
+deallocations are no-ops. The chunks are freed together when the arena is
+destroyed. Arenas nest; the innermost one is used.
+
+This is meant for bracketing computations that create many temporaries.
+A Vector allocated in the scope may outlive it: the arena's chunks are then
+kept until the last such block is freed, so that is safe but wastes memory.
+Other threads, including ParallelExecutor workers, are not affected. **/
+class SimTK_SimTKCOMMON_EXPORT MatrixAllocator::ScopedArena {
+public:
+    /** Start an arena that allocates chunks of at least \a chunkSize bytes.
+    **/
+    explicit ScopedArena(std::size_t chunkSize = 64*1024);
+    ~ScopedArena();
+
+    /** Return the number of bytes handed out by this arena so far. **/
+    std::size_t getNumBytesAllocated() const;
+private:
+    ScopedArena(const ScopedArena&);            // suppress
+    ScopedArena& operator=(const ScopedArena&); // suppress
+
+    class Impl;
+    Impl*               impl;
+    MatrixAllocator*    prev; // arena that was current before this one
+};
+
+} //namespace SimTK
+
+#endif // SimTK_SIMMATRIX_MATRIX_ALLOCATOR_H_
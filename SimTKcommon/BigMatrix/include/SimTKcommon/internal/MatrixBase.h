@@ -844,15 +844,28 @@ public:
     Scalar* updContiguousScalarData() {
         return helper.updContiguousData();
     }
+    /// If \a takeOwnership is true, \a newData must have been allocated
+    /// with new[] as an array of the underlying float or double type.
     void replaceContiguousScalarData(Scalar* newData, ptrdiff_t length, bool takeOwnership) {
         helper.replaceContiguousData(newData,length,takeOwnership);
     }
     void replaceContiguousScalarData(const Scalar* newData, ptrdiff_t length) {
         helper.replaceContiguousData(newData,length);
     }
+    /// \a newData must have been allocated with new[] as an array of the
+    /// underlying float or double type, and the caller must free \a oldData
+    /// with delete[]. If the old data was allocated by this Matrix rather
+    /// than handed to it, \a oldData is a copy and the original is freed.
     void swapOwnedContiguousScalarData(Scalar* newData, ptrdiff_t length, Scalar*& oldData) {
         helper.swapOwnedContiguousData(newData,length,oldData);
     }
+    /// Like swapOwnedContiguousScalarData(), but \a newData must have been
+    /// obtained from MatrixAllocator::allocateBlock(), and the caller must
+    /// free \a oldData with MatrixAllocator::deallocateBlock(). This avoids
+    /// the copy when the old data was allocated by this Matrix.
+    void swapOwnedContiguousScalarBlock(Scalar* newData, ptrdiff_t length, Scalar*& oldData) {
+        helper.swapOwnedContiguousBlock(newData,length,oldData);
+    }
 
     /// Helper rep-stealing constructor. We take over ownership of this rep here. Note
     /// that this \e defines the handle commitment for this handle. This is intended
@@ -329,6 +329,7 @@ public:
     void replaceContiguousData(S* newData, ptrdiff_t length, bool takeOwnership);
     void replaceContiguousData(const S* newData, ptrdiff_t length);
     void swapOwnedContiguousData(S* newData, ptrdiff_t length, S*& oldData);
+    void swapOwnedContiguousBlock(S* newData, ptrdiff_t length, S*& oldData);
 
     const MatrixHelperRep<S>& getRep() const {assert(rep); return *rep;}
     MatrixHelperRep<S>&       updRep()       {assert(rep); return *rep;}
@@ -0,0 +1,346 @@
+/* -------------------------------------------------------------------------- *
+ *                       Simbody(tm): SimTKcommon                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "SimTKcommon/internal/common.h"
+#include "SimTKcommon/internal/MatrixAllocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#ifdef _WIN32
+    #include <malloc.h>
+#endif
+
+using namespace SimTK;
+
+namespace {
+
+// Every block starts with this header, padded to the alignment so that the
+// caller's data stays aligned. It records where the block must be returned.
+struct BlockHeader {
+    MatrixAllocator*    from;
+    std::size_t         nBytes; // including the header
+};
+const std::size_t HeaderSize = MatrixAllocator::Alignment;
+static_assert(sizeof(BlockHeader) <= HeaderSize,
+              "MatrixAllocator block header doesn't fit.");
+
+void* alignedSystemAlloc(std::size_t nBytes) {
+    void* p;
+    #ifdef _WIN32
+        p = _aligned_malloc(nBytes, MatrixAllocator::Alignment);
+    #else
+        if (posix_memalign(&p, MatrixAllocator::Alignment, nBytes) != 0)
+            p = 0;
+    #endif
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void alignedSystemFree(void* p) {
+    #ifdef _WIN32
+        _aligned_free(p);
+    #else
+        std::free(p);
+    #endif
+}
+
+//------------------------------------------------------------------------------
+//                              POOL ALLOCATOR
+//------------------------------------------------------------------------------
+// Size class c holds blocks of MinBlockSize<<c bytes. Each thread keeps its
+// own free lists, so there is no locking; a block freed on a different
+// thread than allocated it just joins that thread's list.
+const int         NumSizeClasses   = 11; // 64B..64KB
+const std::size_t MinBlockSize     = 64;
+const int         MaxCachedPerSize = 64;
+
+int calcSizeClass(std::size_t nBytes) {
+    int c = 0;
+    for (std::size_t sz = MinBlockSize; sz < nBytes; sz <<= 1)
+        ++c;
+    return c;
+}
+
+struct FreeBlock {FreeBlock* next;};
+
+//------------------------------------------------------------------------------
+//                                STATISTICS
+//------------------------------------------------------------------------------
+enum Count {Allocations, Deallocations, PoolHits, ArenaAllocations, NumCounts};
+
+// Each thread counts its own activity in a block of its own cache line, so
+// counting doesn't make threads contend. Only the owning thread writes the
+// counts; they are atomic just so getStatistics() can read them.
+struct ThreadCounts {
+    std::atomic<long long> n[NumCounts];
+};
+static_assert(sizeof(ThreadCounts) <= MatrixAllocator::Alignment,
+              "MatrixAllocator thread counts don't fit in a cache line.");
+
+// The counts of every live thread, plus the totals of threads that have
+// exited and of counting done while a thread was exiting. Never destroyed,
+// since threads may exit during static destruction.
+struct CountRegistry {
+    std::mutex                  lock;
+    std::vector<ThreadCounts*>  threads;
+    std::atomic<long long>      retired[NumCounts];
+    long long                   base[NumCounts]; // totals at last reset
+};
+CountRegistry& getCountRegistry() {
+    static CountRegistry* const registry = new CountRegistry();
+    return *registry;
+}
+
+// This is deliberately trivially destructible so that it remains usable by
+// deallocations that happen after the thread's destructors have run, such
+// as those of static Vectors at program exit. The reaper below empties it
+// at thread exit and marks it closed.
+struct ThreadCache {
+    FreeBlock*      head[NumSizeClasses];
+    int             count[NumSizeClasses];
+    ThreadCounts*   counts; // registered on first use
+    bool            closed;
+};
+thread_local ThreadCache threadCache; // zero initialized
+
+struct ThreadCacheReaper {
+    ~ThreadCacheReaper() {
+        for (int c=0; c < NumSizeClasses; ++c) {
+            while (FreeBlock* b = threadCache.head[c]) {
+                threadCache.head[c] = b->next;
+                alignedSystemFree(b);
+            }
+            threadCache.count[c] = 0;
+        }
+        if (ThreadCounts* counts = threadCache.counts) {
+            CountRegistry& registry = getCountRegistry();
+            std::lock_guard<std::mutex> guard(registry.lock);
+            for (int i=0; i < NumCounts; ++i)
+                registry.retired[i] += counts->n[i];
+            registry.threads.erase(std::find(registry.threads.begin(),
+                registry.threads.end(), counts));
+            counts->~ThreadCounts();
+            alignedSystemFree(counts);
+            threadCache.counts = 0;
+        }
+        threadCache.closed = true;
+    }
+};
+thread_local ThreadCacheReaper threadCacheReaper;
+
+void count(Count which) {
+    ThreadCache& cache = threadCache;
+    if (!cache.counts) {
+        CountRegistry& registry = getCountRegistry();
+        if (cache.closed) { // this thread is exiting
+            ++registry.retired[which];
+            return;
+        }
+        (void)&threadCacheReaper; // make sure the counts get retired
+        void* p = alignedSystemAlloc(MatrixAllocator::Alignment);
+        ThreadCounts* counts = new(p) ThreadCounts();
+        std::lock_guard<std::mutex> guard(registry.lock);
+        registry.threads.push_back(counts);
+        cache.counts = counts;
+    }
+    std::atomic<long long>& n = cache.counts->n[which];
+    n.store(n.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+// Totals over all threads, past and present, since the program started.
+void sumCounts(CountRegistry& registry, long long total[NumCounts]) {
+    for (int i=0; i < NumCounts; ++i)
+        total[i] = registry.retired[i];
+    for (unsigned t=0; t < registry.threads.size(); ++t)
+        for (int i=0; i < NumCounts; ++i)
+            total[i] += 
+                registry.threads[t]->n[i].load(std::memory_order_relaxed);
+}
+
+class PoolAllocator : public MatrixAllocator {
+public:
+    void* allocate(std::size_t nBytes) override {
+        const int c = calcSizeClass(nBytes);
+        if (c >= NumSizeClasses)
+            return alignedSystemAlloc(nBytes);
+        ThreadCache& cache = threadCache;
+        if (FreeBlock* b = cache.head[c]) {
+            cache.head[c] = b->next;
+            --cache.count[c];
+            count(PoolHits);
+            return b;
+        }
+        return alignedSystemAlloc(MinBlockSize << c);
+    }
+
+    void deallocate(void* p, std::size_t nBytes) override {
+        const int c = calcSizeClass(nBytes);
+        ThreadCache& cache = threadCache;
+        if (c >= NumSizeClasses || cache.closed
+            || cache.count[c] >= MaxCachedPerSize) {
+            alignedSystemFree(p);
+            return;
+        }
+        (void)&threadCacheReaper; // make sure the cache gets emptied
+        FreeBlock* b = static_cast<FreeBlock*>(p);
+        b->next = cache.head[c];
+        cache.head[c] = b;
+        ++cache.count[c];
+    }
+};
+
+// Never destroyed, since blocks may be freed during static destruction.
+MatrixAllocator& getDefaultAllocator() {
+    static MatrixAllocator* const pool = new PoolAllocator();
+    return *pool;
+}
+
+std::atomic<MatrixAllocator*> replacementAllocator(nullptr);
+
+// Innermost ScopedArena on this thread, if any.
+thread_local MatrixAllocator* currentArena = 0;
+
+} // anonymous namespace
+
+
+
+//==============================================================================
+//                             MATRIX ALLOCATOR
+//==============================================================================
+
+void MatrixAllocator::setAllocator(MatrixAllocator* allocator)
+{   replacementAllocator = allocator; }
+
+MatrixAllocator& MatrixAllocator::getAllocator() {
+    MatrixAllocator* a = replacementAllocator;
+    return a ? *a : getDefaultAllocator();
+}
+
+void* MatrixAllocator::allocateBlock(std::size_t nBytes) {
+    MatrixAllocator& from = currentArena ? *currentArena : getAllocator();
+    const std::size_t total = nBytes + HeaderSize;
+    BlockHeader* h = static_cast<BlockHeader*>(from.allocate(total));
+    h->from   = &from;
+    h->nBytes = total;
+    count(Allocations);
+    return reinterpret_cast<char*>(h) + HeaderSize;
+}
+
+void MatrixAllocator::deallocateBlock(void* p) {
+    if (!p) return;
+    BlockHeader* h =
+        reinterpret_cast<BlockHeader*>(static_cast<char*>(p) - HeaderSize);
+    count(Deallocations);
+    h->from->deallocate(h, h->nBytes);
+}
+
+MatrixAllocator::Statistics MatrixAllocator::getStatistics() {
+    CountRegistry& registry = getCountRegistry();
+    long long total[NumCounts];
+    {   std::lock_guard<std::mutex> guard(registry.lock);
+        sumCounts(registry, total);
+        for (int i=0; i < NumCounts; ++i)
+            total[i] -= registry.base[i]; }
+    Statistics stats;
+    stats.numAllocations      = total[Allocations];
+    stats.numDeallocations    = total[Deallocations];
+    stats.numPoolHits         = total[PoolHits];
+    stats.numArenaAllocations = total[ArenaAllocations];
+    return stats;
+}
+
+// The counts themselves are never zeroed, since only their own threads may
+// write them; we just remember where they were.
+void MatrixAllocator::resetStatistics() {
+    CountRegistry& registry = getCountRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    sumCounts(registry, registry.base);
+}
+
+
+
+//==============================================================================
+//                               SCOPED ARENA
+//==============================================================================
+// The Impl is reference counted: one reference for the ScopedArena and one
+// for each block still outstanding. It is deleted, freeing its chunks, when
+// the last of those goes away.
+class MatrixAllocator::ScopedArena::Impl : public MatrixAllocator {
+public:
+    explicit Impl(std::size_t chunkSize)
+    :   chunkSize(chunkSize), next(0), end(0), nBytesAllocated(0),
+        refCount(1) {}
+
+    ~Impl() {
+        for (unsigned i=0; i < chunks.size(); ++i)
+            alignedSystemFree(chunks[i]);
+    }
+
+    void* allocate(std::size_t nBytes) override {
+        // Keep every block aligned.
+        nBytes = (nBytes + Alignment-1) / Alignment * Alignment;
+        if (std::size_t(end - next) < nBytes) {
+            const std::size_t sz = std::max(chunkSize, nBytes);
+            char* chunk = static_cast<char*>(alignedSystemAlloc(sz));
+            chunks.push_back(chunk);
+            next = chunk; end = chunk + sz;
+        }
+        void* p = next;
+        next += nBytes;
+        nBytesAllocated += nBytes;
+        ++refCount;
+        count(ArenaAllocations);
+        return p;
+    }
+
+    void deallocate(void*, std::size_t) override {release();}
+
+    void release() {if (--refCount == 0) delete this;}
+
+    std::size_t getNumBytesAllocated() const {return nBytesAllocated;}
+private:
+    const std::size_t   chunkSize;
+    std::vector<char*>  chunks;
+    char*               next;
+    char*               end;
+    std::size_t         nBytesAllocated;
+    std::atomic<long>   refCount;
+};
+
+MatrixAllocator::ScopedArena::ScopedArena(std::size_t chunkSize)
+:   impl(new Impl(chunkSize)), prev(currentArena) {
+    currentArena = impl;
+}
+
+MatrixAllocator::ScopedArena::~ScopedArena() {
+    currentArena = prev;
+    impl->release();
+}
+
+std::size_t MatrixAllocator::ScopedArena::getNumBytesAllocated() const
+{   return impl->getNumBytesAllocated(); }
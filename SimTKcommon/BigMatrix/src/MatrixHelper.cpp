@@ -38,6 +38,7 @@
 #include "MatrixHelperRep_Tri.h"
 #include "MatrixHelperRep_Vector.h"
 
+#include <algorithm>
 #include <iostream>
 #include <cstdio>
 
@@ -558,23 +559,56 @@ template <class S> void
 MatrixHelper<S>::replaceContiguousData(S* newData, ptrdiff_t length, bool takeOwnership) {
     assert(length == getContiguousDataLength());
     if (rep->m_owner) {
-        MatrixHelperRep<S>::deleteAllocatedMemory(rep->m_data); 
+        rep->deleteOwnedData(); 
         rep->m_data=0;
     }
     rep->m_data = newData;
     rep->m_owner = takeOwnership;
+    rep->m_dataIsForeign = takeOwnership;
 }
 template <class S> void 
 MatrixHelper<S>::replaceContiguousData(const S* newData, ptrdiff_t length) {
     replaceContiguousData(const_cast<S*>(newData), length, false);
     rep->m_writable = false;
 }
+// The caller gives us new[] data and takes the old data back as new[] data.
+// If the old data came from the MatrixAllocator the caller gets a copy.
 template <class S> void 
 MatrixHelper<S>::swapOwnedContiguousData(S* newData, ptrdiff_t length, S*& oldData) {
     assert(length == getContiguousDataLength());
     assert(rep->m_owner);
     oldData = rep->m_data;
+    if (oldData && !rep->m_dataIsForeign) {
+        typedef typename CNT<S>::Precision P;
+        const ptrdiff_t nPrec = length * ptrdiff_t(sizeof(S)/sizeof(P));
+        P* copy = new P[nPrec];
+        std::copy(reinterpret_cast<const P*>(oldData), 
+                  reinterpret_cast<const P*>(oldData) + nPrec, copy);
+        MatrixHelperRep<S>::deleteAllocatedMemory(oldData);
+        oldData = reinterpret_cast<S*>(copy);
+    }
+    rep->m_data = newData;
+    rep->m_dataIsForeign = true;
+}
+// The same, but with blocks from the MatrixAllocator. If the old data was
+// handed to us as new[] data the caller gets a copy in a block.
+template <class S> void 
+MatrixHelper<S>::swapOwnedContiguousBlock(S* newData, ptrdiff_t length, S*& oldData) {
+    assert(length == getContiguousDataLength());
+    assert(rep->m_owner);
+    oldData = rep->m_data;
+    if (oldData && rep->m_dataIsForeign) {
+        typedef typename CNT<S>::Precision P;
+        const ptrdiff_t nPrec = length * ptrdiff_t(sizeof(S)/sizeof(P));
+        P* copy = static_cast<P*>
+            (MatrixAllocator::allocateBlock(nPrec*sizeof(P)));
+        std::copy(reinterpret_cast<const P*>(oldData), 
+                  reinterpret_cast<const P*>(oldData) + nPrec, copy);
+        delete[] reinterpret_cast<P*>(oldData);
+        oldData = reinterpret_cast<S*>(copy);
+    }
     rep->m_data = newData;
+    rep->m_dataIsForeign = false;
 }
 
 
@@ -808,7 +842,7 @@ template <class S>
 MatrixHelperRep<S>::~MatrixHelperRep()
 {
     if (isOwner()) 
-        deleteAllocatedMemory(m_data);
+        deleteOwnedData();
 }
 
 template <class S> static void
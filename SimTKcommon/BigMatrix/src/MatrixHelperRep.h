@@ -26,6 +26,7 @@
 
 #include "SimTKcommon/Scalar.h"
 #include "SimTKcommon/SmallMatrix.h"
+#include "SimTKcommon/internal/MatrixAllocator.h"
 
 #include "ElementFilter.h"
 
@@ -436,10 +437,22 @@ public:
             return;
         }
         if (m_owner)
-            deleteAllocatedMemory(m_data);
+            deleteOwnedData();
         m_data = 0;
     }
 
+    // Return owned data to wherever it came from: normally the
+    // MatrixAllocator, but data whose ownership was handed to us with
+    // replaceContiguousData() or swapOwnedContiguousData() was allocated by
+    // the caller with new[].
+    void deleteOwnedData() {
+        if (m_dataIsForeign)
+            delete[] reinterpret_cast<Precision*>(m_data);
+        else
+            deleteAllocatedMemory(m_data);
+        m_dataIsForeign = false;
+    }
+
     // Given a number of elements (not scalars), allocate
     // just enough memory to hold that many elements in packed storage.
     void allocateData(ptrdiff_t nelt) {
@@ -460,11 +473,12 @@ public:
         allocateData(ptrdiff_t(m) * ptrdiff_t(n)); }
 
     // Allocate new heap space to hold nelt densely-packed elements each 
-    // composed of m_eltSize scalars of type S. We actually allocate an array of
-    // the underlying Precision type (float or double) to avoid any default 
-    // construction of more complicated elements like complex. If we're in Debug
-    // mode, we'll initialize the resulting data to NaN, otherwise we won't 
-    // touch it. If nelt is zero we return a null pointer.
+    // composed of m_eltSize scalars of type S. The space comes from the
+    // MatrixAllocator and is treated as an array of the underlying Precision
+    // type (float or double) to avoid any default construction of more
+    // complicated elements like complex. If we're in Debug mode, we'll
+    // initialize the resulting data to NaN, otherwise we won't touch it. If
+    // nelt is zero we return a null pointer.
     S* allocateMemory(ptrdiff_t nElt) const {
         assert(nElt >= 0);
         if (nElt==0) 
@@ -472,7 +486,8 @@ public:
         assert(sizeof(S) % sizeof(Precision) == 0);
         const ptrdiff_t nPrecPerElt = (sizeof(S)/sizeof(Precision))*m_eltSize;
         const ptrdiff_t nPrec       = nElt * nPrecPerElt;
-        Precision* p = new Precision[nPrec];
+        Precision* p = static_cast<Precision*>
+            (MatrixAllocator::allocateBlock(nPrec*sizeof(Precision)));
         #ifndef NDEBUG
             const Precision nan = CNT<Precision>::getNaN();
             for (ptrdiff_t i=0; i < nPrec; ++i)
@@ -488,13 +503,10 @@ public:
         return allocateMemory(ptrdiff_t(m) * ptrdiff_t(n)); }
 
     // Use this method to delete help space that you allocated using 
-    // allocateNewData() above. We recast it back to the form in which it was 
-    // allocated before deleting which will keep the heap system happy and also 
-    // prevent the calling of any element destructor that might be present for 
-    // the fancier scalar types.
+    // allocateMemory() above. No element destructors are called, since none
+    // were constructed.
     static void deleteAllocatedMemory(S* mem) {
-        Precision* p = reinterpret_cast<Precision*>(mem);
-        delete[] p;
+        MatrixAllocator::deallocateBlock(mem);
     }
 
     // Use setData only when there isn't already data in this handle. If this
@@ -695,13 +707,13 @@ protected:
     MatrixHelperRep(int esz, int cppesz) 
     :   m_data(0), m_actual(), m_writable(false), 
         m_eltSize(esz), m_cppEltSize(cppesz), 
-        m_canBeOwner(true), m_owner(false), 
+        m_canBeOwner(true), m_owner(false), m_dataIsForeign(false),
         m_handleIsLocked(false), m_commitment(), m_handle(0) {}
 
     MatrixHelperRep(int esz, int cppesz, const MatrixCommitment& commitment) 
     :   m_data(0), m_actual(), m_writable(false),
         m_eltSize(esz), m_cppEltSize(cppesz),
-        m_canBeOwner(true), m_owner(false), 
+        m_canBeOwner(true), m_owner(false), m_dataIsForeign(false),
         m_handleIsLocked(false), m_commitment(commitment), m_handle(0) {}
 
     // Copy constructor copies just the base class members, and *not* the data.
@@ -711,7 +723,7 @@ protected:
     MatrixHelperRep(const MatrixHelperRep& src)
     :   m_data(0), m_actual(src.m_actual), m_writable(false),
         m_eltSize(src.m_eltSize), m_cppEltSize(src.m_cppEltSize),  
-        m_canBeOwner(true), m_owner(false), 
+        m_canBeOwner(true), m_owner(false), m_dataIsForeign(false),
         m_handleIsLocked(false), m_commitment(src.m_commitment), m_handle(0) {}
 
         // Properties of the actual matrix //
@@ -731,6 +743,7 @@ protected:
 
     bool                m_canBeOwner;
     bool                m_owner;
+    bool                m_dataIsForeign; // owned data was allocated with new[]
     bool                m_handleIsLocked; // temporarily prevent resize of owner
 
     /// All commitments are by default "Uncommitted", meaning we're happy to
@@ -1420,16 +1420,16 @@ Rotation_<P>::operator=(const InverseRotation_<P>& R)
 {static_cast<Mat<3,3,P>&>(*this)  = R.asMat33();    return *this;}
 template <class P> inline Rotation_<P>&  
 Rotation_<P>::operator*=(const Rotation_<P>& R)        
-{static_cast<Mat<3,3,P>&>(*this) *= R.asMat33();    return *this;}
+{static_cast<Mat<3,3,P>&>(*this) = asMat33()*R.asMat33();    return *this;}
 template <class P> inline Rotation_<P>&  
 Rotation_<P>::operator/=(const Rotation_<P>& R)        
-{static_cast<Mat<3,3,P>&>(*this) *= (~R).asMat33(); return *this;}
+{static_cast<Mat<3,3,P>&>(*this) = asMat33()*(~R).asMat33(); return *this;}
 template <class P> inline Rotation_<P>&  
 Rotation_<P>::operator*=(const InverseRotation_<P>& R) 
-{static_cast<Mat<3,3,P>&>(*this) *= R.asMat33();    return *this;}
+{static_cast<Mat<3,3,P>&>(*this) = asMat33()*R.asMat33();    return *this;}
 template <class P> inline Rotation_<P>&  
 Rotation_<P>::operator/=(const InverseRotation_<P>& R) 
-{static_cast<Mat<3,3,P>&>(*this) *= (~R).asMat33(); return *this;}
+{static_cast<Mat<3,3,P>&>(*this) = asMat33()*(~R).asMat33(); return *this;}
 
 /// Composition of Rotation matrices via operator*.
 //@{
@@ -45,6 +45,16 @@ namespace SimTK {
  * This class is implemented using the SIMD-oriented Fast Mersenne Twister (SFMT) library.  It provides
  * good performance, excellent statistical properties, and a very long period.
  * 
+ * Alternatively, setStream() selects a counter-based generator (Philox4x32-10; Salmon et al., "Parallel
+ * random numbers: as easy as 1, 2, 3", SC'11), whose values are a fixed function of a seed, a stream number,
+ * and the position in the sequence.  Different streams with the same seed are independent of one another,
+ * so a parallel computation can give each task its own stream and get the same results however its tasks
+ * are assigned to threads:
+ * <pre>
+ *   Random::Gaussian noise;
+ *   noise.setStream(seed, taskIndex);
+ * </pre>
+ * 
  * The methods of this class do not provide any synchronization or other mechanism to ensure thread safety.
  * It is therefore important that a single Random object not be accessed from multiple threads. One minor
  * concession to threads: even if you don't set the seed explicitly, each thread's Random object will
@@ -61,12 +71,20 @@ public:
      * Reinitialize this random number generator with a new seed value.
      */
     void setSeed(int seed);
+    /**
+     * Reinitialize this random number generator to produce the counter-based stream identified by
+     * \a seed and \a stream, starting from its beginning.  Calling setSeed() afterwards switches back to
+     * the default (SFMT) generator.
+     */
+    void setStream(int seed, int stream);
     /**
      * Get the next value in the pseudo-random sequence.
      */
     Real getValue() const;
     /**
-     * Fill an array with values from the pseudo-random sequence.
+     * Fill an array with values from the pseudo-random sequence.  The values are the same as would be
+     * returned by calling getValue() \a length times, but they are generated in bulk, which is
+     * considerably faster.
      */
     void fillArray(Real array[], int length) const;
 protected:
@@ -23,15 +23,63 @@
 
 
 #include "SimTKcommon/basics.h"
+#include "SimTKcommon/Scalar.h"
 #include "SimTKcommon/internal/Random.h"
 #include "SFMT.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <cmath>
 
 using namespace SimTK_SFMT;
 
+namespace {
+// The Philox4x32-10 counter-based generator (Salmon, Moraes, Dror and Shaw,
+// "Parallel random numbers: as easy as 1, 2, 3", SC'11), producing two 64 bit
+// values per 128 bit counter. Blocks are computed several at a time with the
+// lanes in separate arrays, so that the compiler can vectorize the rounds.
+const uint32_t PhiloxM0 = 0xD2511F53, PhiloxM1 = 0xCD9E8D57;
+const uint32_t PhiloxW0 = 0x9E3779B9, PhiloxW1 = 0xBB67AE85;
+const int PhiloxLanes = 8;
+
+// Fill out[0..2*numBlocks) with the values for counters firstBlock, 
+// firstBlock+1, ...; numBlocks must be a multiple of PhiloxLanes.
+void fillPhilox(uint32_t key0, uint32_t key1, uint64_t firstBlock,
+                int numBlocks, uint64_t out[]) {
+    assert(numBlocks % PhiloxLanes == 0);
+    for (int b = 0; b < numBlocks; b += PhiloxLanes) {
+        uint32_t c0[PhiloxLanes], c1[PhiloxLanes], c2[PhiloxLanes], 
+                 c3[PhiloxLanes];
+        for (int i = 0; i < PhiloxLanes; ++i) {
+            const uint64_t block = firstBlock + b + i;
+            c0[i] = (uint32_t)block;
+            c1[i] = (uint32_t)(block >> 32);
+            c2[i] = c3[i] = 0;
+        }
+        uint32_t k0 = key0, k1 = key1;
+        for (int round = 0; round < 10; ++round) {
+            for (int i = 0; i < PhiloxLanes; ++i) {
+                const uint64_t p0 = (uint64_t)PhiloxM0 * c0[i];
+                const uint64_t p1 = (uint64_t)PhiloxM1 * c2[i];
+                const uint32_t n0 = (uint32_t)(p1 >> 32) ^ c1[i] ^ k0;
+                const uint32_t n2 = (uint32_t)(p0 >> 32) ^ c3[i] ^ k1;
+                c1[i] = (uint32_t)p1;
+                c3[i] = (uint32_t)p0;
+                c0[i] = n0;
+                c2[i] = n2;
+            }
+            k0 += PhiloxW0;
+            k1 += PhiloxW1;
+        }
+        for (int i = 0; i < PhiloxLanes; ++i) {
+            out[2*(b+i)]   = c0[i] | ((uint64_t)c1[i] << 32);
+            out[2*(b+i)+1] = c2[i] | ((uint64_t)c3[i] << 32);
+        }
+    }
+}
+}
+
 namespace SimTK {
 
 /**
@@ -41,15 +89,33 @@ namespace SimTK {
 class Random::RandomImpl {
 private:
     mutable SimTK_SFMT::SFMTData* sfmt;
+    static std::atomic<int> nextSeed;
+    // For the counter-based generator; see setStream().
+    bool counterBased;
+    uint32_t key0, key1;
+    mutable uint64_t nextBlock;
+protected:
     static const int bufferSize = 1024;
     mutable uint64_t buffer[bufferSize];
     mutable int nextIndex;
-    static std::atomic<int> nextSeed;
+
+    bool isCounterBased() const {return counterBased;}
+
+    void refillBuffer() const {
+        if (counterBased) {
+            fillPhilox(key0, key1, nextBlock, bufferSize/2, buffer);
+            nextBlock += bufferSize/2;
+        } else
+            fill_array64(buffer, bufferSize, *sfmt);
+        nextIndex = 0;
+    }
+
+    static Real toReal(uint64_t bits) {return Real(to_res53(bits));}
 public:
     class UniformImpl;
     class GaussianImpl;
     
-    RandomImpl() {
+    RandomImpl() : counterBased(false), key0(0), key1(0), nextBlock(0) {
         sfmt = createSFMTData();
         nextIndex = bufferSize;
         init_gen_rand(++nextSeed, *sfmt);
@@ -61,8 +127,17 @@ public:
     
     virtual void setSeed(int seed) {
         nextIndex = bufferSize;
+        counterBased = false;
         init_gen_rand(seed, *sfmt);
     }
+
+    virtual void setStream(int seed, int stream) {
+        nextIndex = bufferSize;
+        counterBased = true;
+        key0 = (uint32_t)seed;
+        key1 = (uint32_t)stream;
+        nextBlock = 0;
+    }
     
     virtual Real getValue() const = 0;
 
@@ -70,17 +145,16 @@ public:
         if (nextIndex >= bufferSize) {
             // There are no remaining values in the buffer, so we need to refill it.
             
-            fill_array64(buffer, bufferSize, *sfmt);
-            nextIndex = 0;
+            refillBuffer();
         }
-        return Real(to_res53(buffer[nextIndex++]));
+        return toReal(buffer[nextIndex++]);
     }
 
     int getInt(int max) {
         return (int) floor(getValue()*max);
     }
 
-    void fillArray(Real array[], int length) const {
+    virtual void fillArray(Real array[], int length) const {
         for (int i = 0; i < length; ++i)
             array[i] = getValue();
     }
@@ -102,6 +176,20 @@ public:
     Real getValue() const override {
         return min+getNextRandom()*range;
     }
+
+    // Take the values straight from the buffer, a buffer's worth at a time.
+    void fillArray(Real array[], int length) const override {
+        for (int i = 0; i < length; ) {
+            if (nextIndex >= bufferSize)
+                refillBuffer();
+            const int n = std::min(length-i, bufferSize-nextIndex);
+            const uint64_t* bits = buffer+nextIndex;
+            for (int j = 0; j < n; ++j)
+                array[i+j] = min+toReal(bits[j])*range;
+            i += n;
+            nextIndex += n;
+        }
+    }
     
     Real getMin() const {
         return min;
@@ -141,6 +229,15 @@ public:
             nextGaussianIsValid = false;
             return mean+stddev*nextGaussian;
         }
+
+        if (isCounterBased()) {
+            const Real u1 = getNextRandom();
+            const Real u2 = getNextRandom();
+            Real first;
+            boxMuller(u1, u2, first, nextGaussian);
+            nextGaussianIsValid = true;
+            return mean+stddev*first;
+        }
         
         // Use the polar form of the Box-Muller transformation to generate two Gaussian random numbers.
         
@@ -156,10 +253,47 @@ public:
         return mean+stddev*x*multiplier;
     }
     
+    // The counter-based generator uses the basic form of the Box-Muller
+    // transformation instead, which always takes two uniform values per pair
+    // and has no data-dependent branches, so that pairs can be generated
+    // straight from the buffer.
+    void fillArray(Real array[], int length) const override {
+        if (!isCounterBased()) {
+            RandomImpl::fillArray(array, length);
+            return;
+        }
+        int i = 0;
+        if (i < length && nextGaussianIsValid)
+            array[i++] = getValue();
+        // Each pair takes two values from the buffer, and the buffer starts
+        // out empty, so nextIndex is always even here.
+        while (length-i >= 2) {
+            if (nextIndex >= bufferSize)
+                refillBuffer();
+            const int pairs = std::min((length-i)/2, (bufferSize-nextIndex)/2);
+            const uint64_t* bits = buffer+nextIndex;
+            for (int j = 0; j < pairs; ++j) {
+                Real z0, z1;
+                boxMuller(toReal(bits[2*j]), toReal(bits[2*j+1]), z0, z1);
+                array[i+2*j]   = mean+stddev*z0;
+                array[i+2*j+1] = mean+stddev*z1;
+            }
+            i += 2*pairs;
+            nextIndex += 2*pairs;
+        }
+        if (i < length)
+            array[i] = getValue();
+    }
+
     void setSeed(int seed) override {
         RandomImpl::setSeed(seed);
         nextGaussianIsValid = false;
     }
+
+    void setStream(int seed, int stream) override {
+        RandomImpl::setStream(seed, stream);
+        nextGaussianIsValid = false;
+    }
     
     Real getMean() const {
         return mean;
@@ -176,6 +310,15 @@ public:
     void setStdDev(Real value) {
         stddev = value;
     }
+private:
+    // u1 and u2 are in [0,1]; 1-u1 can round to zero, so it is kept from
+    // reaching it.
+    static void boxMuller(Real u1, Real u2, Real& z0, Real& z1) {
+        const Real r = std::sqrt(-2*std::log(std::max(1-u1, Eps)));
+        const Real theta = 2*Pi*u2;
+        z0 = r*std::cos(theta);
+        z1 = r*std::sin(theta);
+    }
 };
 
 Random::Random() : impl(0) {
@@ -199,6 +342,10 @@ void Random::setSeed(int seed) {
     getImpl().setSeed(seed);
 }
 
+void Random::setStream(int seed, int stream) {
+    getImpl().setStream(seed, stream);
+}
+
 Real Random::getValue() const {
     return getConstImpl().getValue();
 }
@@ -958,13 +958,18 @@ values that are no longer needed are removed from the beginning. When a value is
 requested at current time t, the %Measure interpolates using values from just 
 prior to t-delay and just afterwards to approximate the value at t-delay.
 
+The buffer is circular, so adding and removing entries takes constant 
+amortized time, and the bracketing entries are found by bisection. The buffer
+is kept in an auto-update state variable whose update value is normally still
+holding the previous step's contents, so only the entries that changed are
+written each step rather than the whole history. If you need many delayed
+signals with the same delay, a single %Delay of a Measure_<Vector> stores one
+time stamp per sample for all of them rather than one per signal.
+
 @bug Only linear interpolation implemented so far.
 @bug There should be an option for the measure to specify a sampling interval
 that would force the integrator to provide interpolated states at least that
 often.
-@bug The current implementation involves a lot of unnecessary copying because
-it uses an auto-update state variable and cache entry. It should be using
-an end-of-step event handler to update the buffer directly in the state.
 
 @see Measure_::Integrate, Measure_::Differentiate **/
 template <class T>
@@ -1738,6 +1738,19 @@ private:
 // Empty = n==0
 // Full = n==capacity()
 // Next available = (oldest+n)%capacity()
+//
+// Entry times are strictly increasing, so they are searched by bisection.
+//
+// Every change to a buffer's contents gives it a new contents id, and a
+// buffer filled by copyInAndUpdate() remembers the id of the buffer it was
+// filled from. Because the auto-update discrete variable swaps its two
+// buffers after each step, the buffer being filled usually still has exactly
+// the contents its source was made from; then only the few entries that
+// differ need to be changed rather than copying the whole history.
+
+// Return a contents id that has never been returned before; never zero.
+SimTK_SimTKCOMMON_EXPORT long long makeMeasureDelayBufferContentsId();
+
 template <class T>
 class Measure_Delay_Buffer {
 public:
@@ -1763,17 +1776,8 @@ public:
     // Add a new entry to the end of the list, throwing out old entries that
     // aren't needed to answer requests at tEarliest or later.
     void append(double tEarliest, double tNow, const T& valueNow) {
-        forgetEntriesMuchOlderThan(tEarliest);
-        removeEntriesLaterOrEq(tNow);
-        if (full()) 
-            makeMoreRoom();
-        else if (capacity() > std::max((int)MaxShrinkProofSize, 
-                                       (int)TooBigFactor * (size()+1)))
-            makeLessRoom(); // less than 1/TooBigFactor full
-        const int nextFree = getArrayIndex(m_size++);
-        m_times[nextFree] = tNow;
-        m_values[nextFree] = valueNow;
-        m_maxSize = std::max(m_maxSize, size());
+        appendEntry(tEarliest, tNow, valueNow);
+        setNewContentsId(0);
     }
 
     // Prepend an older entry to the beginning of the list. No cleanup is done.
@@ -1785,6 +1789,7 @@ public:
         m_values[m_oldest] = value;
         ++m_size;
         m_maxSize = std::max(m_maxSize, size());
+        setNewContentsId(0);
     }
 
     // This is a specialized copy assignment for copying an old buffer
@@ -1792,53 +1797,15 @@ public:
     // be asked about from now on, and won't copy any entries older than those
     // needed to answer that earliest request. We won't copy anything at or
     // newer than tNow, and finally we'll push (tNow,valueNow) as the newest
-    // entry.
+    // entry. If this buffer still holds the contents oldBuf was made from,
+    // we just bring it up to date instead of copying.
     void copyInAndUpdate(const Measure_Delay_Buffer& oldBuf, double tEarliest,
                          double tNow, const T& valueNow) {
-        // clear all current entries (no heap activity)
-        m_oldest = m_size = 0;
-
-        // determine how may old entries we have to keep
-        int firstNeeded = oldBuf.countNumUnneededOldEntries(tEarliest);
-        int lastNeeded  = oldBuf.findLastEarlier(tNow); // might be -1
-        int numOldEntriesToKeep = lastNeeded-firstNeeded+1;
-        int newSize = numOldEntriesToKeep+1; // includes the new one
-
-        int newSizeRequest = -1;
-        if (capacity() < newSize) {
-            newSizeRequest = std::max((int)InitialAllocation, 
-                                      (int)GrowthFactor * newSize);
-            ++m_nGrows;
-        } else if (capacity() > std::max((int)MaxShrinkProofSize, 
-                                         (int)TooBigFactor * newSize)) {
-            newSizeRequest = std::max((int)MaxShrinkProofSize, 
-                                      (int)GrowthFactor * newSize);
-            ++m_nShrinks;
-        }
-
-        // Reallocate space if advisable.
-        if (newSizeRequest != -1) {
-            const double dNaN = NTraits<double>::getNaN();
-            m_values.resize(newSizeRequest); 
-            if (m_values.capacity() > m_values.size())
-                m_values.resize(m_values.capacity()); // don't waste any     
-            m_times.resize(m_values.size(), dNaN); 
-        }
-
-        m_maxCapacity = std::max(m_maxCapacity, capacity());
-        
-        // Copy the entries we need to keep.
-        int nxt = 0;
-        for (int i=firstNeeded; i<=lastNeeded; ++i, ++nxt) {
-            m_times[nxt]  = oldBuf.getEntryTime(i);
-            m_values[nxt] = oldBuf.getEntryValue(i);
-        }
-        // Now add the newest entry and set the size.
-        m_times[nxt]  = tNow;
-        m_values[nxt] = valueNow;
-        assert(nxt+1==newSize);
-        m_size = nxt+1;
-        m_maxSize = std::max(m_maxSize, size());
+        if (!(   &oldBuf != this && m_contentsId == oldBuf.m_parentId
+              && catchUpTo(oldBuf)))
+            copyNeededEntries(oldBuf, tEarliest, tNow);
+        appendEntry(tEarliest, tNow, valueNow);
+        setNewContentsId(oldBuf.m_contentsId);
     }
 
     // Given the current time and value and the earlier time at which the
@@ -1906,6 +1873,102 @@ public:
     int getMaxCapacity() const {return m_maxCapacity;}
 
 private:
+    // Add a new entry to the end of the list after throwing out old entries
+    // as described for append(), but leave the contents id alone.
+    void appendEntry(double tEarliest, double tNow, const T& valueNow) {
+        forgetEntriesMuchOlderThan(tEarliest);
+        removeEntriesLaterOrEq(tNow);
+        if (full()) 
+            makeMoreRoom();
+        else if (capacity() > std::max((int)MaxShrinkProofSize, 
+                                       (int)TooBigFactor * (size()+1)))
+            makeLessRoom(); // less than 1/TooBigFactor full
+        const int nextFree = getArrayIndex(m_size++);
+        m_times[nextFree] = tNow;
+        m_values[nextFree] = valueNow;
+        m_maxSize = std::max(m_maxSize, size());
+    }
+
+    // We hold the contents oldBuf was made from, so oldBuf's entries other 
+    // than its newest one are a contiguous run of ours. Drop the entries
+    // before and after that run and append oldBuf's newest entry, leaving
+    // us with the same contents as oldBuf. Returns false without changing
+    // anything if the contents don't match up that way.
+    bool catchUpTo(const Measure_Delay_Buffer& oldBuf) {
+        if (oldBuf.empty()) return false;
+        const int n = oldBuf.size()-1; // entries we must already have
+        int first = 0;
+        if (n) {
+            first = findFirstLaterOrEq(oldBuf.getEntryTime(0));
+            if (   first < 0 || first+n > size()
+                || getEntryTime(first) != oldBuf.getEntryTime(0)
+                || getEntryTime(first+n-1) != oldBuf.getEntryTime(n-1))
+                return false;
+        }
+        m_oldest = n ? getArrayIndex(first) : 0;
+        m_size = n;
+        if (full()) makeMoreRoom();
+        const int nextFree = getArrayIndex(m_size++);
+        m_times[nextFree] = oldBuf.getEntryTime(n);
+        m_values[nextFree] = oldBuf.getEntryValue(n);
+        m_maxSize = std::max(m_maxSize, size());
+        return true;
+    }
+
+    // Replace our contents with the entries of oldBuf that would survive
+    // appending an entry at tNow with earliest request time tEarliest, and
+    // make sure there is room for that entry.
+    void copyNeededEntries(const Measure_Delay_Buffer& oldBuf, 
+                           double tEarliest, double tNow) {
+        // clear all current entries (no heap activity)
+        m_oldest = m_size = 0;
+
+        // determine how may old entries we have to keep
+        int firstNeeded = oldBuf.countNumUnneededOldEntries(tEarliest);
+        int lastNeeded  = oldBuf.findLastEarlier(tNow); // might be -1
+        int numOldEntriesToKeep = lastNeeded-firstNeeded+1;
+        int newSize = numOldEntriesToKeep+1; // includes the new one
+
+        int newSizeRequest = -1;
+        if (capacity() < newSize) {
+            newSizeRequest = std::max((int)InitialAllocation, 
+                                      (int)GrowthFactor * newSize);
+            ++m_nGrows;
+        } else if (capacity() > std::max((int)MaxShrinkProofSize, 
+                                         (int)TooBigFactor * newSize)) {
+            newSizeRequest = std::max((int)MaxShrinkProofSize, 
+                                      (int)GrowthFactor * newSize);
+            ++m_nShrinks;
+        }
+
+        // Reallocate space if advisable.
+        if (newSizeRequest != -1) {
+            const double dNaN = NTraits<double>::getNaN();
+            m_values.resize(newSizeRequest); 
+            if (m_values.capacity() > m_values.size())
+                m_values.resize(m_values.capacity()); // don't waste any     
+            m_times.resize(m_values.size(), dNaN); 
+        }
+
+        m_maxCapacity = std::max(m_maxCapacity, capacity());
+        
+        // Copy the entries we need to keep.
+        int nxt = 0;
+        for (int i=firstNeeded; i<=lastNeeded; ++i, ++nxt) {
+            m_times[nxt]  = oldBuf.getEntryTime(i);
+            m_values[nxt] = oldBuf.getEntryValue(i);
+        }
+        assert(nxt+1==newSize);
+        m_size = nxt;
+    }
+
+    // Record that our contents have changed; parentId is the contents id of
+    // the buffer they were derived from by copyInAndUpdate(), or 0.
+    void setNewContentsId(long long parentId) {
+        m_contentsId = makeMeasureDelayBufferContentsId();
+        m_parentId = parentId;
+    }
+
     // Return the i'th oldest entry 
     // (0 -> oldest, size-1 -> newest, size -> first free, -1 -> last free)
     int getArrayIndex(int i) const 
@@ -1942,19 +2005,28 @@ private:
     // Return the entry number (0..size-1) of the first entry whose time 
     // is >= the given time, or -1 if there is none such.
     int findFirstLaterOrEq(double tDelay) const {
-        for (int i=0; i < size(); ++i)
-            if (getEntryTime(i) >= tDelay)
-                return i;
-        return -1;
+        const int i = countEntriesEarlier(tDelay);
+        return i == size() ? -1 : i;
     }
 
     // Return the entry number(size-1..0) of the last entry whose time 
     // is < the given time, or -1 if there is none such.
     int findLastEarlier(double t) const {
-        for (int i=size()-1; i>=0; --i)
-            if (getEntryTime(i) < t)
-                return i;
-        return -1;
+        return countEntriesEarlier(t) - 1;
+    }
+
+    // Return the number of entries whose time is < t by bisection. Times at
+    // or beyond the newest entry are the common case when appending so are
+    // checked first.
+    int countEntriesEarlier(double t) const {
+        if (empty() || getEntryTime(size()-1) < t) return size();
+        int lo = 0, hi = size()-1; // answer is in [lo,hi]
+        while (lo < hi) {
+            const int mid = (lo+hi)/2;
+            if (getEntryTime(mid) < t) lo = mid+1;
+            else hi = mid;
+        }
+        return lo;
     }
 
     // We don't have enough space. This is either the initial allocation or
@@ -2007,6 +2079,7 @@ private:
         m_times.clear(); m_values.clear();
         m_oldest=m_size=0;
         m_nGrows=m_nShrinks=m_maxSize=m_maxCapacity=0;
+        setNewContentsId(0);
     }
 
     // These are circular buffers of the same size.
@@ -2015,6 +2088,11 @@ private:
     int                 m_oldest; // Array index of oldest (time,value)
     int                 m_size;   // number of entries in use
 
+    // Identifies our contents, and those of the buffer they were derived 
+    // from by copyInAndUpdate() (0 if none).
+    long long           m_contentsId;
+    long long           m_parentId;
+
     // Statistics.
     int m_nGrows, m_nShrinks, m_maxSize, m_maxCapacity;
 };
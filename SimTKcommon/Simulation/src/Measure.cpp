@@ -34,6 +34,7 @@
 
 #include <cassert>
 #include <algorithm>
+#include <atomic>
 
 #if defined(__clang__)
     #if __has_warning("-Winstantiation-after-specialization")
@@ -45,6 +46,11 @@
 
 namespace SimTK {
 
+long long makeMeasureDelayBufferContentsId() {
+    static std::atomic<long long> lastId(0);
+    return ++lastId;
+}
+
 // These are here just to make sure they compile.
 template class Measure_<Real>::Constant;
 template class Measure_<Real>::Zero;
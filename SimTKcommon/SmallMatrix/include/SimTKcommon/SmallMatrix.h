@@ -95,6 +95,8 @@
 #include "SimTKcommon/internal/Mat.h"
 #include "SimTKcommon/internal/SymMat.h"
 #include "SimTKcommon/internal/SmallMatrixMixed.h"
+#include "SimTKcommon/internal/SmallMatrixSIMD.h"
+#include "SimTKcommon/internal/SmallMatrixBatch.h"
 
 // Friendly abbreviations.
 namespace SimTK {
@@ -0,0 +1,217 @@
+#ifndef SimTK_SIMMATRIX_SMALLMATRIX_BATCH_H_
+#define SimTK_SIMMATRIX_SMALLMATRIX_BATCH_H_
+
+/* -------------------------------------------------------------------------- *
+ *                       Simbody(tm): SimTKcommon                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/**@file
+ * This file provides LDL' factorization, solve, and inverse kernels for
+ * small (typically 1x1 to 6x6) symmetric positive definite matrices whose
+ * size is known at compile time, both for a single Mat and for a batch of
+ * many matrices of the same size processed together.
+ *
+ * A batch of \a n MxM matrices is stored "structure of arrays" style:
+ * element (i,j) of matrix k is at <tt>a[(i+j*M)*n + k]</tt>. The innermost
+ * loop of every kernel runs over the batch with unit stride and no branches,
+ * so the compiler can vectorize across matrices even though each matrix is
+ * too small to vectorize on its own. With n==1 the layout is the same as
+ * that of a packed Mat<M,M>, which is how the single-matrix versions are
+ * implemented.
+ *
+ * The factorization is unpivoted; it is intended for matrices like mass
+ * matrices that are known to be positive definite, and uses only the lower
+ * triangle. No square roots are needed, unlike Cholesky.
+ */
+
+#include "SimTKcommon/internal/common.h"
+
+#include <type_traits>
+
+namespace SimTK {
+
+namespace SmallMatrixBatch {
+
+/// Return true if the \a k'th factorization in a batch of \a n produced by
+/// factorLDLT() has all positive pivots, that is, the original matrix was
+/// numerically positive definite.
+template <int M, class P> inline bool
+isPositiveDefinite(int n, const P* ldl, int k) {
+    for (int p=0; p < M; ++p)
+        if (!(ldl[(p+p*M)*n + k] > 0)) return false;
+    return true;
+}
+
+/// Replace the lower triangle of each of the \a n MxM symmetric matrices in
+/// \a a by its LDL' factorization, with D on the diagonal and the strictly
+/// lower part of the unit lower triangular L below it. The strict upper
+/// triangle is neither used nor changed. Returns the number of matrices
+/// that were not numerically positive definite; for those, some diagonal
+/// element of the result is not positive (or is NaN) and the rest of that
+/// factorization is garbage. The others are unaffected.
+template <int M, class P> inline int
+factorLDLT(int n, P* a) {
+    static_assert(std::is_floating_point<P>::value,
+        "SmallMatrixBatch::factorLDLT(): element type must be float or double");
+    for (int j=0; j < M; ++j) {
+        P* ajj = a + (j+j*M)*n;
+        for (int p=0; p < j; ++p) {
+            const P* ajp = a + (j+p*M)*n;
+            const P* app = a + (p+p*M)*n;
+            for (int k=0; k < n; ++k)
+                ajj[k] -= ajp[k]*ajp[k]*app[k];
+        }
+        for (int i=j+1; i < M; ++i) {
+            P* aij = a + (i+j*M)*n;
+            for (int p=0; p < j; ++p) {
+                const P* aip = a + (i+p*M)*n;
+                const P* ajp = a + (j+p*M)*n;
+                const P* app = a + (p+p*M)*n;
+                for (int k=0; k < n; ++k)
+                    aij[k] -= aip[k]*ajp[k]*app[k];
+            }
+            for (int k=0; k < n; ++k)
+                aij[k] /= ajj[k];
+        }
+    }
+    int nBad = 0;
+    for (int k=0; k < n; ++k)
+        nBad += !isPositiveDefinite<M>(n, a, k);
+    return nBad;
+}
+
+/// Given \a n LDL' factorizations from factorLDLT(), overwrite each of the
+/// \a n length-M right hand sides in \a b with the solution x of A x = b.
+/// Element i of vector k is at <tt>b[i*n + k]</tt>.
+template <int M, class P> inline void
+solveLDLT(int n, const P* ldl, P* b) {
+    for (int i=1; i < M; ++i)       // L y = b
+        for (int p=0; p < i; ++p) {
+            const P* lip = ldl + (i+p*M)*n;
+            const P* bp  = b + p*n;
+            P*       bi  = b + i*n;
+            for (int k=0; k < n; ++k)
+                bi[k] -= lip[k]*bp[k];
+        }
+    for (int i=0; i < M; ++i) {     // z = D^-1 y
+        const P* dii = ldl + (i+i*M)*n;
+        P*       bi  = b + i*n;
+        for (int k=0; k < n; ++k)
+            bi[k] /= dii[k];
+    }
+    for (int i=M-2; i >= 0; --i)    // L' x = z
+        for (int p=i+1; p < M; ++p) {
+            const P* lpi = ldl + (p+i*M)*n;
+            const P* bp  = b + p*n;
+            P*       bi  = b + i*n;
+            for (int k=0; k < n; ++k)
+                bi[k] -= lpi[k]*bp[k];
+        }
+}
+
+/// Given \a n LDL' factorizations from factorLDLT(), write the full inverse
+/// of each original matrix into \a ainv, which uses the same layout and must
+/// not overlap \a ldl. The results are exactly symmetric.
+///
+/// A^-1 = ~Z D^-1 Z where Z = L^-1 is unit lower triangular, so its (i,j)
+/// element for i >= j is Y(i,j) + sum(p>i) Z(p,i) Y(p,j), with Y = D^-1 Z.
+/// We build Z in the strict lower triangle of \a ainv, D^-1 on its diagonal
+/// and Y in its strict upper triangle (transposed), then overwrite the lower
+/// triangle with the result column by column; nothing is overwritten before
+/// its last use. Only M divides are needed per matrix.
+template <int M, class P> inline void
+invertLDLT(int n, const P* ldl, P* ainv) {
+    for (int j=0; j < M; ++j) {
+        P*       rjj = ainv + (j+j*M)*n;
+        const P* djj = ldl  + (j+j*M)*n;
+        for (int k=0; k < n; ++k)
+            rjj[k] = 1/djj[k];
+        for (int i=j+1; i < M; ++i) {
+            P*       zij = ainv + (i+j*M)*n;
+            const P* lij = ldl  + (i+j*M)*n;
+            for (int k=0; k < n; ++k)
+                zij[k] = -lij[k];
+            for (int p=j+1; p < i; ++p) {
+                const P* lip = ldl  + (i+p*M)*n;
+                const P* zpj = ainv + (p+j*M)*n;
+                for (int k=0; k < n; ++k)
+                    zij[k] -= lip[k]*zpj[k];
+            }
+        }
+    }
+
+    for (int j=0; j < M; ++j)
+        for (int p=j+1; p < M; ++p) {
+            P*       yjp = ainv + (j+p*M)*n; // Y(p,j)
+            const P* zpj = ainv + (p+j*M)*n;
+            const P* rpp = ainv + (p+p*M)*n;
+            for (int k=0; k < n; ++k)
+                yjp[k] = zpj[k]*rpp[k];
+        }
+
+    for (int j=0; j < M; ++j)
+        for (int i=j; i < M; ++i) {
+            P*       xij = ainv + (i+j*M)*n;
+            if (i != j) { // replace Z(i,j) with Y(i,j)
+                const P* yji = ainv + (j+i*M)*n;
+                for (int k=0; k < n; ++k)
+                    xij[k] = yji[k];
+            }
+            for (int p=i+1; p < M; ++p) {
+                const P* zpi = ainv + (p+i*M)*n;
+                const P* yjp = ainv + (j+p*M)*n;
+                for (int k=0; k < n; ++k)
+                    xij[k] += zpi[k]*yjp[k];
+            }
+        }
+
+    for (int j=1; j < M; ++j)
+        for (int i=0; i < j; ++i) {
+            P*       xij = ainv + (i+j*M)*n;
+            const P* xji = ainv + (j+i*M)*n;
+            for (int k=0; k < n; ++k)
+                xij[k] = xji[k];
+        }
+}
+
+} // namespace SmallMatrixBatch
+
+
+/// Inverse of a small, fixed-size, symmetric positive definite matrix with
+/// real elements, using an unpivoted LDL' factorization of its lower
+/// triangle. This is cheaper than inverse() for sizes above 3x3, which uses
+/// Lapack's general LU, and the result is exactly symmetric. Throws an
+/// exception if the matrix is not numerically positive definite.
+/// @see SmallMatrixBatch::factorLDLT() to invert many matrices at once.
+template <int M, class P, int CS, int RS> inline
+Mat<M,M,P> ldltInverse(const Mat<M,M,P,CS,RS>& m) {
+    Mat<M,M,P> ldl = m, inv;
+    const int nBad = SmallMatrixBatch::factorLDLT<M>(1, &ldl(0,0));
+    SimTK_ERRCHK_ALWAYS(nBad==0, "ldltInverse(Mat<>)",
+        "Matrix is not positive definite so can't be inverted this way.");
+    SmallMatrixBatch::invertLDLT<M>(1, &ldl(0,0), &inv(0,0));
+    return inv;
+}
+
+} // namespace SimTK
+
+#endif // SimTK_SIMMATRIX_SMALLMATRIX_BATCH_H_
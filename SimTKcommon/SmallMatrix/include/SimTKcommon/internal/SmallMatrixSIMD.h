@@ -0,0 +1,135 @@
+#ifndef SimTK_SIMMATRIX_SMALLMATRIX_SIMD_H_
+#define SimTK_SIMMATRIX_SMALLMATRIX_SIMD_H_
+
+/* -------------------------------------------------------------------------- *
+ *                       Simbody(tm): SimTKcommon                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/**@file
+ * This file provides hand-vectorized overloads of the 3x3 double precision
+ * Mat*Vec and Mat*Mat products, which dominate Rotation and inertia
+ * arithmetic in the multibody sweeps and are too small for compilers to
+ * vectorize on their own. They are selected at compile time when SSE2 is
+ * available (always on x86-64) unless SimTK_NO_SIMD is defined; otherwise
+ * the generic templates are used.
+ *
+ * Each result element is accumulated in exactly the same order as in the
+ * generic code, ((a0*b0 + a1*b1) + a2*b2), so results are bitwise identical
+ * whether or not these kernels are used. That would not hold if the compiler
+ * were allowed to contract the generic code into fused multiply-adds.
+ *
+ * The kernels apply to packed matrices (Mat33) and their transposes, which
+ * covers Rotation and InverseRotation; any other storage layout falls back
+ * to scalar code.
+ */
+
+#include "SimTKcommon/internal/common.h"
+
+#if !defined(SimTK_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) \
+                                || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define SimTK_SIMD_SMALLMATRIX 1
+    #include <emmintrin.h>
+#else
+    #define SimTK_SIMD_SMALLMATRIX 0
+#endif
+
+namespace SimTK {
+
+#if SimTK_SIMD_SMALLMATRIX
+
+namespace SmallMatrixSIMD {
+
+// r = A*v where A is a packed 3x3 matrix (columns at a, a+3, a+6). Each
+// column is scaled by one element of v and the columns are summed.
+inline void multPacked33(const double* a, double v0, double v1, double v2,
+                         double* r) {
+    const __m128d s0 = _mm_set1_pd(v0), s1 = _mm_set1_pd(v1),
+                  s2 = _mm_set1_pd(v2);
+    __m128d r01 = _mm_mul_pd(_mm_loadu_pd(a), s0);
+    r01 = _mm_add_pd(r01, _mm_mul_pd(_mm_loadu_pd(a+3), s1));
+    r01 = _mm_add_pd(r01, _mm_mul_pd(_mm_loadu_pd(a+6), s2));
+    __m128d r2 = _mm_mul_sd(_mm_load_sd(a+2), s0);
+    r2 = _mm_add_sd(r2, _mm_mul_sd(_mm_load_sd(a+5), s1));
+    r2 = _mm_add_sd(r2, _mm_mul_sd(_mm_load_sd(a+8), s2));
+    _mm_storeu_pd(r, r01);
+    _mm_store_sd(r+2, r2);
+}
+
+// r = A*v where A is the transpose of a packed 3x3 matrix, so that its rows
+// are contiguous at a, a+3, a+6. Rows 0 and 1 are done together as dot
+// products; the pair of partial products is transposed so the first two
+// terms of each can be added in one instruction.
+inline void multTransposed33(const double* a, double v0, double v1, double v2,
+                             double* r) {
+    const __m128d v01 = _mm_set_pd(v1, v0), s2 = _mm_set1_pd(v2);
+    const __m128d p0 = _mm_mul_pd(_mm_loadu_pd(a),   v01); // a0v0 a1v1
+    const __m128d p1 = _mm_mul_pd(_mm_loadu_pd(a+3), v01); // a3v0 a4v1
+    __m128d r01 = _mm_add_pd(_mm_unpacklo_pd(p0,p1), _mm_unpackhi_pd(p0,p1));
+    r01 = _mm_add_pd(r01, _mm_mul_pd(_mm_set_pd(a[5], a[2]), s2));
+    const __m128d p2 = _mm_mul_pd(_mm_loadu_pd(a+6), v01);
+    __m128d r2 = _mm_add_sd(p2, _mm_unpackhi_pd(p2,p2));
+    r2 = _mm_add_sd(r2, _mm_mul_sd(_mm_load_sd(a+8), s2));
+    _mm_storeu_pd(r, r01);
+    _mm_store_sd(r+2, r2);
+}
+
+// r = A*v for a 3x3 matrix in any layout.
+template <int CS, int RS> inline void
+mult33(const Mat<3,3,double,CS,RS>& m, double v0, double v1, double v2,
+       double* r) {
+    if (CS==3 && RS==1)
+        multPacked33(&m(0,0), v0, v1, v2, r);
+    else if (CS==1 && RS==3)
+        multTransposed33(&m(0,0), v0, v1, v2, r);
+    else
+        for (int i=0; i<3; ++i)
+            r[i] = m(i,0)*v0 + m(i,1)*v1 + m(i,2)*v2;
+}
+
+} // namespace SmallMatrixSIMD
+
+// vec3 = mat33 * vec3
+template <int CS, int RS, int S> inline
+typename Mat<3,3,double,CS,RS>::template Result<Vec<3,double,S> >::Mul
+operator*(const Mat<3,3,double,CS,RS>& m, const Vec<3,double,S>& v) {
+    typename Mat<3,3,double,CS,RS>::template Result<Vec<3,double,S> >::Mul
+        result;
+    SmallMatrixSIMD::mult33(m, v[0], v[1], v[2], &result[0]);
+    return result;
+}
+
+// mat33 = mat33 * mat33, one column at a time.
+template <int CSL, int RSL, int CSR, int RSR> inline
+typename Mat<3,3,double,CSL,RSL>::template Result<Mat<3,3,double,CSR,RSR> >::Mul
+operator*(const Mat<3,3,double,CSL,RSL>& l, const Mat<3,3,double,CSR,RSR>& r) {
+    typename Mat<3,3,double,CSL,RSL>::template
+        Result<Mat<3,3,double,CSR,RSR> >::Mul result;
+    for (int j=0; j<3; ++j)
+        SmallMatrixSIMD::mult33(l, r(0,j), r(1,j), r(2,j), &result(0,j));
+    return result;
+}
+
+#endif // SimTK_SIMD_SMALLMATRIX
+
+} // namespace SimTK
+
+#endif // SimTK_SIMMATRIX_SMALLMATRIX_SIMD_H_
@@ -52,6 +52,7 @@
 #include "SimTKcommon/internal/Fortran.h"
 #include "SimTKcommon/internal/Array.h"
 #include "SimTKcommon/internal/StableArray.h"
+#include "SimTKcommon/internal/SmallArray.h"
 #include "SimTKcommon/internal/Value.h"
 #include "SimTKcommon/internal/Stage.h"
 #include "SimTKcommon/internal/CoordinateAxis.h"
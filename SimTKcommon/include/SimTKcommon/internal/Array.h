@@ -3411,6 +3411,10 @@ std::istream& readArrayFromStreamHelper
         // if any; istream is good; might be looking at white space.
         assert(in.good());
 
+        // Without brackets, trailing white space is all we might have left;
+        // that's the end of the sequence rather than a missing element.
+        if (!lookForCloser) {std::ws(in); if (!in.good()) break;}
+
         // Now read in an element of type T.
         // The extractor T::operator>>() will ignore leading white space.
         if (!isFixedSize)
@@ -3426,10 +3430,12 @@ std::istream& readArrayFromStreamHelper
     //  - we reached eof
     //  - we saw a closing brace
     //  - we got all the elements we wanted (for a fixed-size read)
-    // Note that it is possible that we consumed everything except some
-    // trailing white space (meaning we're not technically at eof), but
-    // for consistency with built-in operator>>()'s we won't try to absorb
-    // that trailing white space.
+    // If the sequence was bracketed or of fixed size, anything following the
+    // last element, including white space, is left in the stream for
+    // consistency with built-in operator>>()'s. Without brackets a 
+    // variable-size sequence only ends at eof, so we absorbed any trailing
+    // white space when looking for another element rather than mistake it
+    // for a missing one.
 
     if (!in.fail()) {
         if (lookForCloser && !terminatorSeen)
@@ -3654,6 +3660,33 @@ template <class T, class X> inline
 std::istream& operator>>(std::istream& in, ArrayView_<T,X>& out) 
 {   return fillArrayViewFromStream<T,X>(in, out); }
 
+/** @cond **/ // Hide from Doxygen.
+// Converting a String to an owner Array_ of numbers uses the fast 
+// String::tryConvertToNumbers() when it can, since that is much quicker for
+// long arrays such as mesh data read from XML element values. Anything it 
+// doesn't understand goes through the generic stream-based conversion, 
+// selected here by the explicit template argument.
+template <class T, class X> inline bool
+tryConvertStringToNumberArray(const String& value, Array_<T,X>& out) {
+    std::vector<T> elements;
+    if (out.isOwner() && value.tryConvertToNumbers(elements)) {
+        out.assign(elements.begin(), elements.end());
+        return true;
+    }
+    return tryConvertStringTo< Array_<T,X> >(value, out);
+}
+
+template <class X> inline bool
+tryConvertStringTo(const String& value, Array_<int,X>& out)
+{   return tryConvertStringToNumberArray(value, out); }
+template <class X> inline bool
+tryConvertStringTo(const String& value, Array_<float,X>& out)
+{   return tryConvertStringToNumberArray(value, out); }
+template <class X> inline bool
+tryConvertStringTo(const String& value, Array_<double,X>& out)
+{   return tryConvertStringToNumberArray(value, out); }
+/** @endcond **/
+
 /*@}                       End of Array serialization. **/
 
 
@@ -0,0 +1,282 @@
+#ifndef SimTK_SimTKCOMMON_SMALLARRAY_H_
+#define SimTK_SimTKCOMMON_SMALLARRAY_H_
+
+/* -------------------------------------------------------------------------- *
+ *                       Simbody(tm): SimTKcommon                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "SimTKcommon/internal/common.h"
+#include "SimTKcommon/internal/Array.h"
+
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace SimTK {
+
+/** A variable-size array that holds up to \a N elements inside the object
+itself and uses the heap only when it grows beyond that. This is meant for
+the many short temporary arrays created while computing, such as the handful
+of constrained bodies or mobilities of a Constraint, where the heap
+allocation for an ordinary Array_ would cost more than the work done with it.
+
+A %SmallArray_ is an ArrayView_ of its own elements, so it can be passed
+without copying wherever an ArrayViewConst_, an ArrayView_ or a
+<tt>const Array_&</tt> is expected, and it may be indexed by the same index
+type \a X. It provides the most commonly used resizing operations of Array_
+itself (push_back(), resize(), reserve(), clear() and so on) with the same
+semantics.
+
+A writable <tt>Array_&</tt> obtained by implicit conversion may always be
+used to change element values. It may be used to change the size only if
+the %SmallArray_ is empty or its elements are already on the heap; while
+they are in the inline buffer the Array_ sees a non-owner, and resizing it
+is an error just as for any other ArrayView_.
+
+@tparam T   The element type.
+@tparam N   The number of elements that can be stored without heap
+            allocation; must be at least 1.
+@tparam X   The index type, as for Array_.
+@see Array_ **/
+template <class T, int N, class X=unsigned>
+class SmallArray_ : public ArrayView_<T,X> {
+    typedef ArrayViewConst_<T,X>    CBase;
+    typedef ArrayView_<T,X>         Base;
+public:
+typedef typename Base::size_type        size_type;
+typedef typename Base::value_type       value_type;
+typedef typename Base::iterator         iterator;
+typedef typename Base::const_iterator   const_iterator;
+
+using Base::size;
+using Base::empty;
+using Base::begin;
+using Base::end;
+
+/** The number of elements that fit in the inline buffer. **/
+static const int InlineCapacity = N;
+
+/** Default constructor allocates no heap space and is very fast. **/
+SmallArray_() : Base() {}
+
+/** Construct an array of \a n default-constructed elements. **/
+explicit SmallArray_(size_type n) : Base() {resize(n);}
+
+/** Construct an array of \a n copies of \a value. **/
+SmallArray_(size_type n, const T& value) : Base() {resize(n, value);}
+
+/** Construct from a list of values. **/
+SmallArray_(std::initializer_list<T> ilist) : Base()
+{   assign(ilist.begin(), ilist.end()); }
+
+/** Copy constructor copies the elements. **/
+SmallArray_(const SmallArray_& src) : Base()
+{   assign(src.cbegin(), src.cend()); }
+
+/** Move constructor takes over the source's heap space if it has any;
+otherwise the inline elements are moved one by one. **/
+SmallArray_(SmallArray_&& src) : Base() {takeContentsOf(src);}
+
+/** Construct a copy of the elements of any array. **/
+template <class T2, class X2>
+explicit SmallArray_(const ArrayViewConst_<T2,X2>& src) : Base()
+{   assign(src.cbegin(), src.cend()); }
+
+/** Destroy the elements and free the heap space, if any. **/
+~SmallArray_() {clear(); freeHeap();}
+
+/** Copy assignment replaces the contents with copies of the source's. **/
+SmallArray_& operator=(const SmallArray_& src) {
+    if (&src != this) assign(src.cbegin(), src.cend());
+    return *this;
+}
+
+/** Move assignment. **/
+SmallArray_& operator=(SmallArray_&& src) {
+    if (&src != this) {clear(); freeHeap(); takeContentsOf(src);}
+    return *this;
+}
+
+/** Replace the contents with copies of those of any array; unlike
+ArrayView_ assignment the sizes need not match. **/
+template <class T2, class X2>
+SmallArray_& operator=(const ArrayViewConst_<T2,X2>& src)
+{   assign(src.cbegin(), src.cend()); return *this; }
+
+/** Replace the contents with copies of the elements in [first,last1). **/
+template <class Iter>
+void assign(Iter first, const Iter& last1) {
+    clear();
+    reserve(size_type(std::distance(first, last1)));
+    for (; first != last1; ++first)
+        new(end()) T(*first), this->incrSize();
+}
+
+/** Return the number of elements that can be held without reallocating. **/
+size_type capacity() const
+{   return isInline() ? size_type(N) : this->allocated(); }
+
+/** Return true if the elements are in the inline buffer (or there are
+none), false if they are on the heap. **/
+bool isInline() const
+{   return !this->cdata() || this->cdata() == inlineData(); }
+
+/** Make sure there is room for at least \a n elements. **/
+void reserve(size_type n) {
+    if (n > capacity()) reallocate(n);
+    else if (n && !this->cdata()) this->setData(updInlineData());
+}
+
+/** Change the size, default-constructing new elements or destroying
+excess ones. **/
+void resize(size_type n) {
+    if (n < size()) {shrinkTo(n); return;}
+    reserve(n);
+    while (size() < n) new(end()) T(), this->incrSize();
+}
+
+/** Change the size, copy-constructing new elements from \a value. **/
+void resize(size_type n, const T& value) {
+    if (n < size()) {shrinkTo(n); return;}
+    reserve(n);
+    while (size() < n) new(end()) T(value), this->incrSize();
+}
+
+/** Destroy all the elements; capacity is unchanged. **/
+void clear() {shrinkTo(0);}
+
+/** Append a copy of \a value. **/
+void push_back(const T& value) {
+    if (size() == capacity()) {
+        T tmp(value); // value may refer to one of our elements
+        reallocate(calcGrowth());
+        new(end()) T(std::move(tmp));
+    } else {
+        reserve(size()+1);
+        new(end()) T(value);
+    }
+    this->incrSize();
+}
+
+/** Append \a value, moving from it. **/
+void push_back(T&& value) {
+    if (size() == capacity()) {
+        T tmp(std::move(value));
+        reallocate(calcGrowth());
+        new(end()) T(std::move(tmp));
+    } else {
+        reserve(size()+1);
+        new(end()) T(std::move(value));
+    }
+    this->incrSize();
+}
+
+/** Append an element constructed in place from the given arguments. **/
+template <class... Args>
+void emplace_back(Args&&... args) {
+    if (size() == capacity()) reallocate(calcGrowth());
+    else reserve(size()+1);
+    new(end()) T(std::forward<Args>(args)...);
+    this->incrSize();
+}
+
+/** Remove the last element. **/
+void pop_back() {
+    SimTK_ERRCHK(!empty(), "SmallArray_<T>::pop_back()",
+        "Can't pop_back() from an empty Array.");
+    shrinkTo(size()-1);
+}
+
+private:
+const T* inlineData() const
+{   return reinterpret_cast<const T*>(&m_buffer[0]); }
+T* updInlineData() {return reinterpret_cast<T*>(&m_buffer[0]);}
+
+// Destroy elements [n,size()). An empty inline array goes back to null data.
+void shrinkTo(size_type n) {
+    while (size() > n) {this->decrSize(); end()->~T();}
+    if (n == 0 && isInline()) this->setData(0);
+}
+
+size_type calcGrowth() const {
+    SimTK_ERRCHK1_ALWAYS(capacity() < this->max_size(),
+        "SmallArray_<T>::push_back()",
+        "Can't grow this Array beyond its max_size of %llu.",
+        (unsigned long long)this->max_size());
+    return capacity() <= this->max_size()/2 ? 2*capacity()
+                                            : this->max_size();
+}
+
+// Move the elements to heap space for n > capacity() elements. This uses
+// the same allocation as Array_ so that an Array_& conversion of a
+// heap-based SmallArray_ can safely reallocate it.
+void reallocate(size_type n) {
+    T* newData = reinterpret_cast<T*>(new unsigned char[n*sizeof(T)]);
+    T* p = newData;
+    for (T* q = begin(); q != end(); ++q, ++p) {
+        new(p) T(std::move(*q));
+        q->~T();
+    }
+    freeHeap();
+    this->setData(newData);
+    this->setAllocated(n);
+}
+
+// Free heap space without destructing; the elements must already be gone
+// or moved out. Afterwards the array is back to using the inline buffer.
+// An empty array has null data so that it is an owner in Array_'s eyes;
+// nonempty inline data has zero allocation so that it is a non-owner.
+void freeHeap() {
+    if (!isInline())
+        delete[] reinterpret_cast<unsigned char*>(begin());
+    this->setData(0);
+    this->setAllocated(0);
+}
+
+void takeContentsOf(SmallArray_& src) {
+    if (src.isInline()) {
+        reserve(src.size());
+        for (T* q = src.begin(); q != src.end(); ++q) {
+            new(end()) T(std::move(*q));
+            this->incrSize();
+        }
+        src.clear();
+    } else {
+        this->setData(src.begin());
+        this->setSize(src.size());
+        this->setAllocated(src.allocated());
+        src.setSize(0);
+        src.setData(0);
+        src.setAllocated(0);
+    }
+}
+
+typename std::aligned_storage<sizeof(T), alignof(T)>::type m_buffer[N];
+
+static_assert(N >= 1, "SmallArray_ must have an inline capacity of at "
+                      "least one element.");
+};
+
+} // namespace SimTK
+
+#endif // SimTK_SimTKCOMMON_SMALLARRAY_H_
@@ -32,6 +32,7 @@
 #include <limits>
 #include <complex>
 #include <sstream>
+#include <vector>
 
 // Keeps MS VC++ quiet about sprintf, strcpy, etc.
 #ifdef _MSC_VER
@@ -261,6 +262,21 @@ NaN, [-]Inf, [-]Infinity (in any case) as well as whatever operator>>() accepts.
 Returns false if the contents of this %String, ignoring leading and trailing
 whitespace, can't be interpreted as a double. **/
 SimTK_SimTKCOMMON_EXPORT bool tryConvertToDouble(double& out) const;
+
+/** Special-purpose method for interpreting this %String as a sequence of
+numbers, with the same result you would get by reading an Array_ of them 
+using operator>>(), but much faster for long sequences. Only plain decimal 
+numbers separated consistently by white space or by commas, and optionally 
+enclosed in () or [], are recognized. Returns false if the contents of this 
+%String are in any other format, even one that operator>>() would accept; 
+\a out is unspecified in that case. You normally don't call this directly; 
+converting a %String to an Array_ or Vector_ of int, float, or double uses 
+it and falls back to the general stream-based conversion if it fails. **/
+SimTK_SimTKCOMMON_EXPORT bool tryConvertToNumbers(std::vector<int>& out) const;
+/** Same as tryConvertToNumbers(std::vector<int>&) but for floats. **/
+SimTK_SimTKCOMMON_EXPORT bool tryConvertToNumbers(std::vector<float>& out) const;
+/** Same as tryConvertToNumbers(std::vector<int>&) but for doubles. **/
+SimTK_SimTKCOMMON_EXPORT bool tryConvertToNumbers(std::vector<double>& out) const;
 /*@}*/
 
 /** @name In-place modifications
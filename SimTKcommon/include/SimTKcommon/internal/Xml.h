@@ -1161,7 +1161,10 @@ void setValueAs(const T& value)
 /** Assuming this is a "value element", convert its text value to the type
 of the template argument T. It is an error if the text can not be converted,
 in its entirety, to a single object of type T. (But note that type T may
-be a container of some sort, like a Vector or Array.) 
+be a container of some sort, like a Vector or Array.) Array_ values of int,
+float, or double, and Vector_ and Vec values of float or double, are 
+converted without going through a stream when they are in the usual format;
+see String::tryConvertToNumbers().
 @tparam T   A type that can be read from a stream using the ">>" operator.
 **/
 template <class T> T getValueAs() const 
@@ -1593,6 +1596,146 @@ explicit Unknown(TiXmlUnknown* tiUnknown)
 :   Node(reinterpret_cast<TiXmlNode*>(tiUnknown)) {}
 };
 
+
+
+//------------------------------------------------------------------------------
+//                            XML :: STREAM READER
+//------------------------------------------------------------------------------
+/** This is a "pull" parser that reads an XML document as a sequence of events
+(element start and end tags, text, comments, and unknowns) without ever 
+building the in-memory tree that Xml::Document does. Use this for large 
+documents, such as mesh files, that you only need to look through once; it is
+much faster and uses little memory beyond a copy of the document text.
+
+Each call to next() advances to the next event and returns its type; then
+you can ask for the tag word and attributes of an element, or the text of a
+text, comment, or unknown node. Those are only valid until the next call to
+next(). An empty-element tag like "<tag/>" produces a StartElement event 
+followed immediately by an EndElement event. Here is how you might read all 
+the "<vertex>" value elements in a file:
+@code
+    Xml::StreamReader reader("mesh.xml");
+    Vector_<Vec3> vertices; 
+    while (reader.next() != Xml::StreamReader::EndDocument)
+        if (reader.getEvent() == Xml::StreamReader::StartElement
+            && reader.getTag() == "vertex")
+            vertices.pushBack(reader.readElementValueAs<Vec3>());
+@endcode
+
+Text is presented as it would be in an Xml::Document: character escapes are
+replaced, "<![CDATA[...]]>" sections are presented as text, text nodes that 
+consist only of white space are skipped, and white space is condensed if
+Document::isXmlWhiteSpaceCondensed() says so. However, numeric character 
+references like "&#x263A;" always produce UTF-8, and unrecognized escapes like
+"&nbsp;" are left as they are. Unlike Xml::Document, we don't canonicalize the
+document, so document-level text and elements are presented as they are 
+found. The declaration "<?xml ... ?>" is skipped. An exception is
+thrown if the document is not well formed, for example if an end tag doesn't
+match its start tag; events preceding the error will already have been 
+delivered. **/
+class SimTK_SimTKCOMMON_EXPORT StreamReader {
+public:
+/** These are the kinds of events that next() can return. **/
+enum Event {
+    NoEvent,        ///< Nothing read yet
+    StartElement,   ///< Start tag or empty-element tag; see getTag()
+    EndElement,     ///< End tag, or end of an empty-element tag
+    TextEvent,      ///< Text or CDATA; see getText()
+    CommentEvent,   ///< Comment; getText() is between "<!--" and "-->"
+    UnknownEvent,   ///< Unknown tag; getText() is between "<" and ">"
+    EndDocument     ///< No more events
+};
+
+/** Create a reader with nothing to read; next() will return EndDocument. **/
+StreamReader();
+/** Create a reader for the given file. An exception will be thrown if the
+file can't be read. @see readFromFile() **/
+explicit StreamReader(const String& pathname);
+/** The destructor cleans up all heap space used by this reader. **/
+~StreamReader();
+
+/** Prepare to read the file whose pathname is supplied; its entire contents
+are read into memory now and parsed as you call next(). This replaces 
+anything this reader was reading before. **/
+void readFromFile(const String& pathname);
+/** Prepare to read a document contained in a string; a copy of the string is
+made. This replaces anything this reader was reading before. **/
+void readFromString(const String& xmlDocument);
+/** Alternate form that reads from a null-terminated C string (char*) 
+rather than a C++ string object. **/
+void readFromString(const char* xmlDocument);
+
+/** Advance to the next event and return its type. Once EndDocument has been
+returned, it will be returned by every subsequent call. **/
+Event next();
+/** Return the type of the event most recently returned by next(). **/
+Event getEvent() const;
+/** Return the number of elements whose start tags have been seen but not
+their end tags, counting the current element if this is a StartElement
+event but not if it is an EndElement event. **/
+int getDepth() const;
+
+/** Return the tag word of the current StartElement or EndElement event. **/
+const String& getTag() const;
+/** Return the number of attributes in the current StartElement's tag. **/
+int getNumAttributes() const;
+/** Return the name of the i'th attribute of the current StartElement. **/
+const String& getAttributeName(int i) const;
+/** Return the value of the i'th attribute of the current StartElement, with
+character escapes replaced. **/
+const String& getAttributeValue(int i) const;
+/** Return true if the current StartElement has an attribute of this 
+name. **/
+bool hasAttribute(const String& name) const;
+/** Return the value of the current StartElement's attribute of this name, 
+throwing an error if there isn't one. If the name occurs more than once we
+use the last one, as Xml::Document does. **/
+const String& getRequiredAttributeValue(const String& name) const;
+/** Return the value of the current StartElement's attribute of this name, or
+\a def if there isn't one. **/
+String getOptionalAttributeValue(const String& name, 
+                                 const String& def=String()) const;
+/** Convert the value of the current StartElement's required attribute of 
+this name to type T. @see getRequiredAttributeValue() **/
+template <class T> T getRequiredAttributeValueAs(const String& name) const
+{   T out; convertStringTo(getRequiredAttributeValue(name),out); return out; }
+
+/** Return the text of the current TextEvent, CommentEvent, or 
+UnknownEvent. **/
+const String& getText() const;
+
+/** If the current event is a StartElement, read up to and including the 
+matching EndElement and return the text contained in that element, as
+Element::getValue() would. An error is thrown if the element contains child
+elements or more than one text node, that is, if it is not a value element.
+Afterwards the current event is the EndElement. **/
+const String& readElementValue();
+/** Like readElementValue() but converts the value to type T; see
+Element::getValueAs(). **/
+template <class T> T readElementValueAs()
+{   T out; convertStringTo(readElementValue(),out); return out; }
+/** Alternate form of readElementValueAs() that avoids unnecessary copying 
+and heap allocation for reading in large container objects. **/
+template <class T> void readElementValueAs(T& out)
+{   convertStringTo(readElementValue(),out); }
+
+/** If the current event is a StartElement, skip everything up to and
+including the matching EndElement, which becomes the current event. 
+Otherwise do nothing. **/
+void skipElement();
+
+//------------------------------------------------------------------------------
+                                  private:
+StreamReader(const StreamReader&) = delete;
+StreamReader& operator=(const StreamReader&) = delete;
+
+class Impl; // a private, local class StreamReader::Impl
+const Impl& getImpl() const {assert(impl); return *impl;}
+Impl&       updImpl()       {assert(impl); return *impl;}
+
+Impl*       impl; // This is the lone data member.
+};
+
 } // end of namespace Xml
 
 
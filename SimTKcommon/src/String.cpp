@@ -34,6 +34,10 @@
 
 #include <string>
 #include <cctype>
+#include <cerrno>
+#include <climits>
+#include <clocale>
+#include <cstdlib>
 
 using SimTK::String;
 
@@ -102,6 +106,100 @@ bool String::tryConvertToDouble(double& out) const {
     return !sstream.fail();
 }
 
+// These are used by tryConvertToNumbers() below. Each parse() reads a number
+// starting at s, which must not be white space, and sets s to the first 
+// character after it. It returns false unless the number was plain decimal 
+// and in range, since otherwise strtod() and operator>>() might disagree 
+// about it ("inf", "0x1p3", overflow).
+static bool isPlainNumber(const char* begin, const char* end) {
+    if (end == begin) return false;
+    for (const char* p=begin; p != end; ++p) {
+        const char c = *p;
+        if (!(('0' <= c && c <= '9') || c=='.' || c=='-' || c=='+' 
+              || c=='e' || c=='E')) return false;
+    }
+    return true;
+}
+
+static bool parse(const char*& s, double& out) {
+    char* end; errno = 0;
+    out = std::strtod(s, &end);
+    if (errno || !isPlainNumber(s, end)) return false;
+    s = end; return true;
+}
+
+static bool parse(const char*& s, float& out) {
+    char* end; errno = 0;
+    out = std::strtof(s, &end);
+    if (errno || !isPlainNumber(s, end)) return false;
+    s = end; return true;
+}
+
+static bool parse(const char*& s, int& out) {
+    char* end; errno = 0;
+    const long value = std::strtol(s, &end, 10);
+    if (errno || value < INT_MIN || value > INT_MAX || !isPlainNumber(s, end))
+        return false;
+    out = (int)value;
+    s = end; return true;
+}
+
+static bool isWhite(char c) 
+{   return c==' ' || c=='\t' || c=='\n' || c=='\r' || c=='\v' || c=='\f'; }
+
+static const char* skipWhite(const char* p)
+{   while (isWhite(*p)) ++p; return p; }
+
+// This follows the rules of readArrayFromStream() and readVectorFromStream()
+// but gives up on anything unusual, leaving that to them.
+template <class T> static bool 
+tryConvertToNumbersHelper(const String& in, std::vector<T>& out) {
+    // strtod() etc. use the C locale but operator>>() uses the C++ one; 
+    // the latter is classic unless someone changed it, so we just need to
+    // make sure the C locale wasn't changed in a way that matters.
+    if (*std::localeconv()->decimal_point != '.') return false;
+
+    out.clear();
+    const char* const end = in.c_str() + in.size();
+    const char* p = skipWhite(in.c_str());
+
+    char closeBracket = 0; // i.e., end of string
+    if      (*p == '(') closeBracket = ')';
+    else if (*p == '[') closeBracket = ']';
+    if (closeBracket) p = skipWhite(p+1);
+
+    // The first separator decides whether commas are required.
+    bool commaRequired = false;
+    while (*p && *p != closeBracket) {
+        if (*p == ',') {
+            if (out.size() == 1) commaRequired = true;
+            if (!commaRequired) return false;
+            p = skipWhite(p+1);
+        } else if (commaRequired) 
+            return false;
+
+        T value;
+        if (!parse(p, value)) return false;
+        if (*p && *p != ',' && *p != closeBracket && !isWhite(*p)) 
+            return false;
+        out.push_back(value);
+        p = skipWhite(p);
+    }
+
+    if (closeBracket) {
+        if (*p != closeBracket) return false;
+        p = skipWhite(p+1);
+    }
+    return p == end;
+}
+
+bool String::tryConvertToNumbers(std::vector<int>& out) const
+{   return tryConvertToNumbersHelper(*this, out); }
+bool String::tryConvertToNumbers(std::vector<float>& out) const
+{   return tryConvertToNumbersHelper(*this, out); }
+bool String::tryConvertToNumbers(std::vector<double>& out) const
+{   return tryConvertToNumbersHelper(*this, out); }
+
 
 
 String& String::toUpper() {
@@ -28,6 +28,11 @@
 
 #include "tinyxml.h"
 
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
 using namespace SimTK;
 
 // Handy helper for weeding out unwanted nodes.
@@ -1072,3 +1077,389 @@ Xml::Unknown Xml::Unknown::clone() const {
         node.getNodeTypeAsString().c_str());
     return reinterpret_cast<Unknown&>(node); }
 
+
+
+
+//------------------------------------------------------------------------------
+//                        XML :: STREAM READER :: IMPL
+//------------------------------------------------------------------------------
+// This follows the parsing rules in tinyxmlparser.cpp closely enough that the 
+// events correspond to the nodes TinyXML would have created, but it reuses 
+// its Strings from one event to the next rather than allocating nodes.
+class Xml::StreamReader::Impl {
+public:
+    Impl() {String empty; setDocument(empty);}
+
+    // The document text is taken from doc, leaving it empty.
+    void setDocument(String& doc) {
+        m_doc.swap(doc);
+        doc.clear();
+        m_p = m_doc.c_str();
+        m_event = NoEvent;
+        m_emptyElement = false;
+        m_depth = 0;
+        m_numAttributes = 0;
+    }
+
+    Event next() {
+        if (m_event == EndDocument) return m_event;
+        m_numAttributes = 0;
+
+        // The end of an empty-element tag "<tag/>" is an event of its own.
+        if (m_emptyElement) {
+            m_emptyElement = false;
+            --m_depth;
+            return m_event = EndElement;
+        }
+
+        while (true) {
+            const char* const textStart = m_p;
+            const char* q = skipWhite(m_p);
+            if (!*q) {
+                checkSyntax(m_depth==0, q, "Missing end tag for <%s>",
+                            m_depth ? m_openTags[m_depth-1].c_str() : "");
+                m_p = q;
+                return m_event = EndDocument;
+            }
+            if (*q != '<') {
+                // White space is kept only if it is not being condensed.
+                if (readText(Document::isXmlWhiteSpaceCondensed() 
+                             ? q : textStart))
+                    return m_event = TextEvent;
+                continue; // skip blank text
+            }
+            if (q[1] == '/')
+                return m_event = readEndTag(q);
+            if (std::strncmp(q, "<!--", 4) == 0) {
+                readUpTo(q+4, "-->", q, "Unterminated comment");
+                return m_event = CommentEvent;
+            }
+            if (std::strncmp(q, "<![CDATA[", 9) == 0) {
+                readUpTo(q+9, "]]>", q, "Unterminated CDATA section");
+                return m_event = TextEvent;
+            }
+            if (isDeclaration(q)) {
+                const char* gt = std::strchr(q, '>');
+                checkSyntax(gt != 0, q, "Unterminated declaration");
+                m_p = gt+1;
+                continue; // skip declarations
+            }
+            if (isNameStart(q[1]))
+                return m_event = readStartTag(q);
+            readUpTo(q+1, ">", q, "Unterminated tag");
+            return m_event = UnknownEvent;
+        }
+    }
+
+    Event getEvent() const {return m_event;}
+    int getDepth() const {return m_depth;}
+    const String& getTag() const {return m_tag;}
+    const String& getText() const {return m_text;}
+    int getNumAttributes() const {return m_numAttributes;}
+    const String& getAttributeName(int i) const {return m_attrNames[i];}
+    const String& getAttributeValue(int i) const {return m_attrValues[i];}
+
+    // Duplicate attributes are resolved as TinyXML does; the last one wins.
+    const String* findAttributeValue(const String& name) const {
+        for (int i=m_numAttributes-1; i >= 0; --i)
+            if (m_attrNames[i] == name) return &m_attrValues[i];
+        return 0;
+    }
+
+    const String& readElementValue() {
+        SimTK_ERRCHK_ALWAYS(m_event==StartElement, 
+            "Xml::StreamReader::readElementValue()",
+            "The current event was not a StartElement.");
+        m_value.clear();
+        const int depth = m_depth;
+        int numText = 0;
+        while (next() != EndElement) {
+            SimTK_ERRCHK1_ALWAYS(m_event != StartElement && 
+                                 (m_event != TextEvent || ++numText == 1),
+                "Xml::StreamReader::readElementValue()",
+                "Element <%s> is not a value element.", 
+                m_openTags[depth-1].c_str());
+            if (m_event == TextEvent) m_value.swap(m_text);
+        }
+        return m_value;
+    }
+
+    void skipElement() {
+        if (m_event != StartElement) return;
+        const int depth = m_depth;
+        while (!(next() == EndElement && m_depth == depth-1)) {}
+    }
+
+private:
+    static bool isWhite(char c) 
+    {   return c==' ' || c=='\t' || c=='\n' || c=='\r' || c=='\v' || c=='\f'; }
+    static const char* skipWhite(const char* p)
+    {   while (isWhite(*p)) ++p; return p; }
+    // Bytes above 127 are taken to be parts of UTF-8 letters.
+    static bool isNameStart(char c)
+    {   return std::isalpha((unsigned char)c) || c=='_' || (c & 0x80); }
+    static bool isNameChar(char c)
+    {   return std::isalnum((unsigned char)c) || c=='_' || c=='-' || c=='.' 
+            || c==':' || (c & 0x80); }
+    static const char* skipName(const char* p)
+    {   while (isNameChar(*p)) ++p; return p; }
+
+    // The "<?xml" must be matched without regard to case.
+    static bool isDeclaration(const char* p) {
+        const char* decl = "<?xml";
+        for (; *decl; ++p, ++decl)
+            if (std::tolower((unsigned char)*p) != *decl) return false;
+        return true;
+    }
+
+    // Append to out the character at p, or the character represented by
+    // the escape sequence beginning there, and return the following 
+    // position. An '&' that doesn't begin a recognized escape is taken
+    // literally.
+    static const char* readChar(const char* p, String& out) {
+        if (*p != '&') {out += *p; return p+1;}
+
+        if (p[1] == '#') {
+            const bool isHex = (p[2] == 'x');
+            const char* q = p + (isHex ? 3 : 2);
+            unsigned long code = 0; int ndigits = 0;
+            for (; ndigits < 8; ++q, ++ndigits) {
+                const int c = (unsigned char)*q;
+                if (std::isdigit(c)) code = code*(isHex?16:10) + (c-'0');
+                else if (isHex && std::isxdigit(c))
+                    code = code*16 + (std::tolower(c)-'a'+10);
+                else break;
+            }
+            if (ndigits && *q == ';') {appendUTF8(code, out); return q+1;}
+        }
+
+        static const struct {const char* str; int len; char c;} escapes[] = 
+        {   {"&amp;",5,'&'}, {"&lt;",4,'<'}, {"&gt;",4,'>'}, 
+            {"&quot;",6,'"'}, {"&apos;",6,'\''}   };
+        for (const auto& e : escapes)
+            if (std::strncmp(p, e.str, e.len) == 0) {out += e.c; return p+e.len;}
+
+        out += '&'; return p+1;
+    }
+
+    static void appendUTF8(unsigned long code, String& out) {
+        if (code < 0x80) {out += (char)code; return;}
+        if (code < 0x800) {
+            out += (char)(0xC0 | (code>>6));
+        } else {
+            if (code < 0x10000) out += (char)(0xE0 | (code>>12));
+            else { 
+                out += (char)(0xF0 | ((code>>18) & 0x07));
+                out += (char)(0x80 | ((code>>12) & 0x3F));
+            }
+            out += (char)(0x80 | ((code>>6) & 0x3F));
+        }
+        out += (char)(0x80 | (code & 0x3F));
+    }
+
+    // Read text starting at p up to the next '<' into m_text, condensing
+    // white space if requested. Return false if the text was blank.
+    bool readText(const char* p) {
+        m_text.clear();
+        bool isBlank = true;
+        if (Document::isXmlWhiteSpaceCondensed()) {
+            bool sawWhite = false;
+            while (*p && *p != '<') {
+                if (isWhite(*p)) {sawWhite = true; ++p; continue;}
+                if (sawWhite) {m_text += ' '; sawWhite = false;}
+                if (*p == '&') {p = readChar(p, m_text); continue;}
+                const char* run = p; // copy ordinary characters in bulk
+                while (*p && *p != '<' && *p != '&' && !isWhite(*p)) ++p;
+                m_text.append(run, p);
+            }
+        } else {
+            while (*p && *p != '<') {
+                if (*p == '&') {p = readChar(p, m_text); continue;}
+                const char* run = p;
+                while (*p && *p != '<' && *p != '&') ++p;
+                m_text.append(run, p);
+            }
+        }
+        for (char c : m_text)
+            if (!isWhite(c)) {isBlank = false; break;}
+        m_p = p;
+        return !isBlank;
+    }
+
+    // Set m_text to everything from p up to the terminator, and position
+    // after the terminator.
+    void readUpTo(const char* p, const char* terminator, 
+                  const char* tagStart, const char* errorMessage) {
+        const char* end = std::strstr(p, terminator);
+        checkSyntax(end != 0, tagStart, "%s", errorMessage);
+        m_text.assign(p, end);
+        m_p = end + std::strlen(terminator);
+    }
+
+    Event readStartTag(const char* q) {
+        const char* p = skipName(q+1);
+        m_tag.assign(q+1, p);
+        while (true) {
+            p = skipWhite(p);
+            if (*p == '>') {++p; break;}
+            if (*p == '/') {
+                checkSyntax(p[1]=='>', p, "Expected '>' after '/' in <%s>",
+                            m_tag.c_str());
+                p += 2; m_emptyElement = true; break;
+            }
+            checkSyntax(isNameStart(*p), p, "Malformed start tag <%s>", 
+                        m_tag.c_str());
+            if (m_numAttributes == (int)m_attrNames.size()) {
+                m_attrNames.emplace_back(); m_attrValues.emplace_back();
+            }
+            String& name  = m_attrNames[m_numAttributes];
+            String& value = m_attrValues[m_numAttributes];
+            const char* nameEnd = skipName(p);
+            name.assign(p, nameEnd);
+            p = skipWhite(nameEnd);
+            checkSyntax(*p=='=', p, "Expected '=' after attribute %s in <%s>",
+                        name.c_str(), m_tag.c_str());
+            p = skipWhite(p+1);
+            value.clear();
+            if (*p=='"' || *p=='\'') {
+                // Quoted values are kept as-is apart from escapes.
+                const char quote = *p++;
+                while (*p && *p != quote) {
+                    if (*p == '&') {p = readChar(p, value); continue;}
+                    const char* run = p;
+                    while (*p && *p != quote && *p != '&') ++p;
+                    value.append(run, p);
+                }
+                checkSyntax(*p==quote, p, "Unterminated value for "
+                            "attribute %s in <%s>", name.c_str(), m_tag.c_str());
+                ++p;
+            } else {
+                // Missing quotes are forgiven, as in TinyXML.
+                while (*p && !isWhite(*p) && *p!='/' && *p!='>') 
+                    p = readChar(p, value);
+            }
+            ++m_numAttributes;
+        }
+
+        if (m_depth == (int)m_openTags.size()) m_openTags.emplace_back();
+        m_openTags[m_depth++] = m_tag;
+        m_p = p;
+        return StartElement;
+    }
+
+    Event readEndTag(const char* q) {
+        const char* p = skipName(q+2);
+        m_tag.assign(q+2, p);
+        p = skipWhite(p);
+        checkSyntax(*p=='>', q, "Malformed end tag </%s>", m_tag.c_str());
+        checkSyntax(m_depth > 0 && m_openTags[m_depth-1] == m_tag, q, 
+            "End tag </%s> doesn't match start tag <%s>", m_tag.c_str(), 
+            m_depth ? m_openTags[m_depth-1].c_str() : "");
+        --m_depth;
+        m_p = p+1;
+        return EndElement;
+    }
+
+    // Throw an exception with the message and its line number if the 
+    // condition is false. The message is formatted printf-style.
+    template <class... Args>
+    void checkSyntax(bool cond, const char* where, const char* fmt, 
+                     Args... args) const {
+        if (cond) return;
+        char message[512];
+        std::snprintf(message, sizeof(message), fmt, args...);
+        int line = 1;
+        for (const char* p = m_doc.c_str(); p != where; ++p)
+            if (*p == '\n') ++line;
+        SimTK_ERRCHK2_ALWAYS(false, "Xml::StreamReader::next()",
+            "%s at line %d.", message, line);
+    }
+
+    String              m_doc;      // the entire document
+    const char*         m_p;        // next character to parse in m_doc
+    Event               m_event;
+    bool                m_emptyElement; // current event is from "<tag/>"
+
+    // Elements with start tags but no end tags yet; only the first m_depth
+    // entries are meaningful. The rest are kept to reuse their memory.
+    std::vector<String> m_openTags;
+    int                 m_depth;
+
+    // Contents of the current event; again, kept for reuse.
+    String              m_tag, m_text, m_value;
+    std::vector<String> m_attrNames, m_attrValues;
+    int                 m_numAttributes;
+};
+
+
+
+//------------------------------------------------------------------------------
+//                           XML :: STREAM READER
+//------------------------------------------------------------------------------
+Xml::StreamReader::StreamReader() : impl(new Impl()) {}
+Xml::StreamReader::StreamReader(const String& pathname) : impl(new Impl()) 
+{   readFromFile(pathname); }
+Xml::StreamReader::~StreamReader() {delete impl;}
+
+void Xml::StreamReader::readFromFile(const String& pathname) {
+    std::ifstream in(pathname.c_str(), std::ios::in | std::ios::binary);
+    SimTK_ERRCHK1_ALWAYS(in.good(), "Xml::StreamReader::readFromFile()",
+        "Failed to open the Xml file '%s'.", pathname.c_str());
+    in.seekg(0, std::ios::end);
+    String contents;
+    contents.resize((size_t)in.tellg());
+    in.seekg(0, std::ios::beg);
+    in.read(&contents[0], contents.size());
+    SimTK_ERRCHK1_ALWAYS(!in.fail(), "Xml::StreamReader::readFromFile()",
+        "Failed to read the Xml file '%s'.", pathname.c_str());
+    updImpl().setDocument(contents);
+}
+void Xml::StreamReader::readFromString(const String& xmlDocument) 
+{   String copy(xmlDocument); updImpl().setDocument(copy); }
+void Xml::StreamReader::readFromString(const char* xmlDocument) 
+{   String copy(xmlDocument); updImpl().setDocument(copy); }
+
+Xml::StreamReader::Event Xml::StreamReader::next() 
+{   return updImpl().next(); }
+Xml::StreamReader::Event Xml::StreamReader::getEvent() const 
+{   return getImpl().getEvent(); }
+int Xml::StreamReader::getDepth() const 
+{   return getImpl().getDepth(); }
+
+const String& Xml::StreamReader::getTag() const 
+{   return getImpl().getTag(); }
+int Xml::StreamReader::getNumAttributes() const 
+{   return getImpl().getNumAttributes(); }
+const String& Xml::StreamReader::getAttributeName(int i) const {
+    SimTK_INDEXCHECK_ALWAYS(i, getNumAttributes(), 
+                            "Xml::StreamReader::getAttributeName()");
+    return getImpl().getAttributeName(i);
+}
+const String& Xml::StreamReader::getAttributeValue(int i) const {
+    SimTK_INDEXCHECK_ALWAYS(i, getNumAttributes(), 
+                            "Xml::StreamReader::getAttributeValue()");
+    return getImpl().getAttributeValue(i);
+}
+bool Xml::StreamReader::hasAttribute(const String& name) const 
+{   return getImpl().findAttributeValue(name) != 0; }
+const String& Xml::StreamReader::
+getRequiredAttributeValue(const String& name) const {
+    const String* value = getImpl().findAttributeValue(name);
+    SimTK_ERRCHK2_ALWAYS(value != 0, 
+        "Xml::StreamReader::getRequiredAttributeValue()",
+        "Couldn't find required attribute %s in element <%s>.",
+        name.c_str(), getTag().c_str());
+    return *value;
+}
+String Xml::StreamReader::
+getOptionalAttributeValue(const String& name, const String& def) const {
+    const String* value = getImpl().findAttributeValue(name);
+    return value ? *value : def;
+}
+
+const String& Xml::StreamReader::getText() const 
+{   return getImpl().getText(); }
+const String& Xml::StreamReader::readElementValue() 
+{   return updImpl().readElementValue(); }
+void Xml::StreamReader::skipElement() 
+{   updImpl().skipElement(); }
@@ -23,7 +23,12 @@
 
 #include "SimTKcommon.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #define ASSERT(cond) {SimTK_ASSERT_ALWAYS(cond, "Assertion failed");}
 
@@ -220,10 +225,180 @@ void testGaussian() {
     ASSERT(value2[2000] == 567.8)
 }
 
+void testStreams() {
+    const int N = 5000;
+    std::vector<Real> value(N), value2(N);
+
+    // Each stream is reproducible, and differs from the other streams and
+    // from the default generator with the same seed.
+
+    Random::Uniform rand;
+    rand.setStream(7, 0);
+    for (int i = 0; i < N; ++i)
+        value[i] = rand.getValue();
+    verifyUniformDistribution(0.0, 1.0, &value[0], 2000);
+    rand.setStream(7, 0);
+    rand.fillArray(&value2[0], N);
+    for (int i = 0; i < N; ++i)
+        ASSERT(value[i] == value2[i])
+    rand.setStream(7, 1);
+    rand.fillArray(&value2[0], N);
+    for (int i = 0; i < N; ++i)
+        ASSERT(value[i] != value2[i])
+    rand.setSeed(7);
+    rand.fillArray(&value2[0], N);
+    for (int i = 0; i < N; ++i)
+        ASSERT(value[i] != value2[i])
+
+    // Going back to the default generator gives its usual sequence.
+
+    Random::Uniform reference;
+    reference.setSeed(7);
+    for (int i = 0; i < N; ++i)
+        ASSERT(value2[i] == reference.getValue())
+
+    // Gaussian values come in pairs; filling arrays of odd lengths in 
+    // pieces gives the same values as one at a time.
+
+    Random::Gaussian gauss(2.0, 3.0);
+    gauss.setStream(7, 3);
+    for (int i = 0; i < N; ++i)
+        value[i] = gauss.getValue();
+    verifyGaussianDistribution(2.0, 3.0, &value[0], 2000);
+    gauss.setStream(7, 3);
+    for (int start = 0; start < N; start += 333)
+        gauss.fillArray(&value2[start], std::min(333, N-start));
+    for (int i = 0; i < N; ++i)
+        ASSERT(value[i] == value2[i])
+
+    // Streams generated concurrently are the same as when generated one
+    // after the other.
+
+    const int NStreams = 4;
+    std::vector<std::vector<Real>> serial(NStreams, std::vector<Real>(N)),
+                                   parallel(NStreams, std::vector<Real>(N));
+    for (int s = 0; s < NStreams; ++s) {
+        gauss.setStream(11, s);
+        gauss.fillArray(&serial[s][0], N);
+    }
+    std::vector<std::thread> threads;
+    for (int s = 0; s < NStreams; ++s)
+        threads.emplace_back([s, &parallel] {
+            Random::Gaussian noise(2.0, 3.0);
+            noise.setStream(11, s);
+            noise.fillArray(&parallel[s][0], N);
+        });
+    for (std::thread& thread : threads)
+        thread.join();
+    for (int s = 0; s < NStreams; ++s)
+        ASSERT(parallel[s] == serial[s])
+}
+
+// A plain one-block-at-a-time Philox4x32-10, used to check the streams
+// against the known-answer vectors published with Random123.
+void philoxReference(const uint32_t counter[4], const uint32_t key[2],
+                     uint32_t out[4]) {
+    uint32_t c[4] = {counter[0], counter[1], counter[2], counter[3]};
+    uint32_t k[2] = {key[0], key[1]};
+    for (int round = 0; round < 10; ++round) {
+        if (round > 0) {
+            k[0] += 0x9E3779B9;
+            k[1] += 0xBB67AE85;
+        }
+        const uint64_t p0 = (uint64_t)0xD2511F53 * c[0];
+        const uint64_t p1 = (uint64_t)0xCD9E8D57 * c[2];
+        const uint32_t next[4] = {(uint32_t)(p1 >> 32) ^ c[1] ^ k[0],
+                                  (uint32_t)p1,
+                                  (uint32_t)(p0 >> 32) ^ c[3] ^ k[1],
+                                  (uint32_t)p0};
+        for (int i = 0; i < 4; ++i)
+            c[i] = next[i];
+    }
+    for (int i = 0; i < 4; ++i)
+        out[i] = c[i];
+}
+
+// The value Uniform(0,1) returns for a 64 bit word of generator output.
+Real toUniform(uint32_t low, uint32_t high) {
+    return std::ldexp((Real)(low | ((uint64_t)high << 32)), -64);
+}
+
+void testPhiloxKnownAnswers() {
+    // Counter, key, and expected output from Random123's kat_vectors.
+    const uint32_t kat[3][10] = {
+        {0x00000000, 0x00000000, 0x00000000, 0x00000000,
+         0x00000000, 0x00000000,
+         0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8},
+        {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+         0xffffffff, 0xffffffff,
+         0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd},
+        {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344,
+         0xa4093822, 0x299f31d0,
+         0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}};
+    for (int v = 0; v < 3; ++v) {
+        uint32_t out[4];
+        philoxReference(&kat[v][0], &kat[v][4], out);
+        for (int i = 0; i < 4; ++i)
+            ASSERT(out[i] == kat[v][6+i])
+    }
+
+    // The stream with seed and stream 0 starts with counter 0 and key 0.
+
+    Random::Uniform rand;
+    rand.setStream(0, 0);
+    ASSERT(rand.getValue() == toUniform(0x6627e8d5, 0xe169c58d))
+    ASSERT(rand.getValue() == toUniform(0xbc57ac4c, 0x9b00dbd8))
+
+    // Other streams use (seed, stream) as the key and count blocks from 0,
+    // across several refills of the buffer.
+
+    const int NBlocks = 2000;
+    const int seeds[][2] = {{0, 0}, {7, 3}, {-1, -1}, {12345, 0x7fffffff}};
+    std::vector<Real> value(2*NBlocks);
+    for (const auto& s : seeds) {
+        rand.setStream(s[0], s[1]);
+        rand.fillArray(&value[0], 2*NBlocks);
+        const uint32_t key[2] = {(uint32_t)s[0], (uint32_t)s[1]};
+        for (int b = 0; b < NBlocks; ++b) {
+            const uint32_t counter[4] = {(uint32_t)b, 0, 0, 0};
+            uint32_t out[4];
+            philoxReference(counter, key, out);
+            ASSERT(value[2*b] == toUniform(out[0], out[1]))
+            ASSERT(value[2*b+1] == toUniform(out[2], out[3]))
+        }
+    }
+}
+
+// Report the rate at which values are generated.
+void timeFillArray() {
+    const int N = 1000000;
+    std::vector<Real> value(N);
+    Random::Uniform uniform;
+    Random::Gaussian gauss;
+    for (int counterBased = 0; counterBased < 2; ++counterBased) {
+        if (counterBased) {
+            uniform.setStream(1, 0);
+            gauss.setStream(1, 0);
+        }
+        double t0 = realTime();
+        uniform.fillArray(&value[0], N);
+        const double tUniform = realTime()-t0;
+        t0 = realTime();
+        gauss.fillArray(&value[0], N);
+        const double tGauss = realTime()-t0;
+        cout << (counterBased ? "Philox" : "SFMT") << ": uniform " 
+             << N/tUniform/1e6 << "M/s, Gaussian " << N/tGauss/1e6 << "M/s"
+             << endl;
+    }
+}
+
 int main() {
     try {
         testUniform();
         testGaussian();
+        testStreams();
+        testPhiloxKnownAnswers();
+        timeFillArray();
     } catch(const std::exception& e) {
         cout << "exception: " << e.what() << endl;
         return 1;
@@ -0,0 +1,187 @@
+/* -------------------------------------------------------------------------- *
+ *                       Simbody(tm): SimTKcommon                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "SimTKcommon.h"
+#include "SimTKcommon/Testing.h"
+
+#include <cstdint>
+#include <thread>
+
+using namespace SimTK;
+
+namespace {
+bool isAligned(const void* p)
+{   return reinterpret_cast<std::uintptr_t>(p) % MatrixAllocator::Alignment
+           == 0; }
+
+// Counts what passes through it on the way to the default allocator.
+class CountingAllocator : public MatrixAllocator {
+public:
+    CountingAllocator() : numAllocate(0), numDeallocate(0) {}
+    void* allocate(std::size_t n) override
+    {   ++numAllocate; return getDefault().allocate(n); }
+    void deallocate(void* p, std::size_t n) override
+    {   ++numDeallocate; getDefault().deallocate(p, n); }
+    static MatrixAllocator& getDefault() {
+        static MatrixAllocator* d = &MatrixAllocator::getAllocator();
+        return *d;
+    }
+    int numAllocate, numDeallocate;
+};
+}
+
+void testAlignmentAndPooling() {
+    for (int n=1; n < 5000; n = 3*n+1) {
+        Vector v(n, Real(1));
+        SimTK_TEST(isAligned(&v[0]));
+        Matrix m(n, 3, Real(2));
+        SimTK_TEST(isAligned(&m(0,0)));
+        Vector_<Vec3> v3(n, Vec3(1,2,3));
+        SimTK_TEST(isAligned(&v3[0]));
+        SimTK_TEST(v3[n-1] == Vec3(1,2,3));
+    }
+
+    // A freed block of the same size is reused.
+    Vector warm(100); warm.clear();
+    MatrixAllocator::resetStatistics();
+    for (int i=0; i < 10; ++i) {
+        Vector tmp(100, Real(i));
+        SimTK_TEST(tmp[99] == i);
+    }
+    const MatrixAllocator::Statistics stats = MatrixAllocator::getStatistics();
+    SimTK_TEST(stats.numAllocations == 10);
+    SimTK_TEST(stats.numDeallocations == 10);
+    SimTK_TEST(stats.numPoolHits == 10);
+}
+
+// Each thread counts its own allocations; the statistics include those of
+// threads that have since exited.
+void testStatisticsFromOtherThreads() {
+    MatrixAllocator::resetStatistics();
+    std::thread worker([] {
+        for (int i=0; i < 5; ++i) {
+            Vector tmp(100, Real(i));
+            SimTK_TEST(tmp[99] == i);
+        }
+    });
+    worker.join();
+    Vector here(100);
+    const MatrixAllocator::Statistics stats = MatrixAllocator::getStatistics();
+    SimTK_TEST(stats.numAllocations == 6);
+    SimTK_TEST(stats.numDeallocations == 5);
+}
+
+void testArena() {
+    MatrixAllocator::resetStatistics();
+    Vector survivor;
+    {
+        MatrixAllocator::ScopedArena arena(1024);
+        Vector a(10, Real(1)), b(500, Real(2)); // b needs its own chunk
+        SimTK_TEST(isAligned(&a[0]) && isAligned(&b[0]));
+        SimTK_TEST(arena.getNumBytesAllocated() > 510*sizeof(Real));
+        const std::size_t outerBytes = arena.getNumBytesAllocated();
+        {
+            MatrixAllocator::ScopedArena inner;
+            Vector c(3, Real(3));
+            SimTK_TEST(inner.getNumBytesAllocated() > 0);
+            SimTK_TEST(arena.getNumBytesAllocated() == outerBytes);
+        }
+        survivor = a + b(0,10);
+        SimTK_TEST(arena.getNumBytesAllocated() > outerBytes);
+    }
+    // Allocated in the arena but still valid after it ended.
+    SimTK_TEST(survivor.size() == 10 && survivor[9] == 3);
+    survivor.clear();
+
+    const long long numArena =
+        MatrixAllocator::getStatistics().numArenaAllocations;
+    SimTK_TEST(numArena >= 4);
+    Vector after(10);
+    SimTK_TEST(MatrixAllocator::getStatistics().numArenaAllocations
+               == numArena);
+}
+
+void testReplacementAllocator() {
+    CountingAllocator::getDefault();
+    CountingAllocator counter;
+    MatrixAllocator::setAllocator(&counter);
+    SimTK_TEST(&MatrixAllocator::getAllocator() == &counter);
+    {
+        Vector v(20, Real(1));
+        Matrix m(4, 4, Real(0));
+    }
+    Vector keep(7);
+    MatrixAllocator::setAllocator(0);
+    SimTK_TEST(&MatrixAllocator::getAllocator() != &counter);
+    SimTK_TEST(counter.numAllocate == 3);
+    SimTK_TEST(counter.numDeallocate == 2);
+    keep.clear(); // returned to the allocator it came from
+    SimTK_TEST(counter.numDeallocate == 3);
+}
+
+// Ownership of foreign memory can still be given to a Vector.
+void testForeignData() {
+    Vector v(4, Real(0));
+    Real* mine = new Real[4];
+    for (int i=0; i < 4; ++i) mine[i] = i;
+    v.replaceContiguousScalarData(mine, 4, true);
+    SimTK_TEST(v[3] == 3);
+    v.resize(6); // frees mine with delete[]
+    v = 1;
+    SimTK_TEST(v[5] == 1);
+
+    // Swapped data comes and goes as new[] data; the Vector's own block is
+    // copied out and freed.
+    Real* old;
+    Real* swapped = new Real[6];
+    for (int i=0; i < 6; ++i) swapped[i] = 2;
+    v.swapOwnedContiguousScalarData(swapped, 6, old);
+    SimTK_TEST(old != v.getContiguousScalarData() && old[5] == 1);
+    delete[] old;
+    SimTK_TEST(v.getContiguousScalarData() == swapped && v[5] == 2);
+
+    // Swapping new[] data out as a block copies it; swapping the block back
+    // in doesn't.
+    const Real* block = 
+        static_cast<Real*>(MatrixAllocator::allocateBlock(6*sizeof(Real)));
+    v.swapOwnedContiguousScalarBlock(const_cast<Real*>(block), 6, old);
+    SimTK_TEST(old != swapped && old[5] == 2);
+    Real* again;
+    v.swapOwnedContiguousScalarBlock(old, 6, again);
+    SimTK_TEST(again == block && v[5] == 2);
+    MatrixAllocator::deallocateBlock(again);
+
+    // Swapped in with new[], then freed by the Vector with delete[].
+    v.swapOwnedContiguousScalarData(new Real[6], 6, old);
+    delete[] old;
+}
+
+int main() {
+    SimTK_START_TEST("TestMatrixAllocator");
+        SimTK_SUBTEST(testAlignmentAndPooling);
+        SimTK_SUBTEST(testStatisticsFromOtherThreads);
+        SimTK_SUBTEST(testArena);
+        SimTK_SUBTEST(testReplacementAllocator);
+        SimTK_SUBTEST(testForeignData);
+    SimTK_END_TEST();
+}
@@ -0,0 +1,160 @@
+/* -------------------------------------------------------------------------- *
+ *                       Simbody(tm): SimTKcommon                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Tests the history buffer used by Measure_<T>::Delay. The buffer pair of an
+auto-update discrete variable is updated incrementally when possible; the
+results must always be the same as copying the whole history. */
+
+#include "SimTKcommon.h"
+#include "SimTKcommon/Testing.h"
+
+#include <iostream>
+#include <utility>
+
+using namespace SimTK;
+using std::cout;
+using std::endl;
+
+namespace {
+typedef Measure_Delay_Buffer<Real> Buffer;
+
+const Real Delay = .1;
+
+Real f(Real t) {return 3*t - 1;} // interpolates exactly
+
+bool isSame(const Buffer& a, const Buffer& b) {
+    if (a.size() != b.size()) return false;
+    for (int i=0; i < a.size(); ++i)
+        if (   a.getEntryTime(i) != b.getEntryTime(i)
+            || a.getEntryValue(i) != b.getEntryValue(i))
+            return false;
+    return true;
+}
+
+// The current value in the state and the update value in the cache, as for
+// an auto-update discrete variable.
+struct BufferPair {
+    BufferPair() {current.append(-Delay, 0, f(0));}
+
+    // Calculate the update and check it against a copy of everything.
+    void update(Real t) {
+        next.copyInAndUpdate(current, t-Delay, t, f(t));
+        Buffer reference;
+        reference.copyInAndUpdate(current, t-Delay, t, f(t));
+        SimTK_TEST(isSame(next, reference));
+    }
+    void commit() {std::swap(current, next);}
+
+    Buffer current, next;
+};
+}
+
+void testMatchesFullCopy() {
+    BufferPair bufs;
+    Random::Uniform random(.001, .03); random.setSeed(3);
+    Real t = 0;
+    for (int step=0; step < 500; ++step) {
+        const Real h = random.getValue();
+        if (step % 7 == 3) {
+            // A rejected step: update, then try again with a smaller one.
+            bufs.update(t+h);
+            bufs.update(t+h/2);
+            t += h/2;
+        } else if (step % 11 == 5) {
+            // Reset the same time; replaces the newest entry.
+            bufs.update(t);
+        } else {
+            t += h;
+            bufs.update(t);
+        }
+        bufs.commit();
+        SimTK_TEST(bufs.current.getEntryTime(bufs.current.size()-1) == t);
+
+        // Interpolation at the delayed time is exact for a linear function.
+        const Real tDelay = t - Delay;
+        Real value;
+        bufs.current.calcValueAtTimeLinearOnly(tDelay, value);
+        SimTK_TEST_EQ_TOL(value, f(std::max(tDelay, Real(0))), 1e-12);
+    }
+    // Only a couple of entries earlier than t-delay are kept.
+    SimTK_TEST(bufs.current.getEntryTime(0) < t-Delay);
+    SimTK_TEST(bufs.current.getEntryTime(2) >= t-Delay);
+}
+
+// Copies of a state (and its cache) continue independently.
+void testCopies() {
+    BufferPair bufs;
+    Real t = 0;
+    for (int step=0; step < 20; ++step) {
+        t += .01; bufs.update(t); bufs.commit();
+    }
+    bufs.update(t + .01); // cache holds an update not yet committed
+
+    BufferPair copy = bufs;
+    Real tCopy = t;
+    for (int step=0; step < 30; ++step) {
+        t += .01; bufs.update(t); bufs.commit();
+        tCopy += .007; copy.update(tCopy); copy.commit();
+    }
+    SimTK_TEST(bufs.current.getEntryTime(bufs.current.size()-1) == t);
+    SimTK_TEST(copy.current.getEntryTime(copy.current.size()-1) == tCopy);
+
+    // Starting over from a cleared buffer.
+    bufs.current.clear();
+    bufs.current.append(t-Delay, t, f(t));
+    bufs.update(t + .01);
+    bufs.commit();
+    SimTK_TEST(bufs.current.size() == 2);
+}
+
+// Report the time per step with a long history, updating the buffer pair
+// and always copying everything.
+void timeLongHistory() {
+    const int NSteps = 20000;
+    const Real h = Delay/2000;
+    double times[2];
+    for (int fresh=0; fresh < 2; ++fresh) {
+        Buffer current, next;
+        current.append(-Delay, 0, f(0));
+        const double t0 = cpuTime();
+        for (int step=1; step <= NSteps; ++step) {
+            const Real t = step*h;
+            if (fresh) next = Buffer();
+            next.copyInAndUpdate(current, t-Delay, t, f(t));
+            std::swap(current, next);
+        }
+        times[fresh] = cpuTime() - t0;
+        SimTK_TEST(current.size() >= 2000);
+    }
+    cout << "Delay buffer with 2000 entries: " << 1e6*times[0]/NSteps
+         << "us per step incremental, " << 1e6*times[1]/NSteps
+         << "us copying" << endl;
+}
+
+int main() {
+    SimTK_START_TEST("TestMeasureDelay");
+        SimTK_SUBTEST(testMatchesFullCopy);
+        SimTK_SUBTEST(testCopies);
+        SimTK_SUBTEST(timeLongHistory);
+    SimTK_END_TEST();
+}
@@ -0,0 +1,172 @@
+/* -------------------------------------------------------------------------- *
+ *                       Simbody(tm): SimTKcommon                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "SimTKcommon.h"
+#include "SimTKcommon/Testing.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+using std::cout;
+using std::endl;
+using namespace SimTK;
+
+// Count every heap allocation made by this program.
+static long long numHeapAllocations = 0;
+void* operator new(std::size_t n) {
+    ++numHeapAllocations;
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t n) {return operator new(n);}
+void operator delete(void* p) noexcept {std::free(p);}
+void operator delete[](void* p) noexcept {std::free(p);}
+void operator delete(void* p, std::size_t) noexcept {std::free(p);}
+void operator delete[](void* p, std::size_t) noexcept {std::free(p);}
+
+namespace {
+SimTK_DEFINE_UNIQUE_INDEX_TYPE(SmallIndex);
+
+Real sumOf(const Array_<Real>& a) {
+    Real s = 0;
+    for (unsigned i=0; i < a.size(); ++i) s += a[i];
+    return s;
+}
+void doubleIt(ArrayView_<Real> a) {for (auto& x : a) x *= 2;}
+}
+
+void testInline() {
+    const long long n0 = numHeapAllocations;
+    SmallArray_<Real,4> a;
+    SimTK_TEST(a.empty() && a.isInline() && a.capacity() == 4);
+    a.push_back(1); a.push_back(2); a.emplace_back(3);
+    SimTK_TEST(a.size() == 3 && a[2] == 3 && a.isInline());
+    SimTK_TEST(sumOf(a) == 6);   // as const Array_&
+    doubleIt(a);                 // as ArrayView_
+    SimTK_TEST(a[0] == 2 && a[2] == 6);
+    a.resize(4, Real(5));
+    SimTK_TEST(a.back() == 5 && a.isInline());
+    a.pop_back();
+    SimTK_TEST(a.size() == 3);
+
+    SmallArray_<Vec3,3,SmallIndex> b(3, Vec3(1,2,3));
+    SimTK_TEST(b[SmallIndex(2)] == Vec3(1,2,3));
+    SmallArray_<int,8> c{1,2,3};
+    SimTK_TEST(c.size() == 3 && c[1] == 2);
+    SimTK_TEST(numHeapAllocations == n0);
+}
+
+void testGrowth() {
+    SmallArray_<std::string,2> a;
+    a.push_back("one"); a.push_back("two");
+    SimTK_TEST(a.isInline());
+    a.push_back(a[0]); // aliases an element that is about to move
+    SimTK_TEST(!a.isInline() && a.capacity() >= 3);
+    SimTK_TEST(a[0] == "one" && a[1] == "two" && a[2] == "one");
+    for (int i=0; i < 20; ++i) a.push_back(String(i));
+    SimTK_TEST(a.size() == 23 && a[22] == "19");
+    a.clear();
+    SimTK_TEST(a.empty() && !a.isInline());
+
+    // A heap-based array can be grown through an Array_&.
+    SmallArray_<int,2> h(3, 7);
+    Array_<int>& ah = h;
+    ah.push_back(8);
+    SimTK_TEST(h.size() == 4 && h[3] == 8 && h.capacity() >= 4);
+
+    // So can an empty one, which then holds heap data.
+    SmallArray_<int,2> e;
+    Array_<int>& ae = e;
+    ae.push_back(1); ae.push_back(2); ae.push_back(3);
+    SimTK_TEST(e.size() == 3 && !e.isInline());
+
+    // But one whose elements are inline looks like a non-owner.
+    SmallArray_<int,4> i(2, 1);
+    const Array_<int>& ai = i;
+    SimTK_TEST(!ai.isOwner());
+}
+
+void testCopyAndMove() {
+    SmallArray_<std::string,2> in{"a","b"}, heap{"a","b","c"};
+    SmallArray_<std::string,2> c1(in), c2(heap);
+    SimTK_TEST(c1.isInline() && c1[1] == "b");
+    SimTK_TEST(!c2.isInline() && c2[2] == "c");
+
+    const std::string* heapData = &heap[0];
+    SmallArray_<std::string,2> m1(std::move(in)), m2(std::move(heap));
+    SimTK_TEST(in.empty() && heap.empty());
+    SimTK_TEST(m1.isInline() && m1[0] == "a");
+    SimTK_TEST(&m2[0] == heapData); // took over the heap space
+
+    m1 = m2;
+    SimTK_TEST(m1.size() == 3 && m1[2] == "c");
+    m2 = SmallArray_<std::string,2>{"x"};
+    SimTK_TEST(m2.size() == 1 && m2.isInline() && m2[0] == "x");
+
+    Array_<int> big(5, 3);
+    SmallArray_<int,8> fromArray(big);
+    SimTK_TEST(fromArray.size() == 5 && fromArray[4] == 3);
+    fromArray = Array_<int>(2, 1);
+    SimTK_TEST(fromArray.size() == 2);
+}
+
+// Report heap allocations for building a few short temporary arrays, as is
+// done for every constraint during each realization.
+void benchmark() {
+    const int Reps = 100000;
+    Real sum = 0;
+
+    long long n0 = numHeapAllocations;
+    double t0 = cpuTime();
+    for (int r=0; r < Reps; ++r) {
+        Array_<Transform> X(2); Array_<Real> q(3, Real(r));
+        sum += q[2] + X[1].p()[0];
+    }
+    const double tArray = cpuTime()-t0;
+    const long long nArray = numHeapAllocations - n0;
+
+    n0 = numHeapAllocations;
+    t0 = cpuTime();
+    for (int r=0; r < Reps; ++r) {
+        SmallArray_<Transform,4> X(2); SmallArray_<Real,8> q(3, Real(r));
+        sum += q[2] + X[1].p()[0];
+    }
+    const double tSmall = cpuTime()-t0;
+    const long long nSmall = numHeapAllocations - n0;
+
+    SimTK_TEST(nArray == 2*Reps && nSmall == 0);
+    cout << "Array_:      " << nArray << " allocations, " << tArray << "s\n"
+         << "SmallArray_: " << nSmall << " allocations, " << tSmall << "s"
+         << "  (checksum " << sum << ")" << endl;
+}
+
+int main() {
+    SimTK_START_TEST("TestSmallArray");
+        SimTK_SUBTEST(testInline);
+        SimTK_SUBTEST(testGrowth);
+        SimTK_SUBTEST(testCopyAndMove);
+        SimTK_SUBTEST(benchmark);
+    SimTK_END_TEST();
+}
@@ -0,0 +1,173 @@
+/* -------------------------------------------------------------------------- *
+ *                       Simbody(tm): SimTKcommon                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Checks the LDL' kernels in SmallMatrixBatch.h for all the sizes that occur
+as mobilizer mass matrices, against Lapack's general inverse, and times the
+batched inverse against inverting the matrices one at a time. */
+
+#include "SimTKcommon.h"
+#include "SimTKcommon/Testing.h"
+
+#include <iostream>
+
+using std::cout;
+using std::endl;
+using namespace SimTK;
+
+namespace {
+// A random, reasonably well conditioned symmetric positive definite matrix.
+template <int M> Mat<M,M> randSPD() {
+    const Mat<M,M> j = Test::randMat<M,M>();
+    return j*~j + Mat<M,M>(M);
+}
+
+// Copy matrix k into or out of a batch of n.
+template <int M> void
+store(const Mat<M,M>& m, int n, int k, Real* a) {
+    for (int j=0; j < M; ++j)
+        for (int i=0; i < M; ++i)
+            a[(i+j*M)*n + k] = m(i,j);
+}
+template <int M> Mat<M,M>
+load(int n, int k, const Real* a) {
+    Mat<M,M> m;
+    for (int j=0; j < M; ++j)
+        for (int i=0; i < M; ++i)
+            m(i,j) = a[(i+j*M)*n + k];
+    return m;
+}
+}
+
+template <int M> void testSingle() {
+    for (int trial=0; trial < 20; ++trial) {
+        const Mat<M,M> a = randSPD<M>();
+        const Mat<M,M> inv = ldltInverse(a);
+        SimTK_TEST_EQ(inv, lapackInverse(a));
+        SimTK_TEST(inv == ~inv); // exactly symmetric
+
+        // Only the lower triangle is used, and other layouts work.
+        Mat<M,M> lower(a);
+        for (int j=1; j < M; ++j)
+            for (int i=0; i < j; ++i)
+                lower(i,j) = NaN;
+        SimTK_TEST(ldltInverse(lower) == inv);
+        SimTK_TEST(ldltInverse(~lower.transpose()) == inv);
+    }
+
+    Mat<M,M> notPD = randSPD<M>();
+    notPD(M-1,M-1) = -notPD(M-1,M-1);
+    SimTK_TEST_MUST_THROW(ldltInverse(notPD));
+    SimTK_TEST_MUST_THROW(ldltInverse(Mat<M,M>(0)));
+}
+
+// A batch whose size isn't a multiple of any vector width, with one matrix
+// that isn't positive definite; the others must be unaffected by it.
+template <int M> void testBatch() {
+    const int n = 11, bad = 4;
+    Array_<Mat<M,M> > mats(n);
+    Array_<Vec<M> >   rhs(n);
+    Array_<Real> a(M*M*n), inv(M*M*n), b(M*n);
+    for (int k=0; k < n; ++k) {
+        mats[k] = randSPD<M>();
+        if (k == bad) mats[k](0,0) = 0;
+        rhs[k] = Test::randVec<M>();
+        store(mats[k], n, k, a.begin());
+        for (int i=0; i < M; ++i)
+            b[i*n + k] = rhs[k][i];
+    }
+
+    SimTK_TEST(SmallMatrixBatch::factorLDLT<M>(n, a.begin()) == 1);
+    SmallMatrixBatch::invertLDLT<M>(n, a.cbegin(), inv.begin());
+    SmallMatrixBatch::solveLDLT<M>(n, a.cbegin(), b.begin());
+    for (int k=0; k < n; ++k) {
+        SimTK_TEST(SmallMatrixBatch::isPositiveDefinite<M>(n, a.cbegin(), k)
+                   == (k != bad));
+        if (k == bad) continue;
+        SimTK_TEST(load<M>(n, k, inv.cbegin()) == ldltInverse(mats[k]));
+        Vec<M> x;
+        for (int i=0; i < M; ++i)
+            x[i] = b[i*n + k];
+        SimTK_TEST_EQ(mats[k]*x, rhs[k]);
+    }
+}
+
+template <int M> void testSize() {
+    testSingle<M>();
+    testBatch<M>();
+}
+
+void testAllSizes() {
+    testSize<1>(); testSize<2>(); testSize<3>();
+    testSize<4>(); testSize<5>(); testSize<6>();
+}
+
+// Not a pass/fail test; reports how inverting a batch compares with calling
+// Mat::invert() and ldltInverse() on each matrix in turn.
+template <int M> void benchmark() {
+    const int n = 64, Reps = 2000;
+    Array_<Mat<M,M> > mats(n), invs(n);
+    Array_<Real> a(M*M*n), ldl(M*M*n), inv(M*M*n);
+    for (int k=0; k < n; ++k) {
+        mats[k] = randSPD<M>();
+        store(mats[k], n, k, a.begin());
+    }
+
+    double sum = 0;
+    double t0 = cpuTime();
+    for (int r=0; r < Reps; ++r) {
+        for (int k=0; k < n; ++k) invs[k] = mats[k].invert();
+        sum += invs[r%n](0,0);
+    }
+    const double tInvert = cpuTime()-t0;
+    t0 = cpuTime();
+    for (int r=0; r < Reps; ++r) {
+        for (int k=0; k < n; ++k) invs[k] = ldltInverse(mats[k]);
+        sum += invs[r%n](0,0);
+    }
+    const double tSingle = cpuTime()-t0;
+    t0 = cpuTime();
+    for (int r=0; r < Reps; ++r) {
+        ldl = a;
+        SmallMatrixBatch::factorLDLT<M>(n, ldl.begin());
+        SmallMatrixBatch::invertLDLT<M>(n, ldl.cbegin(), inv.begin());
+        sum += inv[r%n];
+    }
+    const double tBatch = cpuTime()-t0;
+
+    const double perMat = 1e9/(double(Reps)*n);
+    cout << M << "x" << M << " inverse: invert() " << tInvert*perMat
+         << "ns, ldltInverse() " << tSingle*perMat << "ns, batch of " << n
+         << " " << tBatch*perMat << "ns (checksum " << sum << ")\n";
+}
+
+void benchmarkAllSizes() {
+    benchmark<1>(); benchmark<2>(); benchmark<3>();
+    benchmark<4>(); benchmark<5>(); benchmark<6>();
+}
+
+int main() {
+    SimTK_START_TEST("TestSmallMatrixBatch");
+        SimTK_SUBTEST(testAllSizes);
+        SimTK_SUBTEST(benchmarkAllSizes);
+    SimTK_END_TEST();
+}
@@ -0,0 +1,149 @@
+/* -------------------------------------------------------------------------- *
+ *                       Simbody(tm): SimTKcommon                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Checks that the vectorized 3x3 kernels in SmallMatrixSIMD.h produce results
+bitwise identical to the generic element-wise templates, and times them
+against a scalar loop written the same way. */
+
+#include "SimTKcommon.h"
+#include "SimTKcommon/Testing.h"
+
+#include <iostream>
+
+using std::cout;
+using std::endl;
+using namespace SimTK;
+
+namespace {
+// Scalar reference, in the same summation order as the generic templates.
+template <int CS, int RS, int S>
+Vec3 refMult(const Mat<3,3,double,CS,RS>& m, const Vec<3,double,S>& v) {
+    Vec3 r;
+    for (int i=0; i<3; ++i)
+        r[i] = m(i,0)*v[0] + m(i,1)*v[1] + m(i,2)*v[2];
+    return r;
+}
+template <int CSL, int RSL, int CSR, int RSR>
+Mat33 refMult(const Mat<3,3,double,CSL,RSL>& l,
+              const Mat<3,3,double,CSR,RSR>& r) {
+    Mat33 c;
+    for (int j=0; j<3; ++j)
+        c(j) = refMult(l, r(j));
+    return c;
+}
+
+bool isBitwiseEqual(const Vec3& a, const Vec3& b)
+{   return a[0]==b[0] && a[1]==b[1] && a[2]==b[2]; }
+bool isBitwiseEqual(const Mat33& a, const Mat33& b) {
+    for (int j=0; j<3; ++j) if (!isBitwiseEqual(a(j), b(j))) return false;
+    return true;
+}
+}
+
+void testMatVec() {
+    for (int trial=0; trial < 100; ++trial) {
+        const Mat33 m = Test::randMat<3,3>();
+        const Vec3  v = Test::randVec<3>();
+        SimTK_TEST(isBitwiseEqual(m*v, refMult(m,v)));
+        SimTK_TEST(isBitwiseEqual(~m*v, refMult(~m,v)));
+
+        // Strided vector: a column of the transpose is a row of m.
+        SimTK_TEST(isBitwiseEqual(m*(~m)(1), refMult(m,(~m)(1))));
+
+        // A 3x3 block of a larger matrix has neither supported layout.
+        Mat<4,3> big; big.updSubMat<3,3>(1,0) = m;
+        SimTK_TEST(isBitwiseEqual(big.getSubMat<3,3>(1,0)*v, refMult(m,v)));
+
+        const Rotation R(Test::randReal()*Pi, Test::randVec<3>());
+        SimTK_TEST(isBitwiseEqual(R*v, refMult(R.asMat33(),v)));
+        SimTK_TEST(isBitwiseEqual(~R*v, refMult((~R).asMat33(),v)));
+    }
+}
+
+void testMatMat() {
+    for (int trial=0; trial < 100; ++trial) {
+        const Mat33 a = Test::randMat<3,3>(), b = Test::randMat<3,3>();
+        SimTK_TEST(isBitwiseEqual(a*b,   refMult(a,b)));
+        SimTK_TEST(isBitwiseEqual(~a*b,  refMult(~a,b)));
+        SimTK_TEST(isBitwiseEqual(a*~b,  refMult(a,~b)));
+        SimTK_TEST(isBitwiseEqual(~a*~b, refMult(~a,~b)));
+        SimTK_TEST_EQ(a*b, a.conformingMultiply(b));
+
+        const Rotation R1(Test::randReal()*Pi, Test::randVec<3>());
+        const Rotation R2(Test::randReal()*Pi, Test::randVec<3>());
+        SimTK_TEST(isBitwiseEqual((R1*R2).asMat33(),
+                                  refMult(R1.asMat33(), R2.asMat33())));
+        SimTK_TEST(isBitwiseEqual((~R1*R2).asMat33(),
+                                  refMult((~R1).asMat33(), R2.asMat33())));
+        Rotation R3(R1); R3 *= ~R2;
+        SimTK_TEST(isBitwiseEqual(R3.asMat33(),
+                                  refMult(R1.asMat33(), (~R2).asMat33())));
+    }
+}
+
+// Not a pass/fail test; reports how the kernels compare with the scalar
+// loop on this machine.
+void benchmark() {
+    const int N = 1000, Reps = 2000;
+    Array_<Mat33> ms(N); Array_<Vec3> vs(N);
+    for (int i=0; i<N; ++i)
+        {ms[i] = Test::randMat<3,3>(); vs[i] = Test::randVec<3>();}
+
+    Vec3 sum(0);
+    double t0 = cpuTime();
+    for (int r=0; r<Reps; ++r)
+        for (int i=0; i<N; ++i) sum += refMult(ms[i], vs[i]);
+    const double tScalar = cpuTime()-t0;
+    t0 = cpuTime();
+    for (int r=0; r<Reps; ++r)
+        for (int i=0; i<N; ++i) sum += ms[i]*vs[i];
+    const double tKernel = cpuTime()-t0;
+    t0 = cpuTime();
+    for (int r=0; r<Reps; ++r)
+        for (int i=0; i<N; ++i) sum += ~ms[i]*vs[i];
+    const double tKernelT = cpuTime()-t0;
+
+    Mat33 msum(0);
+    t0 = cpuTime();
+    for (int r=0; r<Reps/10; ++r)
+        for (int i=1; i<N; ++i) msum += refMult(ms[i-1], ms[i]);
+    const double tScalarMM = cpuTime()-t0;
+    t0 = cpuTime();
+    for (int r=0; r<Reps/10; ++r)
+        for (int i=1; i<N; ++i) msum += ms[i-1]*ms[i];
+    const double tKernelMM = cpuTime()-t0;
+
+    cout << "SIMD kernels " << (SimTK_SIMD_SMALLMATRIX ? "on" : "off") << ":\n"
+         << "  Mat33*Vec3  scalar " << tScalar << "s, kernel " << tKernel
+         << "s, transposed " << tKernelT << "s\n"
+         << "  Mat33*Mat33 scalar " << tScalarMM << "s, kernel " << tKernelMM
+         << "s\n  (checksum " << sum.norm() + msum.norm() << ")\n";
+}
+
+int main() {
+    SimTK_START_TEST("TestSmallMatrixSIMD");
+        SimTK_SUBTEST(testMatVec);
+        SimTK_SUBTEST(testMatMat);
+        SimTK_SUBTEST(benchmark);
+    SimTK_END_TEST();
+}
@@ -29,6 +29,7 @@
 #include <iostream>
 #include <string>
 #include <cstdio>
+#include <sstream>
 
 
 using std::cout;
@@ -324,6 +325,225 @@ void testStringConvert() {
 
 }
 
+// Converting to an Array_ or Vector_ of numbers takes a fast path for the
+// common formats; it must agree with the stream extraction operator.
+template <class T> static bool convertWithStream(const String& s, T& out) {
+    std::istringstream in(s);
+    in >> out;
+    if (in.fail()) return false;
+    if (in.eof()) return true;
+    std::ws(in);
+    return in.eof();
+}
+
+template <class T> static void compareNumberConversion(const String& s) {
+    T fast, slow;
+    const bool fastOK = s.tryConvertTo(fast);
+    const bool slowOK = convertWithStream(s, slow);
+    SimTK_TEST(fastOK == slowOK);
+    if (fastOK && slowOK) {
+        SimTK_TEST(fast.size() == slow.size());
+        for (int i=0; i < (int)fast.size(); ++i)
+            SimTK_TEST(fast[i] == slow[i]);
+    }
+}
+
+void testNumberConversions() {
+    const char* cases[] = {
+        "1 2 3", "1,2,3", " 1 , 2 ,3 ", "[1, 2, 3]", "(1 2 3)", "  [ ]", "",
+        "   ", " -.25, .5, 29.2e4 ", "-0 +7 12345678 1e-5 3.", "1e-320",
+        "1e400", "99999999999", "nan", "1 inf", "0x10", "1.5.3", "1-2", 
+        "1 2,3", "1,2 3", "1,,2", "[1,]", "[1 2", "1 2]", "(1 2]", "~[1 2]", 
+        "{1 2}", "1 2 x", "1 2 ] 3", "1\t2\n3\r\n"
+    };
+    for (const char* c : cases) {
+        compareNumberConversion< Array_<double> >(c);
+        compareNumberConversion< Array_<float> >(c);
+        compareNumberConversion< Array_<int> >(c);
+        compareNumberConversion< Array_<double,unsigned short> >(c);
+        compareNumberConversion< Vector >(c);
+        compareNumberConversion< Vector_<float> >(c);
+        compareNumberConversion< Vec3 >(c);
+        compareNumberConversion< Vec<2,float> >(c);
+    }
+
+    // Trailing white space is fine with or without the fast path.
+    SimTK_TEST(convertStringTo< Array_<int> >("1 2 3 \n").size() == 3);
+    SimTK_TEST(convertStringTo< Array_<String> >("a b c \n").size() == 3);
+    SimTK_TEST(convertStringTo< Vector >("1 2 3 \n").size() == 3);
+
+    // Fixed-size views still insist on the right number of elements.
+    Array_<int> a(3);
+    Array_<int> view(a.begin(), a.end(), DontCopy());
+    SimTK_TEST_MUST_THROW(convertStringTo("1 2", view));
+    convertStringTo("4 5 6", view);
+    SimTK_TEST(a[0]==4 && a[1]==5 && a[2]==6);
+
+    // Compare speed with the stream extraction operator.
+    String big;
+    for (int i=0; i < 100000; ++i)
+        big += String(std::sin(i)*1e3) + " ";
+    Array_<double> fast, slow;
+    double t0 = realTime();
+    convertStringTo(big, fast);
+    const double tFast = realTime() - t0;
+    t0 = realTime();
+    SimTK_TEST(convertWithStream(big, slow));
+    const double tSlow = realTime() - t0;
+    SimTK_TEST(fast == slow);
+    cout << "Converted 100000 doubles in " << tFast*1e3 << "ms (stream " 
+         << tSlow*1e3 << "ms)\n";
+}
+
+// A stream reader and an Xml::Document should see the same nodes.
+static void compareStreamReaderWithElement(Xml::Element elt,
+                                           Xml::StreamReader& reader) {
+    SimTK_TEST(reader.next() == Xml::StreamReader::StartElement);
+    SimTK_TEST(reader.getTag() == elt.getElementTag());
+    int i = 0;
+    for (Xml::attribute_iterator p = elt.attribute_begin(); 
+         p != elt.attribute_end(); ++p, ++i) {
+        SimTK_TEST(reader.getAttributeName(i) == p->getName());
+        SimTK_TEST(reader.getAttributeValue(i) == p->getValue());
+    }
+    SimTK_TEST(reader.getNumAttributes() == i);
+
+    for (Xml::node_iterator p = elt.node_begin(); p != elt.node_end(); ++p) {
+        if (p->getNodeType() == Xml::ElementNode) {
+            compareStreamReaderWithElement(Xml::Element::getAs(*p), reader);
+            continue;
+        }
+        const Xml::StreamReader::Event event = reader.next();
+        switch (p->getNodeType()) {
+        case Xml::TextNode: 
+            SimTK_TEST(event == Xml::StreamReader::TextEvent); break;
+        case Xml::CommentNode: 
+            SimTK_TEST(event == Xml::StreamReader::CommentEvent); break;
+        default:
+            SimTK_TEST(event == Xml::StreamReader::UnknownEvent); break;
+        }
+        SimTK_TEST(reader.getText() == p->getNodeText());
+    }
+    SimTK_TEST(reader.next() == Xml::StreamReader::EndElement);
+    SimTK_TEST(reader.getTag() == elt.getElementTag());
+}
+
+static void compareStreamReaderWithDocument(Xml::Document& doc,
+                                            Xml::StreamReader& reader) {
+    SimTK_TEST(reader.getEvent() == Xml::StreamReader::NoEvent);
+    for (Xml::node_iterator p = doc.node_begin(); p != doc.node_end(); ++p) {
+        if (p->getNodeType() == Xml::ElementNode)
+            compareStreamReaderWithElement(Xml::Element::getAs(*p), reader);
+        else {
+            reader.next();
+            SimTK_TEST(reader.getText() == p->getNodeText());
+        }
+    }
+    SimTK_TEST(reader.next() == Xml::StreamReader::EndDocument);
+    SimTK_TEST(reader.next() == Xml::StreamReader::EndDocument);
+    SimTK_TEST(reader.getDepth() == 0);
+}
+
+const char* xmlModel = 
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"<!-- a model -->\n"
+"<!DOCTYPE model SYSTEM \"model.dtd\">\n"
+"<model name=\"arm &amp; hand\" version='2' units=m>\n"
+"  <body  name = 'upper'>\n"
+"     <mass>  2.5 </mass>\n"
+"     <inertia>1 2 3\n\n   0 0 0</inertia>\n"
+"     <joint type=\"pin\"/>\n"
+"     <!-- child comment -->\n"
+"  </body>\n"
+"  <body name='lower'><mass>1</mass><empty></empty></body>\n"
+"  Some   &lt;text&gt; with &#65;&#x42; &quot;escapes&apos;\n"
+"  <![CDATA[raw <stuff>  & more]]>\n"
+"  <  !SOMETHING unknown>\n"
+"  <_under:score.dot-dash/>\n"
+"</model>\n";
+
+void testStreamReader() {
+    for (bool condense : {true, false}) {
+        Xml::Document::setXmlCondenseWhiteSpace(condense);
+        Xml::Document doc;
+        doc.readFromString(xmlModel);
+        Xml::StreamReader reader;
+        reader.readFromString(xmlModel);
+        compareStreamReaderWithDocument(doc, reader);
+    }
+    Xml::Document::setXmlCondenseWhiteSpace(true);
+
+    // Attributes, values, and skipping.
+    Xml::StreamReader reader;
+    reader.readFromString(xmlModel);
+    while (reader.next() != Xml::StreamReader::StartElement) {}
+    SimTK_TEST(reader.getDepth() == 1);
+    SimTK_TEST(reader.getRequiredAttributeValue("name") == "arm & hand");
+    SimTK_TEST(reader.getRequiredAttributeValueAs<int>("version") == 2);
+    SimTK_TEST(reader.getOptionalAttributeValue("units") == "m");
+    SimTK_TEST(reader.getOptionalAttributeValue("color", "red") == "red");
+    SimTK_TEST(!reader.hasAttribute("color"));
+    SimTK_TEST_MUST_THROW(reader.getRequiredAttributeValue("color"));
+    SimTK_TEST_MUST_THROW(reader.getAttributeName(3));
+    SimTK_TEST_MUST_THROW(reader.readElementValue()); // not a value element
+
+    reader.readFromString(xmlModel);
+    while (!(reader.next() == Xml::StreamReader::StartElement
+             && reader.getTag() == "body")) {}
+    SimTK_TEST(reader.getDepth() == 2);
+    reader.next(); 
+    SimTK_TEST(reader.getTag() == "mass");
+    SimTK_TEST(reader.readElementValueAs<double>() == 2.5);
+    SimTK_TEST(reader.getEvent() == Xml::StreamReader::EndElement);
+    SimTK_TEST(reader.getDepth() == 2);
+    reader.next();
+    Vector inertia;
+    reader.readElementValueAs(inertia);
+    SimTK_TEST_EQ(inertia, Vector(Vec6(1,2,3,0,0,0)));
+    reader.next(); // <joint/>
+    SimTK_TEST(reader.getRequiredAttributeValue("type") == "pin");
+    SimTK_TEST(reader.readElementValue().empty());
+    SimTK_TEST(reader.getTag() == "joint");
+    SimTK_TEST(reader.getDepth() == 2);
+    reader.next(); // comment
+    reader.next(); // </body>
+    SimTK_TEST(reader.getEvent() == Xml::StreamReader::EndElement);
+    reader.next(); // <body name='lower'>
+    SimTK_TEST(reader.getRequiredAttributeValue("name") == "lower");
+    reader.skipElement();
+    SimTK_TEST(reader.getEvent() == Xml::StreamReader::EndElement);
+    SimTK_TEST(reader.getTag() == "body" && reader.getDepth() == 1);
+    reader.next();
+    SimTK_TEST(reader.getText() == "Some <text> with AB \"escapes'");
+
+    // Unlike Xml::Document we produce UTF-8 and keep unknown escapes.
+    reader.readFromString("<a>&#x263A;&#9731; &nbsp; &#; &</a>");
+    reader.next(); 
+    SimTK_TEST(reader.readElementValue() 
+               == "\xE2\x98\xBA\xE2\x98\x83 &nbsp; &#; &");
+
+    // Malformed documents.
+    const char* bad[] = {
+        "<a><b></a>", "<a>", "</a>", "<a><!-- unterminated </a>", 
+        "<a x='1></a>", "<a x></a>", "<a/ >", "<a><![CDATA[ </a>"
+    };
+    for (const char* b : bad) {
+        reader.readFromString(b);
+        SimTK_TEST_MUST_THROW(
+            while (reader.next() != Xml::StreamReader::EndDocument) {});
+    }
+
+    // Reading from a file.
+    const String filename = "TestXmlStreamReader.xml";
+    Xml::Document doc;
+    doc.readFromString(xmlModel);
+    doc.writeToFile(filename);
+    Xml::StreamReader fromFile(filename);
+    compareStreamReaderWithDocument(doc, fromFile);
+    std::remove(filename.c_str());
+    SimTK_TEST_MUST_THROW(fromFile.readFromFile(filename));
+}
+
 int main() {
     cout << "Path of this executable: '" << Pathname::getThisExecutablePath() << "'\n";
     cout << "Executable directory: '" << Pathname::getThisExecutableDirectory() << "'\n";
@@ -334,6 +554,8 @@ int main() {
         SimTK_SUBTEST(testStringConvert);
         SimTK_SUBTEST(testXmlFromString);
         SimTK_SUBTEST(testXmlFromScratch);
+        SimTK_SUBTEST(testNumberConversions);
+        SimTK_SUBTEST(testStreamReader);
 
     SimTK_END_TEST();
 }
@@ -726,6 +726,16 @@ Vec2 calcSplitGeodError(const Vec3& P, const Vec3& Q,
 
 
 
+/** Return true if this surface has closed-form geodesics, currently Sphere
+and Cylinder. For those surfaces continueGeodesic(),
+shootGeodesicInDirectionUntilLengthReached() and
+shootGeodesicInDirectionUntilPlaneHit() use the analytical methods below
+rather than integrating the geodesic equations, and the returned Geodesic
+includes the exact directional and positional Jacobi fields. The numerical
+methods calcGeodesic() and calcGeodesicUsingOrthogonalMethod() are never
+replaced. **/
+bool hasAnalyticGeodesics() const;
+
 /** Analytically compute a geodesic curve starting at the given point, starting in the
  * given direction, and terminating at the given length. Only possible for a few simple
  * shapes, such as spheres and cylinders.
@@ -751,9 +761,10 @@ void shootGeodesicInDirectionUntilLengthReachedAnalytical
 @param[in] terminatingPlane   The plane in which the end point of the resulting geodesic should lie.
 @param[in] options       Parameters related to geodesic calculation
 @param[out] geod         On exit, this contains the calculated geodesic
-**/
-// XXX what to do if tP is not in the tangent plane at P -- project it?
-// XXX what to do if we don't hit the plane
+
+Any component of \a tP normal to the surface at \a xP is ignored. If the
+geodesic never reaches the plane, it stops after the same length the
+numerical method gives up at. **/
 void shootGeodesicInDirectionUntilPlaneHitAnalytical(const Vec3& xP, const UnitVec3& tP,
         const Plane& terminatingPlane, const GeodesicOptions& options,
         Geodesic& geod) const;
@@ -807,8 +807,12 @@ void ContactGeometry::
 shootGeodesicInDirectionUntilPlaneHit(const Vec3& xP, const UnitVec3& tP,
         const Plane& terminatingPlane, const GeodesicOptions& options,
         Geodesic& geod) const {
-    getImpl().shootGeodesicInDirectionUntilPlaneHit(xP, tP, terminatingPlane,
-            options, geod);
+    if (getImpl().hasAnalyticGeodesics())
+        getImpl().shootGeodesicInDirectionUntilPlaneHitAnalytical
+           (xP, tP, terminatingPlane, options, geod);
+    else
+        getImpl().shootGeodesicInDirectionUntilPlaneHit(xP, tP,
+            terminatingPlane, options, geod);
 }
 
 
@@ -819,7 +823,12 @@ void ContactGeometry::
 shootGeodesicInDirectionUntilLengthReached(const Vec3& xP, const UnitVec3& tP,
         const Real& terminatingLength, const GeodesicOptions& options,
         Geodesic& geod) const {
-    getImpl().shootGeodesicInDirection(xP, tP, terminatingLength, options, geod);
+    if (getImpl().hasAnalyticGeodesics())
+        getImpl().shootGeodesicInDirectionUntilLengthReachedAnalytical
+           (xP, tP, terminatingLength, options, geod);
+    else
+        getImpl().shootGeodesicInDirectionUntilLengthReached(xP, tP,
+            terminatingLength, options, geod);
 }
 
 void ContactGeometry::
@@ -830,6 +839,10 @@ calcGeodesicReverseSensitivity(Geodesic& geodesic, const Vec2& initSensitivity)
 }
 
 
+bool ContactGeometry::hasAnalyticGeodesics() const {
+    return getImpl().hasAnalyticGeodesics();
+}
+
 void ContactGeometry::
 shootGeodesicInDirectionUntilLengthReachedAnalytical(const Vec3& xP, const UnitVec3& tP,
         const Real& terminatingLength, const GeodesicOptions& options, Geodesic& geod) const {
@@ -1239,8 +1252,10 @@ continueGeodesic(const Vec3& xP, const Vec3& xQ, const Geodesic& prevGeod,
     // If there is no previous geodesic the best we can do is to start in
     // direction PQdir, and guess length |PQ|.
     if (!prevGeod.getNumPoints()) {
-        calcGeodesicUsingOrthogonalMethod(P, Q, PQdir, PQlength, geod);
-        //calcGeodesicAnalytical(P, Q, PQ, PQ, geod);
+        if (hasAnalyticGeodesics())
+            calcGeodesicAnalytical(P, Q, PQdir, PQdir, geod);
+        else
+            calcGeodesicUsingOrthogonalMethod(P, Q, PQdir, PQlength, geod);
         return;
     }
 
@@ -1284,8 +1299,10 @@ continueGeodesic(const Vec3& xP, const Vec3& xQ, const Geodesic& prevGeod,
         }
     }
 
-    calcGeodesicUsingOrthogonalMethod(P, Q, tPhint, sHint, geod);
-    //calcGeodesicAnalytical(P, Q, tPhint, tQhint, geod);
+    if (hasAnalyticGeodesics())
+        calcGeodesicAnalytical(P, Q, tPhint, tQhint, geod);
+    else
+        calcGeodesicUsingOrthogonalMethod(P, Q, tPhint, sHint, geod);
 }
 
 
@@ -1379,7 +1396,7 @@ shootGeodesicInDirection(const Vec3& P, const UnitVec3& tP,
     ++numGeodesicsShot;
 
     // Initialize state
-    State sysState = ptOnSurfSys->getDefaultState();
+    State sysState = updParticleOnSurfaceSystem().getDefaultState();
     sysState.setTime(startTime);
     Vector& q = sysState.updQ();
     Vector& u = sysState.updU();
@@ -1391,16 +1408,16 @@ shootGeodesicInDirection(const Vec3& P, const UnitVec3& tP,
     u[3] = 1;
 
     // Setup integrator to integrate until terminatingLength
-    //RungeKutta3Integrator integ(*ptOnSurfSys);
-    RungeKuttaMersonIntegrator integ(*ptOnSurfSys);
-    //RungeKuttaFeldbergIntegrator integ(*ptOnSurfSys);
+    //RungeKutta3Integrator integ(updParticleOnSurfaceSystem());
+    RungeKuttaMersonIntegrator integ(updParticleOnSurfaceSystem());
+    //RungeKuttaFeldbergIntegrator integ(updParticleOnSurfaceSystem());
     integ.setAccuracy(IntegratorAccuracy);
     integ.setConstraintTolerance(IntegratorConstraintTol);
     integ.setFinalTime(finalTime);
     integ.setReturnEveryInternalStep(true); // save geodesic knot points
 
     // Setup timestepper in order to handle event when geodesic hits the plane
-    TimeStepper ts(*ptOnSurfSys, integ);
+    TimeStepper ts(updParticleOnSurfaceSystem(), integ);
     ts.setReportAllSignificantStates(true);
     ts.initialize(sysState);
 
@@ -1563,15 +1580,15 @@ void ContactGeometryImpl::
 calcGeodesicReverseSensitivity(Geodesic& geod, const Vec2& initJacobi) const {
     
     // Don't look for a plane.
-    geodHitPlaneEvent->setEnabled(false);
+    updGeodHitPlaneEvent().setEnabled(false);
 
     // integrator settings
 
     //RungeKutta3Integrator integ(ptOnSurfSys);
-    RungeKuttaMersonIntegrator integ(*ptOnSurfSys);
+    RungeKuttaMersonIntegrator integ(updParticleOnSurfaceSystem());
     integ.setAccuracy(IntegratorAccuracy);
     integ.setConstraintTolerance(IntegratorConstraintTol);
-    State sysState = ptOnSurfSys->getDefaultState();
+    State sysState = updParticleOnSurfaceSystem().getDefaultState();
     Vector& q = sysState.updQ();
     Vector& u = sysState.updU();
 
@@ -1697,8 +1714,8 @@ void ContactGeometryImpl::
 shootGeodesicInDirectionUntilPlaneHit(const Vec3& xP, const UnitVec3& tP,
         const Plane& terminatingPlane, const GeodesicOptions& options,
         Geodesic& geod) const {
-    geodHitPlaneEvent->setEnabled(true);
-    geodHitPlaneEvent->setPlane(terminatingPlane);
+    updGeodHitPlaneEvent().setEnabled(true);
+    updGeodHitPlaneEvent().setPlane(terminatingPlane);
     // TODO: need a reasonable max length
     const Real MaxLength = /*Infinity*/100;
     shootGeodesicInDirection(xP, tP, MaxLength, options, geod);
@@ -1712,7 +1729,7 @@ void ContactGeometryImpl::
 shootGeodesicInDirectionUntilLengthReached(const Vec3& xP, const UnitVec3& tP,
         const Real& terminatingLength, const GeodesicOptions& options,
         Geodesic& geod) const {
-    geodHitPlaneEvent->setEnabled(false);
+    updGeodHitPlaneEvent().setEnabled(false);
 #ifdef USE_NEW_INTEGRATOR
     shootGeodesicInDirection2(xP, tP, terminatingLength, options, geod);
 #else
@@ -1763,7 +1780,7 @@ void ContactGeometryImpl::calcGeodesic(const Vec3& xP, const Vec3& xQ,
     // calculate plane bisecting P and Q, and use as termination condition for integrator
     UnitVec3 normal(xQ - xP);
     Real offset = (~(xP+xQ)*normal)/2 ;
-    geodHitPlaneEvent->setPlane(Plane(normal, offset));
+    updGeodHitPlaneEvent().setPlane(Plane(normal, offset));
 
     Mat22 J;
     Vec2 x, xold, dx, Fx;
@@ -1781,7 +1798,7 @@ void ContactGeometryImpl::calcGeodesic(const Vec3& xP, const Vec3& xQ,
 //    splitGeodErr->f(x, Fx);
     Fx = calcSplitGeodError(xP, xQ, x[0], x[1]);
     if (vizReporter != NULL) {
-        vizReporter->handleEvent(ptOnSurfSys->getDefaultState());
+        vizReporter->handleEvent(updParticleOnSurfaceSystem().getDefaultState());
         sleepInSec(pauseBetweenGeodIterations);
     }
 
@@ -1821,7 +1838,7 @@ void ContactGeometryImpl::calcGeodesic(const Vec3& xP, const Vec3& xQ,
         }
 
         if (vizReporter != NULL) {
-            vizReporter->handleEvent(ptOnSurfSys->getDefaultState());
+            vizReporter->handleEvent(updParticleOnSurfaceSystem().getDefaultState());
             sleepInSec(pauseBetweenGeodIterations);
         }
 
@@ -1872,7 +1889,7 @@ void ContactGeometryImpl::calcGeodesicUsingOrthogonalMethod
 
     Fx = calcOrthogonalGeodError(P, Q, x[0], x[1], geod);
     if (vizReporter != NULL) {
-        vizReporter->handleEvent(ptOnSurfSys->getDefaultState());
+        vizReporter->handleEvent(updParticleOnSurfaceSystem().getDefaultState());
         sleepInSec(pauseBetweenGeodIterations);
     }
 
@@ -2015,7 +2032,7 @@ void ContactGeometryImpl::calcGeodesicUsingOrthogonalMethod
         }
 
         if (vizReporter != NULL) {
-            vizReporter->handleEvent(ptOnSurfSys->getDefaultState());
+            vizReporter->handleEvent(updParticleOnSurfaceSystem().getDefaultState());
             sleepInSec(pauseBetweenGeodIterations);
         }
 
@@ -2076,9 +2093,9 @@ calcSplitGeodError(const Vec3& xP, const Vec3& xQ,
 
     GeodesicOptions opts;
     shootGeodesicInDirectionUntilPlaneHit(xP, tP,
-            geodHitPlaneEvent->getPlane(), opts, geodP);
+            updGeodHitPlaneEvent().getPlane(), opts, geodP);
     shootGeodesicInDirectionUntilPlaneHit(xQ, tQ,
-            geodHitPlaneEvent->getPlane(), opts, geodQ);
+            updGeodHitPlaneEvent().getPlane(), opts, geodQ);
 
     // Finish each geodesic with reverse Jacobi field.
     calcGeodesicReverseSensitivity(geodP,
@@ -2137,9 +2154,9 @@ calcSplitGeodErrorAnalytical(const Vec3& xP, const Vec3& xQ,
 
     GeodesicOptions opts;
     shootGeodesicInDirectionUntilPlaneHitAnalytical(xP, tP,
-            geodHitPlaneEvent->getPlane(), opts, geodP);
+            updGeodHitPlaneEvent().getPlane(), opts, geodP);
     shootGeodesicInDirectionUntilPlaneHitAnalytical(xQ, tQ,
-            geodHitPlaneEvent->getPlane(), opts, geodQ);
+            updGeodHitPlaneEvent().getPlane(), opts, geodQ);
 
     // Finish each geodesic with reverse Jacobi field.
     calcGeodesicReverseSensitivity(geodP,
@@ -2168,9 +2185,9 @@ calcSplitGeodErrorJacobian(const Vec3& xP, const Vec3& xQ,
 //
 //    GeodesicOptions opts;
 //    shootGeodesicInDirectionUntilPlaneHit(xP, tP,
-//            geodHitPlaneEvent->getPlane(), opts, geodP);
+//            updGeodHitPlaneEvent().getPlane(), opts, geodP);
 //    shootGeodesicInDirectionUntilPlaneHit(xQ, tQ,
-//            geodHitPlaneEvent->getPlane(), opts, geodQ);
+//            updGeodHitPlaneEvent().getPlane(), opts, geodQ);
 
     GeodesicOptions opts;
 
@@ -2201,7 +2218,7 @@ calcSplitGeodErrorJacobian(const Vec3& xP, const Vec3& xQ,
     // positive perturb
     tP = calcUnitTangentVec(thetaP+h, R_SP);
     shootGeodesicInDirectionUntilPlaneHit(xP, tP,
-            geodHitPlaneEvent->getPlane(), opts, geodPtmp);
+            updGeodHitPlaneEvent().getPlane(), opts, geodPtmp);
     fyptmp = calcError(geodPtmp, geodQ);
 
     if (order==1) {
@@ -2211,7 +2228,7 @@ calcSplitGeodErrorJacobian(const Vec3& xP, const Vec3& xQ,
         geodPtmp.clear();
         tP = calcUnitTangentVec(thetaP-h, R_SP);
         shootGeodesicInDirectionUntilPlaneHit(xP, tP,
-                geodHitPlaneEvent->getPlane(), opts, geodPtmp);
+                updGeodHitPlaneEvent().getPlane(), opts, geodPtmp);
         fymtmp = calcError(geodPtmp, geodQ);
 
         dfdy(0) = (fyptmp-fymtmp)/(2*h);
@@ -2224,7 +2241,7 @@ calcSplitGeodErrorJacobian(const Vec3& xP, const Vec3& xQ,
     // positive perturb
     tQ = calcUnitTangentVec(thetaQ+h, R_SQ);
     shootGeodesicInDirectionUntilPlaneHit(xQ, tQ,
-            geodHitPlaneEvent->getPlane(), opts, geodQtmp);
+            updGeodHitPlaneEvent().getPlane(), opts, geodQtmp);
     fyptmp = calcError(geodP, geodQtmp);
 
     if (order==1) {
@@ -2234,7 +2251,7 @@ calcSplitGeodErrorJacobian(const Vec3& xP, const Vec3& xQ,
         geodQtmp.clear();
         tQ = calcUnitTangentVec(thetaQ-h, R_SQ);
         shootGeodesicInDirectionUntilPlaneHit(xQ, tQ,
-                geodHitPlaneEvent->getPlane(), opts, geodQtmp);
+                updGeodHitPlaneEvent().getPlane(), opts, geodQtmp);
         fymtmp = calcError(geodP, geodQtmp);
 
         dfdy(1) = (fyptmp-fymtmp)/(2*h);
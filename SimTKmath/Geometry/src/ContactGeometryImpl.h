@@ -34,6 +34,7 @@
 
 #include <atomic>
 #include <limits>
+#include <mutex>
 
 namespace SimTK {
 
@@ -48,9 +49,7 @@ public:
     ContactGeometryImpl() 
     :   myHandle(0), ptOnSurfSys(0), geodHitPlaneEvent(0), vizReporter(0),
         splitGeodErr(0), numGeodesicsShot(0)
-    {
-        createParticleOnSurfaceSystem();
-    }
+    {}
     ContactGeometryImpl(const ContactGeometryImpl& source)
     :   myHandle(0), ptOnSurfSys(0), geodHitPlaneEvent(0), vizReporter(0),
         splitGeodErr(0), numGeodesicsShot(0) 
@@ -182,6 +181,11 @@ public:
 
     // analytical versions of the geodesic API methods
 
+    // Return true if this surface's analytical geodesic methods are closed
+    // form. If so, continueGeodesic() and the shooting methods of the
+    // ContactGeometry handle use them in place of numerical integration.
+    virtual bool hasAnalyticGeodesics() const {return false;}
+
     virtual void shootGeodesicInDirectionUntilLengthReachedAnalytical(const Vec3& xP, const UnitVec3& tP,
             const Real& terminatingLength, const GeodesicOptions& options, Geodesic& geod) const;
 
@@ -368,12 +372,12 @@ public:
 
     // Get the plane associated with the geodesic hit plane event handler
     const Plane& getPlane() const {
-        return geodHitPlaneEvent->getPlane();
+        return updGeodHitPlaneEvent().getPlane();
     }
 
     // Set the plane associated with the geodesic hit plane event handler
     void setPlane(const Plane& plane) const {
-        return geodHitPlaneEvent->setPlane(plane);
+        return updGeodHitPlaneEvent().setPlane(plane);
     }
 
 
@@ -393,8 +397,9 @@ public:
 
     void addVizReporter(ScheduledEventReporter* reporter) const {
         vizReporter = reporter;
-        ptOnSurfSys->addEventReporter(vizReporter); // takes ownership
-        ptOnSurfSys->realizeTopology();
+        ParticleConSurfaceSystem& sys = updParticleOnSurfaceSystem();
+        sys.addEventReporter(vizReporter); // takes ownership
+        sys.realizeTopology();
     }
 
     class SplitGeodesicError; // local class
@@ -402,7 +407,24 @@ public:
     class OrthoGeodesicError; // local class
     friend class OrthoGeodesicError;
 
-    void createParticleOnSurfaceSystem() {
+    // The system used to integrate geodesics is expensive to build and most
+    // geometry never needs one, so it isn't created until it is first used.
+    // Otherwise every copy of a ContactGeometry, and hence of every Body
+    // that has a ContactSurface, would pay for building and realizing it.
+    // Cable paths may be solved concurrently, so more than one thread can
+    // get here first; only one of them builds the system.
+    ParticleConSurfaceSystem& updParticleOnSurfaceSystem() const {
+        std::call_once(ptOnSurfSysCreated, 
+                       [this] {createParticleOnSurfaceSystem();});
+        return *ptOnSurfSys;
+    }
+
+    GeodHitPlaneEvent& updGeodHitPlaneEvent() const {
+        updParticleOnSurfaceSystem();
+        return *geodHitPlaneEvent;
+    }
+
+    void createParticleOnSurfaceSystem() const {
         ptOnSurfSys = new ParticleConSurfaceSystem(*this);
         geodHitPlaneEvent = new GeodHitPlaneEvent();
         ptOnSurfSys->addEventHandler(geodHitPlaneEvent); // takes ownership
@@ -422,8 +444,9 @@ protected:
     ContactGeometry*        myHandle;
     OBBTree                 obbTree;
 
-    ParticleConSurfaceSystem* ptOnSurfSys;
-    GeodHitPlaneEvent* geodHitPlaneEvent; // don't delete this
+    mutable ParticleConSurfaceSystem* ptOnSurfSys; // created on demand
+    mutable std::once_flag ptOnSurfSysCreated;
+    mutable GeodHitPlaneEvent* geodHitPlaneEvent; // don't delete this
     mutable ScheduledEventReporter* vizReporter; // don't delete this
     mutable SplitGeodesicError* splitGeodErr;
 
@@ -565,6 +588,8 @@ public:
     void calcCurvature(const Vec3& point, Vec2& curvature,
                        Rotation& orientation) const override;
 
+    bool hasAnalyticGeodesics() const override {return true;}
+
     void shootGeodesicInDirectionUntilLengthReachedAnalytical
        (const Vec3& xP, const UnitVec3& tP,
         const Real& terminatingLength, const GeodesicOptions& options, 
@@ -650,6 +675,8 @@ public:
     void calcCurvature(const Vec3& point, Vec2& curvature, 
                        Rotation& orientation) const override;
 
+    bool hasAnalyticGeodesics() const override {return true;}
+
     void shootGeodesicInDirectionUntilLengthReachedAnalytical
        (const Vec3& xP, const UnitVec3& tP, const Real& terminatingLength, 
         const GeodesicOptions& options, Geodesic& geod) const override;
@@ -210,9 +210,9 @@ static void setGeodesicToHelicalArc(Real R, Real phiP, Real angle, Real m, Real
         geod.addDirectionalSensitivityQtoP(jQP);
 
 
-        // TODO: positional sensitivity
-        geod.addPositionalSensitivityPtoQ(Vec2(NaN));
-        geod.addPositionalSensitivityQtoP(Vec2(NaN));
+        // Positional sensitivity has j(0)=1, j'(0)=0 so is constant.
+        geod.addPositionalSensitivityPtoQ(Vec2(1, 0));
+        geod.addPositionalSensitivityQtoP(Vec2(1, 0));
     }
 
     // Only compute torsion and binormal curvature at the end points.
@@ -278,6 +278,14 @@ calcGeodesicAnalytical(const Vec3& xP, const Vec3& xQ,
         angle = angleLeftHanded;
     }
 
+    // If P and Q are on the same generator line the helix degenerates to
+    // a straight line along the axis.
+    if (std::abs(angle)*radius <= SqrtEps*std::abs(xQ[2] - xP[2])) {
+        makeStraightLineGeodesic(xP, xQ, UnitVec3(ZAxis), GeodesicOptions(),
+                                 geod);
+        return;
+    }
+
     // Offset and slope.
     Real c =  xP[2];
     Real m = (xQ[2] - xP[2]) / (angle * radius);
@@ -285,17 +293,98 @@ calcGeodesicAnalytical(const Vec3& xP, const Vec3& xQ,
     setGeodesicToHelicalArc(radius, phiP, angle, m, c, geod);
 }
 
+// Find the helix that leaves P in direction tP: its starting angle phiP,
+// slope m, and whether phi increases (orientation=1) or decreases (-1)
+// along it. Returns false if tP runs along the axis, in which case the
+// geodesic is a straight line and only phiP is set.
+static bool calcHelixFromTangent(const Vec3& xP, const UnitVec3& tP,
+                                 Real& phiP, Real& m, Real& orientation) {
+    phiP = std::atan2(xP[1], xP[0]);
+    // Component of tP along the circumference.
+    const Real tphi = -std::sin(phiP)*tP[0] + std::cos(phiP)*tP[1];
+    if (std::abs(tphi) <= SqrtEps*std::abs(tP[2]))
+        return false;
+    // From the helix tangent t = orientation/sqrt(1+m^2) * [-sin, cos, m].
+    m = tP[2]/tphi;
+    orientation = tphi < 0 ? Real(-1) : Real(1);
+    return true;
+}
+
 void ContactGeometry::Cylinder::Impl::shootGeodesicInDirectionUntilLengthReachedAnalytical(const Vec3& xP, const UnitVec3& tP,
         const Real& terminatingLength, const GeodesicOptions& options, Geodesic& geod) const {
 
-    //TODO for Andreas :)
+    Real phiP, m, orientation;
+    if (!calcHelixFromTangent(xP, tP, phiP, m, orientation)) {
+        const Vec3 P(radius*std::cos(phiP), radius*std::sin(phiP), xP[2]);
+        const Real dir = tP[2] < 0 ? Real(-1) : Real(1);
+        makeStraightLineGeodesic(P, P + Vec3(0,0,dir*terminatingLength),
+                                 UnitVec3(0,0,dir), options, geod);
+        return;
+    }
+
+    const Real angle = orientation*terminatingLength / (radius*std::sqrt(1+m*m));
+    setGeodesicToHelicalArc(radius, phiP, angle, m, xP[2], geod);
 }
 
+// The helix crosses the plane where n.p(phi) = d, with n.p(phi) a sinusoid
+// plus a linear term, so there may be several crossings or none. We step
+// along the helix in increments small enough not to skip over a pair of
+// crossings (except where the helix is nearly tangent to the plane), then
+// bisect on the first sign change. As in the numerical version, we give up
+// at a length of 100 and return that geodesic.
 void ContactGeometry::Cylinder::Impl::shootGeodesicInDirectionUntilPlaneHitAnalytical(const Vec3& xP, const UnitVec3& tP,
         const Plane& terminatingPlane, const GeodesicOptions& options,
         Geodesic& geod) const {
 
-    //TODO for Andreas :)
+    const Real MaxLength = 100;
+    const Vec3 n = terminatingPlane.getNormal();
+    const Real d = terminatingPlane.getOffset();
+
+    Real phiP, m, orientation;
+    if (!calcHelixFromTangent(xP, tP, phiP, m, orientation)) {
+        const Vec3 P(radius*std::cos(phiP), radius*std::sin(phiP), xP[2]);
+        const Real dir = tP[2] < 0 ? Real(-1) : Real(1);
+        const Real rate = dir*n[2]; // d(n.p)/ds
+        Real length = MaxLength;
+        if (rate != 0) {
+            const Real s = (d - ~n*P)/rate;
+            if (s > 0) length = std::min(s, MaxLength);
+        }
+        makeStraightLineGeodesic(P, P + Vec3(0,0,dir*length),
+                                 UnitVec3(0,0,dir), options, geod);
+        return;
+    }
+
+    // Plane function in terms of the unsigned angle u traveled from P.
+    const Real c = xP[2];
+    const Real sqrt1m2 = std::sqrt(1+m*m);
+    const Real uMax = MaxLength / (radius*sqrt1m2);
+    struct PlaneFunc {
+        Real operator()(Real u) const {
+            const Real phi = phiP + orientation*u;
+            return radius*(n[0]*std::cos(phi) + n[1]*std::sin(phi))
+                   + n[2]*(radius*m*orientation*u + c) - d;
+        }
+        Real phiP, orientation, radius, m, c, d; Vec3 n;
+    } f = {phiP, orientation, radius, m, c, d, n};
+
+    const Real du = Pi/8;
+    Real u = uMax, uLo = 0, fLo = f(0);
+    while (uLo < uMax) {
+        const Real uHi = std::min(uLo+du, uMax), fHi = f(uHi);
+        if (fLo != 0 && fLo*fHi <= 0) {
+            Real a = uLo, b = uHi;
+            for (int i=0; i < 100 && b-a > SignificantReal*b; ++i) {
+                const Real mid = (a+b)/2, fMid = f(mid);
+                if (fMid*fLo > 0) a = mid; else b = mid;
+            }
+            u = (a+b)/2;
+            break;
+        }
+        uLo = uHi; fLo = fHi;
+    }
+
+    setGeodesicToHelicalArc(radius, phiP, orientation*u, m, c, geod);
 }
 
 Real CylinderImplicitFunction::
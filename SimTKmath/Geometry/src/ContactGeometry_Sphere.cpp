@@ -208,9 +208,15 @@ static void setGeodesicToArc(const UnitVec3& e1, const UnitVec3& e2,
         geod.addDirectionalSensitivityQtoP(jQP);
 
 
-        // TODO: positional sensitivity
-        geod.addPositionalSensitivityPtoQ(Vec2(NaN));
-        geod.addPositionalSensitivityQtoP(Vec2(NaN));
+        // Positional sensitivity solves the same equation with j(0)=1 and
+        // j'(0)=0, that is, a sideways shift of the start point with the
+        // initial direction kept parallel:
+        //
+        //        j  =        cos(1/R * s)
+        //        j' = -1/R * sin(1/R * s) .
+        geod.addPositionalSensitivityPtoQ(Vec2(cos(k * s), -k*sin(k * s)));
+        geod.addPositionalSensitivityQtoP(Vec2(cos(k * (L-s)), 
+                                               -k*sin(k * (L-s))));
 
         geod.addCurvature(k);
     }
@@ -233,10 +239,19 @@ calcGeodesicAnalytical(const Vec3& xP, const Vec3& xQ,
     const UnitVec3 e1(xP), e_OQ(xQ);
     const Vec3 arcAxis = e1 % e_OQ;
 
-    const Real sinAngle = arcAxis.norm();
+    Real sinAngle = arcAxis.norm();
     const Real cosAngle = ~e1*e_OQ;
 
-    UnitVec3 e3(arcAxis/sinAngle, true);
+    // If P and Q are (nearly) coincident or antipodal they don't determine
+    // the plane of the arc, so take it from the hint at P instead. Then the
+    // arc is either empty or a half-turn in the direction of the hint.
+    UnitVec3 e3;
+    if (sinAngle <= SqrtEps) {
+        const Vec3 hintAxis = e1 % tPhint;
+        e3 = hintAxis.norm() > 0 ? UnitVec3(hintAxis) : e1.perp();
+        sinAngle = 0;
+    } else
+        e3 = UnitVec3(arcAxis/sinAngle, true);
 
     // Tangent vectors tP and tQ at P and Q corresponding to a positive rotation
     // of the arc around e3.
@@ -285,24 +300,45 @@ void ContactGeometry::Sphere::Impl::shootGeodesicInDirectionUntilLengthReachedAn
     UnitVec3 e_OP(xP);
     Real angle = terminatingLength/radius;
 
-    setGeodesicToArc(e_OP, tP, radius, angle, geod);
+    // tP must be exactly perpendicular to e_OP; remove any normal component.
+    const UnitVec3 tPproj(tP - (~tP*e_OP)*e_OP);
+
+    setGeodesicToArc(e_OP, tPproj, radius, angle, geod);
 }
 
 void ContactGeometry::Sphere::Impl::shootGeodesicInDirectionUntilPlaneHitAnalytical(const Vec3& xP, const UnitVec3& tP,
         const Plane& terminatingPlane, const GeodesicOptions& options,
         Geodesic& geod) const {
 
+    // Give up after this length if the plane is never reached, the same as
+    // the numerical integrator does.
+    const Real MaxLength = 100;
+
     UnitVec3 e_OP(xP);
 
-    // solve ~( e_OP * cos(t) + tP * sin(t) - pt_on_plane )*plane_normal = 0
-    // for sphere plane offset is zero, therefore pt_on_plane = 0
-    Real a = ~e_OP*terminatingPlane.getNormal();
-    Real b = ~tP*terminatingPlane.getNormal();
-    Real alpha = std::atan2(a,b);
-    Real angle = (alpha > 0 ? Pi-alpha : -alpha);
-//    std::cout << "a=" << a << ", b=" << b << ", alpha = " << alpha << std::endl;
+    // tP must be exactly perpendicular to e_OP; remove any normal component.
+    const UnitVec3 tPproj(tP - (~tP*e_OP)*e_OP);
+
+    // Solve ~(r*(e_OP*cos(t) + tP*sin(t)))*n = d for the first t > 0. With
+    // a = ~e_OP*n = R cos(phi) and b = ~tP*n = R sin(phi) that is 
+    // r*R*cos(t-phi) = d, which has no solution if the great circle doesn't
+    // reach the plane.
+    const Vec3& n = terminatingPlane.getNormal();
+    const Real d = terminatingPlane.getOffset();
+    const Real a = ~e_OP*n;
+    const Real b = ~tPproj*n;
+    const Real rR = radius*std::sqrt(a*a + b*b);
+    Real angle = MaxLength/radius;
+    if (rR > 0 && std::abs(d) <= rR) {
+        const Real phi = std::atan2(b, a);
+        const Real delta = std::acos(d/rR);
+        for (Real t : {phi-delta, phi+delta}) {
+            if (t <= 0) t += 2*Pi;
+            angle = std::min(angle, t);
+        }
+    }
 
-    setGeodesicToArc(e_OP, tP, radius, angle, geod);
+    setGeodesicToArc(e_OP, tPproj, radius, angle, geod);
 }
 
 
@@ -654,7 +654,7 @@ bool AbstractIntegratorRep::takeOneStep(Real tMax, Real tReport)
     // From above we have earliestTimeEst which is the time at which we
     // think the first event is triggering.
 
-    Vector eLow = e0, eHigh = e1;
+    Vector eLow = e0, eHigh = e1, eMid;
     Real bias = 1; // neutral
 
     // There is an event in (tLow,tHigh], with the eariest occurrence
@@ -679,12 +679,20 @@ bool AbstractIntegratorRep::takeOneStep(Real tMax, Real tReport)
 
         createInterpolatedState(tMid);
 
+        // Only the candidates' trigger functions are examined from here on,
+        // so we realize the interpolated state only as far as the highest 
+        // stage among them. Position- and velocity-level witnesses, such as
+        // those for contact and joint limits, then don't require forces or
+        // accelerations. Entries of eMid for higher-stage triggers are NaN
+        // but none of those can be candidates.
         // Failure to evaluate at the interpolated state is a disaster of some
         // kind, not something we expect to be able to recover from, so this 
         // will throw an exception if it fails.
-        realizeStateDerivatives(getInterpolatedState());
-
-        const Vector& eMid = getInterpolatedState().getEventTriggers();
+        const Stage triggerStage = 
+            findEventTriggerStage(getInterpolatedState(), eventCandidates);
+        realizeEventTriggers(getInterpolatedState(), triggerStage);
+        getEventTriggersThroughStage(getInterpolatedState(), triggerStage, 
+                                     eMid);
 
         // TODO: should search in the wider interval first
 
@@ -164,13 +164,16 @@ nvgetarraypointer_SimTK(N_Vector nvx) {
 // delete the old data here; we're assuming that the N_Vector
 // user is holding onto a pointer to it obtained with
 // N_VGetArrayPointer above. If that's not right then there
-// is going to be a leak here.
+// is going to be a leak here. The pointers must be exchanged
+// without copying, and the user is expected to restore the
+// original data before the N_Vector is destroyed, so we swap
+// blocks even though vdata may not come from the MatrixAllocator.
 static void        
 nvsetarraypointer_SimTK(realtype* vdata, N_Vector nvz) {
     Vector& z = N_Vector_SimTK::updVector(nvz);
     assert(z.hasContiguousData());
     realtype* oldData;
-    z.swapOwnedContiguousScalarData(vdata, z.size(), oldData);
+    z.swapOwnedContiguousScalarBlock(vdata, z.size(), oldData);
     // don't do anything with oldData here
 }
 
@@ -118,10 +118,17 @@ public:
      */
     int root(Real t, const Vector& y, const Vector& yp, Vector& gout) const override {
         try { 
-            integ.setAdvancedStateAndRealizeDerivatives(t,y);
+            // Realize only as far as the highest stage that has triggers.
+            integ.setAdvancedStateAndRealizeKinematics(t,y);
+            const State& advanced = integ.getAdvancedState();
+            Stage g = Stage::HighestRuntime;
+            while (g > Stage::Empty && advanced.getNEventTriggersByStage(g) == 0)
+                --g;
+            integ.realizeEventTriggers(advanced, g);
+            CPodesIntegratorRep::getEventTriggersThroughStage(advanced, g, 
+                                                              gout);
         }
         catch(...) { return CPodes::RecoverableError; } // assume recoverable
-        gout = integ.getAdvancedState().getEventTriggers();
         return CPodes::Success;
     }
 private:
@@ -449,6 +449,21 @@ public:
             ids.push_back(eventTriggerInfo[indices[i]].getEventId());
     }
 
+    /// Given a list of events, specified by their indices in the list of trigger functions,
+    /// find the stage through which a state must be realized for all of their trigger
+    /// functions to be valid. Returns Stage::Empty if the list is empty.
+    static Stage findEventTriggerStage(const State& s, const Array_<SystemEventTriggerIndex>& indices) {
+        if (indices.empty())
+            return Stage::Empty;
+        // The trigger functions are ordered by stage, so it is the last one that matters.
+        const int last = *std::max_element(indices.begin(), indices.end());
+        Stage g = Stage::Empty;
+        for (int end = s.getNEventTriggersByStage(g); end <= last;
+             end += s.getNEventTriggersByStage(g))
+            ++g;
+        return g;
+    }
+
     // Calculate the error norm using RMS or Inf norm, and report which y
     // was dominant.
     Real calcErrorNorm(const State& s, const Vector& yErrEst, 
@@ -760,6 +775,37 @@ protected:
         }
     }
 
+    // Realize the supplied state far enough to evaluate the event trigger
+    // functions of stage g and below. A state that has been realized through
+    // Velocity stage needs no further work for position- and velocity-level
+    // triggers; otherwise this counts as a realization like 
+    // realizeStateDerivatives(). Throws an exception if it fails.
+    void realizeEventTriggers(const State& s, Stage g) const {
+        if (g >= Stage::Acceleration)
+            realizeStateDerivatives(s);
+        if (s.getSystemStage() < g) {
+            ++statsRealizations; ++statsRealizationFailures;
+            getSystem().realize(s, g);
+            --statsRealizationFailures;
+        }
+    }
+
+    // Copy into e the event trigger function values of stage g and below from
+    // a state that has been realized through g; State::getEventTriggers()
+    // can't be used for that unless g is Acceleration or higher. The values
+    // of any higher-stage triggers are not available and are set to NaN.
+    static void getEventTriggersThroughStage(const State& s, Stage g, 
+                                             Vector& e) {
+        e.resize(s.getNEventTriggers());
+        int next = 0;
+        for (int j=0; j < Stage::NValid; ++j) {
+            const int n = s.getNEventTriggersByStage(Stage(j));
+            if (j <= g) e(next, n) = s.getEventTriggersByStage(Stage(j));
+            else        e(next, n) = NaN;
+            next += n;
+        }
+    }
+
     // State should have had its q's prescribed and realized through Position
     // stage. This will attempt to project q's and the q part of the yErrEst
     // (if yErrEst is not length zero). Returns false if we fail which you
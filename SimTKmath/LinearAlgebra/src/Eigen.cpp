@@ -77,14 +77,24 @@ Eigen::Eigen( const Eigen& c ) {
 }
 // copy assignment operator
 Eigen& Eigen::operator=(const Eigen& rhs) {
-    rep = rhs.rep->clone();
+    if (&rhs != this) {
+        delete rep;
+        rep = rhs.rep->clone();
+    }
     return *this;
 }
 
 template < class ELT >
 void Eigen::factor( const Matrix_<ELT>& m ) {
+    typedef EigenRep<typename CNT<ELT>::StdNumber> Rep;
+    // Refactoring a matrix of the same element type reuses the storage.
+    if (Rep* r = dynamic_cast<Rep*>(rep)) {
+        r->refactor( m );
+        return;
+    }
+    EigenRepBase* newRep = new Rep(m); // might throw
     delete rep;
-    rep = new EigenRep<typename CNT<ELT>::StdNumber>(m); 
+    rep = newRep;
 }
 
 template <class VAL, class VEC> 
@@ -154,6 +164,20 @@ EigenRep<T>::EigenRep( const Matrix_<ELT>& mat):
     isFactored = true;
         
 }
+template <typename T >
+    template < typename ELT >
+void EigenRep<T>::refactor( const Matrix_<ELT>& mat ) {
+    n = mat.ncol();
+    inputMatrix.resize(n*n);   // no-op if the size is unchanged
+    structure = mat.getMatrixCharacter().getStructure();
+    range = AllValues;
+    valuesFound = 0;
+    vectorsInMatrix = false;
+    needValues = true;
+    needVectors = true;
+    LapackConvert::convertMatrixToLapack( inputMatrix.data, mat );
+    isFactored = true;
+}
 template <typename T >
 EigenRepBase* EigenRep<T>::clone() const {
    return( new EigenRep<T>(*this) );
@@ -714,6 +738,19 @@ template SimTK_SIMMATH_EXPORT Eigen::Eigen( const Matrix_<negator< std::complex<
 template SimTK_SIMMATH_EXPORT Eigen::Eigen( const Matrix_<negator< conjugate<float> > >& m );
 template SimTK_SIMMATH_EXPORT Eigen::Eigen( const Matrix_<negator< conjugate<double> > >& m );
 
+template SimTK_SIMMATH_EXPORT void Eigen::factor( const Matrix_<double>& m );
+template SimTK_SIMMATH_EXPORT void Eigen::factor( const Matrix_<float>& m );
+template SimTK_SIMMATH_EXPORT void Eigen::factor( const Matrix_<std::complex<float> >& m );
+template SimTK_SIMMATH_EXPORT void Eigen::factor( const Matrix_<std::complex<double> >& m );
+template SimTK_SIMMATH_EXPORT void Eigen::factor( const Matrix_<conjugate<float> >& m );
+template SimTK_SIMMATH_EXPORT void Eigen::factor( const Matrix_<conjugate<double> >& m );
+template SimTK_SIMMATH_EXPORT void Eigen::factor( const Matrix_<negator< double> >& m );
+template SimTK_SIMMATH_EXPORT void Eigen::factor( const Matrix_<negator< float> >& m );
+template SimTK_SIMMATH_EXPORT void Eigen::factor( const Matrix_<negator< std::complex<float> > >& m );
+template SimTK_SIMMATH_EXPORT void Eigen::factor( const Matrix_<negator< std::complex<double> > >& m );
+template SimTK_SIMMATH_EXPORT void Eigen::factor( const Matrix_<negator< conjugate<float> > >& m );
+template SimTK_SIMMATH_EXPORT void Eigen::factor( const Matrix_<negator< conjugate<double> > >& m );
+
 //template SimTK_SIMMATH_EXPORT void Eigen::getAllEigenValuesAndVectors<float, float >(Vector_<float>&, Matrix_<float>& );
 //template SimTK_SIMMATH_EXPORT void Eigen::getAllEigenValuesAndVectors<double, double >(Vector_<double>&, Matrix_<double>& );
 //template SimTK_SIMMATH_EXPORT void Eigen::getAllEigenValuesAndVectors<float, std::complex<float> >(Vector_<float>&, Matrix_<std::complex<float> >& );
@@ -263,6 +263,9 @@ class EigenRep : public EigenRepBase {
     EigenRepBase* clone() const override;
 
     typedef typename CNT<T>::TReal RType;
+    // Supply a new matrix, which may have a different size, reusing this
+    // rep's storage where possible.
+    template <class ELT> void refactor( const Matrix_<ELT>& );
 //    template <class VAL, class VEC> void getAllEigenValuesAndVectors( Vector_<VAL>& values, Matrix_<VEC>& vectors);
     void getAllEigenValuesAndVectors( Vector_<std::complex<RType> >& values, Matrix_<std::complex<RType> >& vectors) override;
     void getAllEigenValuesAndVectors( Vector_<RType>& values, Matrix_<RType>& vectors) override;
@@ -73,7 +73,10 @@ FactorLU::FactorLU( const FactorLU& c ) {
 }
 // copy assignment operator
 FactorLU& FactorLU::operator=(const FactorLU& rhs) {
-    rep = rhs.rep->clone();
+    if (&rhs != this) {
+        delete rep;
+        rep = rhs.rep->clone();
+    }
     return *this;
 }
 
@@ -90,8 +93,15 @@ FactorLU::FactorLU( const Matrix_<ELT>& m ) {
 
 template < class ELT >
 void FactorLU::factor( const Matrix_<ELT>& m ) {
+    typedef FactorLURep<typename CNT<ELT>::StdNumber> Rep;
+    // Refactoring a matrix of the same element type reuses the storage.
+    if (Rep* r = dynamic_cast<Rep*>(rep)) {
+        r->refactor( m );
+        return;
+    }
+    FactorLURepBase* newRep = new Rep(m); // might throw
     delete rep;
-    rep = new FactorLURep<typename CNT<ELT>::StdNumber>(m);
+    rep = newRep;
 }
 
 template < typename ELT >
@@ -166,6 +176,16 @@ FactorLURep<T>::FactorLURep()
         lu(0)
 {
 }
+template <typename T >
+    template < typename ELT >
+void FactorLURep<T>::refactor( const Matrix_<ELT>& mat ) {
+    nRow = mat.nrow();
+    nCol = mat.ncol();
+    mn = (nRow < nCol) ? nRow : nCol;
+    pivots.resize(nCol);   // no-ops if the size is unchanged
+    lu.resize(nRow*nCol);
+    factor( mat );
+}
 template <typename T >
 FactorLURep<T>::~FactorLURep() {}
  
@@ -0,0 +1,278 @@
+/* -------------------------------------------------------------------------- *
+ *                        Simbody(tm): SimTKmath                              *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/**@file
+ *
+ * Factors symmetric positive semidefinite systems of linear equations using
+ * a Cholesky factorization with diagonal pivoting.
+ */
+
+#include "SimTKcommon.h"
+
+#include "simmath/internal/common.h"
+#include "simmath/LinearAlgebra.h"
+
+#include "LapackInterface.h"
+#include "FactorCholeskyRep.h"
+#include "WorkSpace.h"
+#include "LATraits.h"
+#include "LapackConvert.h"
+
+#include <algorithm>
+
+
+namespace SimTK {
+
+   ///////////////////////////
+   // FactorCholeskyDefault //
+   ///////////////////////////
+FactorCholeskyDefault::FactorCholeskyDefault() {
+    isFactored = false;
+}
+FactorCholeskyRepBase* FactorCholeskyDefault::clone() const {
+    return( new FactorCholeskyDefault(*this));
+}
+
+   ////////////////////
+   // FactorCholesky //
+   ////////////////////
+FactorCholesky::~FactorCholesky() {
+    delete rep;
+}
+// default constructor
+FactorCholesky::FactorCholesky() {
+    rep = new FactorCholeskyDefault();
+}
+// copy constructor
+FactorCholesky::FactorCholesky( const FactorCholesky& c ) {
+    rep = c.rep->clone();
+}
+// copy assignment operator
+FactorCholesky& FactorCholesky::operator=(const FactorCholesky& rhs) {
+    if (&rhs != this) {
+        delete rep;
+        rep = rhs.rep->clone();
+    }
+    return *this;
+}
+
+// Refactoring a matrix of the same element type reuses the existing rep and
+// its storage.
+template < class ELT, class RC >
+static void refactorCholesky( FactorCholeskyRepBase*& rep,
+                              const Matrix_<ELT>& m, RC rcond ) {
+    typedef typename CNT<ELT>::StdNumber T;
+    if (FactorCholeskyRep<T>* r = dynamic_cast<FactorCholeskyRep<T>*>(rep)) {
+        r->factor( m, (T)rcond );
+        return;
+    }
+    // might throw
+    FactorCholeskyRepBase* newRep = new FactorCholeskyRep<T>(m, (T)rcond);
+    delete rep;
+    rep = newRep;
+}
+
+template < class ELT >
+FactorCholesky::FactorCholesky( const Matrix_<ELT>& m ) {
+    rep = new FactorCholeskyDefault();
+    factor( m );
+}
+template < class ELT >
+FactorCholesky::FactorCholesky( const Matrix_<ELT>& m, double rcond ) {
+    rep = new FactorCholeskyDefault();
+    refactorCholesky(rep, m, rcond);
+}
+template < class ELT >
+FactorCholesky::FactorCholesky( const Matrix_<ELT>& m, float rcond ) {
+    rep = new FactorCholeskyDefault();
+    refactorCholesky(rep, m, rcond);
+}
+template < class ELT >
+void FactorCholesky::factor( const Matrix_<ELT>& m ) {
+    // if user does not supply rcond set it to n*(eps)^7/8 as for FactorQTZ
+    refactorCholesky(rep, m,
+        m.nrow()*NTraits<typename CNT<ELT>::Precision>::getSignificant());
+}
+template < class ELT >
+void FactorCholesky::factor( const Matrix_<ELT>& m, double rcond ) {
+    refactorCholesky(rep, m, rcond);
+}
+template < class ELT >
+void FactorCholesky::factor( const Matrix_<ELT>& m, float rcond ) {
+    refactorCholesky(rep, m, rcond);
+}
+
+int FactorCholesky::getRank() const {
+    return(rep->rank);
+}
+double FactorCholesky::getRCondEstimate() const {
+    return (rep->actualRCond);
+}
+template < typename ELT >
+void FactorCholesky::solve( const Vector_<ELT>& b, Vector_<ELT>& x ) const {
+    rep->solve( b, x );
+}
+template < class ELT >
+void FactorCholesky::solve( const Matrix_<ELT>& b, Matrix_<ELT>& x ) const {
+    rep->solve( b, x );
+}
+
+   ///////////////////////
+   // FactorCholeskyRep //
+   ///////////////////////
+template <typename T >
+    template < typename ELT >
+FactorCholeskyRep<T>::FactorCholeskyRep( const Matrix_<ELT>& mat, T rcond )
+:   n(0) {
+    factor( mat, rcond );
+}
+
+template <typename T >
+FactorCholeskyRepBase* FactorCholeskyRep<T>::clone() const {
+   return( new FactorCholeskyRep<T>(*this) );
+}
+
+template <typename T >
+FactorCholeskyRep<T>::~FactorCholeskyRep() {}
+
+template <class T>
+    template <typename ELT>
+void FactorCholeskyRep<T>::factor( const Matrix_<ELT>& mat, T rcond ) {
+    SimTK_APIARGCHECK2_ALWAYS(mat.nelt() > 0,"FactorCholesky","factor",
+       "Can't factor a matrix that has a zero dimension -- got %d X %d.",
+       (int)mat.nrow(), (int)mat.ncol());
+    SimTK_APIARGCHECK2_ALWAYS(mat.nrow() == mat.ncol(),
+       "FactorCholesky","factor",
+       "The matrix must be square but was %d X %d.",
+       (int)mat.nrow(), (int)mat.ncol());
+
+    isFactored = false;
+    n = mat.nrow();
+    pivots.resize(n);   // no-ops if the size is unchanged
+    chol.resize(n*n);
+    work.resize(2*n);
+
+    // converts (negated etc.) to LAPACK format
+    LapackConvert::convertMatrixToLapack( chol.data, mat );
+
+    T maxDiag = 0;
+    for (int i=0; i < n; ++i)
+        maxDiag = std::max(maxDiag, chol.data[i*n+i]);
+
+    rank = 0;
+    actualRCond = 0;
+    if (maxDiag > 0) {
+        // info > 0 just reports that the matrix was rank deficient; the
+        // leading rank X rank block of L is still valid.
+        int info;
+        LapackInterface::pstrf<T>('L', n, chol.data, n, pivots.data, rank,
+                                  rcond*maxDiag, work.data, info);
+        if (rank > 0) {
+            const T ratio = chol.data[(rank-1)*n + rank-1] / chol.data[0];
+            actualRCond = (double)(ratio*ratio);
+        }
+    }
+    isFactored = true;
+}
+
+template < class T >
+void FactorCholeskyRep<T>::solve( const Vector_<T>& b, Vector_<T>& x ) const {
+    checkIfFactored();
+    SimTK_APIARGCHECK2_ALWAYS(b.size()==n,"FactorCholesky","solve",
+       "number of rows in right hand side=%d does not match number of rows in original matrix=%d \n",
+        b.size(), n );
+
+    Matrix_<T> bm(n, 1), xm;
+    for (int i=0; i < n; ++i)
+        bm(i,0) = b[i];
+    doSolve( bm, xm );
+    x.resize(n);
+    for (int i=0; i < n; ++i)
+        x[i] = xm(i,0);
+}
+
+template < class T >
+void FactorCholeskyRep<T>::solve( const Matrix_<T>& b, Matrix_<T>& x ) const {
+    checkIfFactored();
+    SimTK_APIARGCHECK2_ALWAYS(b.nrow()==n,"FactorCholesky","solve",
+       "number of rows in right hand side=%d does not match number of rows in original matrix=%d \n",
+        b.nrow(), n );
+
+    doSolve( b, x );
+}
+
+// x = P L^-T L^-1 P' b, using only the first rank columns of L.
+template < class T >
+void FactorCholeskyRep<T>::doSolve( const Matrix_<T>& b, Matrix_<T>& x ) const {
+    const int nrhs = b.ncol();
+    x.resize(n, nrhs);
+    if (rank == 0 || nrhs == 0) {
+        x.setToZero();
+        return;
+    }
+
+    Matrix_<T> y(n, nrhs);
+    for (int j=0; j < nrhs; ++j)
+        for (int i=0; i < n; ++i)
+            y(i,j) = b(pivots.data[i]-1, j);
+
+    LapackInterface::trsm<T>('L', 'L', 'N', 'N', rank, nrhs, 1,
+                             chol.data, n, &y(0,0), n);
+    LapackInterface::trsm<T>('L', 'L', 'T', 'N', rank, nrhs, 1,
+                             chol.data, n, &y(0,0), n);
+
+    for (int j=0; j < nrhs; ++j)
+        for (int i=0; i < n; ++i)
+            x(pivots.data[i]-1, j) = i < rank ? y(i,j) : T(0);
+}
+
+// instantiate
+template SimTK_SIMMATH_EXPORT FactorCholesky::FactorCholesky( const Matrix_<double>& m );
+template SimTK_SIMMATH_EXPORT FactorCholesky::FactorCholesky( const Matrix_<float>& m );
+template SimTK_SIMMATH_EXPORT FactorCholesky::FactorCholesky( const Matrix_<negator< double> >& m );
+template SimTK_SIMMATH_EXPORT FactorCholesky::FactorCholesky( const Matrix_<negator< float> >& m );
+
+template SimTK_SIMMATH_EXPORT FactorCholesky::FactorCholesky( const Matrix_<double>& m, double rcond );
+template SimTK_SIMMATH_EXPORT FactorCholesky::FactorCholesky( const Matrix_<float>& m, float rcond );
+template SimTK_SIMMATH_EXPORT FactorCholesky::FactorCholesky( const Matrix_<negator< double> >& m, double rcond );
+template SimTK_SIMMATH_EXPORT FactorCholesky::FactorCholesky( const Matrix_<negator< float> >& m, float rcond );
+
+template SimTK_SIMMATH_EXPORT void FactorCholesky::factor( const Matrix_<double>& m );
+template SimTK_SIMMATH_EXPORT void FactorCholesky::factor( const Matrix_<float>& m );
+template SimTK_SIMMATH_EXPORT void FactorCholesky::factor( const Matrix_<negator< double> >& m );
+template SimTK_SIMMATH_EXPORT void FactorCholesky::factor( const Matrix_<negator< float> >& m );
+
+template SimTK_SIMMATH_EXPORT void FactorCholesky::factor( const Matrix_<double>& m, double rcond );
+template SimTK_SIMMATH_EXPORT void FactorCholesky::factor( const Matrix_<float>& m, float rcond );
+template SimTK_SIMMATH_EXPORT void FactorCholesky::factor( const Matrix_<negator< double> >& m, double rcond );
+template SimTK_SIMMATH_EXPORT void FactorCholesky::factor( const Matrix_<negator< float> >& m, float rcond );
+
+template class FactorCholeskyRep<double>;
+template class FactorCholeskyRep<float>;
+
+template SimTK_SIMMATH_EXPORT void FactorCholesky::solve<float>(const Vector_<float>&, Vector_<float>&) const;
+template SimTK_SIMMATH_EXPORT void FactorCholesky::solve<double>(const Vector_<double>&, Vector_<double>&) const;
+template SimTK_SIMMATH_EXPORT void FactorCholesky::solve<float>(const Matrix_<float>&, Matrix_<float>&) const;
+template SimTK_SIMMATH_EXPORT void FactorCholesky::solve<double>(const Matrix_<double>&, Matrix_<double>&) const;
+
+} // namespace SimTK
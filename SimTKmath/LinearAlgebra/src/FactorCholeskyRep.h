@@ -0,0 +1,106 @@
+#ifndef SimTK_SIMMATH_FACTOR_CHOLESKY_REP_H_
+#define SimTK_SIMMATH_FACTOR_CHOLESKY_REP_H_
+
+/* -------------------------------------------------------------------------- *
+ *                        Simbody(tm): SimTKmath                              *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "SimTKmath.h"
+#include "WorkSpace.h"
+
+namespace SimTK {
+
+class FactorCholeskyRepBase {
+public:
+    FactorCholeskyRepBase() : isFactored(false), rank(0), actualRCond(0) {}
+
+    virtual ~FactorCholeskyRepBase(){};
+
+    virtual FactorCholeskyRepBase* clone() const { return 0; };
+    virtual void solve( const Vector_<float>& b, Vector_<float>& x ) const {
+        checkIfFactored();
+        SimTK_APIARGCHECK_ALWAYS(false,"FactorCholesky","solve",
+        "solve called with rhs of type <float>  which does not match type of original linear system \n");
+    }
+    virtual void solve( const Vector_<double>& b, Vector_<double>& x ) const {
+        checkIfFactored();
+        SimTK_APIARGCHECK_ALWAYS(false,"FactorCholesky","solve",
+        "solve called with rhs of type <double>  which does not match type of original linear system \n");
+    }
+    virtual void solve( const Matrix_<float>& b, Matrix_<float>& x ) const {
+        checkIfFactored();
+        SimTK_APIARGCHECK_ALWAYS(false,"FactorCholesky","solve",
+        "solve called with rhs of type <float>  which does not match type of original linear system \n");
+    }
+    virtual void solve( const Matrix_<double>& b, Matrix_<double>& x ) const {
+        checkIfFactored();
+        SimTK_APIARGCHECK_ALWAYS(false,"FactorCholesky","solve",
+        "solve called with rhs of type <double>  which does not match type of original linear system \n");
+    }
+
+    bool isFactored;
+    int rank;     // number of pivots kept
+    double actualRCond; // smallest kept pivot / largest pivot
+
+    void checkIfFactored()  const {
+        if( !isFactored ) {
+            SimTK_APIARGCHECK_ALWAYS(false,"FactorCholesky","solve",
+            "solve called before the matrix was factored \n");
+        }
+    }
+
+}; // class FactorCholeskyRepBase
+
+class FactorCholeskyDefault : public FactorCholeskyRepBase {
+   public:
+       FactorCholeskyDefault();
+       FactorCholeskyRepBase* clone() const override;
+};
+
+template <typename T>
+class FactorCholeskyRep : public FactorCholeskyRepBase {
+public:
+   template <class ELT> FactorCholeskyRep( const Matrix_<ELT>&, T rcond );
+
+   ~FactorCholeskyRep();
+
+   // Factor a new matrix, which may have a different size, reusing this
+   // rep's storage where possible.
+   template < class ELT > void factor( const Matrix_<ELT>&, T rcond );
+   void solve( const Vector_<T>& b, Vector_<T>& x ) const override;
+   void solve( const Matrix_<T>& b, Matrix_<T>& x ) const override;
+
+   FactorCholeskyRepBase* clone() const override;
+
+private:
+   void doSolve( const Matrix_<T>& b, Matrix_<T>& x ) const;
+
+   int                      n;        // dimension of the original matrix
+   TypedWorkSpace<int>      pivots;   // P(pivots[i]-1, i) = 1
+   TypedWorkSpace<T>        chol;     // L in the lower triangle
+   TypedWorkSpace<T>        work;     // for pstrf
+
+}; // end class FactorCholeskyRep
+
+} // namespace SimTK
+
+#endif   // SimTK_SIMMATH_FACTOR_CHOLESKY_REP_H_
@@ -71,7 +71,10 @@ FactorQTZ::FactorQTZ( const FactorQTZ& c ) {
 }
 // copy assignment operator
 FactorQTZ& FactorQTZ::operator=(const FactorQTZ& rhs) {
-    rep = rhs.rep->clone();
+    if (&rhs != this) {
+        delete rep;
+        rep = rhs.rep->clone();
+    }
     return *this;
 }
 
@@ -79,23 +82,32 @@ template <typename ELT>
 void FactorQTZ::inverse( Matrix_<ELT>& inverse ) const {
     rep->inverse( inverse );
 }
+// Refactoring a matrix of the same element type reuses the existing rep and
+// its workspace.
+template < class ELT, class RC >
+static void refactorQTZ( FactorQTZRepBase*& rep, const Matrix_<ELT>& m, RC rcond ) {
+    typedef FactorQTZRep<typename CNT<ELT>::StdNumber> Rep;
+    if (Rep* r = dynamic_cast<Rep*>(rep)) {
+        r->refactor( m, rcond );
+        return;
+    }
+    FactorQTZRepBase* newRep = new Rep(m, rcond); // might throw
+    delete rep;
+    rep = newRep;
+}
 template < class ELT >
 void FactorQTZ::factor( const Matrix_<ELT>& m ){
-    delete rep;
-  
     // if user does not supply rcond set it to max(nRow,nCol)*(eps)^7/8 (similar to matlab)
     int mnmax = (m.nrow() > m.ncol()) ? m.nrow() : m.ncol();
-    rep = new FactorQTZRep<typename CNT<ELT>::StdNumber>(m, mnmax*NTraits<typename CNT<ELT>::Precision>::getSignificant());
+    refactorQTZ(rep, m, mnmax*NTraits<typename CNT<ELT>::Precision>::getSignificant());
 }
 template < class ELT >
 void FactorQTZ::factor( const Matrix_<ELT>& m, double rcond ){
-    delete rep;
-    rep = new FactorQTZRep<typename CNT<ELT>::StdNumber>(m, rcond );
+    refactorQTZ(rep, m, rcond);
 }
 template < class ELT >
 void FactorQTZ::factor( const Matrix_<ELT>& m, float rcond ){
-    delete rep;
-    rep = new FactorQTZRep<typename CNT<ELT>::StdNumber>(m, rcond );
+    refactorQTZ(rep, m, rcond);
 }
 template < class ELT >
 FactorQTZ::FactorQTZ( const Matrix_<ELT>& m ) {
@@ -153,25 +165,64 @@ FactorQTZRep<T>::FactorQTZRep()
 template <typename T >
     template < typename ELT >
 FactorQTZRep<T>::FactorQTZRep( const Matrix_<ELT>& mat, typename CNT<T>::TReal rc) 
-:   mn( (mat.nrow() < mat.ncol()) ? mat.nrow() : mat.ncol() ),
-    maxmn( (mat.nrow() > mat.ncol()) ? mat.nrow() : mat.ncol() ),
-    nRow( mat.nrow() ),
-    nCol( mat.ncol() ),
+:   mn(0),
+    maxmn(0),
+    nRow(0),
+    nCol(0),
     scaleLinSys(false),
     linSysScaleF(NTraits<typename CNT<T>::Precision>::getNaN()),
     anrm(NTraits<typename CNT<T>::Precision>::getNaN()),
-    rcond(rc),
-    pivots(mat.ncol()),
-    qtz( mat.nrow()*mat.ncol() ),
-    tauGEQP3(mn),
-    tauORMQR(mn)    
+    rcond(rc)
 { 
-    for(int i=0; i<mat.ncol(); ++i) 
-        pivots.data[i] = 0;
+    allocate( mat.nrow(), mat.ncol() );
     FactorQTZRep<T>::factor( mat );
     isFactored = true;
 }
 
+template <typename T >
+    template < typename ELT >
+void FactorQTZRep<T>::refactor( const Matrix_<ELT>& mat, typename CNT<T>::TReal rc ) {
+    isFactored = false;
+    rcond = rc;
+    allocate( mat.nrow(), mat.ncol() );
+    FactorQTZRep<T>::factor( mat );
+    isFactored = true;
+}
+
+// Size the factorization storage and the workspace for factor(). The LAPACK
+// workspace queries are repeated only when the dimensions change.
+template <typename T >
+void FactorQTZRep<T>::allocate( int m, int n ) {
+    if (m == nRow && n == nCol && work.size > 0)
+        return;
+
+    nRow  = m;
+    nCol  = n;
+    mn    = std::min(m, n);
+    maxmn = std::max(m, n);
+    pivots.resize(n);
+    qtz.resize(m*n);
+    tauGEQP3.resize(mn);
+    tauORMQR.resize(mn);
+    if (mn == 0) {
+        work.resize(0);
+        return;
+    }
+
+    // Compute optimal size for work space for dtzrzf and dgepq3. The
+    // arguments here should match the calls in factor(), although we use
+    // maxRank rather than rank since we don't know the rank yet.
+    int info;
+    T workSz;
+    LapackInterface::tzrzf<T>(mn, nCol, 0, nRow, 0, &workSz, -1, info);
+    const int lwork1 = (int)NTraits<T>::real(workSz);
+
+    LapackInterface::geqp3<T>(nRow, nCol, 0, nRow, 0, 0, &workSz, -1, info);
+    const int lwork2 = (int)NTraits<T>::real(workSz);
+   
+    work.resize(std::max(lwork1, lwork2));
+}
+
 template <typename T >
 FactorQTZRepBase* FactorQTZRep<T>::clone() const {
    return( new FactorQTZRep<T>(*this) );
@@ -325,10 +376,17 @@ void FactorQTZRep<T>::factor(const Matrix_<ELT>&mat )  {
        (int)mat.nrow(), (int)mat.ncol());
 
 
-    // allocate and initialize the matrix we pass to LAPACK
+    // initialize the matrix we pass to LAPACK
     // converts (negated,conjugated etc.) to LAPACK format 
     LapackConvert::convertMatrixToLapack( qtz.data, mat );
 
+    // all columns are free to be pivoted
+    for(int i=0; i<nCol; ++i) 
+        pivots.data[i] = 0;
+    scaleLinSys = false;
+    rank = 0;
+    actualRCond = 0;
+
     int info;
     const int smallestSingularValue = 2;
     const int largestSingularValue = 1;
@@ -337,20 +395,6 @@ void FactorQTZRep<T>::factor(const Matrix_<ELT>&mat )  {
 
     if (mat.nelt() == 0) return;
 
-
-    // Compute optimal size for work space for dtzrzf and dgepq3. The
-    // arguments here should match the calls below, although we'll use maxRank
-    // rather than rank since we don't know the rank yet.
-    T workSz;
-    const int maxRank = std::min(nRow, nCol);
-    LapackInterface::tzrzf<T>(maxRank, nCol, 0, nRow, 0, &workSz, -1, info);
-    const int lwork1 = (int)NTraits<T>::real(workSz);
-
-    LapackInterface::geqp3<T>(nRow, nCol, 0, nRow, 0, 0, &workSz, -1, info);
-    const int lwork2 = (int)NTraits<T>::real(workSz);
-   
-    TypedWorkSpace<T> work(std::max(lwork1, lwork2));
-
     LapackInterface::getMachinePrecision<RealType>( smlnum, bignum);
 
     // scale the input system of equations
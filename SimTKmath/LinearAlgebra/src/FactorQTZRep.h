@@ -123,6 +123,9 @@ public:
    ~FactorQTZRep();
 
    template < class ELT > void factor(const Matrix_<ELT>& ); 
+   // Factor a new matrix, which may have a different size, reusing this
+   // rep's storage and workspace where possible.
+   template < class ELT > void refactor(const Matrix_<ELT>&, typename CNT<T>::TReal ); 
    void inverse( Matrix_<T>& ) const override; 
    void solve( const Vector_<T>& b, Vector_<T>& x ) const override;
    void solve( const Matrix_<T>& b, Matrix_<T>& x ) const override;
@@ -131,6 +134,7 @@ public:
  
 private:
    void doSolve( Matrix_<T>& b, Matrix_<T>& x ) const;
+   void allocate( int nRow, int nCol );
 
    int                      mn;           // min of number of rows or columns
    int                      maxmn;        // max of number of rows or columns
@@ -144,6 +148,7 @@ private:
    TypedWorkSpace<T>        qtz;     // factored matrix
    TypedWorkSpace<T>        tauGEQP3;
    TypedWorkSpace<T>        tauORMQR;
+   TypedWorkSpace<T>        work;    // for geqp3 and tzrzf
 
 }; // end class FactorQTZRep
 
@@ -206,6 +206,9 @@ class FactorLURep : public FactorLURepBase {
    FactorLURepBase* clone() const override;
 
    template < class ELT > void factor(const Matrix_<ELT>& ); 
+   // Factor a new matrix, which may have a different size, reusing this
+   // rep's storage where possible.
+   template < class ELT > void refactor(const Matrix_<ELT>& ); 
    void solve( const Vector_<T>& b, Vector_<T>& x ) const override;
    void solve( const Matrix_<T>& b, Matrix_<T>& x ) const override;
    void inverse( Matrix_<T>& m ) const override;
@@ -40,6 +40,7 @@
 
 #include <iostream> 
 #include <cstdio>
+#include <algorithm>
 #include <cmath>
 #include <complex>
 
@@ -72,7 +73,10 @@ FactorSVD::FactorSVD( const FactorSVD& c ) {
 }
 // copy assignment operator
 FactorSVD& FactorSVD::operator=(const FactorSVD& rhs) {
-    rep = rhs.rep->clone();
+    if (&rhs != this) {
+        delete rep;
+        rep = rhs.rep->clone();
+    }
     return *this;
 }
 int FactorSVD::getRank() {
@@ -109,24 +113,33 @@ FactorSVD::FactorSVD( const Matrix_<ELT>& m, float rcond ) {
     rep = new FactorSVDRep<typename CNT<ELT>::StdNumber>(m, rcond);
 }
 
+// Refactoring a matrix of the same element type reuses the existing rep and
+// its storage.
+template < class ELT, class RC >
+static void refactorSVD( FactorSVDRepBase*& rep, const Matrix_<ELT>& m, RC rcond ) {
+    typedef FactorSVDRep<typename CNT<ELT>::StdNumber> Rep;
+    if (Rep* r = dynamic_cast<Rep*>(rep)) {
+        r->refactor( m, rcond );
+        return;
+    }
+    FactorSVDRepBase* newRep = new Rep(m, rcond); // might throw
+    delete rep;
+    rep = newRep;
+}
 template < class ELT >
 void FactorSVD::factor( const Matrix_<ELT>& m ) {
-    delete rep;
-
     // if user does not supply rcond set it to max(nRow,nCol)*(eps)^7/8 (similar to matlab)
     int mnmax = (m.nrow() > m.ncol()) ? m.nrow() : m.ncol();
-    rep = new FactorSVDRep<typename CNT<ELT>::StdNumber>(m, mnmax*NTraits<typename CNT<ELT>::Precision>::getSignificant()); 
+    refactorSVD(rep, m, mnmax*NTraits<typename CNT<ELT>::Precision>::getSignificant());
 }
 
 template < class ELT >
 void FactorSVD::factor( const Matrix_<ELT>& m, double rcond ){
-    delete rep;
-    rep = new FactorSVDRep<typename CNT<ELT>::StdNumber>(m, rcond );
+    refactorSVD(rep, m, rcond);
 }
 template < class ELT >
 void FactorSVD::factor( const Matrix_<ELT>& m, float rcond ){
-    delete rep;
-    rep = new FactorSVDRep<typename CNT<ELT>::StdNumber>(m, rcond );
+    refactorSVD(rep, m, rcond);
 }
 
 template <class T> 
@@ -165,6 +178,30 @@ FactorSVDRep<T>::FactorSVDRep( const Matrix_<ELT>& mat, typename CNT<T>::TReal r
     isFactored = true;
         
 }
+template <typename T >
+    template < typename ELT >
+void FactorSVDRep<T>::refactor( const Matrix_<ELT>& mat, RType rc ) {
+    nCol = mat.ncol();
+    nRow = mat.nrow();
+    mn = (nRow < nCol) ? nRow : nCol;
+    maxmn = (nRow > nCol) ? nRow : nCol;
+    rank = 0;
+    rcond = rc;
+    structure = mat.getMatrixCharacter().getStructure();
+    singularValues.resize(mn);   // no-ops if the size is unchanged
+    inputMatrix.resize(nCol*nRow);
+    LapackConvert::convertMatrixToLapack( inputMatrix.data, mat );
+    isFactored = true;
+}
+// LAPACK overwrites the matrix it is given, so the SVD is computed from a
+// copy kept in scratch, which is reused from one call to the next.
+template <typename T >
+T* FactorSVDRep<T>::copyInputMatrix() {
+    scratch.resize(inputMatrix.size);
+    std::copy(inputMatrix.data, inputMatrix.data + inputMatrix.size, 
+              scratch.data);
+    return scratch.data;
+}
 template <typename T >
 int FactorSVDRep<T>::getRank() {
 
@@ -250,14 +287,14 @@ void FactorSVDRep<T>::doSolve(  Matrix_<T>& b, Matrix_<T>& x) {
 
     if( b.nelt() == 0 || inputMatrix.size == 0) return;
 
-    TypedWorkSpace<T> tempMatrix = inputMatrix;
+    T* tempMatrix = copyInputMatrix();
 
     x.resize(nCol, b.ncol() );
     Matrix_<T> tb;
     tb.resize(maxmn, b.ncol() );
     for(j=0;j<b.ncol();j++) for(i=0;i<b.nrow();i++) tb(i,j) = b(i,j);
 
-    LapackInterface::gelss<T>( nRow, nCol, mn, b.ncol(), tempMatrix.data, nRow, &tb(0,0), 
+    LapackInterface::gelss<T>( nRow, nCol, mn, b.ncol(), tempMatrix, nRow, &tb(0,0), 
                       tb.nrow(), singularValues.data, rcond, rank, info  );
 
     if( info > 0 ) {
@@ -316,8 +353,8 @@ void FactorSVDRep<T>::computeSVD( bool computeVectors, RType* values, T* leftVec
         jobz = 'N';
     }
 
-    TypedWorkSpace<T> tempMatrix = inputMatrix;
-    LapackInterface::gesdd<T>(jobz, nRow,nCol,tempMatrix.data, nRow, values,
+    T* tempMatrix = copyInputMatrix();
+    LapackInterface::gesdd<T>(jobz, nRow,nCol,tempMatrix, nRow, values,
            leftVectors, nRow, rightVectors, nCol, info);
 
     for(int i=0, rank=0;i<mn;i++) {
@@ -167,6 +167,9 @@ class FactorSVDRep : public FactorSVDRepBase {
 
     void getSingularValuesAndVectors( Vector_<RType>& values,   Matrix_<T>& leftVectors,  Matrix_<T>& rightVectors ) override;
     void getSingularValues( Vector_<RType>& values ) override;
+    // Supply a new matrix, which may have a different size, reusing this
+    // rep's storage where possible.
+    template <class ELT> void refactor( const Matrix_<ELT>&, RType );
     int getRank();
     void solve( const Vector_<T>& b, Vector_<T>& x ) override;
     void solve( const Matrix_<T>& b, Matrix_<T>& x ) override;
@@ -176,6 +179,7 @@ class FactorSVDRep : public FactorSVDRepBase {
 
     void computeSVD( bool, RType*, T*, T* );
     void doSolve( Matrix_<T>& b, Matrix_<T>& x );
+    T* copyInputMatrix();
     void inverse( Matrix_<T>& b ) override;
 
     int nCol;       // number of columns in original matrix
@@ -188,6 +192,7 @@ class FactorSVDRep : public FactorSVDRepBase {
     MatrixStructure structure;
     TypedWorkSpace<T> inputMatrix;
     TypedWorkSpace<RType> singularValues;
+    TypedWorkSpace<T> scratch;   // overwritten by LAPACK
 
 }; // end class FactorSVDRep
 } // namespace SimTK
@@ -1138,6 +1138,26 @@ void LapackInterface::potrf<std::complex<float> >( const char& uplo, const int n
         SimTK_THROW2( SimTK::Exception::IllegalLapackArg, "cpotrf", info );
     }
 
+    return;
+ }
+template <>
+void LapackInterface::pstrf<double>( const char& uplo, const int n, double* a, const int lda, int* pivots, int& rank, const double& tol, double* work, int& info ) { 
+
+    dpstrf_(uplo, n, a, lda, pivots, rank, tol, work, info);
+    if( info < 0 ) {
+        SimTK_THROW2( SimTK::Exception::IllegalLapackArg, "dpstrf", info );
+    }
+
+    return;
+ }
+template <>
+void LapackInterface::pstrf<float>( const char& uplo, const int n, float* a, const int lda, int* pivots, int& rank, const float& tol, float* work, int& info ) { 
+
+    spstrf_(uplo, n, a, lda, pivots, rank, tol, work, info);
+    if( info < 0 ) {
+        SimTK_THROW2( SimTK::Exception::IllegalLapackArg, "spstrf", info );
+    }
+
     return;
  }
 template <> 
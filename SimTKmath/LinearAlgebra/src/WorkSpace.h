@@ -75,7 +75,10 @@ class TypedWorkSpace {
         delete [] data;
     }
     
+    // The contents are not preserved, so the existing allocation is reused
+    // when the size doesn't change.
     void resize( int n ) {
+        if( n == size ) return;
         delete [] data;
         size = n;
         data = (n==0 ? 0 : new T[n]);
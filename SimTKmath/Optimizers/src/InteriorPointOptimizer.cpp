@@ -99,9 +99,15 @@ InteriorPointOptimizer::InteriorPointOptimizer( const OptimizerSystem& sys )
         int n = getOptimizerSystem().getNumParameters();
         int m = getOptimizerSystem().getNumConstraints();
 
+        setUpParallelDifferentiation();
+        setUpSparseDerivatives();
+
         Index index_style = 0; /* C-style; start counting of rows and column indices at 0 */
-        Index nele_hess = 0;
-        Index nele_jac = n*m; /* always assume dense */
+        Index nele_hess = hasSparseLagrangianHessian() 
+                          ? getNumLagrangianHessianNonzeros() : 0;
+        Index nele_jac = hasSparseConstraintJacobian() 
+                          ? getNumConstraintJacobianNonzeros() 
+                          : n*m; /* dense unless a pattern was given */
 
         // Parameter limits
         Number *x_L = NULL, *x_U = NULL;
@@ -140,7 +146,10 @@ InteriorPointOptimizer::InteriorPointOptimizer( const OptimizerSystem& sys )
 
         AddIpoptIntOption(nlp, "max_iter", maxIterations);
         AddIpoptStrOption(nlp, "mu_strategy", "adaptive");
-        AddIpoptStrOption(nlp, "hessian_approximation", "limited-memory"); // needs to be limited-memory unless you have explicit hessians
+        if (hasSparseLagrangianHessian())
+            AddIpoptStrOption(nlp, "hessian_approximation", "exact");
+        else
+            AddIpoptStrOption(nlp, "hessian_approximation", "limited-memory"); // needs to be limited-memory unless you have explicit hessians
         AddIpoptIntOption(nlp, "limited_memory_max_history", limitedMemoryHistory);
         AddIpoptIntOption(nlp, "print_level", diagnosticsLevel); // default is 4
 
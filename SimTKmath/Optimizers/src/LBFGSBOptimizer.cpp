@@ -77,6 +77,7 @@ Real LBFGSBOptimizer::optimize(  Vector &results ) {
     gradient = new Real[n];
 
     iprint[0] = iprint[1] = iprint[2] = diagnosticsLevel;
+    setUpParallelDifferentiation();
 
     if( sys.getHasLimits() ) {
         sys.getParameterLimits( &lowerLimits, &upperLimits );
@@ -57,6 +57,7 @@ Real LBFGSOptimizer::optimize(  Vector &results ) {
     int m = limitedMemoryHistory;
 
     iprint[0] = iprint[1] = iprint[2] = diagnosticsLevel; 
+    setUpParallelDifferentiation();
 
     Real tol;
     if( getAdvancedRealOption("xtol", tol ) ) {
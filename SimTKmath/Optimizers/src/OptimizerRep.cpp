@@ -26,6 +26,42 @@
 
 namespace SimTK {
 
+/////////////////////////
+// OptimizerSystemPool //
+/////////////////////////
+
+void OptimizerSystemPool::setUseClones(bool flag) {
+    std::lock_guard<std::mutex> lock(poolLock);
+    assert(freeClones.size() == clones.size()); // none may be in use
+    for (unsigned i=0; i < clones.size(); ++i)
+        delete clones[i];
+    clones.clear(); freeClones.clear();
+    isCloneable = true;
+    useClones = flag;
+}
+
+const OptimizerSystem* OptimizerSystemPool::acquire() const {
+    if (!useClones) return sysp;
+    std::lock_guard<std::mutex> lock(poolLock);
+    if (!freeClones.empty()) {
+        const OptimizerSystem* sys = freeClones.back();
+        freeClones.pop_back();
+        return sys;
+    }
+    if (isCloneable) {
+        OptimizerSystem* sys = sysp->clone();
+        if (sys) {clones.push_back(sys); return sys;}
+        isCloneable = false;
+    }
+    return sysp; // shared
+}
+
+void OptimizerSystemPool::release(const OptimizerSystem* sys) const {
+    if (sys == sysp) return;
+    std::lock_guard<std::mutex> lock(poolLock);
+    freeClones.push_back(sys);
+}
+
 //////////////////////
 // DefaultOptimizer //
 //////////////////////
@@ -131,7 +167,7 @@ useNumericalGradient(bool flag, Real objEstAccuracy) {
         objEstAccuracy > 0 ? objEstAccuracy : SignificantReal;
     delete gradDiff; gradDiff=0; delete of; of=0;
     if (flag) {     // turn on numerical jacbobian
-        of = new SysObjectiveFunc(sysp->getNumParameters(), sysp);
+        of = new SysObjectiveFunc(sysp->getNumParameters(), sysPool.get());
         of->setEstimatedAccuracy(objectiveEstimatedAccuracy);
         gradDiff = new Differentiator(*of, diffMethod);
     }
@@ -144,13 +180,68 @@ useNumericalJacobian(bool flag, Real consEstAccuracy) {
     delete jacDiff; jacDiff=0; delete cf; cf=0;
     if (flag) {     // turn on numerical gradients
         cf = new SysConstraintFunc(sysp->getNumConstraints(), 
-                                   sysp->getNumParameters(), sysp);
+                                   sysp->getNumParameters(), sysPool.get());
         cf->setEstimatedAccuracy(constraintsEstimatedAccuracy);
         jacDiff = new Differentiator(*cf, diffMethod); 
     }
     numericalJacobian = flag;
 }
 
+void Optimizer::OptimizerRep::setUpParallelDifferentiation() {
+    int nthreads = 1;
+    std::string parallel;
+    if (getAdvancedStrOption("parallel", parallel) 
+        && parallel == "multithreading") 
+    {
+        nthreads = ParallelExecutor::getNumProcessors();
+        getAdvancedIntOption("nthreads", nthreads);
+        SimTK_APIARGCHECK1_ALWAYS(nthreads >= 0, "Optimizer", "optimize",
+            "The nthreads option must be nonnegative but was %d.", nthreads);
+    }
+    if (gradDiff) gradDiff->setNumThreads(nthreads);
+    if (jacDiff)  jacDiff->setNumThreads(nthreads);
+    if (sysPool)  sysPool->setUseClones(nthreads != 1);
+}
+
+void Optimizer::OptimizerRep::setUpSparseDerivatives() {
+    const OptimizerSystem& sys = getOptimizerSystem();
+    const int n = sys.getNumParameters(), m = sys.getNumConstraints();
+
+    jacRows.clear(); jacCols.clear();
+    sparseJacobian = m > 0 && sys.getConstraintJacobianSparsity(jacRows, jacCols);
+    if (sparseJacobian) {
+        SimTK_APIARGCHECK2_ALWAYS(jacRows.size() == jacCols.size(), 
+            "OptimizerSystem", "getConstraintJacobianSparsity",
+            "Got %d row indices but %d column indices.",
+            (int)jacRows.size(), (int)jacCols.size());
+        for (unsigned k=0; k < jacRows.size(); ++k)
+            SimTK_APIARGCHECK3_ALWAYS(0 <= jacRows[k] && jacRows[k] < m
+                                      && 0 <= jacCols[k] && jacCols[k] < n,
+                "OptimizerSystem", "getConstraintJacobianSparsity",
+                "Entry %d at (%d,%d) is outside the Jacobian.", 
+                (int)k, jacRows[k], jacCols[k]);
+    }
+    if (jacDiff) {
+        if (sparseJacobian) jacDiff->setJacobianSparsity(jacRows, jacCols);
+        else jacDiff->setJacobianSparsity(Array_<int>(), Array_<int>());
+    }
+
+    hessRows.clear(); hessCols.clear();
+    sparseHessian = sys.getLagrangianHessianSparsity(hessRows, hessCols);
+    if (sparseHessian) {
+        SimTK_APIARGCHECK2_ALWAYS(hessRows.size() == hessCols.size(), 
+            "OptimizerSystem", "getLagrangianHessianSparsity",
+            "Got %d row indices but %d column indices.",
+            (int)hessRows.size(), (int)hessCols.size());
+        for (unsigned k=0; k < hessRows.size(); ++k)
+            SimTK_APIARGCHECK3_ALWAYS(0 <= hessCols[k] 
+                                      && hessCols[k] <= hessRows[k]
+                                      && hessRows[k] < n,
+                "OptimizerSystem", "getLagrangianHessianSparsity",
+                "Entry %d at (%d,%d) is not in the lower triangle of the "
+                "Hessian.", (int)k, hessRows[k], hessCols[k]);
+    }
+}
 
 int Optimizer::OptimizerRep::objectiveFuncWrapper
    (int n, const Real* x, int newX, Real* f, void* vrep)
@@ -217,8 +308,32 @@ int Optimizer::OptimizerRep::constraintJacobianWrapper
 
     const bool isNewParam = (newX==1);
 
+    if (rep->hasSparseConstraintJacobian()) {
+        assert(nele_jac == rep->getNumConstraintJacobianNonzeros());
+        if (values == NULL) {
+            for (int k=0; k < nele_jac; ++k) {
+                iRow[k] = rep->jacRows[k];
+                jCol[k] = rep->jacCols[k];
+            }
+            return 1;
+        }
+        const Vector params(n,x,true);
+        Vector       nonzeros(nele_jac,values,true);
+        int status;
+        if (rep->isUsingNumericalJacobian()) {
+            Vector sfy0(m);
+            status = rep->getOptimizerSystem().constraintFunc(params, true, sfy0);
+            rep->getJacobianDifferentiator()
+                .calcSparseJacobian(params, sfy0, nonzeros);
+        } else {
+            status = rep->getOptimizerSystem()
+                .constraintJacobianValues(params, isNewParam, nonzeros);
+        }
+        return (status==0) ? 1 : 0;
+    }
+
     if (values == NULL) {
-        // always assume  the jacobian is dense
+        // without a sparsity pattern, assume the jacobian is dense
         int index = 0;
         for(int j=0; j<m; ++j)
             for(int i=0; i<n; ++i) {
@@ -261,10 +376,28 @@ int Optimizer::OptimizerRep::hessianWrapper
     assert(vrep);
     const OptimizerRep* rep = reinterpret_cast<const OptimizerRep*>(vrep);
 
+    const bool isNewParam = (newX==1);
+
+    if (rep->hasSparseLagrangianHessian()) {
+        assert(nele_hess == rep->getNumLagrangianHessianNonzeros());
+        if (values == NULL) {
+            for (int k=0; k < nele_hess; ++k) {
+                iRow[k] = rep->hessRows[k];
+                jCol[k] = rep->hessCols[k];
+            }
+            return 1;
+        }
+        const Vector params(n,x,true);
+        const Vector multipliers(m,lambda,true);
+        Vector       nonzeros(nele_hess,values,true);
+        return rep->getOptimizerSystem().lagrangianHessianValues
+                (params, isNewParam, obj_factor, multipliers, nonzeros)==0
+                ? 1 : 0;
+    }
+
     // These Vectors refer to existing space.
     const Vector coeff(n,x,true); 
     Vector hess(n*n,values,true); 
-    const bool isNewParam = (newX==1);
 
     return rep->getOptimizerSystem().hessian(coeff, isNewParam, hess)==0
             ? 1 : 0;
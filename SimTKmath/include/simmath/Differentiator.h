@@ -123,6 +123,63 @@ public:
     Vector calcGradient  (const Vector& y0, Method=UnspecifiedMethod) const;
     Matrix calcJacobian  (const Vector& y0, Method=UnspecifiedMethod) const;
 
+    /** Evaluate the perturbed points for a gradient or Jacobian concurrently
+    using up to \a numThreads threads; 0 means one per available processor.
+    The default is 1, meaning the user function is called serially from the
+    calling thread. The results do not depend on the number of threads.
+
+    When more than one thread is used, the user function's f() (or fBatch(),
+    see setBatchSize()) will be called concurrently from several threads, so
+    it must be safe to do that. In particular a function that realizes a
+    State or otherwise writes into scratch space must give each thread its
+    own (for example, by keeping a \c thread_local copy). The unperturbed
+    value, if not supplied, is always evaluated on the calling thread, and 
+    an exception thrown by the user function in any thread is rethrown on 
+    the calling thread. Derivatives of a ScalarFunction are never computed
+    in parallel since they involve at most two perturbed evaluations. **/
+    Differentiator& setNumThreads(int numThreads);
+    /** Return the value set with setNumThreads(). **/
+    int getNumThreads() const;
+
+    /** Pass the perturbed points to the user function's fBatch() method in 
+    groups of at most \a maxBatchSize points, rather than one at a time to 
+    f(). This lets a function that can evaluate many points more efficiently
+    than one at a time (for example by vectorizing, or by handing them off 
+    to other processes) do so. Use 0 (the default) to call f() for each
+    point. With multiple threads (see setNumThreads()) each batch is 
+    evaluated by one thread; choose a batch size no bigger than the number
+    of points divided by the number of threads if you want all the threads
+    to be used. Each point in a batch counts as one call to the user 
+    function in the statistics. **/
+    Differentiator& setBatchSize(int maxBatchSize);
+    /** Return the value set with setBatchSize(). **/
+    int getBatchSize() const;
+
+    /** Declare which entries of the Jacobian of a JacobianFunction may be
+    nonzero, one (row,col) pair per entry with 0-based indices and no
+    duplicates. This permits calcSparseJacobian(), which perturbs together
+    each group of parameters that affect disjoint sets of functions, so that
+    it needs only one (forward) or two (central difference) evaluations of
+    the function per group instead of per parameter. The groups are formed
+    here, once, by greedy coloring of the column intersection graph. Pass
+    empty arrays to remove the pattern. **/
+    Differentiator& setJacobianSparsity(const Array_<int>& rows, 
+                                        const Array_<int>& cols);
+    /** Return the number of nonzeros in the pattern set with 
+    setJacobianSparsity(). **/
+    int getNumJacobianNonzeros() const;
+    /** Return the number of groups of parameters that calcSparseJacobian()
+    perturbs together. **/
+    int getNumJacobianColumnGroups() const;
+
+    /** Calculate the entries of the Jacobian at the positions given to
+    setJacobianSparsity(), in the same order, given the unperturbed function
+    value \a fy0. Those entries are identical to the ones calcJacobian() 
+    would produce. The other entries are assumed to be zero and are never
+    formed. The function is always evaluated serially here. **/
+    void calcSparseJacobian(const Vector& y0, const Vector& fy0, 
+                            Vector& values, Method=UnspecifiedMethod) const;
+
     // Statistics (mutable)
     void resetAllStatistics();                 // reset all stats to zero
     int getNumDifferentiations() const;        // total # calls of calcWhatever
@@ -209,6 +266,14 @@ class SimTK_SIMMATH_EXPORT Differentiator::GradientFunction : public Differentia
 public:
     virtual int f(const Vector& y, Real& fy) const=0;
 
+    /** Evaluate the function at each of the points given by the columns of
+    \a Y, putting the value for column j in \a fY[j]. \a fY already has one
+    element per column and must not be resized. Return nonzero if any of 
+    the evaluations failed. This is called instead of f() only if the 
+    Differentiator has been given a batch size; the default implementation 
+    calls f() for each column in turn. @see Differentiator::setBatchSize() **/
+    virtual int fBatch(const Matrix& Y, Vector& fY) const;
+
 protected:
     explicit GradientFunction(int ny=-1, Real acc=-1);
     virtual ~GradientFunction() { }
@@ -228,6 +293,15 @@ class SimTK_SIMMATH_EXPORT Differentiator::JacobianFunction : public Differentia
 public:
     virtual int f(const Vector& y, Vector& fy) const=0;
 
+    /** Evaluate the functions at each of the points given by the columns of
+    \a Y, putting the values for column j in column j of \a fY. \a fY 
+    already has the right dimensions and must not be resized. Return nonzero 
+    if any of the evaluations failed. This is called instead of f() only if
+    the Differentiator has been given a batch size; the default 
+    implementation calls f() for each column in turn. 
+    @see Differentiator::setBatchSize() **/
+    virtual int fBatch(const Matrix& Y, Matrix& fY) const;
+
 protected:
     explicit JacobianFunction(int nf=-1, int ny=-1, Real acc=-1); 
     virtual ~JacobianFunction() { }
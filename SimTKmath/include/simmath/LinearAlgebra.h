@@ -140,6 +140,53 @@ class SimTK_SIMMATH_EXPORT FactorQTZ: public Factor {
     protected:
     class FactorQTZRepBase *rep;
 }; // class FactorQTZ
+
+class FactorCholeskyRepBase;
+/**
+ * Class to perform a Cholesky factorization with diagonal pivoting,
+ * P' A P = L L', of a real symmetric positive semidefinite matrix such as
+ * G M^-1 G'. Only the lower triangle of A is used. Pivots are dropped once the
+ * remaining diagonal falls below rcond times the largest diagonal element of
+ * A, which reveals the rank much more cheaply than FactorQTZ. For a rank
+ * deficient matrix solve() returns the basic solution in which the elements
+ * corresponding to the dropped pivots are zero, not the minimum norm solution
+ * that FactorQTZ gives. Refactoring a matrix with the same element type
+ * reuses the storage of the previous factorization.
+ */
+class SimTK_SIMMATH_EXPORT FactorCholesky: public Factor {
+    public:
+
+    ~FactorCholesky();
+
+    FactorCholesky();
+    FactorCholesky( const FactorCholesky& c );
+    FactorCholesky& operator=(const FactorCholesky& rhs);
+    /// do Cholesky factorization of a matrix
+    template <typename ELT> FactorCholesky( const Matrix_<ELT>& m );
+    /// do Cholesky factorization of a matrix for a given reciprocal condition number
+    template <typename ELT> FactorCholesky( const Matrix_<ELT>& m, double rcond );
+    /// do Cholesky factorization of a matrix for a given reciprocal condition number
+    template <typename ELT> FactorCholesky( const Matrix_<ELT>& m, float rcond );
+    /// do Cholesky factorization of a matrix
+    template <typename ELT> void factor( const Matrix_<ELT>& m );
+    /// do Cholesky factorization of a matrix for a given reciprocal condition number
+    template <typename ELT> void factor( const Matrix_<ELT>& m, double rcond );
+    /// do Cholesky factorization of a matrix for a given reciprocal condition number
+    template <typename ELT> void factor( const Matrix_<ELT>& m, float rcond );
+    /// solve for a vector x given a right hand side vector b
+    template <typename ELT> void solve( const Vector_<ELT>& b, Vector_<ELT>& x ) const;
+    /// solve for an array of vectors given multiple right hand sides
+    template <typename ELT> void solve( const Matrix_<ELT>& b, Matrix_<ELT>& x ) const;
+
+    /// returns the rank of the matrix
+    int getRank() const;
+    /// returns the ratio of the smallest to the largest pivot that was kept,
+    /// an estimate of the reciprocal condition number at this rank
+    double getRCondEstimate() const;
+
+    protected:
+    class FactorCholeskyRepBase *rep;
+}; // class FactorCholesky
 /**
  * Class to compute Eigen values and Eigen vectors of a matrix
  */
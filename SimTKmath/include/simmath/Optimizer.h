@@ -85,6 +85,39 @@ public:
         setNumParameters(nParameters);
     }
 
+    /// Copy constructor makes its own copy of any parameter limits, so that
+    /// a derived class can implement clone() with its copy constructor.
+    OptimizerSystem(const OptimizerSystem& src) 
+    :   numParameters(src.numParameters),
+        numEqualityConstraints(src.numEqualityConstraints),
+        numInequalityConstraints(src.numInequalityConstraints),
+        numLinearEqualityConstraints(src.numLinearEqualityConstraints),
+        numLinearInequalityConstraints(src.numLinearInequalityConstraints),
+        useLimits(src.useLimits),
+        lowerLimits(src.useLimits ? new Vector(*src.lowerLimits) : 0),
+        upperLimits(src.useLimits ? new Vector(*src.upperLimits) : 0) {
+    }
+
+    /// Copy assignment, which copies any parameter limits.
+    OptimizerSystem& operator=(const OptimizerSystem& src) {
+        if (&src != this) {
+            numParameters = src.numParameters;
+            numEqualityConstraints = src.numEqualityConstraints;
+            numInequalityConstraints = src.numInequalityConstraints;
+            numLinearEqualityConstraints = src.numLinearEqualityConstraints;
+            numLinearInequalityConstraints = 
+                src.numLinearInequalityConstraints;
+            if (src.useLimits) 
+                setParameterLimits(*src.lowerLimits, *src.upperLimits);
+            else if (useLimits) {
+                delete lowerLimits; lowerLimits = 0;
+                delete upperLimits; upperLimits = 0;
+                useLimits = false;
+            }
+        }
+        return *this;
+    }
+
     virtual ~OptimizerSystem() {
         if( useLimits ) {
             delete lowerLimits;
@@ -92,6 +125,15 @@ public:
         }
     }
 
+    /// Returns a new copy of this system that the caller owns, or null if
+    /// the system can't be copied (the default). When the <b>parallel</b>
+    /// advanced option of a gradient-based Optimizer is "multithreading",
+    /// each thread computing numerical derivatives uses its own clone, so
+    /// that objectiveFunc() and constraintFunc() need not be threadsafe. If
+    /// there are no clones, all threads share this system. A typical
+    /// implementation is <tt>return new MySystem(*this);</tt>.
+    virtual OptimizerSystem* clone() const { return 0; }
+
     /// Objective/cost function which is to be optimized; return 0 when successful.
     /// The value of f upon entry into the function is undefined.
     /// This method must be supplied by concrete class.
@@ -125,6 +167,47 @@ public:
                                  SimTK_THROW2(SimTK::Exception::UnimplementedVirtualMethod , "OptimizerSystem", "hessian" );
                                  return -1; }
 
+    /// Declares which entries of the constraint Jacobian may be nonzero, if
+    /// it is sparse. Override this to return true after filling \a rows
+    /// (constraint indices) and \a cols (parameter indices) with one 
+    /// 0-based entry per possible nonzero, with no duplicates. The default
+    /// returns false, meaning the Jacobian is dense. A sparse Jacobian is 
+    /// used by the InteriorPoint optimizer, which then obtains its values
+    /// from constraintJacobianValues() or, with a numerical Jacobian, by
+    /// perturbing together groups of parameters that affect disjoint sets of
+    /// constraints. Other optimizers ignore the pattern.
+    virtual bool getConstraintJacobianSparsity(Array_<int>& rows,
+                                               Array_<int>& cols) const {
+                                 return false; }
+    /// Computes the entries of the constraint Jacobian whose positions were
+    /// given by getConstraintJacobianSparsity(), in the same order; return 0
+    /// when successful. This must be supplied if there is a sparsity pattern
+    /// and a numerical Jacobian is not used; constraintJacobian() is then
+    /// not called.
+    virtual int constraintJacobianValues( const Vector& parameters,
+                                  bool new_parameters, Vector& values ) const {
+                                 SimTK_THROW2(SimTK::Exception::UnimplementedVirtualMethod , "OptimizerSystem", "constraintJacobianValues" );
+                                 return -1; }
+    /// Declares which entries of the lower triangle (row >= col) of the
+    /// Hessian of the Lagrangian may be nonzero, in the same way as
+    /// getConstraintJacobianSparsity(). If this returns true, the
+    /// InteriorPoint optimizer uses this exact Hessian, obtained from
+    /// lagrangianHessianValues(), instead of a limited-memory approximation.
+    /// The default returns false.
+    virtual bool getLagrangianHessianSparsity(Array_<int>& rows,
+                                              Array_<int>& cols) const {
+                                 return false; }
+    /// Computes the entries of \a objectiveFactor times the Hessian of the
+    /// objective plus the sum of \a multipliers[k] times the Hessian of 
+    /// constraint k, at the positions given by 
+    /// getLagrangianHessianSparsity(); return 0 when successful.
+    virtual int lagrangianHessianValues( const Vector& parameters,
+                                 bool new_parameters, Real objectiveFactor,
+                                 const Vector& multipliers, 
+                                 Vector& values ) const {
+                                 SimTK_THROW2(SimTK::Exception::UnimplementedVirtualMethod , "OptimizerSystem", "lagrangianHessianValues" );
+                                 return -1; }
+
    /// Sets the number of parameters in the objective function.
    void setNumParameters( const int nParameters ) {
        if(   nParameters < 1 ) {
@@ -417,6 +500,24 @@ private:
  * opt.setAdvancedRealOption("maxTimeFractionForEigendecomposition", 1);
  * @endcode
  *
+ * <h4> LBFGS, LBFGSB and InteriorPoint </h4>
+ *
+ * These algorithms accept the <b>parallel</b> and <b>nthreads</b> options
+ * described for CMAES. They affect only the numerical gradient and
+ * constraint Jacobian (see useNumericalGradient() and
+ * useNumericalJacobian()), whose perturbed objective and constraint
+ * evaluations are then spread over the threads; the optimization itself
+ * remains serial and its results are unchanged. If your OptimizerSystem
+ * implements OptimizerSystem::clone(), each thread evaluates its own clone,
+ * so the system need not be threadsafe. Clones are made when first needed
+ * during each call to optimize().
+ *
+ * @code
+ * opt.useNumericalGradient(true);
+ * opt.setAdvancedStrOption("parallel", "multithreading");
+ * opt.setAdvancedIntOption("nthreads", 4);
+ * @endcode
+ *
  */
 class SimTK_SIMMATH_EXPORT Optimizer {
 public:
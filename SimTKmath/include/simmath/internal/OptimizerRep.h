@@ -28,35 +28,86 @@
 #include "simmath/Optimizer.h"
 #include "simmath/Differentiator.h"
 #include <map>
+#include <memory>
+#include <mutex>
 
 namespace SimTK {
 
+/*  Lends OptimizerSystem objects to the threads of a multithreaded numerical
+    differentiation. While clones are in use, each call to acquire() returns 
+    a clone of the user's system that no other thread is using, making one
+    with OptimizerSystem::clone() when none is free. If clones aren't in use,
+    or the system can't be cloned, every thread gets the user's system
+    itself, which must then be threadsafe. */
+class OptimizerSystemPool {
+public:
+    explicit OptimizerSystemPool(const OptimizerSystem* sysPtr)
+    :   sysp(sysPtr), useClones(false), isCloneable(true) {}
+    ~OptimizerSystemPool() {setUseClones(false);}
+
+    // Turning clones on or off discards any existing clones, so that new ones
+    // will reflect changes the user has made to the system since.
+    void setUseClones(bool flag);
+
+    const OptimizerSystem* acquire() const;
+    void release(const OptimizerSystem* sys) const;
+
+    // Acquires a system for the lifetime of this object.
+    class Lease {
+    public:
+        explicit Lease(const OptimizerSystemPool& pool)
+        :   pool(pool), sys(pool.acquire()) {}
+        ~Lease() {pool.release(sys);}
+        const OptimizerSystem& operator*() const {return *sys;}
+        const OptimizerSystem* operator->() const {return sys;}
+    private:
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        const OptimizerSystemPool&  pool;
+        const OptimizerSystem*      sys;
+    };
+
+private:
+    const OptimizerSystem*  sysp;
+    bool                    useClones;
+
+    OptimizerSystemPool(const OptimizerSystemPool&) = delete;
+    OptimizerSystemPool& operator=(const OptimizerSystemPool&) = delete;
+
+    mutable std::mutex                      poolLock;
+    mutable bool                            isCloneable;
+    mutable Array_<OptimizerSystem*>        clones;     // owned
+    mutable Array_<const OptimizerSystem*>  freeClones;
+};
+
 
 /*  class for Diff jacobian */
 class SysObjectiveFunc : public Differentiator::GradientFunction {
 public:
-    SysObjectiveFunc(int ny, const OptimizerSystem* sysPtr )
-        : Differentiator::GradientFunction(ny) { sysp = sysPtr; }
+    SysObjectiveFunc(int ny, const OptimizerSystemPool* poolPtr )
+        : Differentiator::GradientFunction(ny) { pool = poolPtr; }
 
     // Must provide this pure virtual function.
     int f(const Vector& y, Real& fy) const override  {
-         return(sysp->objectiveFunc(y, true, fy));   // class user's objectiveFunc
+         OptimizerSystemPool::Lease sys(*pool);
+         return(sys->objectiveFunc(y, true, fy));   // class user's objectiveFunc
     }
-    const OptimizerSystem* sysp;
+    const OptimizerSystemPool* pool;
 };
 
 
 /*  class for Diff gradient */
 class SysConstraintFunc : public Differentiator::JacobianFunction {
     public:
-    SysConstraintFunc(int nf, int ny, const OptimizerSystem* sysPtr)
-        : Differentiator::JacobianFunction(nf,ny) { sysp = sysPtr; }
+    SysConstraintFunc(int nf, int ny, const OptimizerSystemPool* poolPtr)
+        : Differentiator::JacobianFunction(nf,ny) { pool = poolPtr; }
 
     // Must provide this pure virtual function.
     int f(const Vector& y, Vector& fy) const override  {
-       return(sysp->constraintFunc(y, true, fy));  // calls user's contraintFunc
+       OptimizerSystemPool::Lease sys(*pool);
+       return(sys->constraintFunc(y, true, fy));  // calls user's contraintFunc
     }
-    const OptimizerSystem* sysp;
+    const OptimizerSystemPool* pool;
 };
 
 
@@ -65,6 +116,7 @@ public:
     virtual ~OptimizerRep();
     OptimizerRep(const OptimizerSystem& sys) 
        : sysp(&sys), 
+         sysPool(std::make_shared<OptimizerSystemPool>(&sys)),
          myHandle(0), 
          cf(0),
          of(0),
@@ -79,7 +131,9 @@ public:
          objectiveEstimatedAccuracy(SignificantReal),
          constraintsEstimatedAccuracy(SignificantReal),
          numericalGradient(false), 
-         numericalJacobian(false)
+         numericalJacobian(false),
+         sparseJacobian(false),
+         sparseHessian(false)
 
     {
     }
@@ -99,7 +153,9 @@ public:
          objectiveEstimatedAccuracy(SignificantReal),
          constraintsEstimatedAccuracy(SignificantReal),
          numericalGradient(false), 
-         numericalJacobian(false)
+         numericalJacobian(false),
+         sparseJacobian(false),
+         sparseHessian(false)
     {
     }
 
@@ -137,6 +193,21 @@ public:
     void useNumericalJacobian(bool flag, Real consEstAccuracy);  
     void setDifferentiatorMethod( Differentiator::Method method);
 
+    // Apply the "parallel" and "nthreads" advanced options to the numerical
+    // gradient and Jacobian, if any. Call this at the start of optimize().
+    void setUpParallelDifferentiation();
+
+    // Obtain and check the constraint Jacobian and Lagrangian Hessian 
+    // sparsity patterns, if any, from the OptimizerSystem, and give the 
+    // Jacobian pattern to the numerical Jacobian. Call this at the start of
+    // optimize() in optimizers that can use sparse derivatives.
+    void setUpSparseDerivatives();
+
+    bool hasSparseConstraintJacobian() const {return sparseJacobian;}
+    bool hasSparseLagrangianHessian() const {return sparseHessian;}
+    int getNumConstraintJacobianNonzeros() const {return (int)jacRows.size();}
+    int getNumLagrangianHessianNonzeros() const {return (int)hessRows.size();}
+
     bool isUsingNumericalGradient() const { return numericalGradient; }
     bool isUsingNumericalJacobian() const { return numericalJacobian; }
     Differentiator::Method getDifferentiatorMethod() const {return diffMethod;}
@@ -190,6 +261,8 @@ protected:
 
 private:
     const OptimizerSystem* sysp;
+    // Shared by copies of this rep, which use the same OptimizerSystem.
+    std::shared_ptr<OptimizerSystemPool> sysPool;
     bool numericalGradient; // true if optimizer will compute an numerical gradient
     bool numericalJacobian; // true if optimizer will compute an numerical Jacobian
     Differentiator *gradDiff;   
@@ -198,6 +271,10 @@ private:
     SysObjectiveFunc  *of;   
     SysConstraintFunc *cf; 
 
+    // Sparsity patterns; see setUpSparseDerivatives().
+    bool sparseJacobian, sparseHessian;
+    Array_<int> jacRows, jacCols, hessRows, hessCols;
+
     std::map<std::string, std::string> advancedStrOptions;
     std::map<std::string, Real> advancedRealOptions;
     std::map<std::string, int> advancedIntOptions;
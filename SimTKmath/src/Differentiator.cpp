@@ -29,6 +29,7 @@
 #include "SimTKcommon.h"
 #include "simmath/Differentiator.h"
 
+#include <algorithm>
 #include <exception>
 
 namespace SimTK {
@@ -132,6 +133,11 @@ public:
                       const Vector& y0, Real fy0, Vector& gf)   const;
     void calcJacobian(const JacobianFunctionRep&, Differentiator::Method, 
                       const Vector& y0, const Vector& fy0, Matrix& dfdy) const;
+    void calcSparseJacobian(const JacobianFunctionRep&, Differentiator::Method,
+                            const Vector& y0, const Vector& fy0, 
+                            Vector& values) const;
+
+    void setJacobianSparsity(const Array_<int>& rows, const Array_<int>& cols);
 
     const Real& getAccFac(int order) const {
         if (order==1) return AccFac1;
@@ -144,6 +150,15 @@ public:
         nDifferentiations = nDifferentiationFailures = nCallsToUserFunction = 0;
     }
 
+    void setNumThreads(int n) {
+        SimTK_APIARGCHECK1_ALWAYS(n >= 0, "Differentiator", "setNumThreads",
+            "Illegal number of threads %d.", n);
+        numThreads = n;
+        if (n == 1) executor.reset();
+        else executor.reset(n == 0 ? new ParallelExecutor()
+                                   : new ParallelExecutor(n));
+    }
+
     // Statistics
     mutable int nDifferentiations; 
     mutable int nDifferentiationFailures; 
@@ -173,6 +188,24 @@ private:
     mutable Vector ytmp;           // [NParameters]
     mutable Vector fyptmp, fymtmp; // [NFunctions]
 
+    // Evaluation options; see setNumThreads() and setBatchSize().
+    int numThreads;
+    int batchSize;
+    mutable ClonePtr<ParallelExecutor> executor; // empty if serial
+
+    // Jacobian sparsity pattern (empty if none), with the parameters 
+    // partitioned into groups that affect disjoint sets of functions, and the
+    // indices of the nonzeros in each group's columns.
+    Array_<int>             sparseRows, sparseCols;
+    Array_< Array_<int> >   groupColumns, groupNonzeros;
+
+    // Evaluate the function at the perturbations of y0 by h used for a
+    // gradient or Jacobian, in batches and possibly concurrently. See
+    // PerturbedPointsTask below.
+    template <class FRep, class Values>
+    void calcPerturbedValues(const FRep& f, int order, const Vector& y0, 
+                             const Vector& h, Values& fvals) const;
+
     // suppress
     DifferentiatorRep(const DifferentiatorRep&);
     DifferentiatorRep& operator=(const DifferentiatorRep&);
@@ -221,6 +254,13 @@ public:
         nCalls = nFailures = 0;
     }
 
+    // Record calls that were made with callBatch(), which can't update the
+    // statistics itself because it may run on several threads at once.
+    void noteCalls(int calls, int failures) const {
+        nCalls += calls;
+        nFailures += failures;
+    }
+
 protected:
     // Stats
     mutable int nCalls;
@@ -358,6 +398,26 @@ public:
         --nFailures;
     }
 
+    // Evaluate f at each column of Y, using the user's fBatch() if useBatch
+    // is set, or f() otherwise. This doesn't touch the statistics so can be
+    // called from several threads at once.
+    void callBatch(const Matrix& Y, Vector& fY, bool useBatch) const {
+        int status = 0;
+        try { 
+            if (useBatch) status = gf.fBatch(Y, fY);
+            else for (int j=0; j < Y.ncol() && status == 0; ++j)
+                    status = gf.f(Y(j), fY[j]);
+        } 
+        catch (const std::exception& e)
+          { SimTK_THROW1(Differentiator::UserFunctionThrewAnException, e.what()); }
+        catch (...)
+          { SimTK_THROW1(Differentiator::UserFunctionThrewAnException, 
+                         "UNRECOGNIZED EXCEPTION TYPE"); }
+
+        if (status != 0)
+            SimTK_THROW1(Differentiator::UserFunctionReturnedNonzeroStatus, status);
+    }
+
     const Differentiator::GradientFunction&       gf;
 };
 
@@ -428,6 +488,26 @@ public:
         nFailures--;
     }
 
+    // See GradientFunctionRep::callBatch().
+    void callBatch(const Matrix& Y, Matrix& fY, bool useBatch) const {
+        int status = 0;
+        try { 
+            if (useBatch) status = jf.fBatch(Y, fY);
+            else for (int j=0; j < Y.ncol() && status == 0; ++j) {
+                    VectorView fy = fY(j);
+                    status = jf.f(Y(j), fy);
+                 }
+        } 
+        catch (const std::exception& e)
+          { SimTK_THROW1(Differentiator::UserFunctionThrewAnException, e.what()); }
+        catch (...)
+          { SimTK_THROW1(Differentiator::UserFunctionThrewAnException, 
+                         "UNRECOGNIZED EXCEPTION TYPE"); }
+
+        if (status != 0)
+            SimTK_THROW1(Differentiator::UserFunctionReturnedNonzeroStatus, status);
+    }
+
     const Differentiator::JacobianFunction&       jf;
 };
 
@@ -451,6 +531,26 @@ Differentiator::Method Differentiator::getDefaultMethod() const {
     return rep->defaultMethod;
 }
 
+Differentiator& Differentiator::setNumThreads(int numThreads) {
+    rep->setNumThreads(numThreads);
+    return *this;
+}
+
+int Differentiator::getNumThreads() const {
+    return rep->numThreads;
+}
+
+Differentiator& Differentiator::setBatchSize(int maxBatchSize) {
+    SimTK_APIARGCHECK1_ALWAYS(maxBatchSize >= 0, "Differentiator", 
+        "setBatchSize", "Illegal batch size %d.", maxBatchSize);
+    rep->batchSize = maxBatchSize;
+    return *this;
+}
+
+int Differentiator::getBatchSize() const {
+    return rep->batchSize;
+}
+
 void Differentiator::calcDerivative
    (Real y0, Real fy0, Real& dfdy, Differentiator::Method m) const 
 {
@@ -545,6 +645,47 @@ Matrix Differentiator::calcJacobian
     return dfdy;
 }
 
+Differentiator& Differentiator::setJacobianSparsity
+   (const Array_<int>& rows, const Array_<int>& cols) 
+{
+    rep->setJacobianSparsity(rows, cols);
+    return *this;
+}
+
+int Differentiator::getNumJacobianNonzeros() const {
+    return (int)rep->sparseRows.size();
+}
+
+int Differentiator::getNumJacobianColumnGroups() const {
+    return (int)rep->groupColumns.size();
+}
+
+void Differentiator::calcSparseJacobian
+   (const Vector& y0, const Vector& fy0, Vector& values,
+    Differentiator::Method m) const 
+{
+    rep->nDifferentiations++;
+    rep->nDifferentiationFailures++; // assume the worst
+
+    const JacobianFunctionRep* jrep = 
+        dynamic_cast<const JacobianFunctionRep*>(&rep->frep);
+    SimTK_APIARGCHECK1_ALWAYS(jrep, "Differentiator", "calcSparseJacobian",
+        "Sparse Jacobians are only available for a JacobianFunction, not a %s.",
+        rep->frep.functionKind().c_str());
+
+    SimTK_APIARGCHECK2_ALWAYS(y0.size()==rep->NParameters, "Differentiator", "calcSparseJacobian",
+        "Expecting %d elements in the parameter (state) vector but got %d", 
+        rep->NParameters, (int)y0.size());
+
+    SimTK_APIARGCHECK2_ALWAYS(fy0.size()==rep->NFunctions, "Differentiator", "calcSparseJacobian",
+        "Expecting %d elements in the unperturbed function value but got %d", 
+        rep->NFunctions, (int)fy0.size());
+
+    rep->calcSparseJacobian(*jrep,m,y0,fy0,values);
+
+    rep->nDifferentiationFailures--;
+}
+
 void Differentiator::resetAllStatistics() {
     rep->resetAllStatistics();
 }
@@ -671,6 +812,90 @@ Differentiator::JacobianFunction::JacobianFunction(int nf, int np, Real acc) {
     rep = new JacobianFunctionRep(*this, nf, np, acc);
 }
 
+int Differentiator::GradientFunction::fBatch(const Matrix& Y, Vector& fY) const {
+    for (int j=0; j < Y.ncol(); ++j)
+        if (const int status = f(Y(j), fY[j]))
+            return status;
+    return 0;
+}
+
+int Differentiator::JacobianFunction::fBatch(const Matrix& Y, Matrix& fY) const {
+    for (int j=0; j < Y.ncol(); ++j) {
+        VectorView fy = fY(j);
+        if (const int status = f(Y(j), fy))
+            return status;
+    }
+    return 0;
+}
+
+
+    ////////////////////////////////////////
+    // CONCURRENT EVALUATION OF PERTURBED //
+    ////////////////////////////////////////
+
+// Return the columns [j0,j0+n) of the values of perturbed points, which are
+// Vector elements for a gradient or Matrix columns for a Jacobian.
+static VectorView updColumns(Vector& v, int j0, int n) 
+{   return v(j0, n); }
+static MatrixView updColumns(Matrix& m, int j0, int n) 
+{   return m(0, j0, m.nrow(), n); }
+
+// Point p perturbs parameter p%n by +h in the first n points or by -h in
+// the next n (central difference only). Each execution evaluates one batch of
+// consecutive points and writes only its own columns of fvals, so batches can
+// be done in any order or concurrently. Exceptions can't be allowed to escape
+// from a worker thread; we save them and rethrow later on the calling thread.
+template <class FRep, class Values>
+class PerturbedPointsTask : public ParallelExecutor::Task {
+public:
+    PerturbedPointsTask(const FRep& f, const Vector& y0, const Vector& h,
+                        int nPoints, int batchSize, bool useBatch,
+                        Values& fvals) 
+    :   f(f), y0(y0), h(h), nPoints(nPoints), batchSize(batchSize),
+        useBatch(useBatch), fvals(fvals),
+        failures(getNumBatches()) {}
+
+    int getNumBatches() const {return (nPoints + batchSize-1) / batchSize;}
+
+    void execute(int b) override {
+        try {
+            const int n = y0.size(), p0 = b*batchSize;
+            const int np = std::min(batchSize, nPoints-p0);
+            Matrix Y(n, np);
+            for (int j=0; j < np; ++j) {
+                const int p = p0+j, i = p % n;
+                Y(j) = y0;
+                Y(i,j) = p < n ? y0[i]+h[i] : y0[i]-h[i];
+            }
+            auto fY = updColumns(fvals, p0, np);
+            f.callBatch(Y, fY, useBatch);
+        } catch (...) {
+            failures[b] = std::current_exception();
+        }
+    }
+
+    // Rethrow the exception from the earliest failed batch, if any.
+    void rethrowIfFailed() const {
+        for (unsigned i=0; i < failures.size(); ++i)
+            if (failures[i]) std::rethrow_exception(failures[i]);
+    }
+
+    int getNumFailures() const {
+        int nf = 0;
+        for (unsigned i=0; i < failures.size(); ++i)
+            if (failures[i]) ++nf;
+        return nf;
+    }
+
+private:
+    const FRep&                 f;
+    const Vector&               y0;
+    const Vector&               h;
+    const int                   nPoints, batchSize;
+    const bool                  useBatch;
+    Values&                     fvals;
+    Array_<std::exception_ptr>  failures;
+};
 
     //////////////////////////////////////////
     // IMPLEMENTATION OF DIFFERENTIATOR REP //
@@ -687,7 +912,8 @@ Differentiator::DifferentiatorRep::DifferentiatorRep
     EstimatedAccuracy(fr.getEstimatedAccuracy()),
     defaultMethod(getMethodOrThrow(defMthd, DefaultDefaultMethod, "Differentiator")),
     AccFac1(std::sqrt(EstimatedAccuracy)),
-    AccFac2(std::pow(EstimatedAccuracy, OneThird))
+    AccFac2(std::pow(EstimatedAccuracy, OneThird)),
+    numThreads(1), batchSize(0)
 {
     //TODO
     assert(NParameters >= 0 && NFunctions >= 0 && EstimatedAccuracy > 0);
@@ -736,9 +962,22 @@ void Differentiator::DifferentiatorRep::calcGradient
 
     gradf.resize(NParameters);
 
-    ytmp = y0;
     const int order = Differentiator::getMethodOrder(method);
 
+    if (numThreads != 1 || batchSize > 0) {
+        Vector h(NParameters), fvals(order*NParameters);
+        for (int i=0; i < NParameters; ++i) {
+            const Real hEst = getAccFac(order)*std::max(std::abs(y0[i]), YMin);
+            h[i] = cleanUpH(hEst, y0[i]);
+        }
+        calcPerturbedValues(f, order, y0, h, fvals);
+        for (int i=0; i < NParameters; ++i)
+            gradf[i] = order==1 ? (fvals[i]-fy0)/h[i]
+                                : (fvals[i]-fvals[NParameters+i])/(2*h[i]);
+        return;
+    }
+
+    ytmp = y0;
     for (int i=0; i < f.getNumParameters(); ++i) {
         const Real hEst = getAccFac(order)*std::max(std::abs(y0[i]), YMin);
         const Real h = cleanUpH(hEst, y0[i]);
@@ -772,6 +1011,20 @@ void Differentiator::DifferentiatorRep::calcJacobian
 
     const int order = Differentiator::getMethodOrder(method);
 
+    if (numThreads != 1 || batchSize > 0) {
+        Vector h(NParameters);
+        Matrix fvals(NFunctions, order*NParameters);
+        for (int i=0; i < NParameters; ++i) {
+            const Real hEst = getAccFac(order)*std::max(std::abs(y0[i]), YMin);
+            h[i] = cleanUpH(hEst, y0[i]);
+        }
+        calcPerturbedValues(f, order, y0, h, fvals);
+        for (int i=0; i < NParameters; ++i)
+            dfdy(i) = order==1 ? (fvals(i)-fy0)/h[i]
+                               : (fvals(i)-fvals(NParameters+i))/(2*h[i]);
+        return;
+    }
+
     ytmp = y0;
     for (int i=0; i < NParameters; ++i) {
         const Real hEst = getAccFac(order)*std::max(std::abs(y0[i]), YMin);
@@ -789,6 +1042,127 @@ void Differentiator::DifferentiatorRep::calcJacobian
     }
 }
 
-} // namespace SimTK
+void Differentiator::DifferentiatorRep::calcSparseJacobian
+   (const JacobianFunctionRep& f, Differentiator::Method m, 
+    const Vector& y0, const Vector& fy0, Vector& values) const 
+{
+    const Differentiator::Method method = 
+        getMethodOrThrow(m, defaultMethod, "calcSparseJacobian");
+    const int order = Differentiator::getMethodOrder(method);
+
+    assert(y0.size() == NParameters && fy0.size() == NFunctions);
+    values.resize(sparseRows.size());
+
+    // The same steps as calcJacobian() uses, so the results match exactly.
+    Vector h(NParameters);
+    for (int j=0; j < NParameters; ++j) {
+        const Real hEst = getAccFac(order)*std::max(std::abs(y0[j]), YMin);
+        h[j] = cleanUpH(hEst, y0[j]);
+    }
+
+    ytmp = y0;
+    for (unsigned g=0; g < groupColumns.size(); ++g) {
+        const Array_<int>& cols = groupColumns[g];
+        for (unsigned k=0; k < cols.size(); ++k)
+            ytmp[cols[k]] = y0[cols[k]] + h[cols[k]];
+        nCallsToUserFunction++; f.call(ytmp, fyptmp);
+        if (order==2) {
+            for (unsigned k=0; k < cols.size(); ++k)
+                ytmp[cols[k]] = y0[cols[k]] - h[cols[k]];
+            nCallsToUserFunction++; f.call(ytmp, fymtmp);
+        }
+        for (unsigned k=0; k < cols.size(); ++k)
+            ytmp[cols[k]] = y0[cols[k]]; // restore
+
+        const Array_<int>& nonzeros = groupNonzeros[g];
+        for (unsigned k=0; k < nonzeros.size(); ++k) {
+            const int nz = nonzeros[k];
+            const int i = sparseRows[nz], j = sparseCols[nz];
+            // Vector division is done by scaling with the reciprocal.
+            values[nz] = order==1 ? (fyptmp[i]-fy0[i])*(1/h[j])
+                                  : (fyptmp[i]-fymtmp[i])*(1/(2*h[j]));
+        }
+    }
+}
 
+// Greedy coloring: each column joins the first group containing no column
+// that shares a row with it.
+void Differentiator::DifferentiatorRep::setJacobianSparsity
+   (const Array_<int>& rows, const Array_<int>& cols) 
+{
+    SimTK_APIARGCHECK2_ALWAYS(rows.size() == cols.size(), "Differentiator",
+        "setJacobianSparsity", "Got %d row indices but %d column indices.",
+        (int)rows.size(), (int)cols.size());
+
+    Array_< Array_<int> > rowsOfCol(NParameters), colsOfRow(NFunctions);
+    for (unsigned nz=0; nz < rows.size(); ++nz) {
+        const int i = rows[nz], j = cols[nz];
+        SimTK_APIARGCHECK3_ALWAYS(0 <= i && i < NFunctions 
+                                  && 0 <= j && j < NParameters, 
+            "Differentiator", "setJacobianSparsity",
+            "Entry %d at (%d,%d) is outside the Jacobian.", (int)nz, i, j);
+        rowsOfCol[j].push_back(i);
+        colsOfRow[i].push_back(j);
+    }
+    for (int i=0; i < NFunctions; ++i) {
+        Array_<int>& c = colsOfRow[i];
+        std::sort(c.begin(), c.end());
+        SimTK_APIARGCHECK1_ALWAYS(std::adjacent_find(c.begin(), c.end()) 
+                                  == c.end(), 
+            "Differentiator", "setJacobianSparsity",
+            "Row %d of the pattern has a duplicate entry.", i);
+    }
+
+    Array_<int> groupOfCol(NParameters, -1);
+    Array_<int> lastBlockedBy; // by group: last column that couldn't use it
+    groupColumns.clear();
+    for (int j=0; j < NParameters; ++j) {
+        if (rowsOfCol[j].empty()) continue; // never needs perturbing
+        for (unsigned k=0; k < rowsOfCol[j].size(); ++k) {
+            const Array_<int>& neighbors = colsOfRow[rowsOfCol[j][k]];
+            for (unsigned l=0; l < neighbors.size(); ++l) {
+                const int g = groupOfCol[neighbors[l]];
+                if (g >= 0) lastBlockedBy[g] = j;
+            }
+        }
+        int g = 0;
+        while (g < (int)groupColumns.size() && lastBlockedBy[g] == j) ++g;
+        if (g == (int)groupColumns.size()) {
+            groupColumns.emplace_back();
+            lastBlockedBy.push_back(-1);
+        }
+        groupColumns[g].push_back(j);
+        groupOfCol[j] = g;
+    }
 
+    groupNonzeros.clear();
+    groupNonzeros.resize(groupColumns.size());
+    for (unsigned nz=0; nz < cols.size(); ++nz)
+        groupNonzeros[groupOfCol[cols[nz]]].push_back(nz);
+
+    sparseRows = rows;
+    sparseCols = cols;
+}
+
+template <class FRep, class Values>
+void Differentiator::DifferentiatorRep::calcPerturbedValues
+   (const FRep& f, int order, const Vector& y0, const Vector& h, 
+    Values& fvals) const
+{
+    const int nPoints = order*NParameters;
+    if (nPoints == 0) return;
+
+    PerturbedPointsTask<FRep,Values> task(f, y0, h, nPoints,
+        batchSize > 0 ? batchSize : 1, batchSize > 0, fvals);
+    const int nBatches = task.getNumBatches();
+    if (executor.empty() || nBatches < 2)
+        for (int b=0; b < nBatches; ++b) task.execute(b);
+    else
+        executor.upd()->execute(task, nBatches);
+
+    nCallsToUserFunction += nPoints;
+    f.noteCalls(nPoints, task.getNumFailures());
+    task.rethrowIfFailed();
+}
+
+} // namespace SimTK
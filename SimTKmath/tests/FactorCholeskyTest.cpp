@@ -0,0 +1,227 @@
+/* -------------------------------------------------------------------------- *
+ *                        Simbody(tm): SimTKmath                              *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Tests the pivoted Cholesky factorization of symmetric positive semidefinite
+matrices, and refactoring with each of the factorization classes. */
+
+#include "SimTKmath.h"
+#include "SimTKcommon/Testing.h"
+
+#include <iostream>
+
+using namespace SimTK;
+using std::cout;
+using std::endl;
+
+namespace {
+// Returns J*~J for a random n X r matrix J, which has rank r.
+Matrix makeSemidefinite(int n, int r, Random::Uniform& rand) {
+    Matrix J(n, r);
+    for (int j=0; j < r; ++j)
+        for (int i=0; i < n; ++i)
+            J(i,j) = rand.getValue();
+    return J*~J;
+}
+
+Vector makeVector(int n, Random::Uniform& rand) {
+    Vector v(n);
+    for (int i=0; i < n; ++i)
+        v[i] = rand.getValue();
+    return v;
+}
+}
+
+void testFullRank() {
+    Random::Uniform rand(-1, 1);
+    rand.setSeed(1);
+    const Matrix A = makeSemidefinite(6, 6, rand) + Matrix(Mat66(1));
+    const Vector b = makeVector(6, rand);
+
+    FactorCholesky chol(A);
+    SimTK_TEST(chol.getRank() == 6);
+    SimTK_TEST(0 < chol.getRCondEstimate() && chol.getRCondEstimate() <= 1);
+    Vector x;
+    chol.solve(b, x);
+    SimTK_TEST_EQ_TOL(A*x, b, 1e-12);
+
+    Vector xlu;
+    FactorLU(A).solve(b, xlu);
+    SimTK_TEST_EQ_TOL(x, xlu, 1e-12);
+
+    // Several right hand sides at once.
+    Matrix B(6, 2);
+    B(0) = b;
+    B(1) = 2*b;
+    Matrix X;
+    chol.solve(B, X);
+    SimTK_TEST(X.nrow() == 6 && X.ncol() == 2);
+    SimTK_TEST_EQ_TOL(X(0), x, 1e-12);
+    SimTK_TEST_EQ_TOL(X(1), 2*x, 1e-12);
+
+    // Copies are independent of the original.
+    FactorCholesky copy(chol);
+    chol.factor(Matrix(Mat33(2)));
+    Vector xc;
+    copy.solve(b, xc);
+    SimTK_TEST_EQ(xc, x);
+
+    // Only the lower triangle is used.
+    Matrix lower(A);
+    for (int j=1; j < 6; ++j)
+        for (int i=0; i < j; ++i)
+            lower(i,j) = NaN;
+    FactorCholesky(lower).solve(b, xc);
+    SimTK_TEST_EQ(xc, x);
+
+    // Single precision.
+    Matrix_<float> Af(6, 6);
+    Vector_<float> bf(6), xf;
+    for (int i=0; i < 6; ++i) {
+        bf[i] = (float)b[i];
+        for (int j=0; j < 6; ++j)
+            Af(i,j) = (float)A(i,j);
+    }
+    FactorCholesky cholf(Af);
+    cholf.solve(bf, xf);
+    for (int i=0; i < 6; ++i)
+        SimTK_TEST_EQ_TOL(xf[i], x[i], 1e-4);
+}
+
+// With a rank deficient matrix the rank is found, and consistent right hand
+// sides are still solved exactly.
+void testRankDeficient() {
+    Random::Uniform rand(-1, 1);
+    rand.setSeed(2);
+    const Matrix A = makeSemidefinite(7, 3, rand);
+    const Vector b = A*makeVector(7, rand);
+
+    FactorCholesky chol(A);
+    SimTK_TEST(chol.getRank() == 3);
+    Vector x;
+    chol.solve(b, x);
+    SimTK_TEST_EQ_TOL(A*x, b, 1e-10);
+
+    // A zero matrix has rank zero and gives a zero solution.
+    chol.factor(Matrix(3, 3, Real(0)));
+    SimTK_TEST(chol.getRank() == 0);
+    chol.solve(Vector(3, Real(1)), x);
+    SimTK_TEST_EQ(x, Vector(3, Real(0)));
+}
+
+void testErrors() {
+    FactorCholesky chol;
+    Vector x;
+    SimTK_TEST_MUST_THROW(chol.solve(Vector(2, Real(1)), x));
+    SimTK_TEST_MUST_THROW(chol.factor(Matrix(2, 3, Real(1))));
+    SimTK_TEST_MUST_THROW(chol.factor(Matrix()));
+    chol.factor(Matrix(Mat22(1)));
+    SimTK_TEST_MUST_THROW(chol.solve(Vector(3, Real(1)), x));
+}
+
+// Refactoring gives the same results as a fresh factorization, whether or
+// not the size changes.
+void testRefactor() {
+    Random::Uniform rand(-1, 1);
+    rand.setSeed(3);
+    FactorCholesky chol;
+    FactorQTZ qtz;
+    FactorLU lu;
+    FactorSVD svd;
+    Eigen eigen;
+    for (int n : {4, 4, 6, 3, 3}) {
+        Matrix A = makeSemidefinite(n, n, rand);
+        for (int i=0; i < n; ++i)
+            A(i,i) += 1;
+        const Vector b = makeVector(n, rand);
+        Vector x, xFresh;
+
+        chol.factor(A);
+        chol.solve(b, x);
+        FactorCholesky(A).solve(b, xFresh);
+        SimTK_TEST_EQ(x, xFresh);
+
+        qtz.factor(A);
+        qtz.solve(b, x);
+        FactorQTZ(A).solve(b, xFresh);
+        SimTK_TEST_EQ(x, xFresh);
+        SimTK_TEST(qtz.getRank() == n);
+
+        lu.factor(A);
+        lu.solve(b, x);
+        FactorLU(A).solve(b, xFresh);
+        SimTK_TEST_EQ(x, xFresh);
+
+        svd.factor(A);
+        svd.solve(b, x);
+        FactorSVD(A).solve(b, xFresh);
+        SimTK_TEST_EQ(x, xFresh);
+
+        Vector_<std::complex<Real> > values, valuesFresh;
+        eigen.factor(A);
+        eigen.getAllEigenValues(values);
+        Eigen(A).getAllEigenValues(valuesFresh);
+        SimTK_TEST(values.size() == n);
+        for (int i=0; i < n; ++i)
+            SimTK_TEST(values[i] == valuesFresh[i]);
+    }
+}
+
+// Compares the cost of factoring G M^-1 ~G sized systems with QTZ and with
+// pivoted Cholesky, refactoring the same objects each time.
+void timeFactorizations() {
+    Random::Uniform rand(-1, 1);
+    rand.setSeed(4);
+    const int n = 30, reps = 2000;
+    const Matrix A = makeSemidefinite(n, n, rand);
+    const Vector b = makeVector(n, rand);
+    Vector x;
+
+    FactorQTZ qtz;
+    double t0 = realTime();
+    for (int i=0; i < reps; ++i) {
+        qtz.factor(A);
+        qtz.solve(b, x);
+    }
+    const double tQTZ = realTime() - t0;
+
+    FactorCholesky chol;
+    t0 = realTime();
+    for (int i=0; i < reps; ++i) {
+        chol.factor(A);
+        chol.solve(b, x);
+    }
+    const double tChol = realTime() - t0;
+
+    cout << n << "x" << n << " factor+solve: QTZ " << 1e6*tQTZ/reps
+         << "us, Cholesky " << 1e6*tChol/reps << "us" << endl;
+}
+
+int main() {
+    SimTK_START_TEST("FactorCholeskyTest");
+        SimTK_SUBTEST(testFullRank);
+        SimTK_SUBTEST(testRankDeficient);
+        SimTK_SUBTEST(testErrors);
+        SimTK_SUBTEST(testRefactor);
+        SimTK_SUBTEST(timeFactorizations);
+    SimTK_END_TEST();
+}
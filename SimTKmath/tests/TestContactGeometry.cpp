@@ -24,6 +24,7 @@
 #include "SimTKmath.h"
 #include <vector>
 #include <exception>
+#include <thread>
 
 using namespace SimTK;
 using namespace std;
@@ -439,6 +440,138 @@ void testAnalyticalCylinderGeodesic() {
     testAnalyticalGeodesicRandom(cylinder);
 }
 
+// Sphere and Cylinder geodesics come from closed-form solutions, including
+// the Jacobi fields, and are used automatically by the shooting methods and
+// continueGeodesic().
+void testAnalyticGeodesicDispatch() {
+    ContactGeometry::Sphere sphere(r);
+    ContactGeometry::Cylinder cylinder(r);
+    ASSERT(sphere.hasAnalyticGeodesics());
+    ASSERT(cylinder.hasAnalyticGeodesics());
+    ASSERT(!ContactGeometry::Ellipsoid(Vec3(1,2,3)).hasAnalyticGeodesics());
+
+    // Quarter of a great circle.
+    Geodesic geod;
+    sphere.shootGeodesicInDirectionUntilLengthReached(Vec3(r,0,0),
+        UnitVec3(YAxis), r*Pi/2, GeodesicOptions(), geod);
+    assertEqual(geod.getPointQ(), Vec3(0,r,0));
+    assertEqual(geod.getTangentQ(), UnitVec3(-1,0,0));
+    assertEqual(geod.getLength(), r*Pi/2);
+    const int last = geod.getNumPoints()-1;
+    assertEqual(geod.getDirectionalSensitivityPtoQ()[last], Vec2(r,0));
+    assertEqual(geod.getPositionalSensitivityPtoQ()[last], Vec2(0,-1/r));
+    assertEqual(geod.getPositionalSensitivityQtoP()[0], Vec2(0,-1/r));
+
+    // Stopped by a plane that doesn't pass through the center, compared with
+    // integrating the same sphere numerically. The arc reaches y = r/2 after
+    // an eighth of a turn. A starting direction that isn't tangent to the
+    // sphere is projected.
+    const ContactGeometry::Ellipsoid numericSphere(Vec3(r,r,r));
+    const Plane offsetPlane(Vec3(0,1,0), r/2);
+    const UnitVec3 tUp(0,1,1);
+    Geodesic numeric;
+    numericSphere.shootGeodesicInDirectionUntilPlaneHit(Vec3(r,0,0), tUp,
+        offsetPlane, GeodesicOptions(), numeric);
+    sphere.shootGeodesicInDirectionUntilPlaneHit(Vec3(r,0,0), tUp,
+        offsetPlane, GeodesicOptions(), geod);
+    assertEqual(geod.getLength(), r*Pi/4);
+    assertEqual(geod.getLength(), numeric.getLength());
+    assertEqual(geod.getPointQ(), numeric.getPointQ());
+    assertEqual(geod.getTangentQ(), numeric.getTangentQ());
+    sphere.shootGeodesicInDirectionUntilPlaneHit(Vec3(r,0,0),
+        UnitVec3(1,1,1), offsetPlane, GeodesicOptions(), geod);
+    assertEqual(geod.getPointQ(), numeric.getPointQ());
+
+    // A plane beyond the sphere is never reached; both methods give up at
+    // the same length.
+    sphere.shootGeodesicInDirectionUntilPlaneHit(Vec3(r,0,0), tUp,
+        Plane(Vec3(0,1,0), 2*r), GeodesicOptions(), geod);
+    assertEqual(geod.getLength(), Real(100));
+
+    // A helix climbing at 45 degrees makes a quarter turn while rising
+    // r*Pi/2.
+    const UnitVec3 t45(0,1,1);
+    cylinder.shootGeodesicInDirectionUntilLengthReached(Vec3(r,0,0), t45,
+        Sqrt2*r*Pi/2, GeodesicOptions(), geod);
+    assertEqual(geod.getPointQ(), Vec3(0,r,r*Pi/2));
+    assertEqual(geod.getTangentQ(), UnitVec3(-1,0,1));
+    assertEqual(geod.getPositionalSensitivityPtoQ().back(), Vec2(1,0));
+
+    // Same helix going the other way around, stopped by the plane z=1.
+    const UnitVec3 t45neg(0,-1,1);
+    cylinder.shootGeodesicInDirectionUntilPlaneHit(Vec3(r,0,0), t45neg,
+        Plane(Vec3(0,0,1), 1), GeodesicOptions(), geod);
+    assertEqual(geod.getPointQ()[2], Real(1));
+    assertEqual(geod.getLength(), Sqrt2);
+    ASSERT(geod.getPointQ()[1] < 0);
+
+    // Straight up a generator line.
+    cylinder.shootGeodesicInDirectionUntilLengthReached(Vec3(r,0,0),
+        UnitVec3(ZAxis), 2, GeodesicOptions(), geod);
+    assertEqual(geod.getPointQ(), Vec3(r,0,2));
+    cylinder.calcGeodesicAnalytical(Vec3(0,r,-1), Vec3(0,r,3),
+        Vec3(0,0,1), Vec3(0,0,1), geod);
+    assertEqual(geod.getLength(), Real(4));
+
+    // Starting from nothing, continueGeodesic() gives the short way around,
+    // the same as the numerical solution.
+    const Vec3 P(r,0,0), Q(0,r*std::sqrt(.5),r*std::sqrt(.5));
+    numeric.clear();
+    sphere.continueGeodesic(P, Q, Geodesic(), GeodesicOptions(), geod);
+    sphere.calcGeodesicUsingOrthogonalMethod(P, Q, numeric);
+    assertEqual(geod.getLength(), r*Pi/2);
+    assertEqual(geod.getLength(), numeric.getLength());
+    assertEqual(geod.getTangentP(), numeric.getTangentP());
+    assertEqual(geod.getTangentQ(), numeric.getTangentQ());
+
+    // Antipodal points take a half-turn in the direction of the hint.
+    sphere.calcGeodesicAnalytical(P, -P, Vec3(0,0,1), Vec3(0,0,-1), geod);
+    assertEqual(geod.getLength(), r*Pi);
+    assertEqual(geod.getTangentP(), UnitVec3(ZAxis));
+}
+
+// The system used to integrate geodesics numerically isn't built until it is
+// needed, so it must work the same way for the original geometry and for
+// copies made before or after the original first used it.
+void testNumericalGeodesicOnCopy() {
+    const ContactGeometry::Ellipsoid original(Vec3(r,r,r));
+    ASSERT(!original.hasAnalyticGeodesics());
+    ContactGeometry copy(original);
+
+    Geodesic geod;
+    original.shootGeodesicInDirectionUntilLengthReached(Vec3(r,0,0),
+        UnitVec3(YAxis), r*Pi/2, GeodesicOptions(), geod);
+    assertEqual(geod.getPointQ(), Vec3(0,r,0));
+
+    ContactGeometry assigned = ContactGeometry::Sphere(1);
+    assigned = original;
+    for (const ContactGeometry* g : {&copy, &assigned}) {
+        Geodesic geodCopy;
+        g->shootGeodesicInDirectionUntilLengthReached(Vec3(r,0,0),
+            UnitVec3(YAxis), r*Pi/2, GeodesicOptions(), geodCopy);
+        assertEqual(geodCopy.getPointQ(), geod.getPointQ());
+        assertEqual(geodCopy.getLength(), geod.getLength());
+    }
+
+    // The plane is kept with that system too.
+    ContactGeometry fresh = ContactGeometry::Ellipsoid(Vec3(1,2,3));
+    fresh.setPlane(Plane(Vec3(0,0,1), 2));
+    assertEqual(fresh.getPlane().getOffset(), Real(2));
+
+    // Several threads may be first to need it; they must all get the same
+    // one.
+    const ContactGeometry::Ellipsoid shared(Vec3(1,2,3));
+    std::vector<const Plane*> planes(8);
+    std::vector<std::thread> threads;
+    for (int i=0; i < (int)planes.size(); ++i)
+        threads.emplace_back([&shared, &planes, i] 
+                             {planes[i] = &shared.getPlane();});
+    for (std::thread& t : threads)
+        t.join();
+    for (const Plane* plane : planes)
+        ASSERT(plane == planes[0]);
+}
+
 void testProjectDownhillToNearestPoint(const ContactGeometry& geom, Real r) {
 
     bool inside;
@@ -473,6 +606,8 @@ int main() {
         // TODO clean up these tests and use them
 //        testAnalyticalSphereGeodesic();
 //        testAnalyticalCylinderGeodesic();
+        testAnalyticGeodesicDispatch();
+        testNumericalGeodesicOnCopy();
         testProjectDownhillToNearestPoint(ContactGeometry::Sphere(r), r);
         testProjectDownhillToNearestPoint(ContactGeometry::Ellipsoid(Vec3(1.5, 2.2, 3.1)), r);
 //        testProjectDownhillToNearestPoint(ContactGeometry::Torus(3*r, r), 3*r);
@@ -0,0 +1,218 @@
+/* -------------------------------------------------------------------------- *
+ *                        Simbody(tm): SimTKmath                              *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Tests multithreaded and batched evaluation of gradients and Jacobians by
+the Differentiator, which must give exactly the serial results. */
+
+#include "SimTKmath.h"
+#include "SimTKcommon/Testing.h"
+
+#include <atomic>
+#include <iostream>
+
+using namespace SimTK;
+using std::cout;
+using std::endl;
+
+namespace {
+const int NParams = 13;
+
+// f_k(y) = k + sum_i sin((i+k+1)*y_i) * y_(i+1). Optionally burns time to
+// mimic an expensive function.
+Real calcF(const Vector& y, int which, int work) {
+    Real f = which;
+    for (int i=0; i < y.size(); ++i)
+        f += std::sin((i+which+1)*y[i]) * y[(i+1) % y.size()];
+    for (int k=0; k < work; ++k) f = f + 1e-300*std::sin(f);
+    return f;
+}
+
+// Scalar f_0, which fails when asked to evaluate at y[0] > failAbove. It
+// records the batches it is given.
+class Objective : public Differentiator::GradientFunction {
+public:
+    explicit Objective(int work=0)
+    :   GradientFunction(NParams), work(work), failAbove(Infinity),
+        numBatchCalls(0), maxBatchSeen(0) {}
+    int f(const Vector& y, Real& fy) const override {
+        if (y[0] > failAbove) return 7;
+        fy = calcF(y, 0, work);
+        return 0;
+    }
+    int fBatch(const Matrix& Y, Vector& fY) const override {
+        ++numBatchCalls;
+        int seen = maxBatchSeen;
+        while (Y.ncol() > seen
+               && !maxBatchSeen.compare_exchange_weak(seen, Y.ncol())) {}
+        return GradientFunction::fBatch(Y, fY);
+    }
+    int work;
+    Real failAbove;
+    mutable std::atomic<int> numBatchCalls, maxBatchSeen;
+};
+
+// f_0..f_4, which throws when asked to evaluate at y[n-1] > throwAbove.
+class Residuals : public Differentiator::JacobianFunction {
+public:
+    Residuals() : JacobianFunction(5, NParams), throwAbove(Infinity) {}
+    int f(const Vector& y, Vector& fy) const override {
+        if (y[NParams-1] > throwAbove)
+            throw std::runtime_error("Residuals: y out of range");
+        for (int k=0; k < fy.size(); ++k) fy[k] = calcF(y, k, 0);
+        return 0;
+    }
+    Real throwAbove;
+};
+
+// Results must match to the last bit.
+template <class M> bool isSame(const M& a, const M& b)
+{   return a.nrow()==b.nrow() && a.ncol()==b.ncol() && (a-b).norm()==0; }
+
+Vector makeY0() {
+    Vector y0(NParams);
+    for (int i=0; i < NParams; ++i) y0[i] = .1*i - .4;
+    return y0;
+}
+}
+
+void testGradientMatchesSerial() {
+    Objective obj;
+    const Vector y0 = makeY0();
+    Real f0; obj.f(y0, f0);
+
+    Differentiator serial(obj);
+    const Vector fwd = serial.calcGradient(y0);
+    const Vector ctr = serial.calcGradient(y0, Differentiator::CentralDifference);
+
+    for (int nThreads=0; nThreads <= 4; nThreads += 2)
+        for (int batch=0; batch <= 20; batch += 5) {
+            Differentiator diff(obj);
+            diff.setNumThreads(nThreads).setBatchSize(batch);
+            SimTK_TEST(diff.getNumThreads()==nThreads
+                       && diff.getBatchSize()==batch);
+            Vector g;
+            diff.calcGradient(y0, f0, g);
+            SimTK_TEST(isSame(g, fwd));
+            diff.calcGradient(y0, f0, g, Differentiator::CentralDifference);
+            SimTK_TEST(isSame(g, ctr));
+            SimTK_TEST(diff.getNumCallsToUserFunction() == 3*NParams);
+        }
+}
+
+void testJacobianMatchesSerial() {
+    Residuals res;
+    const Vector y0 = makeY0();
+
+    Differentiator serial(res);
+    const Matrix fwd = serial.calcJacobian(y0);
+    const Matrix ctr = serial.calcJacobian(y0, Differentiator::CentralDifference);
+
+    Differentiator diff(res);
+    diff.setNumThreads(3).setBatchSize(4);
+    res.resetAllStatistics();
+    SimTK_TEST(isSame(diff.calcJacobian(y0), fwd));
+    SimTK_TEST(isSame(diff.calcJacobian(y0, Differentiator::CentralDifference),
+                      ctr));
+    SimTK_TEST(res.getNumCalls() == 2 + 3*NParams);
+    SimTK_TEST(res.getNumFailures() == 0);
+}
+
+void testBatches() {
+    Objective obj;
+    const Vector y0 = makeY0();
+    Differentiator diff(obj);
+
+    diff.calcGradient(y0); // not batched
+    SimTK_TEST(obj.numBatchCalls == 0);
+
+    diff.setBatchSize(4);
+    diff.calcGradient(y0, Differentiator::CentralDifference);
+    SimTK_TEST(obj.numBatchCalls == (2*NParams+3)/4);
+    SimTK_TEST(obj.maxBatchSeen == 4);
+
+    obj.numBatchCalls = 0;
+    diff.setBatchSize(1000).setNumThreads(2);
+    diff.calcGradient(y0);
+    SimTK_TEST(obj.numBatchCalls == 1);
+    SimTK_TEST(obj.maxBatchSeen == NParams);
+}
+
+// Failures in worker threads are reported on the calling thread.
+void testFailures() {
+    const Vector y0 = makeY0();
+
+    Objective obj;
+    Real f0; obj.f(y0, f0);
+    obj.failAbove = y0[0]; // the perturbation of y[0] fails
+    Differentiator gdiff(obj);
+    gdiff.setNumThreads(4);
+    Vector g;
+    SimTK_TEST_MUST_THROW_SHOW(gdiff.calcGradient(y0, f0, g));
+    SimTK_TEST(gdiff.getNumDifferentiationFailures() == 1);
+    SimTK_TEST(obj.getNumFailures() == 1);
+
+    Residuals res;
+    Vector r0(5); res.f(y0, r0);
+    res.throwAbove = y0[NParams-1];
+    Differentiator jdiff(res);
+    jdiff.setNumThreads(4).setBatchSize(2);
+    Matrix J;
+    SimTK_TEST_MUST_THROW_SHOW(jdiff.calcJacobian(y0, r0, J));
+
+    SimTK_TEST_MUST_THROW(gdiff.setNumThreads(-1));
+    SimTK_TEST_MUST_THROW(gdiff.setBatchSize(-2));
+}
+
+// Report the time for an expensive function with and without threads.
+void timeExpensiveFunction() {
+    Objective obj(20000);
+    const Vector y0 = makeY0();
+    Real f0; obj.f(y0, f0);
+    Differentiator diff(obj);
+    Vector g1, g4;
+
+    double t0 = realTime();
+    diff.calcGradient(y0, f0, g1, Differentiator::CentralDifference);
+    const double tSerial = realTime()-t0;
+
+    diff.setNumThreads(4);
+    t0 = realTime();
+    diff.calcGradient(y0, f0, g4, Differentiator::CentralDifference);
+    const double tThreads = realTime()-t0;
+
+    SimTK_TEST(isSame(g1, g4));
+    cout << "Central difference gradient, " << NParams << " parameters: "
+         << 1000*tSerial << "ms serial, " << 1000*tThreads << "ms with "
+         << "4 threads on " << ParallelExecutor::getNumProcessors()
+         << " processors" << endl;
+}
+
+int main() {
+    SimTK_START_TEST("TestDifferentiatorThreads");
+        SimTK_SUBTEST(testGradientMatchesSerial);
+        SimTK_SUBTEST(testJacobianMatchesSerial);
+        SimTK_SUBTEST(testBatches);
+        SimTK_SUBTEST(testFailures);
+        SimTK_SUBTEST(timeExpensiveFunction);
+    SimTK_END_TEST();
+}
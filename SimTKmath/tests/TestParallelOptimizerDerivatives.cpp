@@ -0,0 +1,189 @@
+/* -------------------------------------------------------------------------- *
+ *                        Simbody(tm): SimTKmath                              *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Tests the "parallel" and "nthreads" options of the gradient-based
+optimizers, which compute numerical derivatives with multiple threads, each
+using its own clone of the OptimizerSystem. */
+
+#include "SimTKmath.h"
+#include "SimTKcommon/Testing.h"
+
+#include <atomic>
+#include <iostream>
+
+using namespace SimTK;
+using std::cout;
+using std::endl;
+
+namespace {
+const int NParams = 12;
+
+// A smooth function with a single minimum, optionally constrained to
+// sum(x_i^2) = NParams/2. If the system is cloneable, evaluation uses
+// scratch space in the system, so the same system object must never be used
+// by two threads at once; that is detected and recorded. Otherwise it is
+// threadsafe.
+class Problem : public OptimizerSystem {
+public:
+    explicit Problem(bool constrained, bool cloneable=true)
+    :   OptimizerSystem(NParams), cloneable(cloneable), inUse(false),
+        numClones(std::make_shared<std::atomic<int>>(0)),
+        numOverlaps(std::make_shared<std::atomic<int>>(0)) {
+        if (constrained) setNumEqualityConstraints(1);
+        setParameterLimits(Vector(NParams, -2.), Vector(NParams, 2.));
+    }
+    Problem(const Problem& src)
+    :   OptimizerSystem(src), cloneable(src.cloneable), inUse(false),
+        numClones(src.numClones), numOverlaps(src.numOverlaps) {}
+
+    OptimizerSystem* clone() const override {
+        if (!cloneable) return 0;
+        ++*numClones;
+        return new Problem(*this);
+    }
+
+    int objectiveFunc(const Vector& x, bool, Real& f) const override {
+        enter();
+        Vector local;
+        Vector& tmp = cloneable ? scratch : local;
+        tmp.resize(NParams-1);
+        for (int i=0; i < NParams-1; ++i)
+            tmp[i] = (i+1)*square(x[i]-.1*i) + .1*square(x[i]*x[i+1]);
+        f = sum(tmp);
+        leave();
+        return 0;
+    }
+    int constraintFunc(const Vector& x, bool, Vector& c) const override {
+        enter();
+        Vector local;
+        Vector& tmp = cloneable ? scratch : local;
+        tmp = x.elementwiseMultiply(x);
+        c[0] = sum(tmp) - NParams/2.;
+        leave();
+        return 0;
+    }
+
+    int getNumClones() const {return *numClones;}
+    int getNumOverlaps() const {return *numOverlaps;}
+
+private:
+    void enter() const
+    {   if (cloneable && inUse.exchange(true)) ++*numOverlaps; }
+    void leave() const {inUse = false;}
+
+    bool                                cloneable;
+    mutable std::atomic<bool>           inUse;
+    mutable Vector                      scratch;
+    std::shared_ptr<std::atomic<int>>   numClones, numOverlaps;
+};
+
+Vector makeX0() {
+    Vector x0(NParams);
+    for (int i=0; i < NParams; ++i) x0[i] = (i%2 ? .9 : -1.1) + .01*i;
+    return x0;
+}
+
+// Optimize with the given number of threads (1 means no parallel option).
+Vector optimize(const Problem& sys, OptimizerAlgorithm alg, int nThreads,
+                Real* f=0) {
+    Optimizer opt(sys, alg);
+    opt.useNumericalGradient(true);
+    if (sys.getNumConstraints()) opt.useNumericalJacobian(true);
+    opt.setConvergenceTolerance(1e-6);
+    opt.setMaxIterations(2000);
+    if (nThreads != 1) {
+        opt.setAdvancedStrOption("parallel", "multithreading");
+        if (nThreads > 0) opt.setAdvancedIntOption("nthreads", nThreads);
+    }
+    Vector x = makeX0();
+    const Real fOpt = opt.optimize(x);
+    if (f) *f = fOpt;
+    return x;
+}
+
+bool isSame(const Vector& a, const Vector& b)
+{   return a.size()==b.size() && (a-b).norm()==0; }
+}
+
+// Threads change neither the path nor the result of the optimization.
+void testSameResults() {
+    const OptimizerAlgorithm algs[] = {LBFGS, LBFGSB, InteriorPoint};
+    for (OptimizerAlgorithm alg : algs) {
+        if (!Optimizer::isAlgorithmAvailable(alg)) continue;
+        const bool constrained = (alg == InteriorPoint);
+        Problem sys(constrained);
+        Real fSerial, fParallel;
+        const Vector xSerial = optimize(sys, alg, 1, &fSerial);
+        SimTK_TEST(sys.getNumClones() == 0);
+        const Vector xParallel = optimize(sys, alg, 3, &fParallel);
+        SimTK_TEST(isSame(xSerial, xParallel));
+        SimTK_TEST(fSerial == fParallel);
+        SimTK_TEST(sys.getNumClones() >= 1 && sys.getNumClones() <= 3);
+        SimTK_TEST(sys.getNumOverlaps() == 0);
+    }
+}
+
+// Without clone(), the threads share the system.
+void testUncloneableSystem() {
+    Problem sys(false, false);
+    const Vector xSerial = optimize(sys, LBFGSB, 1);
+    const Vector xShared = optimize(sys, LBFGSB, 0); // all processors
+    SimTK_TEST(sys.getNumClones() == 0);
+    SimTK_TEST(isSame(xSerial, xShared));
+}
+
+void testBadOption() {
+    Problem sys(false);
+    Optimizer opt(sys, LBFGS);
+    opt.useNumericalGradient(true);
+    opt.setAdvancedStrOption("parallel", "multithreading");
+    opt.setAdvancedIntOption("nthreads", -2);
+    Vector x = makeX0();
+    SimTK_TEST_MUST_THROW(opt.optimize(x));
+}
+
+// Copies of an OptimizerSystem have their own parameter limits.
+void testCopySystem() {
+    Problem* copy;
+    {   Problem sys(true);
+        copy = static_cast<Problem*>(sys.clone()); }
+    SimTK_TEST(copy->getHasLimits() && copy->getNumConstraints() == 1);
+    Real *lower, *upper;
+    copy->getParameterLimits(&lower, &upper);
+    SimTK_TEST(lower[NParams-1] == -2 && upper[0] == 2);
+
+    Problem other(false);
+    other.setParameterLimits(Vector(), Vector());
+    static_cast<OptimizerSystem&>(*copy) = other;
+    SimTK_TEST(!copy->getHasLimits() && copy->getNumConstraints() == 0);
+    delete copy;
+}
+
+int main() {
+    SimTK_START_TEST("TestParallelOptimizerDerivatives");
+        SimTK_SUBTEST(testSameResults);
+        SimTK_SUBTEST(testUncloneableSystem);
+        SimTK_SUBTEST(testBadOption);
+        SimTK_SUBTEST(testCopySystem);
+    SimTK_END_TEST();
+}
@@ -0,0 +1,240 @@
+/* -------------------------------------------------------------------------- *
+ *                        Simbody(tm): SimTKmath                              *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Tests sparse Jacobians computed by the Differentiator with grouped
+perturbations, and sparse constraint Jacobians and Lagrangian Hessians used
+by the InteriorPoint optimizer. */
+
+#include "SimTKmath.h"
+#include "SimTKcommon/Testing.h"
+
+#include <iostream>
+
+using namespace SimTK;
+using std::cout;
+using std::endl;
+
+namespace {
+// f_i(y) = sin(y_i)*y_(i+1) + y_(i-1)^2, a tridiagonal Jacobian.
+class Banded : public Differentiator::JacobianFunction {
+public:
+    explicit Banded(int n) : JacobianFunction(n, n) {}
+    int f(const Vector& y, Vector& fy) const override {
+        const int n = y.size();
+        for (int i=0; i < n; ++i)
+            fy[i] = (i+1 < n ? std::sin(y[i])*y[i+1] : y[i])
+                    + (i > 0 ? square(y[i-1]) : 0);
+        return 0;
+    }
+    static void getPattern(int n, Array_<int>& rows, Array_<int>& cols) {
+        rows.clear(); cols.clear();
+        for (int i=0; i < n; ++i)
+            for (int j=std::max(i-1,0); j <= std::min(i+1,n-1); ++j)
+            {   rows.push_back(i); cols.push_back(j); }
+    }
+};
+
+class Scalar : public Differentiator::GradientFunction {
+public:
+    Scalar() : GradientFunction(3) {}
+    int f(const Vector& y, Real& fy) const override {fy = sum(y); return 0;}
+};
+}
+
+void testDifferentiator() {
+    const int n = 30;
+    Banded banded(n);
+    Array_<int> rows, cols;
+    Banded::getPattern(n, rows, cols);
+
+    Vector y0(n), f0(n);
+    for (int i=0; i < n; ++i) y0[i] = std::cos(Real(i));
+    banded.f(y0, f0);
+
+    Differentiator diff(banded);
+    diff.setJacobianSparsity(rows, cols);
+    SimTK_TEST(diff.getNumJacobianNonzeros() == (int)rows.size());
+    SimTK_TEST(diff.getNumJacobianColumnGroups() == 3);
+
+    const Differentiator::Method methods[] =
+    {   Differentiator::ForwardDifference, Differentiator::CentralDifference };
+    for (Differentiator::Method method : methods) {
+        Matrix dense;
+        diff.calcJacobian(y0, f0, dense, method);
+        diff.resetAllStatistics();
+        Vector values;
+        diff.calcSparseJacobian(y0, f0, values, method);
+        SimTK_TEST(diff.getNumCallsToUserFunction()
+                   == 3*Differentiator::getMethodOrder(method));
+        SimTK_TEST(values.size() == (int)rows.size());
+        for (unsigned k=0; k < rows.size(); ++k)
+            SimTK_TEST(values[k] == dense(rows[k], cols[k]));
+    }
+
+    // A diagonal pattern needs only one group; an empty one none.
+    Array_<int> diag(n);
+    for (int i=0; i < n; ++i) diag[i] = i;
+    diff.setJacobianSparsity(diag, diag);
+    SimTK_TEST(diff.getNumJacobianColumnGroups() == 1);
+    diff.setJacobianSparsity(Array_<int>(), Array_<int>());
+    SimTK_TEST(diff.getNumJacobianColumnGroups() == 0);
+
+    // Bad patterns.
+    Array_<int> dup(rows), dupCols(cols);
+    dup.push_back(rows[4]); dupCols.push_back(cols[4]);
+    SimTK_TEST_MUST_THROW(diff.setJacobianSparsity(dup, dupCols));
+    SimTK_TEST_MUST_THROW(diff.setJacobianSparsity(rows, diag));
+    Array_<int> outside(cols); outside[0] = n;
+    SimTK_TEST_MUST_THROW(diff.setJacobianSparsity(rows, outside));
+
+    Scalar scalar;
+    Differentiator sdiff(scalar);
+    Vector values;
+    SimTK_TEST_MUST_THROW(sdiff.calcSparseJacobian(Vector(3,1.),
+                                                   Vector(1,3.), values));
+}
+
+namespace {
+// Minimize sum (x_i - cos i)^2 subject to the chained constraints
+//     c_k = x_2k - x_2k+1 + sin(x_2k+2)/10 = 0,  k = 0..NCons-1,
+// whose Jacobian has three nonzeros per row.
+const int NParams = 21, NCons = 10;
+
+class Chain : public OptimizerSystem {
+public:
+    explicit Chain(bool sparseJac, bool exactHessian=false)
+    :   OptimizerSystem(NParams), sparseJac(sparseJac),
+        exactHessian(exactHessian), numConstraintCalls(0) {
+        setNumEqualityConstraints(NCons);
+    }
+    int objectiveFunc(const Vector& x, bool, Real& f) const override {
+        f = 0;
+        for (int i=0; i < NParams; ++i) f += square(x[i] - std::cos(Real(i)));
+        return 0;
+    }
+    int gradientFunc(const Vector& x, bool, Vector& g) const override {
+        for (int i=0; i < NParams; ++i) g[i] = 2*(x[i] - std::cos(Real(i)));
+        return 0;
+    }
+    int constraintFunc(const Vector& x, bool, Vector& c) const override {
+        ++numConstraintCalls;
+        for (int k=0; k < NCons; ++k)
+            c[k] = x[2*k] - x[2*k+1] + std::sin(x[2*k+2])/10;
+        return 0;
+    }
+    bool getConstraintJacobianSparsity(Array_<int>& rows,
+                                       Array_<int>& cols) const override {
+        if (!sparseJac) return false;
+        for (int k=0; k < NCons; ++k)
+            for (int j=2*k; j <= 2*k+2; ++j)
+            {   rows.push_back(k); cols.push_back(j); }
+        return true;
+    }
+    int constraintJacobianValues(const Vector& x, bool,
+                                 Vector& values) const override {
+        for (int k=0; k < NCons; ++k) {
+            values[3*k]   = 1;
+            values[3*k+1] = -1;
+            values[3*k+2] = std::cos(x[2*k+2])/10;
+        }
+        return 0;
+    }
+    bool getLagrangianHessianSparsity(Array_<int>& rows,
+                                      Array_<int>& cols) const override {
+        if (!exactHessian) return false;
+        for (int i=0; i < NParams; ++i) {rows.push_back(i); cols.push_back(i);}
+        return true;
+    }
+    int lagrangianHessianValues(const Vector& x, bool, Real objectiveFactor,
+                                const Vector& lambda,
+                                Vector& values) const override {
+        values = 2*objectiveFactor;
+        for (int k=0; k < NCons; ++k)
+            values[2*k+2] -= lambda[k]*std::sin(x[2*k+2])/10;
+        return 0;
+    }
+
+    bool sparseJac, exactHessian;
+    mutable int numConstraintCalls;
+};
+
+Vector solve(const Chain& sys, bool numericalJacobian) {
+    Optimizer opt(sys, InteriorPoint);
+    opt.setConvergenceTolerance(1e-10);
+    opt.setConstraintTolerance(1e-10);
+    opt.useNumericalJacobian(numericalJacobian);
+    Vector x(NParams, Real(.5));
+    opt.optimize(x);
+    return x;
+}
+}
+
+void testInteriorPoint() {
+    if (!Optimizer::isAlgorithmAvailable(InteriorPoint)) return;
+
+    Chain dense(false), sparse(true), analytic(true), exact(true, true);
+    const Vector xDense = solve(dense, true);
+    const Vector xSparse = solve(sparse, true);
+    const Vector xAnalytic = solve(analytic, false);
+    const Vector xExact = solve(exact, false);
+
+    SimTK_TEST_EQ_TOL(xSparse, xDense, 1e-6);
+    SimTK_TEST_EQ_TOL(xAnalytic, xDense, 1e-6);
+    SimTK_TEST_EQ_TOL(xExact, xDense, 1e-6);
+
+    Vector c(NCons);
+    exact.constraintFunc(xExact, true, c);
+    SimTK_TEST_EQ_TOL(c, Vector(NCons, Real(0)), 1e-8);
+
+    cout << "constraint evaluations: dense numerical Jacobian "
+         << dense.numConstraintCalls << ", grouped "
+         << sparse.numConstraintCalls << endl;
+    SimTK_TEST(sparse.numConstraintCalls < dense.numConstraintCalls);
+}
+
+// A pattern must fit the problem.
+void testBadPatterns() {
+    if (!Optimizer::isAlgorithmAvailable(InteriorPoint)) return;
+
+    class BadChain : public Chain {
+    public:
+        BadChain() : Chain(true, true) {}
+        bool getLagrangianHessianSparsity(Array_<int>& rows,
+                                          Array_<int>& cols) const override {
+            rows.push_back(0); cols.push_back(1); // upper triangle
+            return true;
+        }
+    };
+    BadChain bad;
+    Optimizer opt(bad, InteriorPoint);
+    Vector x(NParams, Real(.5));
+    SimTK_TEST_MUST_THROW(opt.optimize(x));
+}
+
+int main() {
+    SimTK_START_TEST("TestSparseDerivatives");
+        SimTK_SUBTEST(testDifferentiator);
+        SimTK_SUBTEST(testInteriorPoint);
+        SimTK_SUBTEST(testBadPatterns);
+    SimTK_END_TEST();
+}
@@ -56,6 +56,7 @@ will include this one). **/
 #include "simbody/internal/ForceSubsystem.h"
 #include "simbody/internal/ForceSubsystemGuts.h"
 #include "simbody/internal/SimbodyMatterSubsystem.h"
+#include "simbody/internal/SparseMassMatrix.h"
 #include "simbody/internal/SimbodyMatterSubtree.h"
 #include "simbody/internal/GeneralContactSubsystem.h"
 #include "simbody/internal/GeneralForceSubsystem.h"
@@ -70,6 +71,7 @@ will include this one). **/
 #include "simbody/internal/AssemblyCondition_Markers.h"
 #include "simbody/internal/AssemblyCondition_OrientationSensors.h"
 #include "simbody/internal/LocalEnergyMinimizer.h"
+#include "simbody/internal/Linearizer.h"
 #include "simbody/internal/ContactTrackerSubsystem.h"
 #include "simbody/internal/CompliantContactSubsystem.h"
 #include "simbody/internal/CableTrackerSubsystem.h"
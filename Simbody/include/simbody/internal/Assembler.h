@@ -130,6 +130,10 @@ with a frame time:
   {   std::cout << "Tracking failed: " << exc.what() << std::endl; }
 @endcode
 
+If all the frames of a trial are available at once, trackTrial() will track
+the whole trial and can use multiple threads to do so; describe the trial
+by implementing the Assembler::Trial interface.
+
 <h2>Optional settings:</h2>
 Optional settings include:
   - Locking particular mobilizers so that their q's can't be changed.
@@ -166,6 +170,10 @@ is unable to achieve the required error tolerance. It is derived from
 std::exception so details can be obtained via the what() method. **/
 class TrackFailed;
 
+/** This is the abstract base class for a description of a whole trial of
+observation frames to be tracked with trackTrial(). **/
+class Trial;
+
 /** @name             Construction and setup
 By default, the only assembly condition is that any Simbody Constraints
 in the System that are enabled must be satisifed to within the assembly
@@ -295,9 +303,32 @@ when combining this cost with those of other goals to form the overall cost
 function; the default weight is 1. If the weight is 0 the goal is ignored and 
 not evaluated at all; if the weight is Infinity this is actually an assembly
 constraint and we'll use its calcErrors() method instead. **/
-AssemblyConditionIndex 
+AssemblyConditionIndex
     adoptAssemblyGoal(AssemblyCondition* p, Real weight=1);
 
+/** Return the number of assembly conditions that have been adopted by this
+Assembler, including the built-in System Constraints condition. **/
+int getNumAssemblyConditions() const {return conditions.size();}
+
+/** Obtain read-only access to an AssemblyCondition that has been adopted by
+this Assembler. **/
+const AssemblyCondition&
+getAssemblyCondition(AssemblyConditionIndex condition) const {
+    SimTK_INDEXCHECK_ALWAYS(condition, conditions.size(),
+        "Assembler::getAssemblyCondition()");
+    return *conditions[condition];
+}
+/** Obtain writable access to an AssemblyCondition that has been adopted by
+this Assembler, for example to change its observations between tracking
+frames. This does not uninitialize the Assembler so you may not make
+structural changes to the condition this way. **/
+AssemblyCondition&
+updAssemblyCondition(AssemblyConditionIndex condition) {
+    SimTK_INDEXCHECK_ALWAYS(condition, conditions.size(),
+        "Assembler::updAssemblyCondition()");
+    return *conditions[condition];
+}
+
 
 /** Set the Assembler's internal state from an existing state which must
 be suitable for use with the Assembler's System as supplied at the time
@@ -346,6 +377,50 @@ assemble() instead of track(). See the Assembler class documentation for
 more information and usage examples. **/
 Real track(Real frameTime = -1);
 
+/** Track an entire trial of observation frames, for example a marker or
+orientation sensor time series, and return the solution q's for every frame.
+The trial is described by a Trial object that you provide; see Trial for
+details.
+
+If more than one thread is used, the trial is split into contiguous chunks
+of frames. A serial seed pass first solves the first frame of each chunk,
+with each seed warm-started from the previous one. Then the chunks are
+tracked concurrently, each on its own worker Assembler that is configured
+by Trial::configureAssembler() and warm-started from its chunk's seed.
+
+A seed is solved from a configuration many frames away, so it may reach a
+different solution than serial tracking would, for example with a knee or
+elbow flipped. So afterwards each chunk's first frame is solved again,
+serially, starting from the previous chunk's last solution. If that
+disagrees with the seed by more than the assembly accuracy, the rest of that
+chunk is re-tracked serially. The results then follow the same solution
+branch as a serial run and agree with it to within the accuracy, but they
+are not bit-for-bit the same and may differ slightly with the number of
+threads. The check is only made at chunk boundaries, which is enough
+because each chunk is tracked frame by frame from its first frame just as
+in a serial run. The re-solves cost one extra track() per chunk, and a
+chunk that has to be re-tracked is tracked twice. With
+\p numThreads == 1 this is just a serial loop calling track() for every
+frame.
+
+@param[in]      trial
+    Describes the frames of the trial and how to load the observations for
+    a particular frame into an Assembler.
+@param[in,out]  state
+    On input, the initial guess for the first frame (only q's are used, in
+    addition to the time-invariant variables). On return, its time and q's
+    are those of the last frame.
+@param[out]     frameQs
+    One q Vector per frame, in the same form (quaternions or Euler angles) as
+    \p state uses.
+@param[in]      numThreads
+    The number of threads to use; 0 (the default) means use one per
+    available processor.
+
+This method throws if tracking fails for any frame. **/
+void trackTrial(const Trial& trial, State& state, Array_<Vector>& frameQs,
+                int numThreads = 0);
+
 /** Given an initial value for the State, modify the q's in it to satisfy
 all the assembly conditions to within a tolerance. The actual tolerance 
 achieved is returned as the function value. 
@@ -620,6 +695,11 @@ Vector getFreeQsFromInternalState() const {
 void reinitializeWithExtraQsLocked
     (const Array_<QIndex>& toBeLocked) const;
 
+// Copy the user-settable options (tolerances, locks, restrictions, condition
+// weights) and the internal State into a freshly-constructed worker Assembler
+// that has already been given its assembly conditions. Used by trackTrial().
+void copySettingsTo(Assembler& worker) const;
+
 
 
 //------------------------------------------------------------------------------
@@ -681,6 +761,7 @@ mutable Array_<AssemblyConditionIndex>  goals;
 
 class AssemblerSystem; // local class
 mutable AssemblerSystem* asmSys;
+class TrackTrialTask;  // local class used by trackTrial()
 mutable Optimizer*       optimizer;
 
 mutable int nAssemblySteps;   // count assemble() and track() calls
@@ -689,6 +770,48 @@ mutable int nInitializations; // # times we had to reinitialize
 friend class AssemblerSystem;
 };
 
+
+
+//------------------------------------------------------------------------------
+//                            ASSEMBLER :: TRIAL
+//------------------------------------------------------------------------------
+/** This abstract class describes a trial of observation frames, such as a
+marker or orientation sensor time series, for use with
+Assembler::trackTrial(). You must override all of its pure virtual methods.
+
+Because trackTrial() may solve different parts of the trial concurrently,
+it needs to construct additional worker Assemblers for the same System.
+configureAssembler() must add to such a worker the same assembly conditions,
+in the same order, as were added to the Assembler on which trackTrial() is
+called, so that AssemblyConditionIndex values agree. Locks, range
+restrictions, tolerances and condition weights are copied from the original
+Assembler automatically. setFrame() is then used to load a particular
+frame's observations into any of these Assemblers. Both methods may be
+called concurrently from different threads for different Assemblers so they
+must not modify shared data. A frame may be loaded more than once, and not
+in order, since trackTrial() re-solves the frames at chunk boundaries. **/
+class Assembler::Trial {
+public:
+    virtual ~Trial() {}
+
+    /** Return the number of frames in this trial. **/
+    virtual int getNumFrames() const = 0;
+
+    /** Return the time associated with a frame; this is passed to track() and
+    affects prescribed motion and time-dependent conditions. **/
+    virtual Real getFrameTime(int frame) const = 0;
+
+    /** Add assembly conditions to a newly-constructed worker Assembler so
+    that it matches the one on which trackTrial() was invoked. **/
+    virtual void configureAssembler(Assembler& worker) const = 0;
+
+    /** Load the observations for the given frame into the assembly
+    conditions of \p assembler, for example using updAssemblyCondition() and
+    Markers::moveAllObservations(). This must not make structural changes to
+    the conditions. **/
+    virtual void setFrame(Assembler& assembler, int frame) const = 0;
+};
+
 } // namespace SimTK
 
 #endif // SimTK_SIMBODY_ASSEMBLER_H_
@@ -187,6 +187,18 @@ returned by getCableLength() so that getIntegratedCableLengthDot() will return
 the same values as getCableLength() during the simulations. **/
 void setIntegratedCableLengthDot(State& state, Real value) const;
 
+/** Return the number of times this cable's path has been solved for a new
+configuration since construction or the last resetStatistics() call. **/
+int getNumPathSolves() const;
+/** Return the total number of Newton iterations taken by those path
+solves. **/
+int getNumPathIterations() const;
+/** Return the total CPU time in seconds spent solving this cable's path, as
+measured by the thread that did the work. **/
+double getPathSolveCpuTime() const;
+/** Zero the path solving statistics. **/
+void resetStatistics();
+
 
 /** Default constructor creates an empty cable path not associated with any
 subsystem; don't use this. **/
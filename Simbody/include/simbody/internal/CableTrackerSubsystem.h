@@ -80,6 +80,17 @@ const CablePath& getCablePath(CablePathIndex cableIx) const;
 /** Get writable access to a particular cable path. **/
 CablePath& updCablePath(CablePathIndex cableIx);
 
+/** Solve cable paths concurrently using up to \a numThreads threads; 0 
+means one per available processor. The default is 1, meaning the paths are
+solved serially. Paths that pass over the same ContactGeometry object are
+always solved one after another by the same thread, so give each path its
+own geometry if you want them solved concurrently. The results do not depend
+on the number of threads. Per-cable work is reported by 
+CablePath::getNumPathSolves() and related methods. **/
+void setNumThreads(int numThreads);
+/** Return the value set with setNumThreads(). **/
+int getNumThreads() const;
+
 /** @cond **/ // Hide from Doxygen.
 SimTK_PIMPL_DOWNCAST(CableTrackerSubsystem, Subsystem);
 class Impl;
@@ -125,6 +125,19 @@ public:
      * Set the transition velocity (vt) of the friction model.
      */
     void setTransitionVelocity(Real v);
+    /**
+     * Evaluate the springs concurrently using up to \a numThreads threads;
+     * 0 means one per available processor. The default is 1, meaning the
+     * springs are evaluated serially. Finding the springs in contact is
+     * always done serially. The forces are always accumulated in
+     * the same order, so the results do not depend on the number of threads.
+     * This is only worthwhile for meshes with many faces in contact.
+     */
+    void setNumThreads(int numThreads);
+    /**
+     * Get the value set with setNumThreads().
+     */
+    int getNumThreads() const;
     SimTK_INSERT_DERIVED_HANDLE_DECLARATIONS(ElasticFoundationForce, ElasticFoundationForceImpl, Force);
 };
 
@@ -90,7 +90,8 @@ public:
     calculate computationally expensive forces (that have the
     shouldBeParallelIfPossible() method overridden). By default, the
     number of threads is the number of total processors (including hyperthreads)
-    on the machine.
+    on the machine. The forces are always added up in the same order, so the
+    results are identical regardless of the number of threads.
     
     @note This method should NOT be called while realizing Stage::Dynamics.**/
     void setNumberOfThreads(unsigned numThreads);
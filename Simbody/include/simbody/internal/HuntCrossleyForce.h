@@ -152,6 +152,18 @@ public:
      * Set the transition velocity (vt) of the friction model.
      */
     void setTransitionVelocity(Real v);
+    /**
+     * Evaluate the contacts concurrently using up to \a numThreads threads;
+     * 0 means one per available processor. The default is 1, meaning the
+     * contacts are evaluated serially. The forces are always accumulated in
+     * contact order, so the results do not depend on the number of threads.
+     * This is only worthwhile when there are many contacts.
+     */
+    void setNumThreads(int numThreads);
+    /**
+     * Get the value set with setNumThreads().
+     */
+    int getNumThreads() const;
     /**
      * Retrieve the ContactSetIndex that was associated with this 
      * %HuntCrossleyForce on construction. 
@@ -114,6 +114,7 @@ public:
     struct BoundedRT;
     struct ConstraintLtdFrictionRT;
     struct StateLtdFrictionRT;
+    class  SparseMatrix;
 
     // How to treat a unilateral contact (input to solver).
     enum ContactType {TypeNA=-1, Observing=0, Known=1, Participating=2};
@@ -131,7 +132,8 @@ public:
                   int maxIters) 
     :   m_maxRollingTangVel(roll2slipTransitionSpeed),
         m_convergenceTol(convergenceTol),
-        m_maxIters(maxIters)
+        m_maxIters(maxIters),
+        m_warmStart(false)
     {
         clearStats();
     }
@@ -156,6 +158,14 @@ public:
     }
     int getMaxIterations() const {return m_maxIters;}
 
+    /** If set, solve() and solveBilateral() take the incoming contents of 
+    \a pi, if it has the right size, as an initial guess for the unknown 
+    impulse rather than starting from zero. Only the participating entries are
+    used. A good guess, such as the previous time step's impulse on a resting
+    contact, can greatly reduce the work done by iterative solvers. **/
+    void setUseWarmStart(bool warmStart) {m_warmStart = warmStart;}
+    bool getUseWarmStart() const {return m_warmStart;}
+
     // We'll keep stats separately for different "phases". The meaning of a
     // phase is up to the caller.
     static const int MaxNumPhases = 3;
@@ -173,6 +183,13 @@ public:
         m_nSolves[phase] = m_nIters[phase] = m_nFail[phase] = 0;
     }
 
+    long long getNumSolves(int phase)     const {return m_nSolves[phase];}
+    long long getNumIterations(int phase) const {return m_nIters[phase];}
+    long long getNumFailures(int phase)   const {return m_nFail[phase];}
+    long long getNumBilateralSolves()     const {return m_nBilateralSolves;}
+    long long getNumBilateralIterations() const {return m_nBilateralIters;}
+    long long getNumBilateralFailures()   const {return m_nBilateralFail;}
+
     /** Solve. **/
     virtual bool solve
        (int                                 phase,
@@ -222,6 +239,41 @@ public:
         Vector&                             pi     // m, unknown result
         ) const = 0;
 
+    /** Same as the other solve() signature but with A supplied in sparse
+    form. Contacts between bodies that share no mobilities produce structural
+    zeroes in A, so for large contact sets the sparse form can be much
+    cheaper to build, store, and iterate with. The default implementation
+    expands A to a dense matrix and calls the dense signature; concrete
+    solvers that can work with A directly should override it. **/
+    virtual bool solve
+       (int                                 phase,
+        const Array_<MultiplierIndex>&      participating,
+        const SparseMatrix&                 A,     // m X m, symmetric
+        const Vector&                       D,
+        const Array_<MultiplierIndex>&      expanding,
+        Vector&                             piExpand,
+        Vector&                             verrStart,
+        Vector&                             verrApplied,
+        Vector&                             pi,
+        Array_<UncondRT>&                   unconditional,
+        Array_<UniContactRT>&               uniContact,
+        Array_<UniSpeedRT>&                 uniSpeed,
+        Array_<BoundedRT>&                  bounded,
+        Array_<ConstraintLtdFrictionRT>&    consLtdFriction,
+        Array_<StateLtdFrictionRT>&         stateLtdFriction
+        ) const;
+
+    /** Same as the other solveBilateral() signature but with A supplied in
+    sparse form. The default implementation expands A to a dense matrix and
+    calls the dense signature. **/
+    virtual bool solveBilateral
+       (const Array_<MultiplierIndex>&      participating,
+        const SparseMatrix&                 A,     // m X m, symmetric
+        const Vector&                       D,
+        const Vector&                       rhs,
+        Vector&                             pi
+        ) const;
+
     // Printable names for the enum values for debugging.
     static const char* getContactTypeName(ContactType ct);
     static const char* getUniCondName(UniCond uc);
@@ -233,9 +285,16 @@ public:
                                 const Array_<UniContactRT>& uniContacts);
 
 protected:
+    // Prepare pi for the start of a solve. If we're warm starting and pi has
+    // m entries, its non-participating entries are zeroed and we return true.
+    // Otherwise pi is resized to m and zeroed.
+    bool initializeUnknownImpulse(const Array_<MultiplierIndex>& participating,
+                                  int m, Vector& pi) const;
+
     Real m_maxRollingTangVel; // Sliding above this speed if solver cares.
     Real m_convergenceTol;    // Meaning depends on concrete solver.
     int  m_maxIters;          // Meaning depends on concrete solver.
+    bool m_warmStart;         // Use incoming pi as the initial guess?
 
     mutable long long m_nSolves[MaxNumPhases];
     mutable long long m_nIters[MaxNumPhases];
@@ -363,6 +422,67 @@ struct ImpulseSolver::StateLtdFrictionRT {
     Array_<Real>            m_Fimpulse; // same size as m_Fk
 };
 
+/** A square matrix stored in compressed sparse row form, used to supply the
+matrix A to an ImpulseSolver without forming it densely. Entries are added
+in any order with addToEntry(), with duplicates summed, and then compressed
+by finalize(); the matrix can't be used in between. The solvers expect A to
+be symmetric, so supply both (i,j) and (j,i). Within each row the column
+indices are strictly increasing. **/
+class SimTK_SIMBODY_EXPORT ImpulseSolver::SparseMatrix {
+public:
+    SparseMatrix() {resize(0);}
+    explicit SparseMatrix(int m) {resize(m);}
+
+    /** Make this an empty (all zero) m X m matrix. **/
+    void resize(int m);
+
+    int nrow() const {return (int)m_rowStart.size()-1;}
+    int ncol() const {return nrow();}
+
+    /** Add \a value to element (i,j). This doesn't take effect until the next
+    call to finalize(). **/
+    void addToEntry(int i, int j, Real value) {
+        assert(0 <= i && i < nrow() && 0 <= j && j < ncol());
+        m_pending.push_back(Entry(i,j,value));
+    }
+
+    /** Merge any entries added since the last call into the compressed
+    form. **/
+    void finalize();
+
+    bool isFinalized() const {return m_pending.empty();}
+
+    /** Return the number of stored elements. **/
+    int getNumNonzeros() const {return (int)m_cols.size();}
+
+    /** Return element (i,j), which is zero if it isn't stored. **/
+    Real getEntry(int i, int j) const;
+
+    /** Calculate Ax = A*x. **/
+    void multiply(const Vector& x, Vector& Ax) const;
+
+    /** Expand into a dense m X m matrix. **/
+    void toDense(Matrix& A) const;
+
+    /** The compressed rows: row i's elements are at [start[i],start[i+1]) of
+    the column index and value arrays. **/
+    const Array_<int>&  getRowStarts()      const {return m_rowStart;}
+    const Array_<int>&  getColumnIndices()  const {return m_cols;}
+    const Array_<Real>& getValues()         const {return m_vals;}
+
+private:
+    struct Entry {
+        Entry() {}
+        Entry(int i, int j, Real value) : i(i), j(j), value(value) {}
+        int i, j; Real value;
+    };
+
+    Array_<int>     m_rowStart; // m+1
+    Array_<int>     m_cols;
+    Array_<Real>    m_vals;
+    Array_<Entry>   m_pending;
+};
+
 } // namespace SimTK
 
 #endif // SimTK_SIMBODY_IMPULSE_SOLVER_H_
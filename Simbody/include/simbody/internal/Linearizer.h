@@ -0,0 +1,142 @@
+#ifndef SimTK_SIMBODY_LINEARIZER_H_
+#define SimTK_SIMBODY_LINEARIZER_H_
+
+/* -------------------------------------------------------------------------- *
+ *                               Simbody(tm)                                  *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "SimTKcommon.h"
+#include "simmath/Differentiator.h"
+#include "simbody/internal/common.h"
+#include "simbody/internal/MultibodySystem.h"
+#include "simbody/internal/MobilizedBody.h"
+
+namespace SimTK {
+
+/** This class linearizes the dynamics of a MultibodySystem about an operating
+point, producing the state-space matrices of
+<pre>
+    dx/dt = A x + B w
+        y = C x + D w
+</pre>
+where x is a small change in the state, w are generalized forces applied to
+chosen mobilities in addition to the system's own forces, and y are the values
+of chosen Measures.
+
+The state is described by nu generalized speed-like position changes, then nu
+changes to the generalized speeds u, then the nz auxiliary states z. The
+position part is dq = N*dtheta at the operating point, so quaternions need no
+special treatment: A has 2*nu+nz rows rather than nq+nu+nz. If the system has
+constraints, by default the state is reduced further to minimal coordinates:
+an orthonormal basis Z for the changes that satisfy the linearized position
+and velocity constraints is found, and the matrices are expressed in terms of
+xr where x = Z*xr (see getStateBasis()).
+
+The mass matrix and constraint Jacobians are used analytically, so B is exact.
+The columns of A and C are found by differencing the system's accelerations
+and the output Measures, since the force elements don't provide derivatives;
+the perturbed states can be evaluated concurrently (see setNumThreads()).
+Prescribed motion is not taken into account.
+
+@code
+    Linearizer lin(system);
+    lin.addInput(knee, MobilizerUIndex(0)).addOutput(footHeight);
+    Matrix A, B, C, D;
+    lin.linearize(state, A, B, C, D);
+@endcode **/
+class SimTK_SIMBODY_EXPORT Linearizer {
+public:
+    explicit Linearizer(const MultibodySystem& system);
+
+    /** Add an input: a generalized force applied to the given mobility.
+    Inputs are numbered in the order they are added. **/
+    Linearizer& addInput(const MobilizedBody& mobod, MobilizerUIndex which);
+    /** Add an input for each mobility of each mobilized body, in order. The
+    system's topology must have been realized. **/
+    Linearizer& addAllMobilityInputs();
+    int getNumInputs() const {return (int)inputBodies.size();}
+
+    /** Add an output. Since the inputs affect only accelerations, the
+    Measure may depend on positions, velocities and forces but not on
+    accelerations; D is then zero. **/
+    Linearizer& addOutput(const Measure_<Real>& output);
+    int getNumOutputs() const {return (int)outputs.size();}
+
+    /** Choose whether to reduce the state to minimal coordinates when the
+    system has position or velocity constraints. The default is true. **/
+    Linearizer& setUseMinimalCoordinates(bool useMinimal)
+    {   useMinimalCoordinates = useMinimal; return *this; }
+    bool getUseMinimalCoordinates() const {return useMinimalCoordinates;}
+
+    /** Set the differencing method used for A and C; the default is
+    Differentiator::CentralDifference. **/
+    Linearizer& setMethod(Differentiator::Method method);
+    Differentiator::Method getMethod() const {return method;}
+
+    /** Evaluate the perturbed states on up to \a numThreads threads; 0 means
+    one per processor and 1 (the default) means the calling thread only. The
+    results do not depend on the number of threads. Each thread realizes its
+    own copy of the State, so every force element must be safe to evaluate
+    concurrently for different States; force elements that were themselves
+    given more than one thread are not. **/
+    Linearizer& setNumThreads(int numThreads);
+    int getNumThreads() const {return numThreads;}
+
+    /** Linearize about the given state, which should satisfy the constraints
+    and must be realized through Model stage. Then A is n X n, B is
+    n X getNumInputs(), C is getNumOutputs() X n and D is
+    getNumOutputs() X getNumInputs(), where n is the number of columns of
+    getStateBasis(). **/
+    void linearize(const State& state, Matrix& A, Matrix& B,
+                   Matrix& C, Matrix& D) const;
+
+    /** Return the basis Z used by the last call to linearize(), whose
+    columns give the changes in (dtheta, du, dz) corresponding to each
+    element of the reduced state. This is the identity unless minimal
+    coordinates were used. **/
+    const Matrix& getStateBasis() const {return stateBasis;}
+
+    /** Extract the entries of \a m whose magnitude exceeds \a tol in
+    coordinate form, ordered by column and then row, for use with sparse
+    control design tools. **/
+    static void findNonzeros(const Matrix& m, Real tol, Array_<int>& rows,
+                             Array_<int>& cols, Array_<Real>& values);
+private:
+    class PerturbedStates;
+    class DynamicsFunction;
+    class ConstraintFunction;
+    void calcStateBasis(const State& s0) const;
+    void calcInputResponse(const State& s0, Matrix& B) const;
+
+    const MultibodySystem&      system;
+    Array_<MobilizedBodyIndex>  inputBodies;
+    Array_<MobilizerUIndex>     inputUs;
+    Array_<Measure_<Real>>      outputs;
+    bool                        useMinimalCoordinates;
+    Differentiator::Method      method;
+    int                         numThreads;
+    mutable Matrix              stateBasis;
+};
+
+} // namespace SimTK
+
+#endif // SimTK_SIMBODY_LINEARIZER_H_
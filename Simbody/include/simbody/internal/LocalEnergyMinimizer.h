@@ -37,6 +37,24 @@ namespace SimTK {
 
 class SimTK_SIMBODY_EXPORT LocalEnergyMinimizer {
 public:
+    /**
+     * The method used to find the minimum.
+     */
+    enum Method {
+        /** Use the Optimizer (interior point) with the position constraints
+            and quaternion normalizations as equality constraints, whose 
+            Jacobian is formed analytically. Each iteration costs O(n*m) for
+            n q's and m constraints. This is the default. */
+        ConstrainedOptimization = 0,
+        /** Use the FIRE algorithm (Bitzek et al., Phys. Rev. Lett. 97:170201,
+            2006), a damped dynamics with adaptive step size, working directly
+            with the system's own q's (quaternions are not converted). Position 
+            constraints are kept satisfied by projection. Each iteration 
+            costs O(n) plus the projection, so this is much faster for large 
+            systems, though it may take more iterations. */
+        FastInertialRelaxation = 1
+    };
+
     /**
      * Find the local potential energy minimum of a MultibodySystem.
      * 
@@ -48,8 +66,22 @@ public:
      *                     energy gradient is larger than this.
      */
     static void minimizeEnergy(const MultibodySystem& system, State& state, Real tolerance);
+
+    /**
+     * Find the local potential energy minimum of a MultibodySystem using the
+     * given method. For FastInertialRelaxation, the search ends when no 
+     * component of the generalized force (the negative energy gradient with 
+     * respect to the generalized speeds u, less its part resisted by the 
+     * constraints) is larger than \a tolerance. An exception is thrown if 
+     * that doesn't happen within \a maxIterations iterations, in which case
+     * \a state is not changed.
+     */
+    static void minimizeEnergy(const MultibodySystem& system, State& state, Real tolerance,
+                               Method method, int maxIterations = 100000);
 private:
     class OptimizerFunction;
+    static void minimizeByFIRE(const MultibodySystem& system, State& state, Real tolerance,
+                               int maxIterations);
 };
 
 } // namespace SimTK
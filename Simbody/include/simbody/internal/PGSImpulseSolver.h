@@ -50,6 +50,19 @@ When piUnknown_z[k] hits its upper limit of 0, we must have v_z[k] >= 0
 depends on all diag(A)[z[k]] > 0. That means that if v_z[k]<0 we could improve
 the solution by making piUnknown_z[k] negative, so it wouldn't have hit the
 limit.
+
+<h3>Graph-colored sweeps</h3>
+By default each iteration is a strict Gauss-Seidel sweep through the
+multipliers in order, which cannot use more than one core. If you call
+enableColoredSweeps(), each solve instead colors the multiplier groups
+(an unconditional constraint, a contact normal, a friction vector, and so on)
+of each sweep phase so that groups of the same color have no coupling through
+A, meaning they share no mobilities. Groups of one color can then be updated
+concurrently; the result is still a Gauss-Seidel iteration, just with the
+multipliers visited in color order. Rows of A are gathered once per solve into
+a compressed sparse form so that the sweeps skip the structural zeroes that
+arise between contacts on unrelated bodies. The answers are deterministic and
+do not depend on the number of threads.
 **/
 
 class SimTK_SIMBODY_EXPORT PGSImpulseSolver : public ImpulseSolver {
@@ -58,7 +71,24 @@ public:
     :   ImpulseSolver(roll2slipTransitionSpeed,
                       1e-6, // default PGS convergence tolerance
                       100), // default PGS max number iterations
-        m_SOR(1.2) {}
+        m_SOR(1.2), m_nColorsLastSolve(0) {}
+
+    /** Use graph-colored sweeps with the given number of threads; 0 (the
+    default) means use one thread per available processor. Colored sweeps
+    are worthwhile for large problems such as granular scenes with thousands
+    of contacts; they may be slower than the default for small ones. **/
+    void enableColoredSweeps(int numThreads = 0);
+
+    /** Return to the default strict Gauss-Seidel sweeps. **/
+    void disableColoredSweeps() {m_executor.reset();}
+
+    /** Return true if enableColoredSweeps() is in effect. **/
+    bool isUsingColoredSweeps() const {return !m_executor.empty();}
+
+    /** Return the number of colors that were needed in the most recent
+    solve using colored sweeps, summed over all sweep phases. This is the
+    number of sequential synchronization points per iteration. **/
+    int getNumColorsInLastSolve() const {return m_nColorsLastSolve;}
 
     /** Solve with conditional constraints. In the common underdetermined
     case (redundant contact) we will return the first solution encountered but
@@ -94,8 +124,41 @@ public:
         Vector&                             pi     // m, unknown result
         ) const override;
 
+    /** Solve with conditional constraints, using A in sparse form. This
+    performs the same iteration as colored sweeps do; if those are not
+    enabled then each sweep phase is just visited serially in multiplier
+    order. **/
+    bool solve
+       (int                                 phase,
+        const Array_<MultiplierIndex>&      participating,
+        const SparseMatrix&                 A,
+        const Vector&                       D, 
+        const Array_<MultiplierIndex>&      expanding,
+        Vector&                             piExpand,
+        Vector&                             verrStart, // in/out
+        Vector&                             verrApplied, // in/out
+        Vector&                             pi, 
+        Array_<UncondRT>&                   unconditional,
+        Array_<UniContactRT>&               uniContact,
+        Array_<UniSpeedRT>&                 uniSpeed,
+        Array_<BoundedRT>&                  bounded,
+        Array_<ConstraintLtdFrictionRT>&    consLtdFriction,
+        Array_<StateLtdFrictionRT>&         stateLtdFriction
+        ) const override;
+
+    /** Solve with only unconditional constraints, using A in sparse form. **/
+    bool solveBilateral
+       (const Array_<MultiplierIndex>&      participating,
+        const SparseMatrix&                 A,
+        const Vector&                       D,
+        const Vector&                       rhs,
+        Vector&                             pi
+        ) const override;
+
 private:
     Real m_SOR; 
+    mutable ClonePtr<ParallelExecutor> m_executor; // empty unless colored
+    mutable int                        m_nColorsLastSolve;
 };
 
 } // namespace SimTK
@@ -69,6 +69,10 @@ public:
         Vector&                             pi     // m, unknown result
         ) const override;
 
+    // PLUS factors dense submatrices of A, so a sparse A is just expanded.
+    using ImpulseSolver::solve;
+    using ImpulseSolver::solveBilateral;
+
     SimTK_DEFINE_UNIQUE_LOCAL_INDEX_TYPE(PLUSImpulseSolver, ActiveIndex);
 
 private:
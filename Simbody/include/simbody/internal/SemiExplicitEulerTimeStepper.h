@@ -67,7 +67,10 @@ public:
     enum InducedImpactModel {Simultaneous=0, Sequential=1, Mixed=2};
     enum PositionProjectionMethod {Bilateral=0,Unilateral=1,
                                    NoPositionProjection=2};
-    enum ImpulseSolverType {PLUS=0, PGS=1};
+    /** Which ImpulseSolver to allocate in initialize(). \c ColoredPGS is
+    the PGS solver with graph-colored sweeps enabled so that it can use
+    multiple threads; see PGSImpulseSolver::enableColoredSweeps(). **/
+    enum ImpulseSolverType {PLUS=0, PGS=1, ColoredPGS=2};
 
 
     explicit SemiExplicitEulerTimeStepper(const MultibodySystem& mbs);
@@ -151,6 +154,33 @@ public:
     ImpulseSolverType getImpulseSolverType() const 
     {   return m_solverType; }
 
+    /** Choose whether the impulse solver is given the projected inverse mass
+    matrix A=G M\ ~G in sparse rather than dense form. Constraints acting on
+    bodies that share no mobilities (for example, contacts on different
+    free-floating objects) produce structural zeroes in A, so for scenes with
+    many contacts on many independent bodies the sparse A can be much cheaper
+    to form and to store. It is calculated by applying multiplyByMInv() to
+    several columns of ~G at once, one for each group of multipliers whose
+    couplings don't overlap. The PGS solver iterates with the sparse A
+    directly; the PLUS solver expands it to dense form. The default is to
+    use a dense A. **/
+    void setUseSparseImpulseMatrix(bool useSparse)
+    {   m_useSparseA = useSparse; }
+    bool getUseSparseImpulseMatrix() const
+    {   return m_useSparseA; }
+
+    /** Choose whether to start each step's contact impulse calculation from
+    the contact forces found in the previous step, rather than from zero.
+    Contacts keep their identity across steps (by UnilateralContactIndex) even
+    when the set of proximal contacts changes, so resting contacts get a good
+    initial guess. For iterative impulse solvers like PGS this can cut the
+    number of iterations needed in resting contact by a large factor. The
+    default is to start from zero. **/
+    void setUseWarmStart(bool useWarmStart)
+    {   m_useWarmStart = useWarmStart; }
+    bool getUseWarmStart() const
+    {   return m_useWarmStart; }
+
     /** Set the impact capture velocity to be used by default when a contact
     does not provide its own. This is the impact velocity below which the
     coefficient of restitution is to be treated as zero. This avoids a Zeno's
@@ -293,6 +323,10 @@ private:
     bool enableProximalConstraints(State&);
     // After constraints are enabled, gather up useful info about them.
     void collectConstraintInfo(const State& s);
+    // Set the initial guess for the compression impulse from the contact
+    // forces saved at the end of the previous step, or save them.
+    void calcWarmStartImpulse(Real h, Vector& impulse) const;
+    void saveWarmStartForces(const Vector& lambda);
     // Calculate velocity-dependent coefficients of restitution and friction
     // and apply combining rules for dissimilar materials.
     void calcCoefficientsOfFriction(const State&, const Vector& verr);
@@ -381,6 +415,29 @@ private:
                               Vector&       impulse);
     bool anyPositionErrorsViolated(const State&, const Vector& perr) const;
 
+    // Calculate A=G M\ ~G into m_GMInvGt or m_sparseGMInvGt depending on
+    // whether we're using a sparse A.
+    void calcImpulseMatrix(const State& s);
+    void calcSparseProjectedMInv(const State& s);
+
+    // Call the impulse solver with whichever form of A we're using.
+    bool solveImpulses
+       (int                                             phase,
+        const Array_<MultiplierIndex>&                  participating,
+        const Array_<MultiplierIndex>&                  expanding,
+        Vector&                                         piExpand,
+        Vector&                                         verrStart,
+        Vector&                                         verrApplied,
+        Vector&                                         pi,
+        Array_<ImpulseSolver::UncondRT>&                unconditional,
+        Array_<ImpulseSolver::UniContactRT>&            uniContact,
+        Array_<ImpulseSolver::UniSpeedRT>&              uniSpeed,
+        Array_<ImpulseSolver::BoundedRT>&               bounded,
+        Array_<ImpulseSolver::ConstraintLtdFrictionRT>& consLtdFriction,
+        Array_<ImpulseSolver::StateLtdFrictionRT>&      stateLtdFriction);
+    bool solveBilateralImpulses(const Array_<MultiplierIndex>& participating,
+                                const Vector& rhs, Vector& pi);
+
     // This phase uses only holonomic constraints, and zero is a good initial
     // guess for the (hopefully small) position correction.
     bool doPositionCorrectionPhase(const State& state, 
@@ -397,6 +454,8 @@ private:
     int                         m_maxInducedImpactsPerStep;
     PositionProjectionMethod    m_projectionMethod;
     ImpulseSolverType           m_solverType;
+    bool                        m_useSparseA;
+    bool                        m_useWarmStart;
 
 
     Real                        m_defaultCaptureVelocity;
@@ -409,9 +468,15 @@ private:
     // Persistent runtime data.
     State                       m_state;
     Vector                      m_emptyVector; // don't change this!
+    // Whether the constraint info below still matches the enabled set.
+    bool                        m_constraintInfoIsValid;
+    // Last step's friction and normal forces (fx,fy,n) for each unilateral
+    // contact, zero if it wasn't proximal.
+    Array_<Vec3,UnilateralContactIndex> m_prevContactForces;
 
     // Step temporaries.
     Matrix                      m_GMInvGt; // G M\ ~G
+    ImpulseSolver::SparseMatrix m_sparseGMInvGt; // same, if using sparse A
     Vector                      m_D; // soft diagonal
     Vector                      m_deltaU;
     Vector                      m_verr;
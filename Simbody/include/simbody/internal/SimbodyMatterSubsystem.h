@@ -42,6 +42,7 @@ class Constraint;
 
 class UnilateralContact;
 class StateLimitedFriction;
+class SparseMassMatrix;
 
 /** This subsystem contains the bodies ("matter") in the multibody system,
 the mobilizers (joints) that define the generalized coordinates used to 
@@ -1356,9 +1357,29 @@ M^-1. Instead, call the method calcMInv() which can produce M^-1 directly.
 @par Required stage
   \c Stage::Position 
 
-@see multiplyByM(), calcMInv() **/
+@see multiplyByM(), calcMInv(), calcSparseM() **/
 void calcM(const State&, Matrix& M) const;
 
+/** This operator calculates the mass matrix M in a compressed form that
+stores only the elements that can be nonzero given the branching of the
+multibody tree. That is element (i,j) for mobilities i and j that lie on a
+common path to Ground; see SparseMassMatrix for the format. The elements are
+computed directly with the composite rigid body method rather than by 
+repeated multiplyByM() calls, so this takes time proportional to the number
+of stored elements. For a branched system with n mobilities that is much 
+less than n^2, and it is O(n) for a system of many small trees.
+
+The result can be factored in place without fill-in using 
+SparseMassMatrix::factorLTL() or SparseMassMatrix::factorLTDL(), and then
+used to solve M x = b in the same time. Prescribed motion is not taken into
+account; this is the full M.
+
+@par Required stage
+  \c Stage::Position
+
+@see calcM(), SparseMassMatrix **/
+void calcSparseM(const State&, SparseMassMatrix& M) const;
+
 /** This operator explicitly calculates the inverse of the part of the system
 mobility-space mass matrix corresponding to free (non-prescribed)
 mobilities. The returned matrix is always n X n, but rows and columns 
@@ -2550,6 +2571,31 @@ will *not* be repeated when realizing Stage::Position for the same q values.
 @see invalidatePositionKinematics() **/
 void realizePositionKinematics(const State& state) const;
 
+/** (Advanced) Enable or disable incremental position kinematics. When this is
+enabled and position kinematics must be recalculated after some q's have been
+changed, only the mobilized bodies whose q's differ from those used for the
+previous realization, together with all their outboard bodies, are 
+recalculated; the results for the other bodies are reused from the cache.
+Constraints are asked to recalculate their ancestor-relative kinematics only
+if one of their constrained bodies moved. This can save a lot of time when 
+only a few q's near the tips of a large tree are changed repeatedly, as in 
+interactive manipulation, inverse kinematics, or finite differencing with 
+respect to individual q's. Results are identical to full realization.
+
+The first realization after any change at Stage::Instance or earlier, or 
+after invalidatePositionKinematics(), is always done in full. This setting 
+is off by default because it costs an extra comparison and copy of all the
+q's per realization, which is wasted when most q's change every time (as 
+during time stepping). It assumes that each mobilizer's transform X_FM 
+depends only on its own q's, which is true for all built-in mobilizers and 
+should be true for Custom ones. This is not a state variable and doesn't 
+invalidate any stage when changed.
+@see getUseIncrementalPositionKinematics() **/
+void setUseIncrementalPositionKinematics(bool useIncremental);
+/** Return the current setting of the incremental position kinematics flag.
+@see setUseIncrementalPositionKinematics() **/
+bool getUseIncrementalPositionKinematics() const;
+
 /** Velocity kinematics is the first part of the Stage::Velocity realization,
 mapping generalized speeds u to the spatial (Cartesian) velocities of the 
 mobilized bodies. This mapping depends only on instance variables, position
@@ -0,0 +1,122 @@
+#ifndef SimTK_SIMBODY_SPARSE_MASS_MATRIX_H_
+#define SimTK_SIMBODY_SPARSE_MASS_MATRIX_H_
+
+/* -------------------------------------------------------------------------- *
+ *                               Simbody(tm)                                  *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "SimTKcommon.h"
+#include "simbody/internal/common.h"
+
+namespace SimTK {
+
+/** This is a mobility-space mass matrix M stored in a compressed form that
+exploits the sparsity induced by the branches of the multibody tree. It is
+filled in by SimbodyMatterSubsystem::calcSparseM().
+
+Element M(i,j) can be nonzero only if mobility i and mobility j lie on a
+common path to Ground. To express that, each mobility k is given a parent
+mobility lambda(k) < k: the preceding mobility of the same mobilizer, or else
+the last mobility of the nearest ancestor body that has any. Then row k of
+the lower triangle has nonzeros only in columns k, lambda(k),
+lambda(lambda(k)), ..., and only those are stored, in that order. The
+storage cost is the sum of the mobilities' depths rather than n^2; for a
+chain it degenerates to the dense lower triangle.
+
+The same pattern holds the factors of M without any fill-in, so the matrix
+can be factored in place. factorLTL() replaces M by L where M=~L*L, and
+factorLTDL() replaces it by unit lower triangular L and diagonal D where
+M=~L*D*L (Featherstone, Rigid Body Dynamics Algorithms, ch. 6). After either,
+solve() computes M^-1*b in O(nnz) time. Note that this is the full M; there
+is no special treatment of prescribed mobilities as there is in
+SimbodyMatterSubsystem::multiplyByMInv(). **/
+class SimTK_SIMBODY_EXPORT SparseMassMatrix {
+public:
+    /** What the stored values currently represent. **/
+    enum Contents {
+        MassMatrix, ///< M itself
+        LTL,        ///< L, with M=~L*L
+        LTDL        ///< unit L (below diagonal) and D (on it), M=~L*D*L
+    };
+
+    SparseMassMatrix() : m_contents(MassMatrix) {m_rowStart.push_back(0);}
+
+    /** Set the sparsity pattern from the parent mobility of each mobility,
+    with -1 for mobilities that have none. Each parent must precede its
+    child. All values are set to zero. **/
+    void setStructure(const Array_<int>& parent);
+
+    int nrow() const {return (int)m_parent.size();}
+    int ncol() const {return nrow();}
+
+    /** Return the number of stored elements in the lower triangle. **/
+    int getNumNonzeros() const {return (int)m_vals.size();}
+
+    Contents getContents() const {return m_contents;}
+    bool isFactored() const {return m_contents != MassMatrix;}
+
+    /** Return the parent mobility of mobility \a k, or -1. **/
+    int getParent(int k) const {return m_parent[k];}
+
+    /** Row k's stored values are at [start[k],start[k+1]), for columns
+    k, lambda(k), lambda(lambda(k)), ... **/
+    const Array_<int>&  getRowStarts() const {return m_rowStart;}
+    const Array_<Real>& getValues()    const {return m_vals;}
+    /** Writable access to the values; these are then taken to be M. **/
+    Array_<Real>&       updValues() {m_contents=MassMatrix; return m_vals;}
+
+    /** Return element (i,j) of whatever is currently stored, which is zero
+    if it isn't stored. For a factored matrix this is L(i,j) with i >= j (or
+    D(i) for i==j after factorLTDL()); the upper triangle reads as zero then.
+    For M the symmetric element is returned. **/
+    Real getEntry(int i, int j) const;
+
+    /** Calculate Mv = M*v. Not allowed once factored. **/
+    void multiply(const Vector& v, Vector& Mv) const;
+
+    /** Expand the stored matrix into a dense n X n matrix. For M this is
+    the full symmetric matrix; for a factor it is the lower triangle as
+    described for getEntry(). **/
+    void toDense(Matrix& M) const;
+
+    /** Factor M in place as M=~L*L. Throws if M is not positive definite.
+    **/
+    void factorLTL();
+
+    /** Factor M in place as M=~L*D*L, avoiding the square roots. Throws if a
+    pivot is not positive. **/
+    void factorLTDL();
+
+    /** Given factored M, calculate x = M^-1*b. \a x and \a b may be the same
+    Vector. **/
+    void solve(const Vector& b, Vector& x) const;
+
+private:
+    Array_<int>     m_parent;   // n
+    Array_<int>     m_rowStart; // n+1
+    Array_<Real>    m_vals;
+    Contents        m_contents;
+};
+
+} // namespace SimTK
+
+#endif // SimTK_SIMBODY_SPARSE_MASS_MATRIX_H_
@@ -29,6 +29,7 @@
 #include "simbody/internal/AssemblyCondition.h"
 #include <map>
 #include <iostream>
+#include <exception>
 using std::cout; using std::endl;
 
 using namespace SimTK;
@@ -978,6 +979,168 @@ Real Assembler::track(Real frameTime) {
     return calcCurrentGoal();
 }
 
+//------------------------------------------------------------------------------
+//                              TRACK TRIAL
+//------------------------------------------------------------------------------
+// Each execution of this task tracks one chunk of a trial's frames on its
+// own worker Assembler, warm-started from the seed solution that was found
+// serially for the chunk's first frame. Solutions are written as internal
+// (Euler angle) q's into slots that belong to this chunk only, so no
+// synchronization is needed. Exceptions can't be allowed to escape from a
+// worker thread; we save them and rethrow later on the calling thread.
+class Assembler::TrackTrialTask : public ParallelExecutor::Task {
+public:
+    TrackTrialTask(const Assembler& master, const Trial& trial,
+                   const Array_<int>& chunkStart, Array_<Vector>& internalQs)
+    :   master(master), trial(trial), chunkStart(chunkStart),
+        internalQs(internalQs), failures(chunkStart.size()-1) {}
+
+    void execute(int chunk) override {
+        const int first = chunkStart[chunk], last = chunkStart[chunk+1];
+        try {
+            Assembler worker(master.getMultibodySystem());
+            trial.configureAssembler(worker);
+            master.copySettingsTo(worker);
+            worker.internalState.updQ() = internalQs[first];
+            worker.initialize(); // conditions must exist before setFrame()
+            for (int f=first+1; f < last; ++f) {
+                trial.setFrame(worker, f);
+                worker.track(trial.getFrameTime(f));
+                internalQs[f] = worker.getInternalState().getQ();
+            }
+        } catch (...) {
+            failures[chunk] = std::current_exception();
+        }
+    }
+
+    // Rethrow the exception from the earliest failed chunk, if any.
+    void rethrowIfFailed() const {
+        for (unsigned i=0; i < failures.size(); ++i)
+            if (failures[i]) std::rethrow_exception(failures[i]);
+    }
+
+private:
+    const Assembler&                    master;
+    const Trial&                        trial;
+    const Array_<int>&                  chunkStart;
+    Array_<Vector>&                     internalQs;
+    Array_<std::exception_ptr>          failures;
+};
+
+void Assembler::copySettingsTo(Assembler& worker) const {
+    SimTK_ERRCHK2_ALWAYS(worker.conditions.size() == conditions.size(),
+        "Assembler::trackTrial()",
+        "Trial::configureAssembler() produced %d assembly conditions but the"
+        " original Assembler has %d; they must match.",
+        (int)worker.conditions.size(), (int)conditions.size());
+
+    worker.uninitialize();
+    worker.accuracy               = accuracy;
+    worker.tolerance              = tolerance;
+    worker.forceNumericalGradient = forceNumericalGradient;
+    worker.forceNumericalJacobian = forceNumericalJacobian;
+    worker.useRMSErrorNorm        = useRMSErrorNorm;
+    worker.internalState          = internalState;
+    worker.userLockedMobilizers   = userLockedMobilizers;
+    worker.userLockedQs           = userLockedQs;
+    worker.userRestrictedQs       = userRestrictedQs;
+    worker.weights                = weights;
+}
+
+void Assembler::trackTrial(const Trial& trial, State& state,
+                           Array_<Vector>& frameQs, int numThreads) {
+    SimTK_ERRCHK1_ALWAYS(numThreads >= 0, "Assembler::trackTrial()",
+        "Illegal number of threads %d; must be nonnegative.", numThreads);
+
+    const int nFrames = trial.getNumFrames();
+    frameQs.clear();
+    if (nFrames == 0)
+        return;
+
+    if (numThreads == 0)
+        numThreads = std::max(1, ParallelExecutor::getNumProcessors());
+    // Chunks shorter than a couple of frames aren't worth a worker Assembler.
+    const int nChunks = std::max(1, std::min(numThreads, nFrames/2));
+
+    setInternalState(state);
+    initialize(); // conditions must exist before setFrame()
+    Array_<Vector> internalQs(nFrames);
+
+    // Frame boundaries; chunk c holds frames [chunkStart[c],chunkStart[c+1]).
+    Array_<int> chunkStart(nChunks+1);
+    for (int c=0; c <= nChunks; ++c)
+        chunkStart[c] = (int)(((long long)c * nFrames) / nChunks);
+
+    // Serial seed pass: solve the first frame of each chunk, each one warm
+    // started from the previous seed. With only one chunk this is the whole
+    // (serial) trial.
+    for (int c=0; c < nChunks; ++c) {
+        const int seedEnd = nChunks == 1 ? nFrames : chunkStart[c]+1;
+        for (int f=chunkStart[c]; f < seedEnd; ++f) {
+            trial.setFrame(*this, f);
+            track(trial.getFrameTime(f));
+            internalQs[f] = internalState.getQ();
+        }
+    }
+
+    if (nChunks > 1) {
+        TrackTrialTask task(*this, trial, chunkStart, internalQs);
+        ParallelExecutor executor(nChunks);
+        executor.execute(task, nChunks);
+        task.rethrowIfFailed();
+
+        // Each seed was warm started from the previous chunk's seed, many
+        // frames earlier, so it may have landed on a different solution
+        // branch (a flipped knee, say) than serial tracking would reach.
+        // Re-solve each chunk's first frame from the previous chunk's last
+        // solution, as track() would; if the answer differs by more than the
+        // accuracy to which track() converges, re-track the rest of the chunk
+        // serially from there.
+        for (int c=1; c < nChunks; ++c) {
+            const int first = chunkStart[c], last = chunkStart[c+1];
+            internalState.setTime(trial.getFrameTime(first-1));
+            internalState.updQ() = internalQs[first-1];
+            system.realize(internalState, Stage::Position);
+            for (int f=first; f < last; ++f) {
+                trial.setFrame(*this, f);
+                track(trial.getFrameTime(f));
+                const Vector& q = internalState.getQ();
+                const bool sameBranch = f == first
+                    && max(abs(q - internalQs[f])) <= getAccuracyInUse();
+                internalQs[f] = q;
+                if (sameBranch)
+                    break;
+            }
+        }
+
+        // Leave the internal state at the last frame, as serial tracking would.
+        trial.setFrame(*this, nFrames-1);
+        internalState.setTime(trial.getFrameTime(nFrames-1));
+        internalState.updQ() = internalQs[nFrames-1];
+        system.realize(internalState, Stage::Position);
+    }
+
+    // Convert the results to the form used by the caller's State.
+    frameQs.resize(nFrames);
+    system.realizeModel(state);
+    if (getMatterSubsystem().getUseEulerAngles(state)) {
+        for (int f=0; f < nFrames; ++f)
+            frameQs[f] = internalQs[f];
+    } else {
+        State eulerState = internalState, quatState;
+        for (int f=0; f < nFrames; ++f) {
+            eulerState.updQ() = internalQs[f];
+            getMatterSubsystem().convertToQuaternions(eulerState, quatState);
+            frameQs[f] = quatState.getQ();
+        }
+    }
+
+    state.setTime(internalState.getTime());
+    state.updQ() = frameQs[nFrames-1];
+}
+
+
+
 int Assembler::getNumGoalEvals()  const 
 {   return asmSys ? asmSys->getNumObjectiveEvals() : 0;}
 int Assembler::getNumErrorEvals() const
@@ -180,6 +180,18 @@ Real CablePath::getIntegratedCableLengthDot(const State& state) const
 void CablePath::setIntegratedCableLengthDot(State& state, Real value) const
 {   getImpl().setIntegratedLengthDot(state, value); }
 
+int CablePath::getNumPathSolves() const 
+{   return getImpl().numPathSolves; }
+
+int CablePath::getNumPathIterations() const 
+{   return getImpl().numPathIterations; }
+
+double CablePath::getPathSolveCpuTime() const 
+{   return getImpl().pathSolveCpuTime; }
+
+void CablePath::resetStatistics() 
+{   updImpl().resetStatistics(); }
+
 
 //==============================================================================
 //                           CABLE PATH :: IMPL
@@ -613,6 +625,8 @@ ensurePositionKinematicsCalculated(const State& state) const {
     if (cables->isDiscreteVarUpdateValueRealized(state, posEntryIx))
         return;
 
+    const double startCpuTime = threadCpuTime();
+
     const PathInstanceInfo& instInfo = getInstanceInfo(state);
     const PathPosEntry&     prevPPE  = getPrevPosEntry(state);
     PathPosEntry&           ppe      = updPosEntry(state);
@@ -667,6 +681,9 @@ ensurePositionKinematicsCalculated(const State& state) const {
         eventTriggers[eventIx+i] = ppe.witnesses[i];
     }
 
+    ++numPathSolves;
+    pathSolveCpuTime += threadCpuTime() - startCpuTime;
+
     cables->markDiscreteVarUpdateValueRealized(state, posEntryIx);
 }
 
@@ -808,6 +825,25 @@ solveForPathPoints(const State& state, const PathInstanceInfo& instInfo,
     if (ppe.x.size() == 0)
         return; // only via points; no iteration to do
 
+    // The previous solution is from the last accepted step. If we also have
+    // its contact point velocities xdot (from the same step and for the same
+    // unknowns) then extrapolating along them is usually a much better start
+    // for this trial step. Keep whichever start has the smaller error.
+    const PathVelEntry& prevPVE = getPrevVelEntry(state);
+    const Real prevTime = cables->getDiscreteVarLastUpdateTime(state,posEntryIx);
+    const Real dt = state.getTime() - prevTime;
+    if (dt != 0 && prevPVE.xdot.size() == ppe.x.size()
+        && cables->getDiscreteVarLastUpdateTime(state,velEntryIx) == prevTime
+        && !isNaN(prevPVE.xdot.normSqr()))
+    {
+        PathPosEntry extrap(ppe);
+        extrap.x += dt*prevPVE.xdot;
+        projectOntoSurface(instInfo,extrap);
+        calcPathError(state,instInfo,extrap);
+        if (extrap.err.norm() < ppe.err.norm())
+            ppe = extrap;
+    }
+
     const Real ftol = Real(1e-12)*1000; // TODO
     const Real xtol = Real(1e-12)*1000;
 
@@ -819,8 +855,6 @@ solveForPathPoints(const State& state, const PathInstanceInfo& instInfo,
     Vector dx, xold, xchg;
 
     Real f = ppe.err.norm();
-    cout << "\n***PATH solveForPathPoints@t=" << state.getTime() 
-         << " err=" << f << "\n"; 
 
     Real fold, lam = 1, nextlam = 1;
     Real dxnormPrev = Infinity;
@@ -829,11 +863,9 @@ solveForPathPoints(const State& state, const PathInstanceInfo& instInfo,
         // We always need a Jacobian even if the path is already good enough
         // because we use it to solve for xdot. So we might as well do one
         // iteration.
-        if (i > 0 && f <= ftol) {
-            std::cout << "\n***PATH converged in " 
-                << i << " iterations err=" << f << "\n\n";
+        if (i > 0 && f <= ftol)
             break;
-        }
+        ++numPathIterations;
         //cout << "obstacle err = " << f << ", x = " << ppe.x << endl;
 
         //diff.calcJacobian(ppe.x, ppe.err, ppe.J, 
@@ -853,12 +885,8 @@ solveForPathPoints(const State& state, const PathInstanceInfo& instInfo,
         ppe.JInv.solve(ppe.err, dx);
 
         const Real dxnorm = std::sqrt(dx.normSqr()/ppe.x.size()); // rms
-        cout << "|dx| = " << dxnorm << endl;
-        if (dxnorm > Real(.99)*dxnormPrev) {
-           std::cout << "\nPATH stalled in " 
-                << i << " iterations err=" << f << " |dx|=" << dxnorm << "\n\n";
-            break;
-        }
+        if (dxnorm > Real(.99)*dxnormPrev)
+            break; // stalled
 
         // backtracking
         lam = nextlam;
@@ -1439,16 +1467,6 @@ Vec6 CableObstacle::Surface::Impl::calcSurfacePathError
     // If length is very short, or geodesic is backwards, use path binormals
     // rather than geodesic binormals.
     const Real ShortLength = Real(1e-3);
-    if (length <= ShortLength)
-        cout << "==> Using short formulation for length=" << length << endl;
-    if (signP < 0 || signQ < 0) { 
-        cout << "==> Backwards geodesic with length=" << length 
-             << " eIn*tP=" << ~eIn*tP << " eOut*tQ=" << ~eOut*tQ << endl;
-        if (signP != signQ) {
-            cout <<"    Mismatch eIn="<<eIn << " eOut="<<eOut<<endl;
-            cout <<"             tP=" <<tP << " tQ="<<tQ<<endl;
-        }
-    }
 
     const Vec3 bbarP = length<=ShortLength ? eOut % nP : Vec3(bP);
     const Vec3 bbarQ = length<=ShortLength ? eIn  % nQ : Vec3(bQ);
@@ -382,9 +382,9 @@ friend class CableObstacle;
 // counted so that CablePath objects can be multiply referenced.
 class CablePath::Impl {
 public:
-    Impl() : referenceCount(0), cables(0) {}
+    Impl() : referenceCount(0), cables(0) {resetStatistics();}
     Impl(CableTrackerSubsystem& cables)
-    :   referenceCount(0), cables(&cables) {}
+    :   referenceCount(0), cables(&cables) {resetStatistics();}
     ~Impl() {assert(referenceCount == 0);}
 
     int getNumObstacles() const {return obstacles.size();}
@@ -514,6 +514,11 @@ public:
     {   return Value<PathVelEntry>::updDowncast
            (cables->updDiscreteVarUpdateValue(state, velEntryIx)); }
 
+    void resetStatistics() {
+        numPathSolves = numPathIterations = 0;
+        pathSolveCpuTime = 0;
+    }
+
     // Be sure to call this whenever you make a topology-level change to
     // the cable definition, like adding an obstacle or modifying one in
     // a significant way.
@@ -582,6 +587,11 @@ friend class CablePath;
     EventTriggerByStageIndex    eventIx; // 1st index; one for each surface
     std::map<EventId, CableObstacleIndex> mapEventIdToObstacle;
 
+    // STATISTICS (only the thread solving this path updates these)
+    mutable int                 numPathSolves;
+    mutable int                 numPathIterations;
+    mutable double              pathSolveCpuTime;
+
     mutable int                 referenceCount;
 };
 
@@ -85,3 +85,9 @@ CablePath& CableTrackerSubsystem::
 updCablePath(CablePathIndex cableIx)
 {   return updImpl().updCablePath(cableIx); }
 
+void CableTrackerSubsystem::setNumThreads(int numThreads)
+{   updImpl().setNumThreads(numThreads); }
+
+int CableTrackerSubsystem::getNumThreads() const 
+{   return getImpl().getNumThreads(); }
+
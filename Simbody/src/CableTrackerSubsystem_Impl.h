@@ -34,7 +34,9 @@
 #include "CablePath_Impl.h"
 
 #include <cassert>
+#include <exception>
 #include <iostream>
+#include <map>
 using std::cout; using std::endl;
 
 namespace SimTK {
@@ -48,7 +50,7 @@ class CableTrackerSubsystem::Impl : public Subsystem::Guts {
 public:
 // Constructor registers a default set of Trackers to use with geometry
 // we know about. These can be overridden later.
-Impl() {}
+Impl() : numThreads(1) {}
 
 ~Impl() {}
 
@@ -69,6 +71,17 @@ CablePathIndex adoptCablePath(CablePath& path) {
     return CablePathIndex(cablePaths.size()-1);
 }
 
+void setNumThreads(int n) {
+    SimTK_APIARGCHECK1_ALWAYS(n >= 0, "CableTrackerSubsystem",
+        "setNumThreads", "Illegal number of threads %d.", n);
+    numThreads = n;
+    if (n == 1) executor.reset();
+    else executor.reset(n == 0 ? new ParallelExecutor()
+                               : new ParallelExecutor(n));
+}
+
+int getNumThreads() const {return numThreads;}
+
 // Return the MultibodySystem which owns this CableTrackerSubsystem.
 const MultibodySystem& getMultibodySystem() const 
 {   return MultibodySystem::downcast(getSystem()); }
@@ -113,6 +126,7 @@ int realizeSubsystemTopologyImpl(State& state) const override {
         path.updImpl().realizeTopology(state);
     }
 
+    wThis->findIndependentPaths();
     return 0;
 }
 
@@ -124,11 +138,20 @@ int realizeSubsystemInstanceImpl(const State& state) const override {
     return 0;
 }
 
+// Solving for the paths is the expensive part so that is where we use
+// threads if we've been asked to. Each task solves one group of paths.
 int realizeSubsystemPositionImpl(const State& state) const override {
-    for (CablePathIndex ix(0); ix < cablePaths.size(); ++ix) {
-        const CablePath& path = getCablePath(ix);
-        path.getImpl().realizePosition(state);
+    if (executor.empty() || pathGroups.size() < 2) {
+        for (CablePathIndex ix(0); ix < cablePaths.size(); ++ix) {
+            const CablePath& path = getCablePath(ix);
+            path.getImpl().realizePosition(state);
+        }
+        return 0;
     }
+
+    RealizePositionTask task(*this, state);
+    executor.upd()->execute(task, (int)pathGroups.size());
+    task.rethrowIfFailed();
     return 0;
 }
 
@@ -258,8 +281,93 @@ int calcDecorativeGeometryAndAppendImpl
 SimTK_DOWNCAST(Impl, Subsystem::Guts);
 
 private:
+// Solve the paths in one group. The paths write only their own state entries
+// and statistics. Exceptions can't be allowed to escape from a worker thread;
+// we save them and rethrow later on the calling thread.
+class RealizePositionTask : public ParallelExecutor::Task {
+public:
+    RealizePositionTask(const Impl& tracker, const State& state)
+    :   tracker(tracker), state(state), 
+        failures(tracker.pathGroups.size()) {}
+
+    void execute(int g) override {
+        try {
+            const Array_<CablePathIndex>& paths = tracker.pathGroups[g];
+            for (unsigned i=0; i < paths.size(); ++i)
+                tracker.getCablePath(paths[i]).getImpl()
+                                              .realizePosition(state);
+        } catch (...) {
+            failures[g] = std::current_exception();
+        }
+    }
+
+    // Rethrow the exception from the earliest failed group, if any.
+    void rethrowIfFailed() const {
+        for (unsigned i=0; i < failures.size(); ++i)
+            if (failures[i]) std::rethrow_exception(failures[i]);
+    }
+
+private:
+    const Impl&                 tracker;
+    const State&                state;
+    Array_<std::exception_ptr>  failures;
+};
+
+// The contact geometry objects keep scratch space for geodesic calculations
+// so two paths that wrap over the same geometry can't be solved at the same
+// time. Here we partition the paths into groups that share no geometry; each
+// group is then solved serially by one thread. Paths keep their original
+// order within a group.
+void findIndependentPaths() {
+    const int np = cablePaths.size();
+    Array_<int> group(np);
+    std::map<const ContactGeometryImpl*, int> geometryGroup;
+    for (int p=0; p < np; ++p) {
+        group[p] = p;
+        const CablePath::Impl& path = cablePaths[CablePathIndex(p)].getImpl();
+        for (CableObstacleIndex ox(0); ox < path.getNumObstacles(); ++ox) {
+            const CableObstacle::Surface::Impl* surf =
+                dynamic_cast<const CableObstacle::Surface::Impl*>
+                    (&path.getObstacleImpl(ox));
+            if (!surf) continue;
+            const ContactGeometryImpl* geo = 
+                &surf->getContactGeometry().getImpl();
+            std::map<const ContactGeometryImpl*,int>::iterator g = 
+                geometryGroup.find(geo);
+            if (g == geometryGroup.end()) {
+                geometryGroup[geo] = group[p];
+                continue;
+            }
+            // Merge this path's group into the earlier one.
+            const int from = group[p], to = g->second;
+            if (from == to) continue;
+            for (int q=0; q <= p; ++q) 
+                if (group[q] == from) group[q] = to;
+            for (g = geometryGroup.begin(); g != geometryGroup.end(); ++g)
+                if (g->second == from) g->second = to;
+        }
+    }
+
+    pathGroups.clear();
+    std::map<int,int> groupSlot;
+    for (int p=0; p < np; ++p) {
+        std::map<int,int>::iterator slot = groupSlot.find(group[p]);
+        if (slot == groupSlot.end()) {
+            groupSlot[group[p]] = pathGroups.size();
+            pathGroups.push_back(Array_<CablePathIndex>());
+            pathGroups.back().push_back(CablePathIndex(p));
+        } else
+            pathGroups[slot->second].push_back(CablePathIndex(p));
+    }
+}
+
 // TOPOLOGY STATE
 Array_<CablePath, CablePathIndex> cablePaths;
+int                               numThreads;   // 1 means serial
+mutable ClonePtr<ParallelExecutor> executor;    // empty if serial
+
+// TOPOLOGY CACHE
+Array_< Array_<CablePathIndex> >  pathGroups;
 };
 
 } // namespace SimTK
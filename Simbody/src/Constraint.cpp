@@ -3955,8 +3955,8 @@ calcPositionErrorsFromState(const State& s, Array_<Real>& perr) const {
     const int ncb = getNumConstrainedBodies();
     const int ncq = cInfo.getNumConstrainedQ();
 
-    Array_<Transform, ConstrainedBodyIndex> X_AB(ncb);
-    Array_<Real, ConstrainedQIndex>         cq(ncq);
+    SmallArray_<Transform,4,ConstrainedBodyIndex> X_AB(ncb);
+    SmallArray_<Real,8,ConstrainedQIndex>         cq(ncq);
 
     for (ConstrainedBodyIndex cbx(0); cbx < ncb; ++cbx) 
         X_AB[cbx] = getBodyTransformFromState(s, cbx);
@@ -3985,8 +3985,8 @@ calcPositionDotErrorsFromState(const State& s, Array_<Real>& pverr) const {
     const int ncb = getNumConstrainedBodies();
     const int ncq = cInfo.getNumConstrainedQ();
 
-    Array_<SpatialVec, ConstrainedBodyIndex> V_AB(ncb);
-    Array_<Real, ConstrainedQIndex>          cqdot(ncq);
+    SmallArray_<SpatialVec,4,ConstrainedBodyIndex> V_AB(ncb);
+    SmallArray_<Real,8,ConstrainedQIndex>          cqdot(ncq);
 
     for (ConstrainedBodyIndex cbx(0); cbx < ncb; ++cbx) 
         V_AB[cbx] = getBodyVelocityFromState(s, cbx);
@@ -4013,8 +4013,8 @@ calcVelocityErrorsFromState(const State& s, Array_<Real>& verr) const {
     const int ncb = getNumConstrainedBodies();
     const int ncu = cInfo.getNumConstrainedU();
 
-    Array_<SpatialVec, ConstrainedBodyIndex> V_AB(ncb);
-    Array_<Real, ConstrainedUIndex>          cu(ncu);
+    SmallArray_<SpatialVec,4,ConstrainedBodyIndex> V_AB(ncb);
+    SmallArray_<Real,8,ConstrainedUIndex>          cu(ncu);
 
     for (ConstrainedBodyIndex cbx(0); cbx < ncb; ++cbx) 
         V_AB[cbx] = getBodyVelocityFromState(s, cbx);
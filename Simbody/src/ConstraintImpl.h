@@ -317,8 +317,8 @@ void calcConstraintForcesFromMultipliers
         const int ncq = getNumConstrainedQ(s);
         const int ncu = getNumConstrainedU(s);
         // State need only be realized to Position stage
-        Array_<Real, ConstrainedQIndex> qForces(ncq, Real(0));
-        Array_<Real, ConstrainedUIndex> uForces(ncu);
+        SmallArray_<Real,8,ConstrainedQIndex> qForces(ncq, Real(0));
+        SmallArray_<Real,8,ConstrainedUIndex> uForces(ncu);
         addInPositionConstraintForces(s, lambdap, 
                                       bodyForcesInA, qForces);
         convertQForcesToUForces(s, qForces, uForces);
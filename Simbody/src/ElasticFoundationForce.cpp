@@ -27,6 +27,7 @@
 #include "simbody/internal/GeneralContactSubsystem.h"
 #include "simbody/internal/MobilizedBody.h"
 #include "ElasticFoundationForceImpl.h"
+#include <exception>
 #include <map>
 #include <set>
 
@@ -53,9 +54,26 @@ void ElasticFoundationForce::setTransitionVelocity(Real v) {
     updImpl().transitionVelocity = v;
 }
 
+void ElasticFoundationForce::setNumThreads(int numThreads) {
+    updImpl().setNumThreads(numThreads);
+}
+
+int ElasticFoundationForce::getNumThreads() const {
+    return getImpl().numThreads;
+}
+
 ElasticFoundationForceImpl::ElasticFoundationForceImpl
    (GeneralContactSubsystem& subsystem, ContactSetIndex set) : 
-        subsystem(subsystem), set(set), transitionVelocity(Real(0.01)) {
+        subsystem(subsystem), set(set), transitionVelocity(Real(0.01)),
+        numThreads(1) {
+}
+
+void ElasticFoundationForceImpl::setNumThreads(int n) {
+    SimTK_APIARGCHECK1_ALWAYS(n >= 0, "ElasticFoundationForce", 
+        "setNumThreads", "Illegal number of threads %d.", n);
+    numThreads = n;
+    if (n == 1) executor.reset();
+    else executor.reset(n == 0 ? new ParallelExecutor() : new ParallelExecutor(n));
 }
 
 void ElasticFoundationForceImpl::setBodyParameters
@@ -89,6 +107,79 @@ void ElasticFoundationForceImpl::setBodyParameters
     subsystem.invalidateSubsystemTopologyCache();
 }
 
+// One side of a contact: a mesh whose springs press against the other 
+// object.
+struct ElasticFoundationForceImpl::MeshContact {
+    const Parameters*   param;
+    const ContactGeometry* otherObject;
+    Real                areaScale;
+    MobilizedBodyIndex  body1, body2; // the mesh's body and the other one
+    Transform           t1g, t2g, t12; // mesh to ground, other to ground,
+                                       // mesh to other object
+    Vec3                origin1, origin2; // body origins in ground
+    SpatialVec          velocity1, velocity2; // body velocities in ground
+};
+
+// All the springs in contact in one calcForce() call, used when there is an
+// executor. The springs of every contact are evaluated in chunks, possibly 
+// concurrently, and the results
+// are then applied to the bodies in their original order so the sums don't 
+// depend on how the work was divided. A batch is reused from one call to
+// the next so that its arrays are only reallocated when they must grow.
+struct ElasticFoundationForceImpl::SpringBatch {
+    Array_<MeshContact> meshContacts;
+    Array_<int>         meshContact;    // for each spring
+    Array_<int>         face;
+    // Results for each spring. The force is the one on the mesh's body; the
+    // other body gets its negative. Springs that aren't inside the other 
+    // object or aren't displaced have zero force and energy.
+    Array_<Vec3>        point;          // nearest point on the other object
+    Array_<Vec3>        force;
+    Array_<Real>        energy;
+    // Exceptions thrown while evaluating each chunk.
+    Array_<std::exception_ptr> failures;
+    int size() const {return face.size();}
+    void clear() {meshContacts.clear(); meshContact.clear(); face.clear();}
+};
+
+// Springs are evaluated in chunks of this many.
+static const int SpringsPerChunk = 256;
+
+class ElasticFoundationForceImpl::CalcForceTask 
+:   public ParallelExecutor::Task {
+public:
+    CalcForceTask(const ElasticFoundationForceImpl& impl, SpringBatch& batch)
+    :   impl(impl), batch(batch), failures(batch.failures) {
+        failures.assign((batch.size()+SpringsPerChunk-1)/SpringsPerChunk,
+                        std::exception_ptr());
+    }
+
+    int getNumChunks() const {return failures.size();}
+
+    // Exceptions can't be allowed to escape from a worker thread; we save
+    // them and rethrow on the calling thread.
+    void execute(int chunk) override {
+        try {
+            const int begin = chunk*SpringsPerChunk;
+            impl.calcSpringForces(batch, begin, 
+                                  std::min(begin+SpringsPerChunk, batch.size()));
+        } catch (...) {
+            failures[chunk] = std::current_exception();
+        }
+    }
+
+    // Rethrow the exception from the earliest failed chunk, if any.
+    void rethrowIfFailed() const {
+        for (unsigned i = 0; i < failures.size(); ++i)
+            if (failures[i]) std::rethrow_exception(failures[i]);
+    }
+
+private:
+    const ElasticFoundationForceImpl&   impl;
+    SpringBatch&                        batch;
+    Array_<std::exception_ptr>&         failures;
+};
+
 void ElasticFoundationForceImpl::calcForce
    (const State& state, Vector_<SpatialVec>& bodyForces, 
     Vector_<Vec3>& particleForces, Vector& mobilityForces) const 
@@ -97,6 +188,20 @@ void ElasticFoundationForceImpl::calcForce
     Real& pe = Value<Real>::updDowncast
                 (subsystem.updCacheEntry(state, energyCacheIndex));
     pe = 0.0;
+    // Without an executor each spring is applied as soon as it is evaluated,
+    // which is cheapest when there are only a few. Otherwise the springs are
+    // first gathered into a batch, serially on this thread; only their 
+    // evaluation is divided among threads. The same force may be evaluated
+    // for different States at once, for example by a multithreaded 
+    // Differentiator, so the batch is per thread. It is shared by every
+    // ElasticFoundationForce on that thread, which is safe because 
+    // calcForce() is never reentered.
+    static thread_local SpringBatch threadBatch;
+    SpringBatch* batch = nullptr;
+    if (executor) {
+        batch = &threadBatch;
+        batch->clear();
+    }
     for (int i = 0; i < (int) contacts.size(); i++) {
         std::map<ContactSurfaceIndex, Parameters>::const_iterator iter1 = 
             parameters.find(contacts[i].getSurface1());
@@ -112,7 +217,7 @@ void ElasticFoundationForceImpl::calcForce
                 static_cast<const TriangleMeshContact&>(contacts[i]);
             processContact(state, contact.getSurface1(), 
                 contact.getSurface2(), iter1->second, 
-                contact.getSurface1Faces(), areaScale, bodyForces, pe);
+                contact.getSurface1Faces(), areaScale, batch, bodyForces, pe);
         }
 
         if (iter2 != parameters.end()) {
@@ -120,77 +225,146 @@ void ElasticFoundationForceImpl::calcForce
                 static_cast<const TriangleMeshContact&>(contacts[i]);
             processContact(state, contact.getSurface2(), 
                 contact.getSurface1(), iter2->second, 
-                contact.getSurface2Faces(), areaScale, bodyForces, pe);
+                contact.getSurface2Faces(), areaScale, batch, bodyForces, pe);
         }
     }
+    if (!batch || batch->size() == 0)
+        return;
+
+    batch->point.resize(batch->size());
+    batch->force.resize(batch->size());
+    batch->energy.resize(batch->size());
+    CalcForceTask task(*this, *batch);
+    if (task.getNumChunks() > 1)
+        executor->execute(task, task.getNumChunks());
+    else
+        task.execute(0);
+    task.rethrowIfFailed();
+
+    // Apply the forces to the bodies.
+
+    for (int i = 0; i < batch->size(); ++i) {
+        if (batch->energy[i] == 0)
+            continue;
+        const MeshContact& mc = batch->meshContacts[batch->meshContact[i]];
+        const Vec3& force = batch->force[i];
+        bodyForces[mc.body1] += SpatialVec((batch->point[i]-mc.origin1) % force, force);
+        bodyForces[mc.body2] -= SpatialVec((batch->point[i]-mc.origin2) % force, force);
+        pe += batch->energy[i];
+    }
 }
 
 void ElasticFoundationForceImpl::processContact
    (const State& state, 
     ContactSurfaceIndex meshIndex, ContactSurfaceIndex otherBodyIndex, 
     const Parameters& param, const std::set<int>& insideFaces,
-    Real areaScale, Vector_<SpatialVec>& bodyForces, Real& pe) const 
+    Real areaScale, SpringBatch* batch, Vector_<SpatialVec>& bodyForces,
+    Real& pe) const 
 {
-    const ContactGeometry& otherObject = subsystem.getBodyGeometry(set, otherBodyIndex);
     const MobilizedBody& body1 = subsystem.getBody(set, meshIndex);
     const MobilizedBody& body2 = subsystem.getBody(set, otherBodyIndex);
-    const Transform t1g = body1.getBodyTransform(state)*subsystem.getBodyTransform(set, meshIndex); // mesh to ground
-    const Transform t2g = body2.getBodyTransform(state)*subsystem.getBodyTransform(set, otherBodyIndex); // other object to ground
-    const Transform t12 = ~t2g*t1g; // mesh to other object
+    MeshContact mc;
+    mc.param = &param;
+    mc.otherObject = &subsystem.getBodyGeometry(set, otherBodyIndex);
+    mc.areaScale = areaScale;
+    mc.body1 = body1.getMobilizedBodyIndex();
+    mc.body2 = body2.getMobilizedBodyIndex();
+    mc.t1g = body1.getBodyTransform(state)*subsystem.getBodyTransform(set, meshIndex); // mesh to ground
+    mc.t2g = body2.getBodyTransform(state)*subsystem.getBodyTransform(set, otherBodyIndex); // other object to ground
+    mc.t12 = ~mc.t2g*mc.t1g; // mesh to other object
+    mc.origin1 = body1.getBodyOriginLocation(state);
+    mc.origin2 = body2.getBodyOriginLocation(state);
+    mc.velocity1 = body1.getBodyVelocity(state);
+    mc.velocity2 = body2.getBodyVelocity(state);
+
+    if (batch) {
+        const int index = batch->meshContacts.size();
+        batch->meshContacts.push_back(mc);
+        for (std::set<int>::const_iterator iter = insideFaces.begin(); 
+                                           iter != insideFaces.end(); ++iter) {
+            batch->meshContact.push_back(index);
+            batch->face.push_back(*iter);
+        }
+        return;
+    }
 
     // Loop over all the springs, and evaluate the force from each one.
 
     for (std::set<int>::const_iterator iter = insideFaces.begin(); 
                                        iter != insideFaces.end(); ++iter) {
-        int face = *iter;
-        UnitVec3 normal;
-        bool inside;
-        Vec3 nearestPoint = otherObject.findNearestPoint(t12*param.springPosition[face], inside, normal);
-        if (!inside)
+        Vec3 point, force;
+        const Real energy = calcSpringForce(mc, *iter, point, force);
+        if (energy == 0)
             continue;
-        
-        // Find how much the spring is displaced.
-        
-        nearestPoint = t2g*nearestPoint;
-        const Vec3 springPosInGround = t1g*param.springPosition[face];
-        const Vec3 displacement = nearestPoint-springPosInGround;
-        const Real distance = displacement.norm();
-        if (distance == 0.0)
-            continue;
-        const Vec3 forceDir = displacement/distance;
-        
-        // Calculate the relative velocity of the two bodies at the contact point.
-        
-        const Vec3 station1 = body1.findStationAtGroundPoint(state, nearestPoint);
-        const Vec3 station2 = body2.findStationAtGroundPoint(state, nearestPoint);
-        const Vec3 v1 = body1.findStationVelocityInGround(state, station1);
-        const Vec3 v2 = body2.findStationVelocityInGround(state, station2);
-        const Vec3 v = v2-v1;
-        const Real vnormal = dot(v, forceDir);
-        const Vec3 vtangent = v-vnormal*forceDir;
-        
-        // Calculate the damping force.
-        
-        const Real area = areaScale * param.springArea[face];
-        const Real f = param.stiffness*area*distance*(1+param.dissipation*vnormal);
-        Vec3 force = (f > 0 ? f*forceDir : Vec3(0));
-        
-        // Calculate the friction force.
-        
-        const Real vslip = vtangent.norm();
-        if (f > 0 && vslip != 0) {
-            const Real vrel = vslip/transitionVelocity;
-            const Real ffriction = 
-                f*(std::min(vrel, Real(1))
-                 *(param.dynamicFriction+2*(param.staticFriction-param.dynamicFriction)
-                 /(1+vrel*vrel))+param.viscousFriction*vslip);
-            force += ffriction*vtangent/vslip;
-        }
+        bodyForces[mc.body1] += SpatialVec((point-mc.origin1) % force, force);
+        bodyForces[mc.body2] -= SpatialVec((point-mc.origin2) % force, force);
+        pe += energy;
+    }
+}
 
-        body1.applyForceToBodyPoint(state, station1, force, bodyForces);
-        body2.applyForceToBodyPoint(state, station2, -force, bodyForces);
-        pe += param.stiffness*area*displacement.normSqr()/2;
+// Evaluate the springs [begin,end) of the batch.
+void ElasticFoundationForceImpl::calcSpringForces
+   (SpringBatch& batch, int begin, int end) const 
+{
+    for (int i = begin; i < end; ++i)
+        batch.energy[i] = calcSpringForce
+           (batch.meshContacts[batch.meshContact[i]], batch.face[i], 
+            batch.point[i], batch.force[i]);
+}
+
+// Evaluate one spring, returning its energy. The force is the one on the 
+// mesh's body, applied at the given point on the other object. A spring that
+// isn't inside the other object or isn't displaced has zero force and energy.
+Real ElasticFoundationForceImpl::calcSpringForce
+   (const MeshContact& mc, int face, Vec3& point, Vec3& force) const 
+{
+    const Parameters& param = *mc.param;
+    force = Vec3(0);
+    UnitVec3 normal;
+    bool inside;
+    Vec3 nearestPoint = mc.otherObject->findNearestPoint(mc.t12*param.springPosition[face], inside, normal);
+    if (!inside)
+        return 0;
+    
+    // Find how much the spring is displaced.
+    
+    nearestPoint = mc.t2g*nearestPoint;
+    const Vec3 springPosInGround = mc.t1g*param.springPosition[face];
+    const Vec3 displacement = nearestPoint-springPosInGround;
+    const Real distance = displacement.norm();
+    if (distance == 0.0)
+        return 0;
+    const Vec3 forceDir = displacement/distance;
+    
+    // Calculate the relative velocity of the two bodies at the contact point.
+    
+    const Vec3 v1 = mc.velocity1[1] + mc.velocity1[0] % (nearestPoint-mc.origin1);
+    const Vec3 v2 = mc.velocity2[1] + mc.velocity2[0] % (nearestPoint-mc.origin2);
+    const Vec3 v = v2-v1;
+    const Real vnormal = dot(v, forceDir);
+    const Vec3 vtangent = v-vnormal*forceDir;
+    
+    // Calculate the damping force.
+    
+    const Real area = mc.areaScale * param.springArea[face];
+    const Real f = param.stiffness*area*distance*(1+param.dissipation*vnormal);
+    if (f > 0)
+        force = f*forceDir;
+    
+    // Calculate the friction force.
+    
+    const Real vslip = vtangent.norm();
+    if (f > 0 && vslip != 0) {
+        const Real vrel = vslip/transitionVelocity;
+        const Real ffriction = 
+            f*(std::min(vrel, Real(1))
+             *(param.dynamicFriction+2*(param.staticFriction-param.dynamicFriction)
+             /(1+vrel*vrel))+param.viscousFriction*vslip);
+        force += ffriction*vtangent/vslip;
     }
+
+    point = nearestPoint;
+    return param.stiffness*area*displacement.normSqr()/2;
 }
 
 Real ElasticFoundationForceImpl::calcPotentialEnergy(const State& state) const {
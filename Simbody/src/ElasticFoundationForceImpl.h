@@ -46,18 +46,28 @@ public:
                    Vector_<Vec3>& particleForces, Vector& mobilityForces) const override;
     Real calcPotentialEnergy(const State& state) const override;
     void realizeTopology(State& state) const override;
+    void setNumThreads(int n);
+private:
+    friend class ElasticFoundationForce;
+    struct MeshContact;
+    struct SpringBatch;
+    class CalcForceTask;
     void processContact(const State& state, ContactSurfaceIndex meshIndex, 
                         ContactSurfaceIndex otherBodyIndex, 
                         const Parameters& param, 
-                        const std::set<int>& insideFaces,
-                        Real areaScale,
-                        Vector_<SpatialVec>& bodyForces, Real& pe) const;
-private:
-    friend class ElasticFoundationForce;
+                        const std::set<int>& insideFaces, Real areaScale,
+                        SpringBatch* batch, Vector_<SpatialVec>& bodyForces,
+                        Real& pe) const;
+    Real calcSpringForce(const MeshContact& mc, int face, 
+                         Vec3& point, Vec3& force) const;
+    void calcSpringForces(SpringBatch& batch, int begin, int end) const;
+
     const GeneralContactSubsystem& subsystem;
     const ContactSetIndex set;
     std::map<ContactSurfaceIndex, Parameters> parameters;
     Real transitionVelocity;
+    int numThreads; // 1 means serial
+    mutable ClonePtr<ParallelExecutor> executor; // empty if serial
     mutable CacheEntryIndex energyCacheIndex;
 };
 
@@ -39,481 +39,271 @@
 
 #include "ForceImpl.h"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 
-//Threading constants used by CalcForcesTask
+// Forces are evaluated in blocks, each block accumulating into its own
+// arrays, and the blocks' arrays are then added together pairwise in a fixed
+// tree. Which forces go into which block depends only on which forces are
+// enabled, never on the number of threads or on timing, so the results are
+// bitwise identical however many threads are used.
 namespace {
 using namespace SimTK;
 
-const int NumNonParallelThreads = 1;
-const int NonParallelForcesIndex = 0;
+// The enabled parallel forces are divided into at most this many blocks of
+// consecutive forces. The non-parallel forces make up one more block, which
+// is always evaluated on a single thread in force order.
+const int MaxParallelBlocks = 32;
+
+// The weight given to the latest measurement of a force's cost.
+const double CostSmoothing = 0.25;
+
+// Refers to a set of force arrays to accumulate into.
+struct ForceArrays {
+    ForceArrays(Vector_<SpatialVec>& rigidBodyForces, 
+                Vector_<Vec3>& particleForces, Vector& mobilityForces)
+    :   rigidBodyForces(rigidBodyForces), particleForces(particleForces),
+        mobilityForces(mobilityForces) {}
+    Vector_<SpatialVec>&    rigidBodyForces;
+    Vector_<Vec3>&          particleForces;
+    Vector&                 mobilityForces;
+};
 
-/* Base class for CalcForcesParallelTask and CalcForcesNonParallelTask - lays 
-out common methods that will be implemented to suit the parallel/non-parallel
-use cases*/
-class CalcForcesTask : public ParallelExecutor::Task {
-public:
-    CalcForcesTask() = default;
-    
-    virtual CalcForcesTask* clone() const = 0;
-    
-    virtual void initializeAll(
-            const Array_<Force*>& forces, const State& s,
-            const Array_<ForceIndex>& enabledNonParallelForces,
-            const Array_<ForceIndex>& enabledParallelForces,
-            Vector_<SpatialVec>& rigidBodyForces,
-            Vector_<Vec3>& particleForces,
-            Vector& mobilityForces) = 0;
-    virtual void initializeCachedAndNonCached(
-            const Array_<Force*>& forces, const State& s,
-            const Array_<ForceIndex>& enabledNonParallelForces,
-            const Array_<ForceIndex>& enabledParallelForces,
-            Vector_<SpatialVec>& rigidBodyForces,
-            Vector_<Vec3>& particleForces,
-            Vector& mobilityForces,
-            Vector_<SpatialVec>& rigidBodyForceCache,
-            Vector_<Vec3>& particleForceCache,
-            Vector& mobilityForceCache) = 0;
-    virtual void initializeNonCached(
-            const Array_<Force*>& forces, const State& s,
-            const Array_<ForceIndex>& enabledNonParallelForces,
-            const Array_<ForceIndex>& enabledParallelForces,
-            Vector_<SpatialVec>& rigidBodyForces,
-            Vector_<Vec3>& particleForces,
-            Vector& mobilityForces) = 0;
-    
+// A set of force arrays belonging to one block.
+struct BlockArrays {
+    ForceArrays upd() 
+    {   return ForceArrays(rigidBodyForces, particleForces, mobilityForces); }
+    void resizeAndZero(const ForceArrays& like) {
+        rigidBodyForces.resize(like.rigidBodyForces.size());
+        rigidBodyForces.setToZero();
+        particleForces.resize(like.particleForces.size());
+        particleForces.setToZero();
+        mobilityForces.resize(like.mobilityForces.size());
+        mobilityForces.setToZero();
+    }
+    void add(const BlockArrays& other) {
+        rigidBodyForces += other.rigidBodyForces;
+        particleForces += other.particleForces;
+        mobilityForces += other.mobilityForces;
+    }
+    void addTo(ForceArrays& result) const {
+        result.rigidBodyForces += rigidBodyForces;
+        result.particleForces += particleForces;
+        result.mobilityForces += mobilityForces;
+    }
+    Vector_<SpatialVec> rigidBodyForces;
+    Vector_<Vec3>       particleForces;
+    Vector              mobilityForces;
 };
-/*Calculates each enabled force's contribution in the MultibodySystem.
-CalcForcesParallelTask allows force calculations to occur in parallel with
-non-parallel forces being calculated on Thread NonParallelForcesIndex and all
-other parallel forces being calculated on separate threads.*/
 
-//Implementation of CalcForcesTask for parallel forces
-class CalcForcesParallelTask : public CalcForcesTask {
+/* Calculates each enabled force's contribution in the MultibodySystem. The
+blocks are handed out to the threads most expensive first, using the measured
+cost of each force from earlier evaluations, so that many cheap forces can
+share a thread while an expensive one has a thread to itself. */
+class CalcForcesTask : public ParallelExecutor::Task {
 public:
     //The different categories of force calculations that GeneralForceSubsystem
     //chooses between
     enum Mode {
-        All,
-        CachedAndNonCached,
-        NonCached
+        All,                // every enabled force goes into forces
+        CachedAndNonCached, // position-only forces go into cache instead
+        NonCached           // position-only forces are skipped
     };
-    
-    CalcForcesParallelTask* clone() const override {
-        return new CalcForcesParallelTask();
-    }
-    // Each different force calculation Mode requires different parameters
-    //
-    // Note: Execute MUST be called directly after CalcForceTask is initialized
-    void initializeAll(
-            const Array_<Force*>& forces, const State& s,
-            const Array_<ForceIndex>& enabledNonParallelForces,
-            const Array_<ForceIndex>& enabledParallelForces,
-            Vector_<SpatialVec>& rigidBodyForces,
-            Vector_<Vec3>& particleForces,
-            Vector& mobilityForces) override
+
+    CalcForcesTask() : m_inUse(false) {}
+
+    // The block arrays and measured costs are only scratch, so a clone
+    // starts out fresh.
+    CalcForcesTask* clone() const {return new CalcForcesTask();}
+
+    // The task's scratch space can serve only one State at a time. Claim it
+    // before calling calcForces() if other threads might be using it too.
+    bool tryAcquire() {return !m_inUse.exchange(true);}
+    void release() {m_inUse = false;}
+
+    // Calculate the enabled forces and add them into the given arrays; cache
+    // is used only in CachedAndNonCached mode. With no executor, everything
+    // is done on the calling thread.
+    void calcForces(ParallelExecutor* executor, Mode mode,
+                    const Array_<Force*>& forces, const State& s,
+                    const Array_<ForceIndex>& enabledNonParallelForces,
+                    const Array_<ForceIndex>& enabledParallelForces,
+                    ForceArrays& result, ForceArrays* cache) 
     {
+        m_mode = mode;
         m_forces = &forces;
+        m_result = &result;
         m_state = &s;
-        m_enabledNonParallelForces = &enabledNonParallelForces;
-        m_enabledParallelForces = &enabledParallelForces;
-        m_rigidBodyForces = &rigidBodyForces;
-        m_particleForces = &particleForces;
-        m_mobilityForces = &mobilityForces;
+        m_cost.resize(forces.size(), 0.);
+        assignBlocks(enabledNonParallelForces, enabledParallelForces);
+        const int numBlocks = m_blockStart.size()-1;
+        if (numBlocks == 0)
+            return;
         
-        m_mode = All;
-    }
-    void initializeCachedAndNonCached(
-            const Array_<Force*>& forces, const State& s,
-            const Array_<ForceIndex>& enabledNonParallelForces,
-            const Array_<ForceIndex>& enabledParallelForces,
-            Vector_<SpatialVec>& rigidBodyForces,
-            Vector_<Vec3>& particleForces,
-            Vector& mobilityForces,
-            Vector_<SpatialVec>& rigidBodyForceCache,
-            Vector_<Vec3>& particleForceCache,
-            Vector& mobilityForceCache) override
-    {
-        m_forces = &forces;
-        m_state = s;
-        m_enabledNonParallelForces = &enabledNonParallelForces;
-        m_enabledParallelForces = &enabledParallelForces;
-        m_rigidBodyForces = &rigidBodyForces;
-        m_particleForces = &particleForces;
-        m_mobilityForces = &mobilityForces;
-        m_rigidBodyForceCache = &rigidBodyForceCache;
-        m_particleForceCache = &particleForceCache;
-        m_mobilityForceCache = &mobilityForceCache;
-
-        m_mode = CachedAndNonCached;
-    }
-    void initializeNonCached(
-            const Array_<Force*>& forces, const State& s,
-            const Array_<ForceIndex>& enabledNonParallelForces,
-            const Array_<ForceIndex>& enabledParallelForces,
-            Vector_<SpatialVec>& rigidBodyForces,
-            Vector_<Vec3>& particleForces,
-            Vector& mobilityForces) override
-    {
-        m_forces = &forces;
-        m_state = s;
-        m_enabledNonParallelForces = &enabledNonParallelForces;
-        m_enabledParallelForces = &enabledParallelForces;
-        m_rigidBodyForces = &rigidBodyForces;
-        m_particleForces = &particleForces;
-        m_mobilityForces = &mobilityForces;
-
-        m_mode = NonCached;
-    }
-    
-    // Set all of the local force contribution arrays to 0. This is so that
-    // each local thread can sum up its force contribution to be later
-    // added into the total force array.
-    void initialize() override {
-        m_rigidBodyForcesLocalStatic.resize(m_rigidBodyForces->size());
-        m_rigidBodyForcesLocalStatic.setToZero();
-        m_particleForcesLocalStatic.resize(m_particleForces->size());
-        m_particleForcesLocalStatic.setToZero();
-        m_mobilityForcesLocalStatic.resize(m_mobilityForces->size());
-        m_mobilityForcesLocalStatic.setToZero();
-
-        if (m_mode == CachedAndNonCached) {
-            m_rigidBodyForceCacheLocalStatic.resize(m_rigidBodyForceCache->size());
-            m_rigidBodyForceCacheLocalStatic.setToZero();
-            m_particleForceCacheLocalStatic.resize(m_particleForceCache->size());
-            m_particleForceCacheLocalStatic.setToZero();
-            m_mobilityForceCacheLocalStatic.resize(m_mobilityForceCache->size());
-            m_mobilityForceCacheLocalStatic.setToZero();
+        // With only one block there is nothing to add up; accumulate
+        // directly into the result.
+        if (numBlocks == 1) {
+            m_timing = false;
+            calcBlock(0, result, cache);
+            return;
         }
-    }
-    
-    // Calculate all enabled forces (taking into account mode and parallelism)
-    void execute(int threadIndex) override {
-      switch (m_mode) {
-        case All:
-            if (threadIndex == NonParallelForcesIndex) {
-                // Process all non-parallel forces
-                for (const auto& forceIndex : *m_enabledNonParallelForces) {
-                    const auto force = m_forces.getRef()[forceIndex];
-                    force->getImpl().calcForce(*m_state, m_rigidBodyForcesLocalStatic, m_particleForcesLocalStatic, m_mobilityForcesLocalStatic);
-                }
-            } else {
-                // Process a single parallel force. Subtract 1 from index b/c
-                // we use 0 for the non-parallel forces.
-                const auto& forceIndex =
-                        m_enabledParallelForces->getElt(threadIndex-1);
-                const auto& impl = m_forces.getRef()[forceIndex]->getImpl();
-                impl.calcForce(*m_state, m_rigidBodyForcesLocalStatic, m_particleForcesLocalStatic, m_mobilityForcesLocalStatic);
 
-            }
-            break;
-
-        case CachedAndNonCached:
-            if (threadIndex == NonParallelForcesIndex) {
-                // Process all non-parallel forces.
-                for (const auto& forceIndex : *m_enabledNonParallelForces) {
-                    const auto& impl = m_forces.getRef()[forceIndex]->getImpl();
-                    if (impl.dependsOnlyOnPositions()) {
-                        impl.calcForce(*m_state, *m_rigidBodyForceCache, *m_particleForceCache, *m_mobilityForceCache);
-                    } else { // ordinary velocity dependent force
-                        impl.calcForce(*m_state, *m_rigidBodyForces, *m_particleForces, *m_mobilityForces);
-                    }
-                }
-            } else {
-                // Process a single parallel force. Subtract 1 from threadIndex b/c
-                // we use 0 for the non-parallel forces.
-                const auto& forceIndex =
-                        m_enabledParallelForces->getElt(threadIndex-1);
-                const auto& impl = m_forces.getRef()[forceIndex]->getImpl();
-                if (impl.dependsOnlyOnPositions()) {
-                    impl.calcForce(*m_state, m_rigidBodyForceCacheLocalStatic, m_particleForceCacheLocalStatic, m_mobilityForceCacheLocalStatic);
-                } else { // ordinary velocity dependent force
-                    impl.calcForce(*m_state, m_rigidBodyForcesLocalStatic, m_particleForcesLocalStatic, m_mobilityForcesLocalStatic);
-                }
-            }
-            break;
-
-        case NonCached:
-            if (threadIndex == NonParallelForcesIndex) {
-                // Process all non-parallel forces.
-                for (const auto& forceIndex : *m_enabledNonParallelForces) {
-                    const auto& impl = m_forces.getRef()[forceIndex]->getImpl();
-                    if (!impl.dependsOnlyOnPositions()) {
-                        impl.calcForce(*m_state,
-                                *m_rigidBodyForces, *m_particleForces,
-                                *m_mobilityForces);
-                    }
-                }
-            } else {
-                // Process a single parallel force. Subtract 1 from index b/c
-                // we use 0 for the non-parallel forces.
-                const auto& forceIndex =
-                        m_enabledParallelForces->getElt(threadIndex-1);
-                const auto& impl = m_forces.getRef()[forceIndex]->getImpl();
-                if (!impl.dependsOnlyOnPositions()) {
-                    impl.calcForce(*m_state,
-                            m_rigidBodyForcesLocalStatic, m_particleForcesLocalStatic,
-                            m_mobilityForcesLocalStatic);
-                }
-            }
-            break;
+        m_blocks.resize(numBlocks);
+        m_failures.clear();
+        m_failures.resize(numBlocks);
+        scheduleBlocks();
+        const int numWorkers = executor 
+            ? std::min(executor->getMaxThreads(), numBlocks) : 1;
+        m_timing = numWorkers > 1;
+        m_nextBlock = 0;
+        if (numWorkers > 1)
+            executor->execute(*this, numWorkers);
+        else
+            execute(0);
+        for (const std::exception_ptr& failure : m_failures)
+            if (failure) std::rethrow_exception(failure);
+
+        // Add up the blocks' contributions in a fixed order.
+        for (int stride = 1; stride < numBlocks; stride *= 2) {
+            ReduceTask reduce(m_blocks, stride, mode == CachedAndNonCached);
+            if (numWorkers > 1 && reduce.getNumPairs() > 1)
+                executor->execute(reduce, reduce.getNumPairs());
+            else
+                for (int pair = 0; pair < reduce.getNumPairs(); ++pair)
+                    reduce.execute(pair);
         }
+        m_blocks[0].forces.addTo(result);
+        if (mode == CachedAndNonCached)
+            m_blocks[0].cache.addTo(*cache);
     }
-    
-    //Once a thread has finished its force calculations, we add in the thread's
-    //contribution into the cached force arrays in the State
-    void finish() override {
-        *m_rigidBodyForces += m_rigidBodyForcesLocalStatic;
-        *m_particleForces += m_particleForcesLocalStatic;
-        *m_mobilityForces += m_mobilityForcesLocalStatic;
-
-        if (m_mode == CachedAndNonCached) {
-            *m_rigidBodyForceCache += m_rigidBodyForceCacheLocalStatic;
-            *m_particleForceCache += m_particleForceCacheLocalStatic;
-            *m_mobilityForceCache += m_mobilityForceCacheLocalStatic;
+
+    // Each call evaluates blocks until there are none left.
+    void execute(int) override {
+        for (int next = m_nextBlock++; next < (int)m_schedule.size();
+             next = m_nextBlock++)
+        {
+            const int b = m_schedule[next];
+            try {
+                Block& block = m_blocks[b];
+                block.forces.resizeAndZero(*m_result);
+                if (m_mode == CachedAndNonCached)
+                    block.cache.resizeAndZero(*m_result);
+                ForceArrays cache = block.cache.upd();
+                calcBlock(b, block.forces.upd(), &cache);
+            } catch (...) {
+                m_failures[b] = std::current_exception();
+            }
         }
     }
-private:
-    Mode m_mode;
-
-    ReferencePtr<const Array_<Force*>> m_forces;
-    ReferencePtr<const State> m_state;
-
-    // Constant state-cache variables for the enabled parallel and non-parallel
-    // forces.
-    ReferencePtr<const Array_<ForceIndex>> m_enabledNonParallelForces;
-    ReferencePtr<const Array_<ForceIndex>> m_enabledParallelForces;
-
-    // ReferencePtrs that point to caches in the state; We eventually add our
-    // thread-local result to these vectors.
-    ReferencePtr<Vector_<SpatialVec>> m_rigidBodyForces;
-    ReferencePtr<Vector_<Vec3>> m_particleForces;
-    ReferencePtr<Vector> m_mobilityForces;
 
-    ReferencePtr<Vector_<SpatialVec>> m_rigidBodyForceCache;
-    ReferencePtr<Vector_<Vec3>> m_particleForceCache;
-    ReferencePtr<Vector> m_mobilityForceCache;
-    
-    // These variables are local to a thread. They are set to their default
-    // value when the threads are spawned. We use them to keep track of each
-    // thread's contribution that we will later add in to the final state cache.
-    static thread_local Vector_<SpatialVec> m_rigidBodyForcesLocalStatic;
-    static thread_local Vector_<Vec3> m_particleForcesLocalStatic;
-    static thread_local Vector m_mobilityForcesLocalStatic;
-
-    static thread_local Vector_<SpatialVec> m_rigidBodyForceCacheLocalStatic;
-    static thread_local Vector_<Vec3> m_particleForceCacheLocalStatic;
-    static thread_local Vector m_mobilityForceCacheLocalStatic;
-};
+private:
+    struct Block {
+        BlockArrays forces, cache;
+    };
 
-//local declarations of static member variables
-/*static*/ thread_local Vector_<SpatialVec>
-                    CalcForcesParallelTask::m_rigidBodyForcesLocalStatic;
-/*static*/ thread_local Vector_<Vec3>
-                    CalcForcesParallelTask::m_particleForcesLocalStatic;
-/*static*/ thread_local Vector
-                    CalcForcesParallelTask::m_mobilityForcesLocalStatic;
-
-/*static*/ thread_local Vector_<SpatialVec>
-                    CalcForcesParallelTask::m_rigidBodyForceCacheLocalStatic;
-/*static*/ thread_local Vector_<Vec3>
-                    CalcForcesParallelTask::m_particleForceCacheLocalStatic;
-/*static*/ thread_local Vector
-                    CalcForcesParallelTask::m_mobilityForceCacheLocalStatic;
-
-/* Calculates each enabled force's contribution in the MultibodySystem. These
-calculations occur on the main thread, without use of local thread variables.*/
-
-//Implementation of CalcForcesTask for non-parallel forces
-class CalcForcesNonParallelTask : public CalcForcesTask {
-public:
-    //The different categories of force calculations that GeneralForceSubsystem
-    //chooses between
-    enum Mode {
-        All,
-        CachedAndNonCached,
-        NonCached
+    // Adds each block at an odd multiple of the stride into the block just
+    // before it at an even multiple.
+    class ReduceTask : public ParallelExecutor::Task {
+    public:
+        ReduceTask(Array_<Block>& blocks, int stride, bool withCache)
+        :   blocks(blocks), stride(stride), withCache(withCache) {}
+        int getNumPairs() const 
+        {   return (blocks.size() + stride - 1) / (2*stride); }
+        void execute(int pair) override {
+            Block& to = blocks[2*stride*pair];
+            const Block& from = blocks[2*stride*pair + stride];
+            to.forces.add(from.forces);
+            if (withCache)
+                to.cache.add(from.cache);
+        }
+    private:
+        Array_<Block>& blocks;
+        const int stride;
+        const bool withCache;
     };
-    
-    CalcForcesNonParallelTask* clone() const override {
-        return new CalcForcesNonParallelTask();
-    }
-    
-    // Each different force calculation Mode requires different parameters
-    //
-    // Note: Execute MUST be called directly after CalcForceTask is initialized
-    void initializeAll(
-            const Array_<Force*>& forces, const State& s,
-            const Array_<ForceIndex>& enabledNonParallelForces,
-            const Array_<ForceIndex>& enabledParallelForces,
-            Vector_<SpatialVec>& rigidBodyForces,
-            Vector_<Vec3>& particleForces,
-            Vector& mobilityForces) override
-    {
-        m_forces = &forces;
-        m_state = &s;
-        m_enabledNonParallelForces = &enabledNonParallelForces;
-        m_enabledParallelForces = &enabledParallelForces;
-        m_rigidBodyForces = &rigidBodyForces;
-        m_particleForces = &particleForces;
-        m_mobilityForces = &mobilityForces;
-        
-        m_mode = All;
-    }
-    void initializeCachedAndNonCached(
-            const Array_<Force*>& forces, const State& s,
-            const Array_<ForceIndex>& enabledNonParallelForces,
-            const Array_<ForceIndex>& enabledParallelForces,
-            Vector_<SpatialVec>& rigidBodyForces,
-            Vector_<Vec3>& particleForces,
-            Vector& mobilityForces,
-            Vector_<SpatialVec>& rigidBodyForceCache,
-            Vector_<Vec3>& particleForceCache,
-            Vector& mobilityForceCache) override
-    {
-        m_forces = &forces;
-        m_state = s;
-        m_enabledNonParallelForces = &enabledNonParallelForces;
-        m_enabledParallelForces = &enabledParallelForces;
-        m_rigidBodyForces = &rigidBodyForces;
-        m_particleForces = &particleForces;
-        m_mobilityForces = &mobilityForces;
-        m_rigidBodyForceCache = &rigidBodyForceCache;
-        m_particleForceCache = &particleForceCache;
-        m_mobilityForceCache = &mobilityForceCache;
-
-        m_mode = CachedAndNonCached;
-    }
-    void initializeNonCached(
-            const Array_<Force*>& forces, const State& s,
-            const Array_<ForceIndex>& enabledNonParallelForces,
-            const Array_<ForceIndex>& enabledParallelForces,
-            Vector_<SpatialVec>& rigidBodyForces,
-            Vector_<Vec3>& particleForces,
-            Vector& mobilityForces) override
-    {
-        m_forces = &forces;
-        m_state = s;
-        m_enabledNonParallelForces = &enabledNonParallelForces;
-        m_enabledParallelForces = &enabledParallelForces;
-        m_rigidBodyForces = &rigidBodyForces;
-        m_particleForces = &particleForces;
-        m_mobilityForces = &mobilityForces;
-
-        m_mode = NonCached;
-    }
-    
-    // Set all of the local force contribution arrays to 0. This is so that
-    // each local thread can sum up it's force contribution to be later
-    // added into the total force array.
-    void initialize() override {
-        m_rigidBodyForcesLocal.resize(m_rigidBodyForces->size());
-        m_rigidBodyForcesLocal.setToZero();
-        m_particleForcesLocal.resize(m_particleForces->size());
-        m_particleForcesLocal.setToZero();
-        m_mobilityForcesLocal.resize(m_mobilityForces->size());
-        m_mobilityForcesLocal.setToZero();
-
-        if (m_mode == CachedAndNonCached) {
-            m_rigidBodyForceCacheLocal.resize(m_rigidBodyForceCache->size());
-            m_rigidBodyForceCacheLocal.setToZero();
-            m_particleForceCacheLocal.resize(m_particleForceCache->size());
-            m_particleForceCacheLocal.setToZero();
-            m_mobilityForceCacheLocal.resize(m_mobilityForceCache->size());
-            m_mobilityForceCacheLocal.setToZero();
+
+    // The non-parallel forces come first, as one block; then the parallel 
+    // ones as evenly as possible in consecutive blocks.
+    void assignBlocks(const Array_<ForceIndex>& nonParallel,
+                      const Array_<ForceIndex>& parallel) {
+        m_blockForces.clear();
+        m_blockStart.clear();
+        m_blockStart.push_back(0);
+        if (!nonParallel.empty()) {
+            m_blockForces.insert(m_blockForces.end(), 
+                                 nonParallel.begin(), nonParallel.end());
+            m_blockStart.push_back(m_blockForces.size());
         }
-    }
-    
-    // Calculate all enabled forces (taking into account mode and parallelism)
-    void execute(int threadIndex) override {
-      switch (m_mode) {
-        case All:
-            if (threadIndex == NonParallelForcesIndex) {
-                // Process all non-parallel forces
-                for (const auto& forceIndex : *m_enabledNonParallelForces) {
-                    const auto force = m_forces.getRef()[forceIndex];
-                    force->getImpl().calcForce(*m_state, m_rigidBodyForcesLocal,
-                                  m_particleForcesLocal, m_mobilityForcesLocal);
-                }
-            }
-            break;
-
-        case CachedAndNonCached:
-            if (threadIndex == NonParallelForcesIndex) {
-                // Process all non-parallel forces.
-                for (const auto& forceIndex : *m_enabledNonParallelForces) {
-                    const auto& impl = m_forces.getRef()[forceIndex]->getImpl();
-                    if (impl.dependsOnlyOnPositions()) {
-                        impl.calcForce(*m_state, *m_rigidBodyForceCache,
-                                  *m_particleForceCache, *m_mobilityForceCache);
-                    } else { // ordinary velocity dependent force
-                        impl.calcForce(*m_state, *m_rigidBodyForces,
-                                          *m_particleForces, *m_mobilityForces);
-                    }
-                }
+        const int numParallel = parallel.size();
+        const int numParallelBlocks = std::min(numParallel, MaxParallelBlocks);
+        m_blockForces.insert(m_blockForces.end(), 
+                             parallel.begin(), parallel.end());
+        for (int i = 1; i <= numParallelBlocks; ++i)
+            m_blockStart.push_back(nonParallel.size() 
+                                   + (i*numParallel)/numParallelBlocks);
+    }
+
+    // Order the blocks by decreasing measured cost.
+    void scheduleBlocks() {
+        const int numBlocks = m_blockStart.size()-1;
+        m_blockCost.resize(numBlocks);
+        m_schedule.resize(numBlocks);
+        for (int b = 0; b < numBlocks; ++b) {
+            m_blockCost[b] = 0;
+            for (int i = m_blockStart[b]; i < m_blockStart[b+1]; ++i)
+                m_blockCost[b] += m_cost[m_blockForces[i]];
+            m_schedule[b] = b;
+        }
+        std::stable_sort(m_schedule.begin(), m_schedule.end(), 
+            [this](int a, int b) {return m_blockCost[a] > m_blockCost[b];});
+    }
+
+    void calcBlock(int b, ForceArrays out, ForceArrays* cache) {
+        for (int i = m_blockStart[b]; i < m_blockStart[b+1]; ++i) {
+            const ForceIndex fx = m_blockForces[i];
+            const ForceImpl& impl = m_forces.getRef()[fx]->getImpl();
+            ForceArrays* target = &out;
+            if (m_mode != All && impl.dependsOnlyOnPositions()) {
+                if (m_mode == NonCached)
+                    continue;
+                target = cache;
             }
-            break;
-
-        case NonCached:
-            if (threadIndex == NonParallelForcesIndex) {
-                // Process all non-parallel forces.
-                for (const auto& forceIndex : *m_enabledNonParallelForces) {
-                    const auto& impl = m_forces.getRef()[forceIndex]->getImpl();
-                    if (!impl.dependsOnlyOnPositions()) {
-                        impl.calcForce(*m_state,
-                                *m_rigidBodyForces, *m_particleForces,
-                                *m_mobilityForces);
-                    }
-                }
+            const double start = m_timing ? realTime() : 0;
+            impl.calcForce(*m_state, target->rigidBodyForces, 
+                           target->particleForces, target->mobilityForces);
+            if (m_timing) {
+                // Each force is in only one block, so only one thread 
+                // writes its cost.
+                const double cost = realTime() - start;
+                m_cost[fx] = m_cost[fx] == 0 ? cost 
+                    : (1-CostSmoothing)*m_cost[fx] + CostSmoothing*cost;
             }
-            break;
-        }
-    }
-    
-    //Once a thread has finished it's force calculations, we add in the thread's
-    //contribution into the cached force arrays in the State
-    void finish() override {
-        *m_rigidBodyForces += m_rigidBodyForcesLocal;
-        *m_particleForces += m_particleForcesLocal;
-        *m_mobilityForces += m_mobilityForcesLocal;
-
-        if (m_mode == CachedAndNonCached) {
-            *m_rigidBodyForceCache += m_rigidBodyForceCacheLocal;
-            *m_particleForceCache += m_particleForceCacheLocal;
-            *m_mobilityForceCache += m_mobilityForceCacheLocal;
         }
     }
-private:
-    Mode m_mode;
-
-    ReferencePtr<const Array_<Force*>> m_forces;
-    ReferencePtr<const State> m_state;
-
-    // Const. state-cache variables for the enabled parallel and non-parallel
-    // forces.
-    ReferencePtr<const Array_<ForceIndex>> m_enabledNonParallelForces;
-    ReferencePtr<const Array_<ForceIndex>> m_enabledParallelForces;
-
-    // ReferencePtrs that point to caches in the state; We eventually add our
-    // thread-local result to these vectors.
-    ReferencePtr<Vector_<SpatialVec>> m_rigidBodyForces;
-    ReferencePtr<Vector_<Vec3>> m_particleForces;
-    ReferencePtr<Vector> m_mobilityForces;
 
-    ReferencePtr<Vector_<SpatialVec>> m_rigidBodyForceCache;
-    ReferencePtr<Vector_<Vec3>> m_particleForceCache;
-    ReferencePtr<Vector> m_mobilityForceCache;
-    
-    // These variables belong to the main thread. We use them to keep track of
-    // each thread's contribution that we will later add in to the final state
-    // cache.
-    Vector_<SpatialVec> m_rigidBodyForcesLocal;
-    Vector_<Vec3> m_particleForcesLocal;
-    Vector m_mobilityForcesLocal;
-
-    Vector_<SpatialVec> m_rigidBodyForceCacheLocal;
-    Vector_<Vec3> m_particleForceCacheLocal;
-    Vector m_mobilityForceCacheLocal;
+    Mode m_mode;
+    ReferencePtr<const Array_<Force*>>  m_forces;
+    ReferencePtr<const State>           m_state;
+    ReferencePtr<const ForceArrays>     m_result; // for the sizes
+    bool                                m_timing;
+
+    // The forces of block b are m_blockForces[m_blockStart[b]] up to 
+    // m_blockForces[m_blockStart[b+1]].
+    Array_<ForceIndex>                  m_blockForces;
+    Array_<int>                         m_blockStart;
+    Array_<Block>                       m_blocks;
+    Array_<std::exception_ptr>          m_failures;
+
+    // Blocks in the order they are handed out, and the next one to go.
+    Array_<double>                      m_blockCost;
+    Array_<int>                         m_schedule;
+    std::atomic<int>                    m_nextBlock;
+
+    // Measured seconds per calcForce() call, smoothed, for each force.
+    Array_<double,ForceIndex>           m_cost;
+
+    std::atomic<bool>                   m_inUse;
 };
 } //namespace
 
@@ -652,31 +442,7 @@ public:
         enabledParallelForcesIndex = allocateCacheEntry(s, Stage::Instance,
                 new Value<Array_<ForceIndex> >(enabledParallelForces));
 
-        //Determine whether the subsystem has parallel forces - if so, use the
-        //parallel implementation of CalcForcesTask (even if those parallel
-        //forces are not currently enabled - they could be enabled in the
-        //future)
-        //
-        // *Consider the following example:*
-        // Parallel Forces: A B C
-        // NonParallel Forces: D E
-        //
-        // Enabled Forces at Time 0: D E
-        // Enabled Forces at Time 1: A B C D E
-        
-        bool hasParallelForces = false;
-        for(int x = 0; x < (int)forces.size(); ++x)
-        {
-            if (forces[x]->getImpl().shouldBeParallelIfPossible())
-            {
-                hasParallelForces = true;
-                break;
-            }
-        }
-        if (hasParallelForces)
-            calcForcesTask = new CalcForcesParallelTask();
-        else
-            calcForcesTask = new CalcForcesNonParallelTask();
+        calcForcesTask = new CalcForcesTask();
         
         // Note that we'll allocate these even if all the needs-caching
         // elements are presently disabled. That way they'll be around when
@@ -796,16 +562,17 @@ public:
         Vector&                mobilityForces  =
                                     mbs.updMobilityForces (s, Stage::Dynamics);
 
+        ForceArrays globalForces(rigidBodyForces, particleForces, 
+                                 mobilityForces);
+
         // Short circuit if we're not doing any caching here. Note that we're
         // checking whether the *index* is valid (i.e. does the cache entry
         // exist?), not the contents.
         if (!cachedForcesAreValidCacheIndex.isValid()) {
             // Call calcForce() on all Forces, in parallel.
-            calcForcesTask->initializeAll(forces, s,
+            calcForces(CalcForcesTask::All, s,
                     enabledNonParallelForces, enabledParallelForces,
-                    rigidBodyForces, particleForces, mobilityForces);
-            calcForcesExecutor->execute(calcForcesTask.updRef(),
-                          enabledParallelForces.size() + NumNonParallelThreads);
+                    globalForces, nullptr);
 
             // Allow forces to do their own realization, but wait until all
             // forces have executed calcForce(). TODO: not sure if that is
@@ -840,25 +607,21 @@ public:
             particleForceCache = Vec3(0);
             mobilityForceCache.resize(matter.getNumMobilities());
             mobilityForceCache = 0;
+            ForceArrays forceCache(rigidBodyForceCache, particleForceCache,
+                                   mobilityForceCache);
 
             // Run through all the forces, accumulating directly into the
             // force arrays or indirectly into the cache as appropriate.
-            calcForcesTask->initializeCachedAndNonCached(forces, s,
-                                enabledNonParallelForces, enabledParallelForces,
-                                rigidBodyForces, particleForces, mobilityForces,
-                                rigidBodyForceCache, particleForceCache,
-                                mobilityForceCache);
-            calcForcesExecutor->execute(calcForcesTask.updRef(),
-                          enabledParallelForces.size() + NumNonParallelThreads);
+            calcForces(CalcForcesTask::CachedAndNonCached, s,
+                    enabledNonParallelForces, enabledParallelForces,
+                    globalForces, &forceCache);
             cachedForcesAreValid = true;
         } else {
             // Cache already valid; just need to do the non-cached ones (the
             // ones for which dependsOnlyOnPositions is false).
-            calcForcesTask->initializeNonCached(forces, s,
-                               enabledNonParallelForces, enabledParallelForces,
-                               rigidBodyForces, particleForces, mobilityForces);
-            calcForcesExecutor->execute(calcForcesTask.updRef(),
-                          enabledParallelForces.size() + NumNonParallelThreads);
+            calcForces(CalcForcesTask::NonCached, s,
+                    enabledNonParallelForces, enabledParallelForces,
+                    globalForces, nullptr);
         }
 
         // Accumulate the values from the cache into the global arrays.
@@ -915,6 +678,30 @@ public:
     }
 
 private:
+    // Evaluate the enabled forces with the shared task and executor. If 
+    // another thread is busy with them, realizing a different State of the
+    // same System, use a private task on this thread instead.
+    void calcForces(CalcForcesTask::Mode mode, const State& s,
+                    const Array_<ForceIndex>& enabledNonParallelForces,
+                    const Array_<ForceIndex>& enabledParallelForces,
+                    ForceArrays& result, ForceArrays* cache) const {
+        if (!calcForcesTask->tryAcquire()) {
+            CalcForcesTask task;
+            task.calcForces(nullptr, mode, forces, s, enabledNonParallelForces,
+                            enabledParallelForces, result, cache);
+            return;
+        }
+        try {
+            calcForcesTask->calcForces(calcForcesExecutor.upd(), mode, forces,
+                s, enabledNonParallelForces, enabledParallelForces, 
+                result, cache);
+        } catch (...) {
+            calcForcesTask->release();
+            throw;
+        }
+        calcForcesTask->release();
+    }
+
     Array_<Force*>                  forces;
 
     // For parallel calculation of forces.
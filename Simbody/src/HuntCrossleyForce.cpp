@@ -29,6 +29,8 @@
 
 #include "HuntCrossleyForceImpl.h"
 
+#include <exception>
+
 namespace SimTK {
 
 SimTK_INSERT_DERIVED_HANDLE_DEFINITIONS(HuntCrossleyForce, HuntCrossleyForceImpl, Force);
@@ -52,13 +54,21 @@ void HuntCrossleyForce::setTransitionVelocity(Real v) {
     updImpl().setTransitionVelocity(v);
 }
 
+void HuntCrossleyForce::setNumThreads(int numThreads) {
+    updImpl().setNumThreads(numThreads);
+}
+
+int HuntCrossleyForce::getNumThreads() const {
+    return getImpl().getNumThreads();
+}
+
 ContactSetIndex HuntCrossleyForce::getContactSetIndex() const {
     return getImpl().getContactSetIndex();
 }
 
 
 HuntCrossleyForceImpl::HuntCrossleyForceImpl(GeneralContactSubsystem& subsystem, ContactSetIndex set) : 
-        subsystem(subsystem), set(set), transitionVelocity(Real(0.01)) {
+        subsystem(subsystem), set(set), transitionVelocity(Real(0.01)), numThreads(1) {
 }
 
 void HuntCrossleyForceImpl::setBodyParameters
@@ -98,73 +108,210 @@ void HuntCrossleyForceImpl::setTransitionVelocity(Real v) {
     subsystem.invalidateSubsystemTopologyCache();
 }
 
-void HuntCrossleyForceImpl::calcForce(const State& state, Vector_<SpatialVec>& bodyForces, 
-                                      Vector_<Vec3>& particleForces, Vector& mobilityForces) const {
-    const Array_<Contact>& contacts = subsystem.getContacts(state, set);
-    Real& pe = Value<Real>::updDowncast(state.updCacheEntry(subsystem.getMySubsystemIndex(), energyCacheIndex)).upd();
-    pe = 0.0;
-    for (int i = 0; i < (int) contacts.size(); i++) {
-        if (!PointContact::isInstance(contacts[i]))
-            continue;
-        const PointContact& contact = static_cast<const PointContact&>(contacts[i]);
-        const Parameters& param1 = getParameters(contact.getSurface1());
-        const Parameters& param2 = getParameters(contact.getSurface2());
+void HuntCrossleyForceImpl::setNumThreads(int n) {
+    SimTK_APIARGCHECK1_ALWAYS(n >= 0, "HuntCrossleyForce", "setNumThreads",
+        "Illegal number of threads %d.", n);
+    numThreads = n;
+    if (n == 1) executor.reset();
+    else executor.reset(n == 0 ? new ParallelExecutor() : new ParallelExecutor(n));
+}
+
+// The point contacts handled in one calcForce() call. Each contact's inputs
+// are gathered into these arrays, then the force law is evaluated in a loop
+// over contiguous arrays with no virtual calls or body lookups, and finally
+// the forces are applied to the bodies in contact order so that the sums are
+// the same however the evaluation was divided among threads. A batch is
+// reused from one call to the next so that its arrays are only reallocated
+// when the number of contacts grows.
+struct HuntCrossleyForceImpl::PointContactBatch {
+    void resize(int n) {
+        contact.resize(n); body1.resize(n); body2.resize(n); 
+        location.resize(n); normal.resize(n); velocity.resize(n);
+        station1.resize(n); station2.resize(n); depth.resize(n); 
+        radius.resize(n); k.resize(n); c.resize(n); us.resize(n);
+        ud.resize(n); uv.resize(n); force.resize(n); energy.resize(n);
+    }
+    int size() const {return contact.size();}
+
+    Array_<int>                 contact;    // index in the contact list
+    Array_<MobilizedBodyIndex>  body1, body2;
+    // Contact point and normal, velocity of body1 relative to body2 at the
+    // contact point, and the contact point relative to each body origin, 
+    // all in Ground.
+    Array_<Vec3>                location, normal, velocity, station1, station2;
+    // Combined material properties.
+    Array_<Real>                depth, radius, k, c, us, ud, uv;
+    // Results: the force on body2 (body1 gets its negative).
+    Array_<Vec3>                force;
+    Array_<Real>                energy;
+    // Exceptions thrown while evaluating each chunk.
+    Array_<std::exception_ptr>  failures;
+};
+
+// Contacts are evaluated in chunks of this many.
+static const int ContactsPerChunk = 128;
+
+class HuntCrossleyForceImpl::CalcForceTask : public ParallelExecutor::Task {
+public:
+    CalcForceTask(const HuntCrossleyForceImpl& impl, const State& state, 
+                  const Array_<Contact>& contacts, PointContactBatch& batch)
+    :   impl(impl), state(state), contacts(contacts), batch(batch),
+        failures(batch.failures) {
+        failures.assign((batch.size()+ContactsPerChunk-1)/ContactsPerChunk,
+                        std::exception_ptr());
+    }
+
+    int getNumChunks() const {return failures.size();}
+
+    // Exceptions can't be allowed to escape from a worker thread; we save
+    // them and rethrow on the calling thread.
+    void execute(int chunk) override {
+        try {
+            const int begin = chunk*ContactsPerChunk;
+            const int end = std::min(begin+ContactsPerChunk, batch.size());
+            for (int i = begin; i < end; ++i)
+                gather(i);
+            impl.calcContactForces(batch, begin, end);
+        } catch (...) {
+            failures[chunk] = std::current_exception();
+        }
+    }
+
+    // Rethrow the exception from the earliest failed chunk, if any.
+    void rethrowIfFailed() const {
+        for (unsigned i = 0; i < failures.size(); ++i)
+            if (failures[i]) std::rethrow_exception(failures[i]);
+    }
+
+private:
+    void gather(int i) {
+        const PointContact& contact = 
+            static_cast<const PointContact&>(contacts[batch.contact[i]]);
+        const Parameters& param1 = impl.getParameters(contact.getSurface1());
+        const Parameters& param2 = impl.getParameters(contact.getSurface2());
         
         // Adjust the contact location based on the relative stiffness of the two materials.
         
         const Real s1 = param2.stiffness/(param1.stiffness+param2.stiffness);
         const Real s2 = 1-s1;
         const Real depth = contact.getDepth();
-        const Vec3& normal = contact.getNormal();
+        const Vec3 normal = contact.getNormal();
         const Vec3 location = contact.getLocation()+(depth*(Real(0.5)-s1))*normal;
+        batch.location[i] = location;
+        batch.normal[i] = normal;
+        batch.depth[i] = depth;
+        batch.radius[i] = contact.getEffectiveRadiusOfCurvature();
+        batch.k[i] = param1.stiffness*s1;
+        batch.c[i] = param1.dissipation*s1 + param2.dissipation*s2;
+        batch.us[i] = combineFriction(param1.staticFriction, param2.staticFriction);
+        batch.ud[i] = combineFriction(param1.dynamicFriction, param2.dynamicFriction);
+        batch.uv[i] = combineFriction(param1.viscousFriction, param2.viscousFriction);
+        
+        // Calculate the relative velocity of the two bodies at the contact point.
         
+        const MobilizedBody& body1 = impl.subsystem.getBody(impl.set, contact.getSurface1());
+        const MobilizedBody& body2 = impl.subsystem.getBody(impl.set, contact.getSurface2());
+        const Vec3 station1 = location - body1.getBodyOriginLocation(state);
+        const Vec3 station2 = location - body2.getBodyOriginLocation(state);
+        const SpatialVec& V1 = body1.getBodyVelocity(state);
+        const SpatialVec& V2 = body2.getBodyVelocity(state);
+        batch.body1[i] = body1.getMobilizedBodyIndex();
+        batch.body2[i] = body2.getMobilizedBodyIndex();
+        batch.station1[i] = station1;
+        batch.station2[i] = station2;
+        batch.velocity[i] = (V1[1] + V1[0] % station1) - (V2[1] + V2[0] % station2);
+    }
+
+    static Real combineFriction(Real u1, Real u2) {
+        return u1 != 0 || u2 != 0 ? 2*u1*u2/(u1+u2) : Real(0);
+    }
+
+    const HuntCrossleyForceImpl&        impl;
+    const State&                        state;
+    const Array_<Contact>&              contacts;
+    PointContactBatch&                  batch;
+    Array_<std::exception_ptr>&         failures;
+};
+
+// Evaluate the force law for contacts [begin,end) of the batch.
+void HuntCrossleyForceImpl::calcContactForces(PointContactBatch& batch, int begin, int end) const {
+    const Real vt = getTransitionVelocity();
+    for (int i = begin; i < end; ++i) {
         // Calculate the Hertz force.
 
-        const Real k = param1.stiffness*s1;
-        const Real c = param1.dissipation*s1 + param2.dissipation*s2;
-        const Real radius = contact.getEffectiveRadiusOfCurvature();
-        const Real fH = Real(4./3.)*k*depth*std::sqrt(radius*k*depth);
-        pe += Real(2./5.)*fH*depth;
+        const Real k = batch.k[i], depth = batch.depth[i];
+        const Real fH = Real(4./3.)*k*depth*std::sqrt(batch.radius[i]*k*depth);
+        batch.energy[i] = Real(2./5.)*fH*depth;
         
-        // Calculate the relative velocity of the two bodies at the contact point.
-        
-        const MobilizedBody& body1 = subsystem.getBody(set, contact.getSurface1());
-        const MobilizedBody& body2 = subsystem.getBody(set, contact.getSurface2());
-        const Vec3 station1 = body1.findStationAtGroundPoint(state, location);
-        const Vec3 station2 = body2.findStationAtGroundPoint(state, location);
-        const Vec3 v1 = body1.findStationVelocityInGround(state, station1);
-        const Vec3 v2 = body2.findStationVelocityInGround(state, station2);
-        const Vec3 v = v1-v2;
+        const Vec3& v = batch.velocity[i];
+        const Vec3& normal = batch.normal[i];
         const Real vnormal = dot(v, normal);
         const Vec3 vtangent = v-vnormal*normal;
         
         // Calculate the Hunt-Crossley force.
         
-        const Real f = fH*(1+Real(1.5)*c*vnormal);
-        if (f <= 0) 
-            return;
-
+        const Real f = fH*(1+Real(1.5)*batch.c[i]*vnormal);
+        if (f <= 0) {
+            batch.force[i] = Vec3(0);
+            continue;
+        }
         Vec3 force = f*normal;
         
         // Calculate the friction force.
         
         const Real vslip = vtangent.norm();
         if (vslip != 0) {
-            const bool hasStatic = (param1.staticFriction != 0 || param2.staticFriction != 0);
-            const bool hasDynamic= (param1.dynamicFriction != 0 || param2.dynamicFriction != 0);
-            const bool hasViscous = (param1.viscousFriction != 0 || param2.viscousFriction != 0);
-            const Real us = hasStatic ? 2*param1.staticFriction*param2.staticFriction/(param1.staticFriction+param2.staticFriction) : 0;
-            const Real ud = hasDynamic ? 2*param1.dynamicFriction*param2.dynamicFriction/(param1.dynamicFriction+param2.dynamicFriction) : 0;
-            const Real uv = hasViscous ? 2*param1.viscousFriction*param2.viscousFriction/(param1.viscousFriction+param2.viscousFriction) : 0;
-            const Real vrel = vslip/getTransitionVelocity();
-            const Real ffriction = f*(std::min(vrel, Real(1))*(ud+2*(us-ud)/(1+vrel*vrel))+uv*vslip);
+            const Real us = batch.us[i], ud = batch.ud[i];
+            const Real vrel = vslip/vt;
+            const Real ffriction = f*(std::min(vrel, Real(1))*(ud+2*(us-ud)/(1+vrel*vrel))+batch.uv[i]*vslip);
             force += ffriction*vtangent/vslip;
         }
-        
-        // Apply the force to the bodies.
-        
-        body1.applyForceToBodyPoint(state, station1, -force, bodyForces);
-        body2.applyForceToBodyPoint(state, station2, force, bodyForces);
+        batch.force[i] = force;
+    }
+}
+
+void HuntCrossleyForceImpl::calcForce(const State& state, Vector_<SpatialVec>& bodyForces, 
+                                      Vector_<Vec3>& particleForces, Vector& mobilityForces) const {
+    const Array_<Contact>& contacts = subsystem.getContacts(state, set);
+    Real& pe = Value<Real>::updDowncast(state.updCacheEntry(subsystem.getMySubsystemIndex(), energyCacheIndex)).upd();
+    pe = 0.0;
+
+    int numPointContacts = 0;
+    for (int i = 0; i < (int) contacts.size(); i++)
+        if (PointContact::isInstance(contacts[i]))
+            ++numPointContacts;
+    if (numPointContacts == 0)
+        return;
+    // The same force may be evaluated for different States at once, for
+    // example by a multithreaded Differentiator, so the batch is per thread.
+    // It is shared by every HuntCrossleyForce on that thread, which is safe
+    // because calcForce() is never reentered.
+    static thread_local PointContactBatch threadBatch;
+    PointContactBatch& batch = threadBatch;
+    batch.resize(numPointContacts);
+    for (int i = 0, j = 0; i < (int) contacts.size(); i++)
+        if (PointContact::isInstance(contacts[i]))
+            batch.contact[j++] = i;
+
+    // Make sure all the parameters exist before any threads look for them.
+    getParameters(ContactSurfaceIndex(subsystem.getNumBodies(set)-1));
+
+    CalcForceTask task(*this, state, contacts, batch);
+    if (executor && task.getNumChunks() > 1)
+        executor->execute(task, task.getNumChunks());
+    else {
+        for (int chunk = 0; chunk < task.getNumChunks(); ++chunk)
+            task.execute(chunk);
+    }
+    task.rethrowIfFailed();
+    
+    // Apply the forces to the bodies.
+
+    for (int i = 0; i < batch.size(); ++i) {
+        pe += batch.energy[i];
+        const Vec3& force = batch.force[i];
+        bodyForces[batch.body1[i]] -= SpatialVec(batch.station1[i] % force, force);
+        bodyForces[batch.body2[i]] += SpatialVec(batch.station2[i] % force, force);
     }
 }
 
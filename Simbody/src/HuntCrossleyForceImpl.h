@@ -45,15 +45,23 @@ public:
     Parameters& updParameters(ContactSurfaceIndex bodyIndex);
     Real getTransitionVelocity() const;
     void setTransitionVelocity(Real v);
+    void setNumThreads(int n);
+    int getNumThreads() const {return numThreads;}
     ContactSetIndex getContactSetIndex() const {return set;}
     void calcForce(const State& state, Vector_<SpatialVec>& bodyForces, Vector_<Vec3>& particleForces, Vector& mobilityForces) const override;
     Real calcPotentialEnergy(const State& state) const override;
     void realizeTopology(State& state) const override;
 private:
+    struct PointContactBatch;
+    class CalcForceTask;
+    void calcContactForces(PointContactBatch& batch, int begin, int end) const;
+
     const GeneralContactSubsystem&          subsystem;
     const ContactSetIndex                   set;
     Array_<Parameters,ContactSurfaceIndex>  parameters;
     Real                                    transitionVelocity;
+    int                                     numThreads; // 1 means serial
+    mutable ClonePtr<ParallelExecutor>      executor;   // empty if serial
     mutable CacheEntryIndex                 energyCacheIndex;
 };
 
@@ -24,6 +24,9 @@
 #include "simbody/internal/common.h"
 #include "simbody/internal/ImpulseSolver.h"
 
+#include <algorithm>
+#include <utility>
+
 namespace SimTK {
 
 // These static methods assume the "NA" value is -1 and the others count up
@@ -76,4 +79,149 @@ dumpUniContacts(const String& msg,
     printf("------------------------------\n\n");
 }
 
-} // namespace SimTK
\ No newline at end of file
+//------------------------------------------------------------------------------
+//                       INITIALIZE UNKNOWN IMPULSE
+//------------------------------------------------------------------------------
+bool ImpulseSolver::
+initializeUnknownImpulse(const Array_<MultiplierIndex>& participating,
+                         int m, Vector& pi) const {
+    if (!(m_warmStart && pi.size() == m)) {
+        pi.resize(m);
+        pi.setToZero();
+        return false;
+    }
+    Array_<bool> isParticipating(m, false);
+    for (unsigned i=0; i < participating.size(); ++i)
+        isParticipating[participating[i]] = true;
+    for (int i=0; i < m; ++i)
+        if (!isParticipating[i]) pi[i] = 0;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+//                          SPARSE MATRIX SOLVES
+//------------------------------------------------------------------------------
+// Solvers that have no use for sparsity just get a dense copy.
+bool ImpulseSolver::
+solve(int                                 phase,
+      const Array_<MultiplierIndex>&      participating,
+      const SparseMatrix&                 A,
+      const Vector&                       D,
+      const Array_<MultiplierIndex>&      expanding,
+      Vector&                             piExpand,
+      Vector&                             verrStart,
+      Vector&                             verrApplied,
+      Vector&                             pi,
+      Array_<UncondRT>&                   unconditional,
+      Array_<UniContactRT>&               uniContact,
+      Array_<UniSpeedRT>&                 uniSpeed,
+      Array_<BoundedRT>&                  bounded,
+      Array_<ConstraintLtdFrictionRT>&    consLtdFriction,
+      Array_<StateLtdFrictionRT>&         stateLtdFriction) const
+{
+    Matrix denseA;
+    A.toDense(denseA);
+    return solve(phase, participating, denseA, D, expanding, piExpand,
+                 verrStart, verrApplied, pi, unconditional, uniContact,
+                 uniSpeed, bounded, consLtdFriction, stateLtdFriction);
+}
+
+bool ImpulseSolver::
+solveBilateral(const Array_<MultiplierIndex>&  participating,
+               const SparseMatrix&             A,
+               const Vector&                   D,
+               const Vector&                   rhs,
+               Vector&                         pi) const
+{
+    Matrix denseA;
+    A.toDense(denseA);
+    return solveBilateral(participating, denseA, D, rhs, pi);
+}
+
+//------------------------------------------------------------------------------
+//                              SPARSE MATRIX
+//------------------------------------------------------------------------------
+void ImpulseSolver::SparseMatrix::resize(int m) {
+    assert(m >= 0);
+    m_rowStart.clear(); m_rowStart.resize(m+1, 0);
+    m_cols.clear(); m_vals.clear(); m_pending.clear();
+}
+
+// Bucket the old and new entries by row, then sort each row by column and
+// combine duplicates. This is O(nnz log(row length)).
+void ImpulseSolver::SparseMatrix::finalize() {
+    if (m_pending.empty())
+        return;
+
+    const int m = nrow();
+    Array_<int> count(m+1, 0);
+    for (int i=0; i < m; ++i)
+        count[i+1] = m_rowStart[i+1] - m_rowStart[i];
+    for (unsigned k=0; k < m_pending.size(); ++k)
+        ++count[m_pending[k].i + 1];
+    for (int i=0; i < m; ++i)
+        count[i+1] += count[i];
+
+    Array_< std::pair<int,Real> > bucket(count[m]);
+    Array_<int> next(count.begin(), count.end()-1);
+    for (int i=0; i < m; ++i)
+        for (int k=m_rowStart[i]; k < m_rowStart[i+1]; ++k)
+            bucket[next[i]++] = std::make_pair(m_cols[k], m_vals[k]);
+    for (unsigned k=0; k < m_pending.size(); ++k) {
+        const Entry& e = m_pending[k];
+        bucket[next[e.i]++] = std::make_pair(e.j, e.value);
+    }
+    m_pending.clear();
+
+    m_cols.clear(); m_vals.clear();
+    m_rowStart[0] = 0;
+    for (int i=0; i < m; ++i) {
+        std::pair<int,Real>* first = bucket.begin() + count[i];
+        std::pair<int,Real>* last  = bucket.begin() + count[i+1];
+        // Sorting the values too makes duplicate sums order-independent.
+        std::sort(first, last);
+        while (first != last) {
+            const int j = first->first;
+            Real sum = 0;
+            for (; first != last && first->first == j; ++first)
+                sum += first->second;
+            m_cols.push_back(j); m_vals.push_back(sum);
+        }
+        m_rowStart[i+1] = (int)m_cols.size();
+    }
+}
+
+Real ImpulseSolver::SparseMatrix::getEntry(int i, int j) const {
+    assert(isFinalized());
+    assert(0 <= i && i < nrow() && 0 <= j && j < ncol());
+    const int* first = m_cols.cbegin() + m_rowStart[i];
+    const int* last  = m_cols.cbegin() + m_rowStart[i+1];
+    const int* p = std::lower_bound(first, last, j);
+    return p != last && *p == j ? m_vals[(int)(p - m_cols.cbegin())] 
+                                : Real(0);
+}
+
+void ImpulseSolver::SparseMatrix::multiply(const Vector& x, Vector& Ax) const {
+    assert(isFinalized());
+    const int m = nrow();
+    assert(x.size() == m);
+    Ax.resize(m);
+    for (int i=0; i < m; ++i) {
+        Real sum = 0;
+        for (int k=m_rowStart[i]; k < m_rowStart[i+1]; ++k)
+            sum += m_vals[k]*x[m_cols[k]];
+        Ax[i] = sum;
+    }
+}
+
+void ImpulseSolver::SparseMatrix::toDense(Matrix& A) const {
+    assert(isFinalized());
+    const int m = nrow();
+    A.resize(m, m);
+    A.setToZero();
+    for (int i=0; i < m; ++i)
+        for (int k=m_rowStart[i]; k < m_rowStart[i+1]; ++k)
+            A(i, m_cols[k]) = m_vals[k];
+}
+
+} // namespace SimTK
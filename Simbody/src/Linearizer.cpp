@@ -0,0 +1,344 @@
+/* -------------------------------------------------------------------------- *
+ *                               Simbody(tm)                                  *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "SimTKmath.h"
+#include "simbody/internal/MobilizedBody.h"
+#include "simbody/internal/MultibodySystem.h"
+#include "simbody/internal/SimbodyMatterSubsystem.h"
+#include "simbody/internal/Linearizer.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace SimTK;
+
+// Copies of the operating point, each changed by some x = (dtheta, du, dz).
+// The Differentiator may evaluate several perturbed points at once, so each
+// evaluation borrows a State of its own from a pool.
+class Linearizer::PerturbedStates {
+public:
+    PerturbedStates(const MultibodySystem& system, const State& s0)
+    :   system(system), s0(s0) {}
+
+    // Holds a State from the pool until it goes out of scope.
+    class Borrowed {
+    public:
+        Borrowed(PerturbedStates& pool, const Vector& x)
+        :   pool(pool), state(pool.acquire()) {
+            try {pool.setState(x, *state);}
+            catch (...) {pool.release(state); throw;}
+        }
+        ~Borrowed() {pool.release(state);}
+        State& operator*() const {return *state;}
+    private:
+        PerturbedStates& pool;
+        State* state;
+    };
+
+    const MultibodySystem& getSystem() const {return system;}
+    const State& getOperatingPoint() const {return s0;}
+private:
+    State* acquire() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (free.empty()) {
+            all.emplace_back(new State(s0));
+            return all.back().get();
+        }
+        State* s = free.back();
+        free.pop_back();
+        return s;
+    }
+
+    void release(State* s) {
+        std::lock_guard<std::mutex> lock(mutex);
+        free.push_back(s);
+    }
+
+    // The position change is dq = N*dtheta at the operating point.
+    void setState(const Vector& x, State& s) const {
+        const int nu = s0.getNU(), nz = s0.getNZ();
+        Vector dq;
+        system.getMatterSubsystem().multiplyByN(s0, false, x(0,nu), dq);
+        s.updQ() = s0.getQ() + dq;
+        s.updU() = s0.getU() + x(nu,nu);
+        s.updZ() = s0.getZ() + x(2*nu,nz);
+    }
+
+    const MultibodySystem&              system;
+    const State&                        s0;
+    std::mutex                          mutex;
+    std::vector<std::unique_ptr<State>> all;
+    Array_<State*>                      free;
+};
+
+// The state derivatives (dtheta/dt, udot, zdot) followed by the outputs, as
+// a function of the reduced state xr, where x = Z*xr.
+class Linearizer::DynamicsFunction : public Differentiator::JacobianFunction {
+public:
+    DynamicsFunction(PerturbedStates& states, const Matrix& basis,
+                     const Array_<Measure_<Real>>& outputs)
+    :   Differentiator::JacobianFunction(basis.nrow() + outputs.size(),
+                                         basis.ncol()),
+        states(states), basis(basis), outputs(outputs) {}
+
+    int f(const Vector& xr, Vector& fx) const override {
+        PerturbedStates::Borrowed s(states, basis*xr);
+        evaluate(*s, fx);
+        return 0;
+    }
+
+    // The operating point's N is used to map qdot back to dtheta/dt.
+    void evaluate(const State& s, Vector& fx) const {
+        const MultibodySystem& system = states.getSystem();
+        const int nu = s.getNU(), nz = s.getNZ();
+        system.realize(s, Stage::Acceleration);
+        fx.resize(2*nu + nz + outputs.size());
+        Vector dtheta;
+        system.getMatterSubsystem().multiplyByNInv(states.getOperatingPoint(),
+                                                   false, s.getQDot(), dtheta);
+        fx(0,nu) = dtheta;
+        fx(nu,nu) = s.getUDot();
+        fx(2*nu,nz) = s.getZDot();
+        for (int i=0; i < (int)outputs.size(); ++i)
+            fx[2*nu + nz + i] = outputs[i].getValue(s);
+    }
+private:
+    PerturbedStates&                states;
+    const Matrix&                   basis;
+    const Array_<Measure_<Real>>&   outputs;
+};
+
+// The velocity constraint errors as a function of dtheta alone. These depend
+// on the positions through the constraint Jacobian, for which we have no
+// analytic derivative.
+class Linearizer::ConstraintFunction
+:   public Differentiator::JacobianFunction {
+public:
+    explicit ConstraintFunction(PerturbedStates& states)
+    :   Differentiator::JacobianFunction
+           (states.getOperatingPoint().getNUErr(),
+            states.getOperatingPoint().getNU()),
+        states(states) {}
+
+    int f(const Vector& dtheta, Vector& uerr) const override {
+        const State& s0 = states.getOperatingPoint();
+        const int nu = s0.getNU();
+        Vector x(2*nu + s0.getNZ(), Real(0));
+        x(0,nu) = dtheta;
+        PerturbedStates::Borrowed s(states, x);
+        states.getSystem().realize(*s, Stage::Velocity);
+        uerr = (*s).getUErr();
+        return 0;
+    }
+private:
+    PerturbedStates& states;
+};
+
+Linearizer::Linearizer(const MultibodySystem& system)
+:   system(system), useMinimalCoordinates(true),
+    method(Differentiator::CentralDifference), numThreads(1) {}
+
+Linearizer& Linearizer::
+addInput(const MobilizedBody& mobod, MobilizerUIndex which) {
+    SimTK_APIARGCHECK_ALWAYS(
+        mobod.isInSubsystem() && mobod.getMatterSubsystem()
+            .isSameSubsystem(system.getMatterSubsystem()),
+        "Linearizer", "addInput",
+        "The mobilized body must belong to the system's matter subsystem.");
+    inputBodies.push_back(mobod.getMobilizedBodyIndex());
+    inputUs.push_back(which);
+    return *this;
+}
+
+Linearizer& Linearizer::addAllMobilityInputs() {
+    const SimbodyMatterSubsystem& matter = system.getMatterSubsystem();
+    const State& s = system.getDefaultState();
+    for (MobilizedBodyIndex mbx(1); mbx < matter.getNumBodies(); ++mbx) {
+        const MobilizedBody& mobod = matter.getMobilizedBody(mbx);
+        for (MobilizerUIndex i(0); i < mobod.getNumU(s); ++i)
+            addInput(mobod, i);
+    }
+    return *this;
+}
+
+Linearizer& Linearizer::addOutput(const Measure_<Real>& output) {
+    SimTK_APIARGCHECK_ALWAYS(
+        output.getDependsOnStage() < Stage::Acceleration,
+        "Linearizer", "addOutput",
+        "An output may not depend on accelerations.");
+    outputs.push_back(output);
+    return *this;
+}
+
+Linearizer& Linearizer::setMethod(Differentiator::Method m) {
+    SimTK_APIARGCHECK1_ALWAYS(Differentiator::isValidMethod(m),
+        "Linearizer", "setMethod", "Method %d is not valid.", (int)m);
+    method = m;
+    return *this;
+}
+
+Linearizer& Linearizer::setNumThreads(int n) {
+    SimTK_APIARGCHECK1_ALWAYS(n >= 0, "Linearizer", "setNumThreads",
+        "The number of threads must be nonnegative but was %d.", n);
+    numThreads = n;
+    return *this;
+}
+
+void Linearizer::linearize(const State& state, Matrix& A, Matrix& B,
+                           Matrix& C, Matrix& D) const {
+    SimTK_APIARGCHECK1_ALWAYS(state.getSystemStage() >= Stage::Model,
+        "Linearizer", "linearize",
+        "The state must be realized through Model stage but was only "
+        "realized through %s.", state.getSystemStage().getName().c_str());
+    State s0 = state;
+    system.realize(s0, Stage::Acceleration);
+    calcStateBasis(s0);
+
+    const int nx = 2*s0.getNU() + s0.getNZ();
+    const int n = stateBasis.ncol();
+    const int ny = outputs.size();
+    PerturbedStates states(system, s0);
+    DynamicsFunction function(states, stateBasis, outputs);
+    Vector fx0;
+    function.evaluate(s0, fx0);
+    Differentiator differentiator(function, method);
+    differentiator.setNumThreads(numThreads);
+    Matrix dfdx;
+    differentiator.calcJacobian(Vector(n, Real(0)), fx0, dfdx);
+
+    A = ~stateBasis * dfdx(0, 0, nx, n);
+    C = dfdx(nx, 0, ny, n);
+    calcInputResponse(s0, B);
+    D.resize(ny, getNumInputs());
+    D = 0;
+}
+
+// The changes that keep the position and velocity constraint errors zero to
+// first order are the null space of their Jacobian with respect to
+// (dtheta, du), which is
+//     [ P      0 ]
+//     [ Dv/Dq  G ]
+// where G holds the P and V rows of the full constraint matrix. The position
+// errors change by P*dtheta since dq = N*dtheta. That dq is also tangent to
+// the unit sphere for quaternions, so the quaternion normalization errors
+// don't change to first order and need no rows. Only the Dv/Dq block isn't
+// available analytically.
+void Linearizer::calcStateBasis(const State& s0) const {
+    const int nu = s0.getNU(), nz = s0.getNZ();
+    const int muerr = s0.getNUErr();
+    if (!useMinimalCoordinates || muerr == 0) {
+        stateBasis.resize(2*nu + nz, 2*nu + nz);
+        stateBasis = 1;
+        return;
+    }
+
+    const SimbodyMatterSubsystem& matter = system.getMatterSubsystem();
+    Matrix P, G;
+    matter.calcP(s0, P);
+    matter.calcG(s0, G);
+    const int mp = P.nrow();
+    Matrix J(mp + muerr, 2*nu, Real(0));
+    J(0, 0, mp, nu) = P;
+    J(mp, nu, muerr, nu) = G(0, 0, muerr, nu);
+
+    PerturbedStates states(system, s0);
+    ConstraintFunction function(states);
+    Differentiator differentiator(function, method);
+    differentiator.setNumThreads(numThreads);
+    Matrix dverrDq;
+    differentiator.calcJacobian(Vector(nu, Real(0)), s0.getUErr(), dverrDq);
+    J(mp, 0, muerr, nu) = dverrDq;
+
+    // Singular values that are tiny relative to the largest belong to
+    // redundant constraints; the differenced block is good to only about
+    // half the digits.
+    FactorSVD svd(J);
+    Vector sv;
+    Matrix U, VT;
+    svd.getSingularValuesAndVectors(sv, U, VT);
+    const Real tol = (sv.size() ? sv[0] : 0) * SqrtEps * 100;
+    int rank = 0;
+    while (rank < sv.size() && sv[rank] > tol)
+        ++rank;
+
+    const int nfree = 2*nu - rank;
+    stateBasis.resize(2*nu + nz, nfree + nz);
+    stateBasis = 0;
+    stateBasis(0, 0, 2*nu, nfree) = ~VT(rank, 0, nfree, 2*nu);
+    stateBasis(2*nu, nfree, nz, nz) = 1;
+}
+
+// The accelerations caused by generalized forces f are
+//     udot = M^-1 (f - ~G lambda),  with  G M^-1 ~G lambda = G M^-1 f
+// so that they satisfy the constraints.
+void Linearizer::calcInputResponse(const State& s0, Matrix& B) const {
+    const SimbodyMatterSubsystem& matter = system.getMatterSubsystem();
+    const int nu = s0.getNU();
+    const int nInputs = getNumInputs();
+
+    Matrix G;
+    matter.calcG(s0, G);
+    const int m = G.nrow();
+    Matrix MInvGt(nu, m);
+    for (int i=0; i < m; ++i) {
+        Vector col;
+        matter.multiplyByMInv(s0, ~G[i], col);
+        MInvGt(i) = col;
+    }
+    FactorQTZ constraintMatrix;
+    if (m > 0)
+        constraintMatrix.factor(G*MInvGt, SqrtEps);
+
+    Matrix Bfull(stateBasis.nrow(), nInputs, Real(0));
+    for (int k=0; k < nInputs; ++k) {
+        const MobilizedBody& mobod = matter.getMobilizedBody(inputBodies[k]);
+        SimTK_APIARGCHECK2_ALWAYS(inputUs[k] < mobod.getNumU(s0),
+            "Linearizer", "linearize",
+            "Input %d refers to a mobility of a mobilized body that has "
+            "only %d.", k, mobod.getNumU(s0));
+        Vector f(nu, Real(0));
+        f[mobod.getFirstUIndex(s0) + inputUs[k]] = 1;
+        Vector udot;
+        matter.multiplyByMInv(s0, f, udot);
+        if (m > 0) {
+            Vector lambda;
+            constraintMatrix.solve(G*udot, lambda);
+            udot -= MInvGt*lambda;
+        }
+        Bfull(k)(nu, nu) = udot;
+    }
+    B = ~stateBasis * Bfull;
+}
+
+void Linearizer::findNonzeros(const Matrix& m, Real tol, Array_<int>& rows,
+                              Array_<int>& cols, Array_<Real>& values) {
+    rows.clear(); cols.clear(); values.clear();
+    for (int j=0; j < m.ncol(); ++j)
+        for (int i=0; i < m.nrow(); ++i)
+            if (std::abs(m(i,j)) > tol) {
+                rows.push_back(i);
+                cols.push_back(j);
+                values.push_back(m(i,j));
+            }
+}
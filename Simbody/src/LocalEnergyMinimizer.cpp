@@ -59,9 +59,10 @@ public:
         Vector_<SpatialVec> dEdR = system.getRigidBodyForces(state, Stage::Dynamics);
         const SimbodyMatterSubsystem& matter = system.getMatterSubsystem();
         Vector dEdU;
-        // Convert spatial forces dEdR to generalized forces dEdU.
+        // Convert spatial forces dEdR to generalized forces dEdU. Like the
+        // spatial forces, the mobility forces are -dE/du.
         matter.multiplyBySystemJacobianTranspose(state, dEdR, dEdU);
-        dEdU -= system.getMobilityForces(state, Stage::Dynamics);
+        dEdU += system.getMobilityForces(state, Stage::Dynamics);
         matter.multiplyByNInv(state, true, -1*dEdU, gradient);
         return 0;
     }
@@ -71,32 +72,135 @@ public:
         constraints = state.getQErr();
         return 0;
     }
+    // The position errors come first, with Jacobian Pq = Dperr/Dq, followed
+    // by a normalization error |q|-1 for each quaternion in use. A quaternion
+    // always occupies the first four q's of its mobilizer.
+    int constraintJacobian(const Vector& parameters, bool new_parameters, Matrix& jac) const override {
+        state.updQ() = parameters;
+        system.realize(state, Stage::Position);
+        const SimbodyMatterSubsystem& matter = system.getMatterSubsystem();
+        const int mp = state.getNQErr() - matter.getNumQuaternionsInUse(state);
+        jac = 0;
+        if (mp > 0) {
+            matter.calcPq(state, pq);
+            jac(0, 0, mp, jac.ncol()) = pq;
+        }
+        for (MobilizedBodyIndex mbx(1); mbx < matter.getNumBodies(); ++mbx) {
+            if (!matter.isUsingQuaternion(state, mbx))
+                continue;
+            const int row = mp + matter.getQuaternionPoolIndex(state, mbx);
+            const int col = matter.getMobilizedBody(mbx).getFirstQIndex(state);
+            const Vec4 quat(&parameters[col]);
+            const Real norm = quat.norm();
+            for (int i=0; i < 4; ++i)
+                jac(row, col+i) = quat[i]/norm;
+        }
+        return 0;
+    }
     void optimize(Vector& q, Real tolerance) {
         Optimizer opt(*this);
-        opt.useNumericalJacobian(true);
         opt.setConvergenceTolerance(tolerance);
         opt.optimize(q);
     }
 private:
     const MultibodySystem& system;
     mutable State state;
+    mutable Matrix pq;
 };
 
 void LocalEnergyMinimizer::minimizeEnergy(const MultibodySystem& system, State& state, Real tolerance) {
-    const SimbodyMatterSubsystem& matter = system.getMatterSubsystem();
-    State tempState = state;
-    matter.setUseEulerAngles(tempState, true);
-    system.realizeModel(tempState);
-    if (!matter.getUseEulerAngles(state))
-        matter.convertToEulerAngles(state, tempState);
-    OptimizerFunction optimizer(system, tempState);
-    Vector q = tempState.getQ();
+    OptimizerFunction optimizer(system, state);
+    Vector q = state.getQ();
     optimizer.optimize(q, tolerance);
-    if (matter.getUseEulerAngles(state))
-        state.updQ() = q;
-    else {
-        tempState.updQ() = q;
-        matter.convertToQuaternions(tempState, state);
+    state.updQ() = q;
+    system.realize(state, Stage::Time);
+    system.getMatterSubsystem().normalizeQuaternions(state);
+    system.realize(state, Stage::Dynamics);
+}
+
+void LocalEnergyMinimizer::minimizeEnergy(const MultibodySystem& system, State& state, Real tolerance,
+                                          Method method, int maxIterations) {
+    SimTK_APIARGCHECK1_ALWAYS(maxIterations > 0, "LocalEnergyMinimizer", "minimizeEnergy",
+        "The maximum number of iterations must be positive but was %d.", maxIterations);
+    if (method == FastInertialRelaxation)
+        minimizeByFIRE(system, state, tolerance, maxIterations);
+    else
+        minimizeEnergy(system, state, tolerance);
+}
+
+/**
+ * Minimize with FIRE. The generalized speeds u play the role of velocities:
+ * with u=0 the constrained accelerations udot are M^-1 times the generalized
+ * forces less their part resisted by the constraints, so they give the
+ * steepest descent direction without forming any Jacobians. Steps are taken
+ * in u and converted to q with N, then projectQ() normalizes quaternions and
+ * restores the position constraints.
+ */
+void LocalEnergyMinimizer::minimizeByFIRE(const MultibodySystem& system, State& state, Real tolerance,
+                                          int maxIterations) {
+    // The parameters recommended by Bitzek et al.
+    const int  NMin       = 5;
+    const Real FInc       = Real(1.1);
+    const Real FDec       = Real(0.5);
+    const Real AlphaStart = Real(0.1);
+    const Real FAlpha     = Real(0.99);
+    // Limit on any one q or u step (radians or length units), and the 
+    // accuracy to which the position constraints are kept satisfied.
+    const Real MaxStep    = Real(0.1);
+    const Real ProjectionAccuracy = Real(1e-10);
+
+    const SimbodyMatterSubsystem& matter = system.getMatterSubsystem();
+    State s = state;
+    s.updU() = 0;
+    system.projectQ(s, ProjectionAccuracy);
+    system.realize(s, Stage::Acceleration);
+
+    const int nu = s.getNU();
+    Vector v(nu, Real(0)), force, du, dq;
+    Real dt = 0, dtMax = 0, alpha = AlphaStart;
+    int numPositive = 0;
+    bool converged = false;
+    for (int iter = 0; iter < maxIterations; ++iter) {
+        const Vector& a = s.getUDot();
+        matter.multiplyByM(s, a, force);
+        const Real maxForce = nu ? max(abs(force)) : Real(0);
+        if (maxForce <= tolerance) {
+            converged = true;
+            break;
+        }
+        if (dt == 0) {
+            // Choose the first step to move a tenth of the maximum step from
+            // rest; the step is allowed to grow to ten times that.
+            dt = std::sqrt(Real(0.1)*MaxStep/max(abs(a)));
+            dtMax = 10*dt;
+        }
+
+        const Real power = ~force*v;
+        if (power >= 0) {
+            v = (1-alpha)*v + (alpha*v.norm()/a.norm())*a;
+            if (++numPositive > NMin) {
+                dt = std::min(dt*FInc, dtMax);
+                alpha *= FAlpha;
+            }
+        } else { // going uphill; stop
+            v = 0;
+            dt *= FDec;
+            alpha = AlphaStart;
+            numPositive = 0;
+        }
+
+        v += dt*a;
+        du = dt*v;
+        const Real maxDu = max(abs(du));
+        if (maxDu > MaxStep)
+            du *= MaxStep/maxDu;
+        matter.multiplyByN(s, false, du, dq);
+        s.updQ() += dq;
+        system.projectQ(s, ProjectionAccuracy);
+        system.realize(s, Stage::Acceleration);
     }
+    SimTK_ERRCHK1_ALWAYS(converged, "LocalEnergyMinimizer::minimizeEnergy()",
+        "The minimization did not converge in %d iterations.", maxIterations);
+    state.updQ() = s.getQ();
     system.realize(state, Stage::Dynamics);
 }
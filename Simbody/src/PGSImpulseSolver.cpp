@@ -212,6 +212,424 @@ boundFriction(Real mu,
     for (unsigned i=0; i<IF.size(); ++i) pi[IF[i]] *= scale;
     return ImpulseSolver::Sliding;
 }
+
+//------------------------------------------------------------------------------
+//                           GRAPH-COLORED SWEEPS
+//------------------------------------------------------------------------------
+// These support PGSImpulseSolver's colored sweep option and its solves with a
+// sparse A. The unit of work is a "group" of multipliers that the serial sweep
+// updates together (Jacobi-style within the group) and then projects onto the
+// group's feasible set, such as an unconditional constraint, a contact normal
+// or a friction vector. Groups are swept in the same phases as the serial
+// solver; within a phase they are colored so that same-colored groups have no
+// rows coupled through A and can be updated concurrently without changing the
+// answer. Without coloring each phase is a single color swept serially in
+// multiplier order.
+
+enum GroupKind {Uncond, UniNormal, UniFriction, Bounded, StateLtd, ConsLtd};
+
+// Don't bother the thread pool with colors smaller than twice this.
+const int MinGroupsPerTask = 16;
+
+class ColoredSweeper {
+public:
+    // Use the participating rows of a dense A.
+    ColoredSweeper(const Array_<MultiplierIndex>&               participating,
+                   const Matrix&                                A,
+                   const Vector&                                D,
+                   const Vector&                                rhs,
+                   const Vector*                                piExpand,
+                   Vector&                                      pi,
+                   Array_<ImpulseSolver::UniContactRT>*         uniContact,
+                   Array_<ImpulseSolver::BoundedRT>*            bounded,
+                   Array_<ImpulseSolver::ConstraintLtdFrictionRT>* consLtd,
+                   Array_<ImpulseSolver::StateLtdFrictionRT>*   stateLtd)
+    :   m_rhs(rhs), m_piExpand(piExpand), m_pi(pi), m_uniContact(uniContact),
+        m_bounded(bounded), m_consLtd(consLtd), m_stateLtd(stateLtd), 
+        m_sor(1), m_colored(true)
+    {
+        gatherRows(participating, A, D);
+        m_rowSums.resize(A.nrow());
+        m_rowGroup.resize(A.nrow(), -1);
+    }
+
+    // Use a sparse A in place. Non-participating multipliers are zero in pi
+    // and are never updated, so their rows and columns do no harm.
+    ColoredSweeper(const ImpulseSolver::SparseMatrix&           A,
+                   const Vector&                                D,
+                   const Vector&                                rhs,
+                   const Vector*                                piExpand,
+                   Vector&                                      pi,
+                   Array_<ImpulseSolver::UniContactRT>*         uniContact,
+                   Array_<ImpulseSolver::BoundedRT>*            bounded,
+                   Array_<ImpulseSolver::ConstraintLtdFrictionRT>* consLtd,
+                   Array_<ImpulseSolver::StateLtdFrictionRT>*   stateLtd)
+    :   m_rhs(rhs), m_piExpand(piExpand), m_pi(pi), m_uniContact(uniContact),
+        m_bounded(bounded), m_consLtd(consLtd), m_stateLtd(stateLtd), 
+        m_sor(1), m_colored(true)
+    {
+        const int m = A.nrow();
+        m_rowStart = A.getRowStarts().cbegin();
+        m_cols     = A.getColumnIndices().cbegin();
+        m_vals     = A.getValues().cbegin();
+        m_diag.resize(m); m_dee.resize(m);
+        for (int r=0; r < m; ++r) {
+            m_dee[r]  = D.size() ? D[r] : Real(0);
+            m_diag[r] = A.getEntry(r,r) + m_dee[r];
+        }
+        m_rowSums.resize(m);
+        m_rowGroup.resize(m, -1);
+    }
+
+    // If not colored, each phase is swept serially in the order its groups
+    // were added. Must be set before adding groups.
+    void setColored(bool colored) {m_colored = colored;}
+
+    // Groups must be added phase by phase, in the order they are to be swept.
+    void beginPhase() {
+        m_phases.push_back(Phase());
+        m_phases.back().firstGroup = (int)m_groups.size();
+    }
+    template <class IndexArray>
+    void addGroup(GroupKind kind, int k, const IndexArray& rows) {
+        Group g; g.kind = kind; g.k = k;
+        g.firstRow = (int)m_groupRows.size(); g.nRows = (int)rows.size();
+        for (unsigned i=0; i < rows.size(); ++i) {
+            m_groupRows.push_back((int)rows[i]);
+            m_rowGroup[(int)rows[i]] = (int)m_groups.size();
+        }
+        m_groups.push_back(g);
+    }
+    void endPhase() {colorPhase(m_phases.back());}
+
+    int getNumColors() const {
+        int nColors = 0;
+        for (unsigned i=0; i < m_phases.size(); ++i)
+            nColors += (int)m_phases[i].colorStart.size()-1;
+        return nColors;
+    }
+
+    // Perform one full iteration and return the sums of squared errors for
+    // all rows and for just the enforced ones. Errors are summed in group
+    // order so the result doesn't depend on how the work was scheduled.
+    // The executor may be null, in which case everything runs serially.
+    void sweep(ParallelExecutor* executor, Real sor, 
+               Real& sum2all, Real& sum2enf);
+
+    void updateGroup(int gx);
+
+private:
+    struct Group {
+        GroupKind   kind;
+        int         k;                  // index into the kind's RT array
+        int         firstRow, nRows;    // in m_groupRows
+        Real        er2all, er2enf;     // results from the latest sweep
+    };
+    struct Phase {
+        int         firstGroup;
+        Array_<int> order;      // group indices sorted by color
+        Array_<int> colorStart; // nColors+1 offsets into order
+    };
+
+    void gatherRows(const Array_<MultiplierIndex>& participating,
+                    const Matrix& A, const Vector& D);
+    void colorPhase(Phase& phase);
+
+    Real rowSum(int r) const {
+        const Real* pip = &m_pi[0];
+        Real sum = m_dee[r]*pip[r];
+        for (int j=m_rowStart[r]; j < m_rowStart[r+1]; ++j)
+            sum += m_vals[j]*pip[m_cols[j]];
+        return sum;
+    }
+
+    const Vector&   m_rhs;
+    const Vector*   m_piExpand; // null for bilateral solves
+    Vector&         m_pi;
+    Array_<ImpulseSolver::UniContactRT>*            m_uniContact;
+    Array_<ImpulseSolver::BoundedRT>*               m_bounded;
+    Array_<ImpulseSolver::ConstraintLtdFrictionRT>* m_consLtd;
+    Array_<ImpulseSolver::StateLtdFrictionRT>*      m_stateLtd;
+    Real            m_sor;
+    bool            m_colored;
+
+    // Rows of A in compressed sparse row form. A dense A is in column order so
+    // we gather its participating rows once per solve into the m_gathered
+    // arrays (non-participating rows are empty); the sweeps then stream
+    // through contiguous memory and skip the structural zeroes between
+    // multipliers on unrelated bodies. A sparse A is used as is.
+    const int*      m_rowStart; // m+1
+    const int*      m_cols;
+    const Real*     m_vals;
+    Array_<int>     m_gatheredRowStart;
+    Array_<int>     m_gatheredCols;
+    Array_<Real>    m_gatheredVals;
+    Array_<Real>    m_diag;     // A(r,r)+D(r)
+    Array_<Real>    m_dee;      // D(r), or 0 if no D
+
+    Array_<Group>   m_groups;
+    Array_<int>     m_groupRows;
+    Array_<int>     m_rowGroup; // m; -1 if not in any group
+    Array_<Phase>   m_phases;
+    Array_<Real>    m_rowSums;  // m; each group uses only its own rows
+};
+
+void ColoredSweeper::gatherRows(const Array_<MultiplierIndex>& participating,
+                                const Matrix& A, const Vector& D) {
+    const int m = A.nrow();
+    const int p = (int)participating.size();
+    assert(A.hasContiguousData()); // packed
+    assert(A(0).hasContiguousData()); // in column order
+    const Real* Ap = &A(0,0);
+
+    // Count first, then fill, working down the columns.
+    Array_<int> count(m, 0);
+    for (int j=0; j < p; ++j) {
+        const Real* cp = Ap + participating[j]*m;
+        for (int i=0; i < p; ++i)
+            if (cp[participating[i]] != 0) ++count[participating[i]];
+    }
+    Array_<int>& rowStart = m_gatheredRowStart;
+    rowStart.resize(m+1);
+    rowStart[0] = 0;
+    for (int r=0; r < m; ++r)
+        rowStart[r+1] = rowStart[r] + count[r];
+    m_gatheredCols.resize(rowStart[m]); m_gatheredVals.resize(rowStart[m]);
+    for (int r=0; r < m; ++r)
+        count[r] = rowStart[r]; // now the next slot to fill
+    for (int j=0; j < p; ++j) {
+        const int c = participating[j];
+        const Real* cp = Ap + c*m;
+        for (int i=0; i < p; ++i) {
+            const int r = participating[i];
+            if (cp[r] == 0) continue;
+            m_gatheredCols[count[r]] = c; m_gatheredVals[count[r]] = cp[r];
+            ++count[r];
+        }
+    }
+    m_rowStart = rowStart.cbegin();
+    m_cols     = m_gatheredCols.cbegin();
+    m_vals     = m_gatheredVals.cbegin();
+
+    m_diag.resize(m); m_dee.resize(m);
+    for (int r=0; r < m; ++r) {
+        m_dee[r]  = D.size() ? D[r] : Real(0);
+        m_diag[r] = Ap[r + r*m] + m_dee[r];
+    }
+}
+
+// Greedy coloring of this phase's groups: two groups conflict if any row of
+// one has a nonzero in A at a column belonging to the other. Within a color
+// groups stay in their original (multiplier) order.
+void ColoredSweeper::colorPhase(Phase& phase) {
+    const int first = phase.firstGroup;
+    const int nGroups = (int)m_groups.size() - first;
+    if (!m_colored) {
+        phase.order.resize(nGroups);
+        for (int gi=0; gi < nGroups; ++gi)
+            phase.order[gi] = first+gi;
+        phase.colorStart.clear();
+        phase.colorStart.push_back(0); phase.colorStart.push_back(nGroups);
+        return;
+    }
+    Array_<int> color(nGroups, -1);
+    Array_<int> lastUser; // for each color, last group index that saw it used
+    for (int gi=0; gi < nGroups; ++gi) {
+        const Group& g = m_groups[first+gi];
+        for (int i=0; i < g.nRows; ++i) {
+            const int r = m_groupRows[g.firstRow+i];
+            for (int j=m_rowStart[r]; j < m_rowStart[r+1]; ++j) {
+                const int hi = m_rowGroup[m_cols[j]] - first;
+                if (0 <= hi && hi < nGroups && hi != gi && color[hi] >= 0)
+                    lastUser[color[hi]] = gi;
+            }
+        }
+        int c = 0;
+        while (c < (int)lastUser.size() && lastUser[c] == gi) ++c;
+        if (c == (int)lastUser.size()) lastUser.push_back(-1);
+        color[gi] = c;
+    }
+
+    const int nColors = (int)lastUser.size();
+    phase.colorStart.clear(); phase.colorStart.resize(nColors+1, 0);
+    for (int gi=0; gi < nGroups; ++gi) ++phase.colorStart[color[gi]+1];
+    for (int c=0; c < nColors; ++c)
+        phase.colorStart[c+1] += phase.colorStart[c];
+    Array_<int> next(phase.colorStart.begin(), phase.colorStart.end()-1);
+    phase.order.resize(nGroups);
+    for (int gi=0; gi < nGroups; ++gi)
+        phase.order[next[color[gi]]++] = first+gi;
+}
+
+void ColoredSweeper::updateGroup(int gx) {
+    Group& g = m_groups[gx];
+    const int* rows = &m_groupRows[g.firstRow];
+    for (int i=0; i < g.nRows; ++i)
+        m_rowSums[rows[i]] = rowSum(rows[i]);
+    Real er2 = 0;
+    for (int i=0; i < g.nRows; ++i) {
+        const int r = rows[i];
+        const Real er = m_rhs[r] - m_rowSums[r];
+        if (m_diag[r] > Real(0))
+            m_pi[r] += m_sor * er/m_diag[r];
+        er2 += square(er);
+    }
+
+    bool enforced = true;
+    switch (g.kind) {
+    case Uncond: 
+        break;
+    case UniNormal: {
+        ImpulseSolver::UniContactRT& rt = (*m_uniContact)[g.k];
+        rt.m_contactCond = boundUnilateral(rt.m_sign, m_pi[rt.m_Nk]);
+        enforced = (rt.m_contactCond == ImpulseSolver::UniActive);
+        break; }
+    case UniFriction: {
+        ImpulseSolver::UniContactRT& rt = (*m_uniContact)[g.k];
+        const MultiplierIndex Nk = rt.m_Nk;
+        const Real N = std::abs(m_pi[Nk] + (*m_piExpand)[Nk]);
+        rt.m_frictionCond = boundVector(rt.m_effMu*N, rt.m_Fk, m_pi);
+        enforced = (rt.m_frictionCond == ImpulseSolver::Rolling);
+        break; }
+    case Bounded: {
+        ImpulseSolver::BoundedRT& rt = (*m_bounded)[g.k];
+        rt.m_boundedCond = boundScalar(rt.m_lb, m_pi[rt.m_ix], rt.m_ub);
+        enforced = (rt.m_boundedCond == ImpulseSolver::Engaged);
+        break; }
+    case StateLtd: {
+        ImpulseSolver::StateLtdFrictionRT& rt = (*m_stateLtd)[g.k];
+        rt.m_frictionCond = boundVector(rt.m_effMu*rt.m_knownN, rt.m_Fk, m_pi);
+        enforced = (rt.m_frictionCond == ImpulseSolver::Rolling);
+        break; }
+    case ConsLtd: {
+        ImpulseSolver::ConstraintLtdFrictionRT& rt = (*m_consLtd)[g.k];
+        rt.m_frictionCond = boundFriction(rt.m_effMu, rt.m_Nk, rt.m_Fk, m_pi);
+        enforced = (rt.m_frictionCond == ImpulseSolver::Rolling);
+        break; }
+    }
+
+    g.er2all = er2;
+    g.er2enf = enforced ? er2 : Real(0);
+}
+
+// Updates a contiguous block of same-colored groups.
+class SweepColorTask : public ParallelExecutor::Task {
+public:
+    SweepColorTask(ColoredSweeper& sweeper, const int* groups, int nGroups,
+                   int groupsPerTask)
+    :   sweeper(sweeper), groups(groups), nGroups(nGroups), 
+        groupsPerTask(groupsPerTask) {}
+    void execute(int index) override {
+        const int end = std::min(nGroups, (index+1)*groupsPerTask);
+        for (int i=index*groupsPerTask; i < end; ++i)
+            sweeper.updateGroup(groups[i]);
+    }
+private:
+    ColoredSweeper& sweeper;
+    const int*      groups;
+    const int       nGroups, groupsPerTask;
+};
+
+void ColoredSweeper::sweep(ParallelExecutor* executor, Real sor,
+                           Real& sum2all, Real& sum2enf) {
+    m_sor = sor;
+    const int maxTasks = executor ? 4*std::max(1,executor->getMaxThreads()) 
+                                  : 0;
+    for (unsigned ph=0; ph < m_phases.size(); ++ph) {
+        const Phase& phase = m_phases[ph];
+        for (unsigned c=0; c+1 < phase.colorStart.size(); ++c) {
+            const int* groups = phase.order.cbegin() + phase.colorStart[c];
+            const int nGroups = phase.colorStart[c+1] - phase.colorStart[c];
+            if (!executor || nGroups < 2*MinGroupsPerTask) {
+                for (int i=0; i < nGroups; ++i)
+                    updateGroup(groups[i]);
+                continue;
+            }
+            const int nTasks = std::min(maxTasks, nGroups/MinGroupsPerTask);
+            const int perTask = (nGroups + nTasks - 1) / nTasks;
+            SweepColorTask task(*this, groups, nGroups, perTask);
+            executor->execute(task, (nGroups + perTask - 1) / perTask);
+        }
+    }
+
+    sum2all = sum2enf = 0;
+    for (unsigned gx=0; gx < m_groups.size(); ++gx) {
+        sum2all += m_groups[gx].er2all;
+        sum2enf += m_groups[gx].er2enf;
+    }
+}
+
+// Iterate sweeps using the same over-relaxation adjustment and convergence
+// test as the serial solver loops. Returns true if converged; the number of
+// iterations taken is returned in its.
+bool iterateColoredSweeps(ColoredSweeper& sweeper, ParallelExecutor* executor,
+                          int p, Real sor, Real tol, int maxIters, int& its) {
+    Real normRMSenf = Infinity;
+    for (its=1; its <= maxIters; ++its) {
+        const Real prevNormRMSenf = normRMSenf;
+        Real sum2all, sum2enf;
+        sweeper.sweep(executor, sor, sum2all, sum2enf);
+        normRMSenf = std::sqrt(sum2enf/p);
+        if (normRMSenf/prevNormRMSenf > 1 && sor > .1)
+            sor = std::max(.8*sor, .1);
+        if (normRMSenf < tol) {
+            SimTK_DEBUG2("COLORED PGS converged to %g in %d iters\n", 
+                         normRMSenf, its);
+            return true;
+        }
+    }
+    its = maxIters;
+    return false;
+}
+
+// Add the groups for a conditional solve, in the same phases and order as
+// the serial sweep in PGSImpulseSolver::solve().
+void addSolveGroups
+   (ColoredSweeper&                                      sweeper,
+    const Array_<ImpulseSolver::UncondRT>&               unconditional,
+    const Array_<ImpulseSolver::UniContactRT>&           uniContact,
+    const Array_<ImpulseSolver::BoundedRT>&              bounded,
+    const Array_<ImpulseSolver::ConstraintLtdFrictionRT>& consLtdFriction,
+    const Array_<ImpulseSolver::StateLtdFrictionRT>&     stateLtdFriction)
+{
+    sweeper.beginPhase();
+    for (unsigned k=0; k < unconditional.size(); ++k)
+        sweeper.addGroup(Uncond, k, unconditional[k].m_mults);
+    sweeper.endPhase();
+    sweeper.beginPhase();
+    for (unsigned k=0; k < uniContact.size(); ++k)
+        if (uniContact[k].m_type == ImpulseSolver::Participating)
+            sweeper.addGroup(UniNormal, k, Array_<int>(1,uniContact[k].m_Nk));
+    sweeper.endPhase();
+    sweeper.beginPhase();
+    for (unsigned k=0; k < uniContact.size(); ++k)
+        if (   uniContact[k].m_type != ImpulseSolver::Observing 
+            && uniContact[k].hasFriction())
+            sweeper.addGroup(UniFriction, k, uniContact[k].m_Fk);
+    sweeper.endPhase();
+    sweeper.beginPhase();
+    for (unsigned k=0; k < bounded.size(); ++k)
+        sweeper.addGroup(Bounded, k, Array_<int>(1,bounded[k].m_ix));
+    sweeper.endPhase();
+    sweeper.beginPhase();
+    for (unsigned k=0; k < stateLtdFriction.size(); ++k)
+        sweeper.addGroup(StateLtd, k, stateLtdFriction[k].m_Fk);
+    sweeper.endPhase();
+    sweeper.beginPhase();
+    for (unsigned k=0; k < consLtdFriction.size(); ++k)
+        sweeper.addGroup(ConsLtd, k, consLtdFriction[k].m_Fk);
+    sweeper.endPhase();
+}
+
+// Add the groups for a bilateral solve: each participating multiplier is its
+// own group.
+void addBilateralGroups(ColoredSweeper&                 sweeper,
+                        const Array_<MultiplierIndex>&  participating) {
+    sweeper.beginPhase();
+    for (unsigned k=0; k < participating.size(); ++k)
+        sweeper.addGroup(Uncond, k, Array_<int>(1,participating[k]));
+    sweeper.endPhase();
+}
 }
 
 namespace SimTK {
@@ -280,6 +698,16 @@ Implicitly, complementarity conditions must hold:
 */
 
 
+//------------------------------------------------------------------------------
+//                          ENABLE COLORED SWEEPS
+//------------------------------------------------------------------------------
+void PGSImpulseSolver::enableColoredSweeps(int numThreads) {
+    SimTK_APIARGCHECK1_ALWAYS(numThreads >= 0, "PGSImpulseSolver",
+        "enableColoredSweeps", "Illegal number of threads %d.", numThreads);
+    m_executor.reset(numThreads == 0 ? new ParallelExecutor()
+                                     : new ParallelExecutor(numThreads));
+}
+
 //------------------------------------------------------------------------------
 //                                 SOLVE
 //------------------------------------------------------------------------------
@@ -330,8 +758,8 @@ solve(int                                 phase,
     const int nx = (int)expanding.size();
     assert(p<=m); assert(nx<=m);
     
-    pi.resize(m);
-    pi.setToZero(); // Use this for piUnknown
+    // Use this for piUnknown.
+    initializeUnknownImpulse(participating, m, pi);
 
     // If there are applied forces, add them to the rhs.
     if (verrApplied.size()) 
@@ -388,6 +816,28 @@ solve(int                                 phase,
         return true;
     }
 
+    if (isUsingColoredSweeps()) {
+        ColoredSweeper sweeper(participating, A, D, verrStart, &piExpand, pi,
+                               &uniContact, &bounded, &consLtdFriction,
+                               &stateLtdFriction);
+        addSolveGroups(sweeper, unconditional, uniContact, bounded,
+                       consLtdFriction, stateLtdFriction);
+        m_nColorsLastSolve = sweeper.getNumColors();
+
+        int its;
+        const bool converged = iterateColoredSweeps(sweeper, 
+            m_executor.upd(), p, m_SOR, m_convergenceTol, m_maxIters, its);
+        m_nIters[phase] += its;
+        if (!converged) {
+            SimTK_DEBUG2("COLORED PGS %d CONVERGENCE FAILURE: %d iters\n",
+                         phase, its);
+            ++m_nFail[phase];
+        }
+        verrStart -= A*pi;
+        verrStart -= D.elementwiseMultiply(pi);
+        return converged;
+    }
+
     // Track total error for all included equations, and the error for just
     // those equations that are being enforced.
     bool converged = false;
@@ -553,8 +1003,8 @@ solveBilateral
     assert(rhs.size()==m);
     assert(p<=m);
  
-    pi.resize(m);
-    pi.setToZero(); // That takes care of all non-participators.
+    // That takes care of all non-participators.
+    initializeUnknownImpulse(participating, m, pi);
 
     if (p == 0) {
         SimTK_DEBUG("  no bilateral participators. Nothing to do.\n");
@@ -563,6 +1013,19 @@ solveBilateral
     }
 
 
+    if (isUsingColoredSweeps()) {
+        ColoredSweeper sweeper(participating, A, D, rhs, 0, pi, 0, 0, 0, 0);
+        addBilateralGroups(sweeper, participating);
+        m_nColorsLastSolve = sweeper.getNumColors();
+
+        int its;
+        const bool converged = iterateColoredSweeps(sweeper, 
+            m_executor.upd(), p, m_SOR, m_convergenceTol, m_maxIters, its);
+        m_nBilateralIters += its;
+        if (!converged) ++m_nBilateralFail;
+        return converged;
+    }
+
     // Track total error for all included equations, and the error for just
     // those equations that are being enforced.
     bool converged = false;
@@ -630,5 +1093,128 @@ solveBilateral
 
 }
 
+//------------------------------------------------------------------------------
+//                            SOLVE (SPARSE)
+//------------------------------------------------------------------------------
+// This is the same iteration as the colored sweeps, using A in place. Without
+// colored sweeps enabled each phase is swept serially in multiplier order.
+bool PGSImpulseSolver::
+solve(int                                 phase,
+      const Array_<MultiplierIndex>&      participating,
+      const SparseMatrix&                 A,
+      const Vector&                       D,
+      const Array_<MultiplierIndex>&      expanding,
+      Vector&                             piExpand,
+      Vector&                             verrStart,
+      Vector&                             verrApplied,
+      Vector&                             pi,
+      Array_<UncondRT>&                   unconditional,
+      Array_<UniContactRT>&               uniContact,
+      Array_<UniSpeedRT>&                 uniSpeed,
+      Array_<BoundedRT>&                  bounded,
+      Array_<ConstraintLtdFrictionRT>&    consLtdFriction,
+      Array_<StateLtdFrictionRT>&         stateLtdFriction
+      ) const 
+{
+    SimTK_DEBUG("\n-----------------\n");
+    SimTK_DEBUG(  "START SPARSE PGS SOLVER:\n");
+    ++m_nSolves[phase];
+
+    const int m=A.nrow();
+    assert(A.isFinalized()); assert(D.size()==m);
+    assert(verrStart.size()==m); 
+    assert(verrApplied.size()==0 || verrApplied.size()==m);
+    assert(piExpand.size()==m); 
+
+    const int p = (int)participating.size();
+    assert(p<=m);
+    
+    // Use this for piUnknown.
+    initializeUnknownImpulse(participating, m, pi);
+
+    // If there are applied forces, add them to the rhs.
+    if (verrApplied.size()) 
+        verrStart += verrApplied;
+
+    // Move expansion impulse to RHS. We will always apply the full expansion
+    // impulse in one interval in this solver.
+    Vector Api;
+    if (!expanding.empty()) {
+        A.multiply(piExpand, Api);
+        verrStart -= Api;
+        verrStart -= D.elementwiseMultiply(piExpand);
+    }
+
+    if (p == 0) {
+        SimTK_DEBUG1("PGS %d: nothing to do; converged in 0 iters.\n", phase);
+        // Returning pi=0; can still have piExpand!=0 so verr is updated.
+        return true;
+    }
+
+    ColoredSweeper sweeper(A, D, verrStart, &piExpand, pi, &uniContact, 
+                           &bounded, &consLtdFriction, &stateLtdFriction);
+    sweeper.setColored(isUsingColoredSweeps());
+    addSolveGroups(sweeper, unconditional, uniContact, bounded,
+                   consLtdFriction, stateLtdFriction);
+    m_nColorsLastSolve = sweeper.getNumColors();
+
+    int its;
+    const bool converged = iterateColoredSweeps(sweeper, m_executor.upd(), p,
+                                m_SOR, m_convergenceTol, m_maxIters, its);
+    m_nIters[phase] += its;
+    if (!converged) {
+        SimTK_DEBUG2("SPARSE PGS %d CONVERGENCE FAILURE: %d iters\n",
+                     phase, its);
+        ++m_nFail[phase];
+    }
+
+    A.multiply(pi, Api);
+    verrStart -= Api;
+    verrStart -= D.elementwiseMultiply(pi);
+    return converged;
+}
+
+
+//------------------------------------------------------------------------------
+//                        SOLVE BILATERAL (SPARSE)
+//------------------------------------------------------------------------------
+bool PGSImpulseSolver::
+solveBilateral
+   (const Array_<MultiplierIndex>&  participating, // p<=m of these 
+    const SparseMatrix&             A,     // m X m, symmetric
+    const Vector&                   D,     // m, diag>=0 added to A
+    const Vector&                   rhs,   // m, RHS
+    Vector&                         pi     // m, unknown result
+    ) const
+{
+    ++m_nBilateralSolves;
+
+    const int m=A.nrow(); 
+    const int p = (int)participating.size();
+
+    assert(A.isFinalized());
+    assert(D.size()==0 || D.size()==m);
+    assert(rhs.size()==m);
+    assert(p<=m);
+ 
+    // That takes care of all non-participators.
+    initializeUnknownImpulse(participating, m, pi);
+
+    if (p == 0)
+        return true;
+
+    ColoredSweeper sweeper(A, D, rhs, 0, pi, 0, 0, 0, 0);
+    sweeper.setColored(isUsingColoredSweeps());
+    addBilateralGroups(sweeper, participating);
+    m_nColorsLastSolve = sweeper.getNumColors();
+
+    int its;
+    const bool converged = iterateColoredSweeps(sweeper, m_executor.upd(), p,
+                                m_SOR, m_convergenceTol, m_maxIters, its);
+    m_nBilateralIters += its;
+    if (!converged) ++m_nBilateralFail;
+    return converged;
+}
+
 
-} // namespace SimTK
\ No newline at end of file
+} // namespace SimTK
@@ -170,7 +170,10 @@ solve(int                                 phase,
     const int nx = (int)expanding.size();
     assert(p<=m); assert(nx<=m);
  
-    pi.resize(m);
+    // If warm starting, save the guess to seed the first sliding interval.
+    Vector piWarm;
+    if (initializeUnknownImpulse(participating, m, pi))
+        piWarm = pi;
     pi.setToZero(); // Use this for piUnknown
 
     const bool hasAppliedImpulse = (verrApplied.size() > 0);
@@ -267,7 +270,9 @@ solve(int                                 phase,
         cout << "  verrExpand=" << m_verrExpand << endl;
         #endif
 
-        piGuess = 0; // Hold the best-guess impulse for this interval.
+        // Hold the best-guess impulse for this interval.
+        if (interval == 1 && piWarm.size()) piGuess = piWarm;
+        else piGuess = 0;
 
         // Determine step begin Rolling vs. Sliding and get slip directions.
         // Sets all non-Observer uni contacts to active or known.
@@ -1053,6 +1058,8 @@ initializeNewton(const Matrix&                  A,
         const MultiplierIndex mz = rt.m_Nk;
         const ActiveIndex az = m_mult2active[mz];
         assert(az.isValid());
+        if (m_warmStart && pi[mz] != 0)
+            continue; // already have a better guess
         // Don't use rt.m_sign here because it affects both pi & rhs; we just
         // want the signs to match.
         m_piActive[az] = .01*sign(m_rhsActive[az]); //-1,0,1
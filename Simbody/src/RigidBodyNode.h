@@ -483,6 +483,26 @@ virtual void realizeArticulatedBodyInertiasInward(
     const SBTreePositionCache&      pc,
     SBArticulatedBodyInertiaCache&  abc) const=0;
 
+// The same calculation split in two, so that the tip-to-base sweep can invert
+// the D matrices (dof X dof blocks of abc.storageForD) of all the mobilizers 
+// at one level together. The first part returns true if it stopped after 
+// calculating D and G=P*H, in which case the caller must fill in DI and then
+// call the second part to finish up. The default implementation does the 
+// whole calculation in the first part and returns false.
+virtual bool realizeArticulatedBodyInertiasInwardToD(
+    const SBInstanceCache&          ic,
+    const SBTreePositionCache&      pc,
+    SBArticulatedBodyInertiaCache&  abc) const
+{   realizeArticulatedBodyInertiasInward(ic,pc,abc); return false; }
+
+virtual void realizeArticulatedBodyInertiasInwardFromDI(
+    const SBInstanceCache&          ic,
+    const SBTreePositionCache&      pc,
+    SBArticulatedBodyInertiaCache&  abc) const
+{   SimTK_ASSERT_ALWAYS(false,
+        "RigidBodyNode::realizeArticulatedBodyInertiasInwardFromDI(): called "
+        "for a node whose first part did the whole calculation."); }
+
 virtual void realizeYOutward(
     const SBInstanceCache&                ic,
     const SBTreePositionCache&            pc,
@@ -628,6 +648,7 @@ bool isBaseNode()   const { return level==1; }
 // TODO: these should come from the model cache.
 UIndex getUIndex() const {return uIndex;}
 QIndex getQIndex() const {return qIndex;}
+USquaredIndex getUSqIndex() const {return uSqIndex;}
 
 
 // Access routines for plucking the right per-body data from the pool in the State.
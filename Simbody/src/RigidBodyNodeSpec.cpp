@@ -246,12 +246,41 @@ RigidBodyNodeSpec<dof, noR_FM, noX_MB, noR_PF>::calcReverseMobilizerHDot_FM(
 //   e.g. pin=143, ball=591 (197/dof), free=1746 (291/dof)
 // Note that per-child cost is paid just once for each non-base body in
 // the whole tree; that is, each body is touched just once.
+//
+// The work is split at DI so that the sweep can invert the D's of all the
+// same-size mobilizers of a level in one batch; see 
+// SimbodyMatterSubsystemRep::realizeArticulatedBodyInertias().
 template<int dof, bool noR_FM, bool noX_MB, bool noR_PF> void
 RigidBodyNodeSpec<dof, noR_FM, noX_MB, noR_PF>::
 realizeArticulatedBodyInertiasInward(
     const SBInstanceCache&          ic,
     const SBTreePositionCache&      pc,
     SBArticulatedBodyInertiaCache&  abc) const 
+{
+    if (!realizeArticulatedBodyInertiasInwardToD(ic,pc,abc))
+        return;
+
+    // D is symmetric positive definite unless the articulated inertia is
+    // degenerate. LDL' is much cheaper than the general Lapack inverse
+    // used above 3x3; fall back to that if it fails so that we get the
+    // same exception as before for a singular D.
+    const Mat<dof,dof>& D  = getD(abc);
+    Mat<dof,dof>&       DI = updDI(abc);
+    Mat<dof,dof> ldl = D;
+    if (SmallMatrixBatch::factorLDLT<dof>(1, &ldl(0,0)) == 0)
+        SmallMatrixBatch::invertLDLT<dof>(1, &ldl(0,0), &DI(0,0));
+    else
+        DI = D.invert();
+
+    realizeArticulatedBodyInertiasInwardFromDI(ic,pc,abc);
+}
+
+template<int dof, bool noR_FM, bool noX_MB, bool noR_PF> bool
+RigidBodyNodeSpec<dof, noR_FM, noX_MB, noR_PF>::
+realizeArticulatedBodyInertiasInwardToD(
+    const SBInstanceCache&          ic,
+    const SBTreePositionCache&      pc,
+    SBArticulatedBodyInertiaCache&  abc) const 
 {
     ArticulatedInertia& P = updP(abc);
 
@@ -288,7 +317,7 @@ realizeArticulatedBodyInertiasInward(
 
     if (isUDotKnown(ic)) {
         PPlus = P;  // prescribed
-        return;
+        return false;
     }
 
     // This is a non-prescribed mobilizer. Compute D, DI, G then P+.
@@ -296,13 +325,33 @@ realizeArticulatedBodyInertiasInward(
     const HType&  H  = getH(pc);
     HType&        G  = updG(abc);
     Mat<dof,dof>& D  = updD(abc);
-    Mat<dof,dof>& DI = updDI(abc);
 
-    const HType PH = P*H;   // 66*dof   flops
-    D  = ~H * PH;           // 11*dof^2 flops (symmetric result)
+    G = P*H;                // 66*dof   flops; this is PH until DI is known
+    D = ~H * G;             // 11*dof^2 flops (symmetric result)
+
+    // Above 3x3 our caller inverts D, possibly along with others.
+    if (dof > 3)
+        return true;
 
     // this will throw an exception if the matrix is ill conditioned
-    DI = D.invert();                        // ~dof^3 flops (symmetric)
+    updDI(abc) = D.invert();                // ~dof^3 flops (symmetric)
+    realizeArticulatedBodyInertiasInwardFromDI(ic,pc,abc);
+    return false;
+}
+
+template<int dof, bool noR_FM, bool noX_MB, bool noR_PF> void
+RigidBodyNodeSpec<dof, noR_FM, noX_MB, noR_PF>::
+realizeArticulatedBodyInertiasInwardFromDI(
+    const SBInstanceCache&          ic,
+    const SBTreePositionCache&      pc,
+    SBArticulatedBodyInertiaCache&  abc) const 
+{
+    const ArticulatedInertia& P     = getP(abc);
+    ArticulatedInertia&       PPlus = updPPlus(abc);
+    const Mat<dof,dof>&       DI    = getDI(abc);
+    HType&                    G     = updG(abc);
+
+    const HType PH = G;
     G  = PH * DI;                           // 12*dof^2-6*dof flops
 
     // Want P+ = P - G*~PH. We can do this in about 55*dof flops.
@@ -353,6 +353,18 @@ void realizeArticulatedBodyInertiasInward(
     const SBTreePositionCache&      pc,
     SBArticulatedBodyInertiaCache&  abc) const override;
 
+// These are the two halves of the above; the first stops before inverting D
+// only for dof > 3, where inverting a batch of D's together pays off.
+bool realizeArticulatedBodyInertiasInwardToD(
+    const SBInstanceCache&          ic,
+    const SBTreePositionCache&      pc,
+    SBArticulatedBodyInertiaCache&  abc) const override;
+
+void realizeArticulatedBodyInertiasInwardFromDI(
+    const SBInstanceCache&          ic,
+    const SBTreePositionCache&      pc,
+    SBArticulatedBodyInertiaCache&  abc) const override;
+
 // This dynamics-stage calculation is needed for handling constraints. It
 // must be called base-to-tip (outward);
 void realizeYOutward(
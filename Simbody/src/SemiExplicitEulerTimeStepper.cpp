@@ -28,6 +28,7 @@
 
 #include "SimbodyMatterSubsystemRep.h"
 
+#include <algorithm>
 #include <iostream>
 using std::cout; using std::endl;
 
@@ -64,11 +65,14 @@ SemiExplicitEulerTimeStepper(const MultibodySystem& mbs)
     m_maxInducedImpactsPerStep(DefMaxInducedImpactsPerStep),
     m_projectionMethod(DefPosProjMethod),
     m_solverType(DefImpulseSolverType), 
+    m_useSparseA(false),
+    m_useWarmStart(false),
     m_defaultCaptureVelocity(0),    // means: use 2 x constraintTol
     m_defaultMinCORVelocity(0),     // means: use capture velocity
     m_defaultTransitionVelocity(0), // means: use 2 x constraintTol
     m_minSignificantForce(DefMinSignificantForce),
-    m_solver(0)
+    m_solver(0),
+    m_constraintInfoIsValid(false)
 {}
 
 
@@ -89,9 +93,12 @@ stepTo(Real time) {
     mbs.realize(s, Stage::Position); 
     // Determine which constraints will be involved for this step.
     findProximalConstraints(s);
-    // Enable all proximal constraints, reassigning multipliers if needed.
-    enableProximalConstraints(s);
-    collectConstraintInfo(s);
+    // Enable all proximal constraints, reassigning multipliers if needed. If
+    // nothing changed, last step's constraint info is still good.
+    if (enableProximalConstraints(s) || !m_constraintInfoIsValid) {
+        collectConstraintInfo(s);
+        m_constraintInfoIsValid = true;
+    }
 
     mbs.realize(s, Stage::Velocity);
 
@@ -115,7 +122,7 @@ stepTo(Real time) {
     calcCoefficientsOfFriction(s, verr0);
 
     // Calculate the constraint compliance matrix A=GM\~G.
-    matter.calcProjectedMInv(s, m_GMInvGt); // m X m
+    calcImpulseMatrix(s); // m X m
 
     // TODO: this is for soft constraints. D >= 0.
     m_D.resize(m); m_D.setToZero();
@@ -314,6 +321,8 @@ stepTo(Real time) {
     // that velocity is what's in verr0.
     Vector verrStart = verr0;
     // Use lambda as a temp here; we are really calculating lambda*h.
+    if (m_useWarmStart)
+        calcWarmStartImpulse(h, lambda);
     doCompressionPhase(s, verrStart, m_verr, lambda);
     #ifndef NDEBUG
     cout << "   dynamics impulse=" << lambda << endl;
@@ -324,6 +333,8 @@ stepTo(Real time) {
     // Convert multipliers from impulses to forces. These are the multipliers
     // reported at end of step.
     lambda /= h;
+    if (m_useWarmStart)
+        saveWarmStartForces(lambda);
 
     // Calculate constraint forces ~G*lambda (body frcs Fc, mobility frcs fc).
     Vector_<SpatialVec> Fc; Vector fc; 
@@ -719,12 +730,19 @@ classifyUnilateralContactsForSimultaneousImpact
 void SemiExplicitEulerTimeStepper::initialize(const State& initState) {
     m_state = initState;
     m_mbs.realize(m_state, Stage::Acceleration);
+    m_constraintInfoIsValid = false;
+    m_prevContactForces.clear();
 
     if (!m_solver) {
         const Real transVel = getDefaultFrictionTransitionVelocityInUse();
-        m_solver = m_solverType==PLUS 
-            ? (ImpulseSolver*)new PLUSImpulseSolver(transVel)
-            : (ImpulseSolver*)new PGSImpulseSolver(transVel);
+        if (m_solverType == PLUS)
+            m_solver = new PLUSImpulseSolver(transVel);
+        else {
+            PGSImpulseSolver* pgs = new PGSImpulseSolver(transVel);
+            if (m_solverType == ColoredPGS)
+                pgs->enableColoredSweeps();
+            m_solver = pgs;
+        }
     }
 
     SimTK_ERRCHK_ALWAYS(m_solver!=0,
@@ -932,6 +950,44 @@ collectConstraintInfo(const State& s) { //TODO: redo
     // (all nonholonomic)
 }
 
+//------------------------------------------------------------------------------
+//                          WARM START IMPULSES
+//------------------------------------------------------------------------------
+// Contacts are matched to the previous step by their UnilateralContactIndex
+// since their multipliers may have moved. Saved forces are scaled by this
+// step's size to get impulses.
+void SemiExplicitEulerTimeStepper::
+calcWarmStartImpulse(Real h, Vector& impulse) const {
+    impulse.setToZero();
+    for (unsigned i=0; i < m_uniContact.size(); ++i) {
+        const ImpulseSolver::UniContactRT& rt = m_uniContact[i];
+        if (rt.m_ucx >= m_prevContactForces.size())
+            continue;
+        const Vec3& F = m_prevContactForces[rt.m_ucx];
+        impulse[rt.m_Nk] = h*F[2];
+        if (rt.hasFriction()) {
+            impulse[rt.m_Fk[0]] = h*F[0];
+            impulse[rt.m_Fk[1]] = h*F[1];
+        }
+    }
+}
+
+void SemiExplicitEulerTimeStepper::
+saveWarmStartForces(const Vector& lambda) {
+    const SimbodyMatterSubsystem& matter = m_mbs.getMatterSubsystem();
+    m_prevContactForces.resize(matter.getNumUnilateralContacts());
+    m_prevContactForces.fill(Vec3(0));
+    for (unsigned i=0; i < m_uniContact.size(); ++i) {
+        const ImpulseSolver::UniContactRT& rt = m_uniContact[i];
+        Vec3& F = m_prevContactForces[rt.m_ucx];
+        F[2] = lambda[rt.m_Nk];
+        if (rt.hasFriction()) {
+            F[0] = lambda[rt.m_Fk[0]];
+            F[1] = lambda[rt.m_Fk[1]];
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 //                        TAKE UNCONSTRAINED STEP
 //------------------------------------------------------------------------------
@@ -1156,15 +1212,18 @@ doCompressionPhase(const State& s, Vector& verrStart, Vector& verrApplied,
     cout << "  verrStart=" << verrStart << endl;
     cout << "  verrApplied=" << verrApplied << endl;
 #endif
-    // TODO: improve initial guess
     m_expansionImpulse.setToZero(); //TODO: shouldn't need to zero this
-    bool converged = m_solver->solve(0,
-        m_allParticipating,m_GMInvGt,m_D,
+    // If warm starting, compImpulse holds the initial guess.
+    const bool wasWarmStarting = m_solver->getUseWarmStart();
+    m_solver->setUseWarmStart(m_useWarmStart);
+    bool converged = solveImpulses(0,
+        m_allParticipating,
         Array_<MultiplierIndex>(), m_expansionImpulse, 
         verrStart, verrApplied, 
         compImpulse,
         m_unconditional,m_uniContact,m_uniSpeed,m_bounded,
         m_consLtdFriction, m_stateLtdFriction);
+    m_solver->setUseWarmStart(wasWarmStarting);
 #ifndef NDEBUG
     m_solver->dumpUniContacts("Post-dynamics", m_uniContact);
 #endif
@@ -1184,8 +1243,8 @@ doExpansionPhase(const State&   state,
                  Vector&        verrStart, 
                  Vector&        reactionImpulse) {
     // TODO: improve initial guess
-    bool converged = m_solver->solve(1,
-        m_participating,m_GMInvGt,m_D,
+    bool converged = solveImpulses(1,
+        m_participating,
         expanding,expansionImpulse, verrStart,m_emptyVector,
         reactionImpulse,
         m_unconditional,m_uniContact,m_uniSpeed,m_bounded,
@@ -1209,8 +1268,8 @@ doInducedImpactRound(const State& s,
 #ifndef NDEBUG
     printf("IMP t=%.15g verr=", s.getTime()); cout << verrStart << endl;
 #endif
-    bool converged = m_solver->solve(0,
-        m_participating,m_GMInvGt,m_D,
+    bool converged = solveImpulses(0,
+        m_participating,
         expanding,expansionImpulse, verrStart,m_emptyVector,
         impulse,
         m_unconditional,m_uniContact,m_uniSpeed,m_bounded,
@@ -1233,8 +1292,8 @@ doPositionCorrectionPhase(const State& state, Vector& pverr,
         SimTK_DEBUG1("UNILATERAL POSITION CORRECTION, %d participators\n",
                      (int)m_posParticipating.size());
         m_expansionImpulse.setToZero(); //TODO: shouldn't need to zero this
-        converged = m_solver->solve(2,
-            m_posParticipating,m_GMInvGt,m_D,
+        converged = solveImpulses(2,
+            m_posParticipating,
             Array_<MultiplierIndex>(), m_expansionImpulse,
             pverr, m_emptyVector,
             positionImpulse,
@@ -1255,8 +1314,8 @@ doPositionCorrectionPhase(const State& state, Vector& pverr,
         }
         SimTK_DEBUG1("BILATERAL POSITION CORRECTION, %d participators\n",
                     (int)m_participating.size());
-        converged = m_solver->solveBilateral(m_participating,m_GMInvGt,m_D,
-                                             pverr, positionImpulse);
+        converged = solveBilateralImpulses(m_participating,
+                                           pverr, positionImpulse);
     }
     return converged;
 }
@@ -1273,6 +1332,180 @@ anyPositionErrorsViolated(const State&, const Vector& perr) const {
     return anyViolated;
 }
 
+//------------------------------------------------------------------------------
+//                           CALC IMPULSE MATRIX
+//------------------------------------------------------------------------------
+void SemiExplicitEulerTimeStepper::calcImpulseMatrix(const State& s) {
+    if (m_useSparseA) {
+        m_GMInvGt.resize(0,0);
+        calcSparseProjectedMInv(s);
+    } else {
+        m_sparseGMInvGt.resize(0);
+        m_mbs.getMatterSubsystem().calcProjectedMInv(s, m_GMInvGt);
+    }
+}
+
+// Record the subtree (identified by its base body) that a constrained body
+// belongs to. Ground has no mobilities and belongs to no subtree.
+static void addSubtree(const MobilizedBody& mobod, Array_<int>& trees) {
+    if (!mobod.isGround())
+        trees.push_back(mobod.getBaseMobilizedBody().getMobilizedBodyIndex());
+}
+
+//------------------------------------------------------------------------------
+//                      CALC SPARSE PROJECTED MINV
+//------------------------------------------------------------------------------
+// M is block diagonal over the independent subtrees descending from each of
+// Ground's children, so A(i,j) can be nonzero only if the constraints owning
+// multipliers i and j involve bodies in a common subtree; we say that those
+// constraints are "coupled". We calculate A a few columns at a time, choosing
+// columns whose coupled rows don't overlap, so that a single pass of the
+// O(n) operators ~G, M\ and G with several unit multipliers at once yields
+// each chosen column in its own rows. For contacts on many independent bodies
+// this takes far fewer passes than the m needed for a dense A. Entries in
+// uncoupled rows are structurally zero and aren't stored.
+void SemiExplicitEulerTimeStepper::calcSparseProjectedMInv(const State& s) {
+    const SimbodyMatterSubsystem& matter = m_mbs.getMatterSubsystem();
+    const int m = s.getNMultipliers();
+    m_sparseGMInvGt.resize(m);
+    if (m == 0)
+        return;
+
+    // Find each enabled constraint's multipliers and subtrees, and the
+    // constraints involved with each subtree.
+    const int nCons = matter.getNumConstraints();
+    Array_< Array_<int> > consMults(nCons), consTrees(nCons);
+    Array_< Array_<ConstraintIndex> > treeCons(matter.getNumBodies());
+    for (ConstraintIndex cx(0); cx < nCons; ++cx) {
+        const Constraint& c = matter.getConstraint(cx);
+        if (c.isDisabled(s))
+            continue;
+        int mp, mv, ma; MultiplierIndex px0, vx0, ax0;
+        c.getNumConstraintEquationsInUse(s, mp, mv, ma);
+        c.getIndexOfMultipliersInUse(s, px0, vx0, ax0);
+        for (int i=0; i < mp; ++i) consMults[cx].push_back(px0+i);
+        for (int i=0; i < mv; ++i) consMults[cx].push_back(vx0+i);
+        for (int i=0; i < ma; ++i) consMults[cx].push_back(ax0+i);
+
+        Array_<int>& trees = consTrees[cx];
+        for (ConstrainedBodyIndex cbx(0); cbx < c.getNumConstrainedBodies();
+             ++cbx)
+            addSubtree(c.getMobilizedBodyFromConstrainedBody(cbx), trees);
+        for (ConstrainedMobilizerIndex cmx(0); 
+             cmx < c.getNumConstrainedMobilizers(); ++cmx)
+            addSubtree(c.getMobilizedBodyFromConstrainedMobilizer(cmx), trees);
+        std::sort(trees.begin(), trees.end());
+        trees.erase(std::unique(trees.begin(), trees.end()), trees.end());
+        for (unsigned t=0; t < trees.size(); ++t)
+            treeCons[trees[t]].push_back(cx);
+    }
+
+    // Collect the constraints coupled to each constraint (including itself)
+    // in compressed form. Constraints touching only Ground have none; their
+    // rows and columns of A are zero.
+    Array_<int> coupledStart(nCons+1), coupled, seen(nCons, -1);
+    coupledStart[0] = 0;
+    for (int cx=0; cx < nCons; ++cx) {
+        for (unsigned t=0; t < consTrees[cx].size(); ++t) {
+            const Array_<ConstraintIndex>& cons = treeCons[consTrees[cx][t]];
+            for (unsigned k=0; k < cons.size(); ++k)
+                if (seen[cons[k]] != cx) {
+                    seen[cons[k]] = cx;
+                    coupled.push_back(cons[k]);
+                }
+        }
+        coupledStart[cx+1] = coupled.size();
+    }
+
+    // Each pass takes the next unprocessed column of as many constraints as
+    // possible, skipping any constraint coupled to a row already claimed
+    // during this pass.
+    Array_<int> pending, nextMult(nCons, 0), claimed(nCons, -1), chosen;
+    for (int cx=0; cx < nCons; ++cx)
+        if (coupledStart[cx+1] > coupledStart[cx] && !consMults[cx].empty())
+            pending.push_back(cx);
+
+    Vector bias, lambda(m, Real(0)), f, MInvf, Ax;
+    matter.calcBiasForMultiplyByG(s, bias);
+    for (int pass=0; !pending.empty(); ++pass) {
+        chosen.clear();
+        for (unsigned k=0; k < pending.size(); ++k) {
+            const int cx = pending[k];
+            const int* first = coupled.cbegin() + coupledStart[cx];
+            const int* last  = coupled.cbegin() + coupledStart[cx+1];
+            const int* p = first;
+            while (p != last && claimed[*p] != pass) ++p;
+            if (p != last) 
+                continue;
+            for (p = first; p != last; ++p) claimed[*p] = pass;
+            chosen.push_back(cx);
+            lambda[consMults[cx][nextMult[cx]]] = 1;
+        }
+
+        matter.multiplyByGTranspose(s, lambda, f);
+        matter.multiplyByMInv(s, f, MInvf);
+        matter.multiplyByG(s, MInvf, bias, Ax);
+
+        for (unsigned k=0; k < chosen.size(); ++k) {
+            const int cx = chosen[k];
+            const int j = consMults[cx][nextMult[cx]++];
+            lambda[j] = 0;
+            for (int c=coupledStart[cx]; c < coupledStart[cx+1]; ++c) {
+                const Array_<int>& rows = consMults[coupled[c]];
+                for (unsigned r=0; r < rows.size(); ++r)
+                    if (Ax[rows[r]] != 0)
+                        m_sparseGMInvGt.addToEntry(rows[r], j, Ax[rows[r]]);
+            }
+        }
+
+        // Drop constraints whose columns are all done.
+        int nKept = 0;
+        for (unsigned k=0; k < pending.size(); ++k)
+            if (nextMult[pending[k]] < (int)consMults[pending[k]].size())
+                pending[nKept++] = pending[k];
+        pending.resize(nKept);
+    }
+
+    m_sparseGMInvGt.finalize();
+}
+
+//------------------------------------------------------------------------------
+//                              SOLVE IMPULSES
+//------------------------------------------------------------------------------
+bool SemiExplicitEulerTimeStepper::
+solveImpulses
+   (int                                             phase,
+    const Array_<MultiplierIndex>&                  participating,
+    const Array_<MultiplierIndex>&                  expanding,
+    Vector&                                         piExpand,
+    Vector&                                         verrStart,
+    Vector&                                         verrApplied,
+    Vector&                                         pi,
+    Array_<ImpulseSolver::UncondRT>&                unconditional,
+    Array_<ImpulseSolver::UniContactRT>&            uniContact,
+    Array_<ImpulseSolver::UniSpeedRT>&              uniSpeed,
+    Array_<ImpulseSolver::BoundedRT>&               bounded,
+    Array_<ImpulseSolver::ConstraintLtdFrictionRT>& consLtdFriction,
+    Array_<ImpulseSolver::StateLtdFrictionRT>&      stateLtdFriction)
+{
+    if (m_useSparseA)
+        return m_solver->solve(phase, participating, m_sparseGMInvGt, m_D,
+            expanding, piExpand, verrStart, verrApplied, pi, unconditional,
+            uniContact, uniSpeed, bounded, consLtdFriction, stateLtdFriction);
+    return m_solver->solve(phase, participating, m_GMInvGt, m_D,
+        expanding, piExpand, verrStart, verrApplied, pi, unconditional,
+        uniContact, uniSpeed, bounded, consLtdFriction, stateLtdFriction);
+}
+
+bool SemiExplicitEulerTimeStepper::
+solveBilateralImpulses(const Array_<MultiplierIndex>& participating,
+                       const Vector& rhs, Vector& pi) {
+    if (m_useSparseA)
+        return m_solver->solveBilateral(participating, m_sparseGMInvGt, m_D,
+                                        rhs, pi);
+    return m_solver->solveBilateral(participating, m_GMInvGt, m_D, rhs, pi);
+}
+
 //------------------------------------------------------------------------------
 //                            DEBUGGING METHODS
 //------------------------------------------------------------------------------
@@ -1296,8 +1529,8 @@ getPositionProjectionMethodName(PositionProjectionMethod ppm) {
 }
 const char* SemiExplicitEulerTimeStepper::
 getImpulseSolverTypeName(ImpulseSolverType ist) {
-    static const char* nm[]={"PLUS", "PGS"};
-    return PLUS<=ist&&ist<=PGS ? nm[ist] : "UNKNOWNImpulseSolverType";
+    static const char* nm[]={"PLUS", "PGS", "ColoredPGS"};
+    return PLUS<=ist&&ist<=ColoredPGS ? nm[ist] : "UNKNOWNImpulseSolverType";
 }
 
 } // namespace SimTK
@@ -107,6 +107,15 @@ void SimbodyMatterSubsystem::setShowDefaultGeometry(bool show) {
     updRep().setShowDefaultGeometry(show);
 }
 
+bool SimbodyMatterSubsystem::getUseIncrementalPositionKinematics() const {
+    return getRep().getUseIncrementalPositionKinematics();
+}
+
+void SimbodyMatterSubsystem::
+setUseIncrementalPositionKinematics(bool useIncremental) {
+    updRep().setUseIncrementalPositionKinematics(useIncremental);
+}
+
 
 ConstraintIndex SimbodyMatterSubsystem::
 adoptConstraint(Constraint& child) {return updRep().adoptConstraint(child);}
@@ -478,6 +487,10 @@ void SimbodyMatterSubsystem::calcM(const State& s, Matrix& M) const
 void SimbodyMatterSubsystem::calcMInv(const State& s, Matrix& MInv) const 
 {   getRep().calcMInv(s, MInv); }
 
+void SimbodyMatterSubsystem::
+calcSparseM(const State& s, SparseMassMatrix& M) const 
+{   getRep().calcSparseM(s, M); }
+
 
 // Note: the implementation methods that generate matrices do *not* require 
 // contiguous storage, so we can just forward to them with no preliminaries.
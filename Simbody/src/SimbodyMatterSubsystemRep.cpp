@@ -39,6 +39,76 @@
 #include <iostream>
 using std::cout; using std::endl;
 
+namespace {
+// The constraint factorizations are kept from one call to the next, one set
+// per thread, so that refactoring a matrix of the same size reuses their
+// storage and LAPACK workspace instead of reallocating them at every step.
+struct ConstraintFactorizations {
+    FactorCholesky  GMInvGt;     // used when G M^-1 ~G has full rank
+    FactorQTZ       GMInvGtQTZ;  // used when it doesn't
+    FactorQTZ       positionProjection;
+    FactorQTZ       velocityProjection;
+};
+
+ConstraintFactorizations& getConstraintFactorizations() {
+    static thread_local ConstraintFactorizations factorizations;
+    return factorizations;
+}
+
+// Solve (G M^-1 ~G) x = b. G M^-1 ~G is symmetric and positive semidefinite,
+// so the pivoted Cholesky factorization is much cheaper than QTZ and reveals
+// the rank just as well. If there are redundant constraints we fall back to
+// QTZ, whose minimum norm solution shares the load among them.
+void solveGMInvGt(const Matrix& GMInvGt, Real conditioningTol,
+                  const Vector& b, Vector& x) {
+    ConstraintFactorizations& fac = getConstraintFactorizations();
+    fac.GMInvGt.factor(GMInvGt, conditioningTol);
+    if (fac.GMInvGt.getRank() == GMInvGt.nrow()) {
+        fac.GMInvGt.solve(b, x);
+        return;
+    }
+    fac.GMInvGtQTZ.factor(GMInvGt, conditioningTol);
+    fac.GMInvGtQTZ.solve(b, x);
+}
+
+// Fill in DI = D^-1 for each of the given nodes, all of which have dof 
+// mobilities. The D's are copied into one batch so that their LDL' 
+// factorizations and inverses are computed together, vectorized across the 
+// nodes. Any D that isn't positive definite gets the general inverse 
+// instead, which throws if it is singular.
+template <int dof> void
+invertDBatch(const Array_<const RigidBodyNode*>& nodes,
+             SBArticulatedBodyInertiaCache& abc) {
+    const int n = (int)nodes.size();
+    if (n == 0) return;
+
+    static thread_local Array_<Real> ldl, inv;
+    ldl.resize(dof*dof*n); inv.resize(dof*dof*n);
+
+    for (int k=0; k < n; ++k) {
+        const Real* D = &abc.storageForD[nodes[k]->getUSqIndex()];
+        for (int e=0; e < dof*dof; ++e)
+            ldl[e*n + k] = D[e];
+    }
+
+    const int nBad = SmallMatrixBatch::factorLDLT<dof>(n, ldl.begin());
+    SmallMatrixBatch::invertLDLT<dof>(n, ldl.cbegin(), inv.begin());
+
+    for (int k=0; k < n; ++k) {
+        const int uSq = nodes[k]->getUSqIndex();
+        Real* DI = &abc.storageForDI[uSq];
+        if (nBad && !SmallMatrixBatch::isPositiveDefinite<dof>
+                                                    (n, ldl.cbegin(), k)) {
+            Mat<dof,dof>::updAs(DI) =
+                Mat<dof,dof>::getAs(&abc.storageForD[uSq]).invert();
+            continue;
+        }
+        for (int e=0; e < dof*dof; ++e)
+            DI[e] = inv[e*n + k];
+    }
+}
+}
+
 SimbodyMatterSubsystemRep::SimbodyMatterSubsystemRep
    (const SimbodyMatterSubsystemRep& src)
 :   SimTK::Subsystem::Guts("SimbodyMatterSubsystemRep", "X.X.X")
@@ -104,6 +174,7 @@ void SimbodyMatterSubsystemRep::clearTopologyCache() {
     nodeNum2NodeMap.clear();
 
     showDefaultGeometry = true;
+    useIncrementalPositionKinematics = false;
 }
 
 MobilizedBodyIndex SimbodyMatterSubsystemRep::adoptMobilizedBody
@@ -393,6 +464,13 @@ int SimbodyMatterSubsystemRep::realizeSubsystemTopologyImpl(State& s) const {
         true /*q*/, false /*u*/, false /*z*/, {} /*dv*/, {} /*ce*/,
         new Value<SBTreePositionCache>());
 
+    // If incremental position kinematics is enabled, this remembers the q's
+    // that the TreePositionCache was last fully computed from. Any change at
+    // Instance stage or earlier invalidates it.
+    tc.positionKinematicsSnapshotCacheIndex = 
+        allocateLazyCacheEntry(s, Stage::Instance,
+                               new Value<SBPositionKinematicsSnapshotCache>());
+
     // Here is where later computations during realizePosition() go; these
     // will assume that the TreePositionCache is available. So you can 
     // calculate these prior to Position stage's completion but not until
@@ -991,6 +1069,7 @@ realizeSubsystemInstanceImpl(const State& s) const {
     // reallocate) the rest of the cache entries.
     updTimeCache(s).allocate(topologyCache, mc, ic);
     updTreePositionCache(s).allocate(topologyCache, mc, ic);
+    updPositionKinematicsSnapshotCache(s).allocate(topologyCache, mc, ic);
     updConstrainedPositionCache(s).allocate(topologyCache, mc, ic);
     updCompositeBodyInertiaCache(s).allocate(topologyCache, mc, ic);
     updArticulatedBodyInertiaCache(s).allocate(topologyCache, mc, ic);
@@ -1123,6 +1202,15 @@ realizePositionKinematics(const State& state) const {
     const SBInstanceVars&   iv = stateDigest.getInstanceVars();
     SBTreePositionCache&    tpc = stateDigest.updTreePositionCache();
 
+    const CacheEntryIndex snapx = 
+        topologyCache.positionKinematicsSnapshotCacheIndex;
+    if (useIncrementalPositionKinematics && isCacheValueRealized(state, snapx)) 
+    {
+        realizePositionKinematicsIncrementally(stateDigest);
+        markCacheValueRealized(state, tpcx);
+        return;
+    }
+
     // realize tree positions (kinematics)
     // This includes all local cross-mobilizer kinematics (M in F, B in P)
     // and all global kinematics relative to Ground (G).
@@ -1141,6 +1229,63 @@ realizePositionKinematics(const State& state) const {
                             .calcConstrainedBodyTransformInAncestor(iv, tpc);
 
     markCacheValueRealized(state, tpcx);
+
+    // Remember the q's these results came from so that the next realization
+    // can be done incrementally.
+    if (useIncrementalPositionKinematics) {
+        updPositionKinematicsSnapshotCache(state).q = getQ(state);
+        markCacheValueRealized(state, snapx);
+    } else if (isCacheValueRealized(state, snapx))
+        markCacheValueNotRealized(state, snapx);
+}
+
+// The TreePositionCache holds valid results for the q's in the snapshot. A
+// body's position kinematics depends only on its own q's and those of its
+// ancestors, so we need to recalculate only the bodies whose q's have changed
+// since then, together with their outboard bodies. Recalculation of a node
+// also rewrites its quaternion normalization error (if any) in qErr; the
+// others' qErr slots are still correct. Then only the Constraints that have
+// a recalculated constrained body need to recalculate their ancestor-relative
+// body transforms.
+void SimbodyMatterSubsystemRep::
+realizePositionKinematicsIncrementally(const SBStateDigest& stateDigest) const {
+    const State&            state = stateDigest.getState();
+    const SBModelCache&     mc  = stateDigest.getModelCache();
+    const SBInstanceVars&   iv  = stateDigest.getInstanceVars();
+    SBTreePositionCache&    tpc = stateDigest.updTreePositionCache();
+    const Vector&           q   = stateDigest.getQ();
+
+    SBPositionKinematicsSnapshotCache& snap = 
+        updPositionKinematicsSnapshotCache(state);
+    assert(snap.q.size() == q.size());
+    Array_<bool,MobilizedBodyIndex>& isDirty = snap.bodyIsDirty;
+
+    isDirty[GroundIndex] = false;
+    for (int i=1 ; i<(int)rbNodeLevels.size() ; i++) 
+        for (int j=0 ; j<(int)rbNodeLevels[i].size() ; j++) {
+            const RigidBodyNode& node = *rbNodeLevels[i][j];
+            const MobilizedBodyIndex mbx = node.getNodeNum();
+            bool dirty = isDirty[node.getParent()->getNodeNum()];
+            if (!dirty) {
+                const int qx = node.getFirstQIndex(mc);
+                for (int k=0; k < node.getNumQInUse(mc); ++k)
+                    if (q[qx+k] != snap.q[qx+k]) {dirty = true; break;}
+            }
+            isDirty[mbx] = dirty;
+            if (dirty) node.realizePosition(stateDigest);
+        }
+
+    for (ConstraintIndex cx(0); cx < constraints.size(); ++cx) {
+        const ConstraintImpl& crep = getConstraint(cx).getImpl();
+        for (ConstrainedBodyIndex cbx(0); 
+             cbx < crep.getNumConstrainedBodies(); ++cbx)
+            if (isDirty[crep.getMobilizedBodyIndexOfConstrainedBody(cbx)]) {
+                crep.calcConstrainedBodyTransformInAncestor(iv, tpc);
+                break;
+            }
+    }
+
+    snap.q = q;
 }
 
 // Position kinematics is realized only if 
@@ -1161,6 +1306,9 @@ invalidatePositionKinematics(const State& state) const {
     state.invalidateAllCacheAtOrAbove(Stage::Position);
     const CacheEntryIndex tpcx = topologyCache.treePositionCacheIndex;
     markCacheValueNotRealized(state, tpcx);
+    // Don't trust the old results for incremental recalculation either.
+    markCacheValueNotRealized(state, 
+                              topologyCache.positionKinematicsSnapshotCacheIndex);
 }
 
 //==============================================================================
@@ -1237,10 +1385,27 @@ realizeArticulatedBodyInertias(const State& state) const {
     const SBTreePositionCache&      tpc = getTreePositionCache(state);
     SBArticulatedBodyInertiaCache&  abc = updArticulatedBodyInertiaCache(state);
 
-    // tip-to-base sweep
-    for (int i=rbNodeLevels.size()-1 ; i>=0 ; --i) 
-        for (int j=0 ; j<(int)rbNodeLevels[i].size() ; ++j)
-            rbNodeLevels[i][j]->realizeArticulatedBodyInertiasInward(ic,tpc,abc);
+    // tip-to-base sweep. Each node stops short of inverting its D if that is
+    // bigger than 3x3; those are inverted together for all the nodes of a
+    // level that have the same number of mobilities, then finished off.
+    static thread_local Array_<const RigidBodyNode*> needDI[3]; // dof 4,5,6
+    for (int i=rbNodeLevels.size()-1 ; i>=0 ; --i) {
+        for (auto& nodes : needDI)
+            nodes.clear();
+        for (int j=0 ; j<(int)rbNodeLevels[i].size() ; ++j) {
+            const RigidBodyNode* node = rbNodeLevels[i][j];
+            if (node->realizeArticulatedBodyInertiasInwardToD(ic,tpc,abc)) {
+                assert(4 <= node->getDOF() && node->getDOF() <= 6);
+                needDI[node->getDOF()-4].push_back(node);
+            }
+        }
+        invertDBatch<4>(needDI[0], abc);
+        invertDBatch<5>(needDI[1], abc);
+        invertDBatch<6>(needDI[2], abc);
+        for (const auto& nodes : needDI)
+            for (const RigidBodyNode* node : nodes)
+                node->realizeArticulatedBodyInertiasInwardFromDI(ic,tpc,abc);
+    }
 
     markCacheValueRealized(state, abx);
 }
@@ -2248,8 +2413,9 @@ calcConstraintForcesFromMultipliers
     bodyForcesInG.resize(getNumBodies()); bodyForcesInG.setToZero();
     mobilityForces.resize(getNU(s));      mobilityForces.setToZero();
 
-    // These Arrays are for one constraint at a time.
-    Array_<Real> lambdap, lambdav, lambdaa; // multipliers
+    // These Arrays are for one constraint at a time, and are usually short
+    // enough not to need the heap.
+    SmallArray_<Real,8> lambdap, lambdav, lambdaa; // multipliers
 
     // Loop over all enabled constraints, ask them to generate forces, and
     // accumulate the results in the global problem return vectors.
@@ -3575,8 +3741,7 @@ solveForConstraintImpulses(const State&     state,
     // MUST DUPLICATE SIMBODY'S METHOD HERE:
     const Real conditioningTol = GMInvGt.nrow() 
                                     * SqrtEps*std::sqrt(SqrtEps); // Eps^(3/4)
-    FactorQTZ qtz(GMInvGt, conditioningTol); 
-    qtz.solve(deltaV, impulse);
+    solveGMInvGt(GMInvGt, conditioningTol, deltaV, impulse);
 }
 
 
@@ -3938,7 +4103,7 @@ void SimbodyMatterSubsystemRep::enforcePositionConstraints
         Vector dfq_WLS(nfq), du(nu), dq(nq); // = Wq^+ dq_WLS
         Vector udfq_WLS(hasPrescribedMotion ? nq : 0); // unpacked if needed
         udfq_WLS.setToZero(); // must initialize unwritten elements
-        FactorQTZ Pqwr_qtz;
+        FactorQTZ& Pqwr_qtz = getConstraintFactorizations().positionProjection;
         Real prevNormAchievedTRMS = normAchievedTRMS; // watch for divergence
         const int MaxIterations  = 20;
         do {
@@ -4265,7 +4430,7 @@ int SimbodyMatterSubsystemRep::projectQ
     Vector dfq_WLS(nfq), du(nu), dq(nq); // = Wq^+ dq_WLS
     Vector udfq_WLS(hasPrescribedMotion ? nq : 0); // unpacked if needed
     udfq_WLS.setToZero(); // must initialize unwritten elements
-    FactorQTZ Pqwr_qtz;
+    FactorQTZ& Pqwr_qtz = getConstraintFactorizations().positionProjection;
     Real prevPerrNormAchieved = perrNormAchieved; // watch for divergence
     bool diverged = false;
     const int MaxIterations  = 20;
@@ -4569,7 +4734,7 @@ void SimbodyMatterSubsystemRep::enforceVelocityConstraints
         // PVwrt is now Wu^-1 (Pt Vt) Tpv
 
         // Calculate pseudoinverse (just once)
-        FactorQTZ PVwr_qtz;
+        FactorQTZ& PVwr_qtz = getConstraintFactorizations().velocityProjection;
         PVwr_qtz.factor<Real>(~PVwrt, conditioningTol);
 
         Real prevNormAchievedTRMS = normAchievedTRMS; // watch for divergence
@@ -4808,7 +4973,7 @@ int SimbodyMatterSubsystemRep::projectU
     // PVwrt is now Eu^-1 (Pt Vt) Tpv
 
     // Calculate pseudoinverse (just once)
-    FactorQTZ PVwr_qtz;
+    FactorQTZ& PVwr_qtz = getConstraintFactorizations().velocityProjection;
     PVwr_qtz.factor<Real>(~PVwrt, conditioningTol);
 
     //printf("projectU m=%d condTol=%g rank=%d rcond=%g\n",
@@ -5126,13 +5291,7 @@ void SimbodyMatterSubsystemRep::calcLoopForwardDynamicsOperator
     calcGMInvGt(s, GMInvGt);
     
     // specify 1/cond at which we declare rank deficiency
-    FactorQTZ qtz(GMInvGt, conditioningTol); 
-
-    //printf("fwdDynamics: m=%d condTol=%g rank=%d rcond=%g\n",
-    //    GMInvGt.nrow(), conditioningTol, qtz.getRank(),
-    //    qtz.getRCondEstimate());
-
-    qtz.solve(udotErr, multipliers);
+    solveGMInvGt(GMInvGt, conditioningTol, udotErr, multipliers);
 
     // We have the multipliers, now turn them into forces.
 
@@ -5459,24 +5618,79 @@ void SimbodyMatterSubsystemRep::calcM(const State& s, Matrix& M) const {
     M.resize(nu,nu);
     if (nu==0) return;
 
-    // This could be calculated much faster by doing it directly and calculating
-    // only half of it. As a placeholder, however, we're doing this with 
-    // repeated O(n) calls to multiplyByM() to get M one column at a time.
+    // The composite rigid body method gives us just the elements that can be
+    // nonzero; the rest of M is zero. This used to be done with nu calls to
+    // multiplyByM(), which costs several times more.
+    SparseMassMatrix sparseM;
+    calcSparseM(s, sparseM);
+    sparseM.toDense(M);
+}
 
-    // If M's columns are contiguous we can avoid copying.
-    const bool isContiguous = M(0).hasContiguousData();
-    Vector contig_col(isContiguous ? 0 : nu);
 
-    Vector v(nu); v.setToZero();
-    for (int i=0; i < nu; ++i) {
-        v[i] = 1;
-        if (isContiguous) {
-            multiplyByM(s, v, M(i));
-        } else {
-            multiplyByM(s, v, contig_col);
-            M(i) = contig_col;
+
+//==============================================================================
+//                               CALC SPARSE M
+//==============================================================================
+// Composite rigid body method. For each mobility k of body B, the spatial
+// force F = R_B*H_k (R_B the composite body inertia) is what it takes to
+// produce a unit u_k with everything outboard of B locked. Shifting F inward
+// and projecting it on each ancestor's hinge columns gives row k of the lower
+// triangle, in exactly the order SparseMassMatrix stores it: first B's own
+// mobilities from k down, then each ancestor's from its last down.
+void SimbodyMatterSubsystemRep::
+calcSparseM(const State& s, SparseMassMatrix& M) const {
+    const SBTreePositionCache& tpc = getTreePositionCache(s);
+    const int nu = getTotalDOF();
+    const int nb = getNumBodies();
+
+    // Each mobility's parent is the previous mobility of the same mobilizer,
+    // or the last one of the nearest ancestor that has any.
+    Array_<int> parent(nu);
+    for (MobilizedBodyIndex mbx(1); mbx < nb; ++mbx) {
+        const RigidBodyNode& node = getRigidBodyNode(mbx);
+        const int dof = node.getDOF();
+        if (dof == 0) continue;
+        const RigidBodyNode* anc = node.getParent();
+        while (!anc->isGroundNode() && anc->getDOF() == 0)
+            anc = anc->getParent();
+        const int u0 = node.getUIndex();
+        parent[u0] = anc->isGroundNode() ? -1 
+                                         : anc->getUIndex() + anc->getDOF()-1;
+        for (int i=1; i < dof; ++i)
+            parent[u0+i] = u0+i-1;
+    }
+
+    bool sameStructure = (M.nrow() == nu);
+    for (int k=0; sameStructure && k < nu; ++k)
+        sameStructure = (M.getParent(k) == parent[k]);
+    if (sameStructure) M.updValues(); // now holds M again
+    else M.setStructure(parent);
+
+    Array_<SpatialInertia,MobilizedBodyIndex> R;
+    calcCompositeBodyInertias(s, R);
+
+    const Array_<int>& rowStart = M.getRowStarts();
+    Array_<Real>& vals = M.updValues();
+    for (MobilizedBodyIndex mbx(1); mbx < nb; ++mbx) {
+        const RigidBodyNode& node = getRigidBodyNode(mbx);
+        const int dof = node.getDOF();
+        const int u0 = node.getUIndex();
+        for (int i=0; i < dof; ++i) {
+            Real* row = &vals[rowStart[u0+i]];
+            SpatialVec F = R[mbx] * node.getHCol(tpc, i);
+            int p = 0;
+            for (int j=i; j >= 0; --j)
+                row[p++] = ~node.getHCol(tpc, j) * F;
+            const RigidBodyNode* body = &node;
+            for (const RigidBodyNode* anc = node.getParent();
+                 !anc->isGroundNode(); body = anc, anc = anc->getParent())
+            {
+                F = body->getPhi(tpc) * F;
+                for (int j=anc->getDOF()-1; j >= 0; --j)
+                    row[p++] = ~anc->getHCol(tpc, j) * F;
+            }
+            assert(p == rowStart[u0+i+1] - rowStart[u0+i]);
         }
-        v[i] = 0;
     }
 }
 
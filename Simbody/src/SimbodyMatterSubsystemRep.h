@@ -30,6 +30,7 @@
 #include "simbody/internal/MultibodySystem.h"
 #include "simbody/internal/SimbodyMatterSubsystem.h"
 #include "simbody/internal/SimbodyMatterSubtree.h"
+#include "simbody/internal/SparseMassMatrix.h"
 #include "simbody/internal/MobilizedBody.h"
 #include "simbody/internal/MobilizedBody_Ground.h"
 
@@ -497,6 +498,11 @@ public:
     // at Stage::Position.
     void realizePositionKinematics(const State&) const;
 
+    // Used by realizePositionKinematics() when incremental position kinematics
+    // is enabled and the TreePositionCache is known to be valid for the q's in
+    // the position kinematics snapshot.
+    void realizePositionKinematicsIncrementally(const SBStateDigest&) const;
+
     // Call at Instance + PositionKinematics Stage or later. Depends on u;
     // automatically realized at Stage::Velocity.
     void realizeVelocityKinematics(const State&) const;
@@ -601,6 +607,11 @@ public:
     // filled in.
     void calcM(const State& s, Matrix& M) const;
 
+    // Calculate the mass matrix in compressed form using the composite rigid
+    // body method, in time proportional to the number of nonzeros. State must
+    // have been realized to Position stage. M's structure is set if needed.
+    void calcSparseM(const State& s, SparseMassMatrix& M) const;
+
     // Calculate the mass matrix inverse in O(n^2) time. State must have already
     // been realized to Position stage. MInv must be resizeable or already the
     // right size (nXn). The result is symmetric but the entire matrix is
@@ -1049,6 +1060,12 @@ public:
             (s.updCacheEntry(getMySubsystemIndex(),topologyCache.treePositionCacheIndex)).upd();
     }
 
+    SBPositionKinematicsSnapshotCache& 
+    updPositionKinematicsSnapshotCache(const State& s) const { //mutable
+        return Value<SBPositionKinematicsSnapshotCache>::updDowncast
+            (updCacheEntry(s,topologyCache.positionKinematicsSnapshotCacheIndex));
+    }
+
     const SBConstrainedPositionCache& getConstrainedPositionCache(const State& s) const {
         return Value<SBConstrainedPositionCache>::downcast
             (s.getCacheEntry(getMySubsystemIndex(),topologyCache.constrainedPositionCacheIndex)).get();
@@ -1210,6 +1227,11 @@ public:
     bool getShowDefaultGeometry() const;
     void setShowDefaultGeometry(bool show);
 
+    bool getUseIncrementalPositionKinematics() const
+    {   return useIncrementalPositionKinematics; }
+    void setUseIncrementalPositionKinematics(bool useIncremental)
+    {   useIncrementalPositionKinematics = useIncremental; }
+
     void calcTreeForwardDynamicsOperator(const State&,
         const Vector&                   mobilityForces,
         const Vector_<Vec3>&            particleForces,
@@ -1436,6 +1458,7 @@ private:
     
     // Specifies whether default decorative geometry should be shown.
     bool showDefaultGeometry;
+    bool useIncrementalPositionKinematics;
 };
 
 std::ostream& operator<<(std::ostream&, const SimbodyMatterSubsystemRep&);
@@ -84,6 +84,7 @@ class SBModelCache;
 class SBInstanceCache;
 class SBTimeCache;
 class SBTreePositionCache;
+class SBPositionKinematicsSnapshotCache;
 class SBConstrainedPositionCache;
 class SBCompositeBodyInertiaCache;
 class SBArticulatedBodyInertiaCache;
@@ -149,7 +150,9 @@ public:
 
     DiscreteVariableIndex modelingVarsIndex;
     CacheEntryIndex       modelingCacheIndex,instanceCacheIndex, timeCacheIndex, 
-                          treePositionCacheIndex, constrainedPositionCacheIndex,
+                          treePositionCacheIndex, 
+                          positionKinematicsSnapshotCacheIndex,
+                          constrainedPositionCacheIndex,
                           compositeBodyInertiaCacheIndex, 
                           articulatedBodyInertiaCacheIndex,
                           treeVelocityCacheIndex, constrainedVelocityCacheIndex,
@@ -744,6 +747,37 @@ public:
 
 
 
+// =============================================================================
+//                     POSITION KINEMATICS SNAPSHOT CACHE
+// =============================================================================
+// When incremental position kinematics is enabled, this records the q's for
+// which the TreePositionCache was last fully valid. The next time position
+// kinematics must be realized, only the mobilized bodies whose q's differ
+// from these, and their outboard bodies, are recomputed; everything else in
+// the TreePositionCache is still correct from last time.
+//
+// This is a lazy cache entry that depends on Stage::Instance, so any
+// Instance-stage change makes it invalid and forces a full realization.
+
+class SBPositionKinematicsSnapshotCache {
+public:
+    Vector                              q;
+    // Scratch space for marking bodies that need recalculation.
+    Array_<bool,MobilizedBodyIndex>     bodyIsDirty;
+
+public:
+    void allocate(const SBTopologyCache& tree,
+                  const SBModelCache&    model,
+                  const SBInstanceCache& instance)
+    {
+        q.clear(); // filled in after the first full realization
+        bodyIsDirty.resize(tree.nBodies);
+    }
+};
+//.................... POSITION KINEMATICS SNAPSHOT CACHE ......................
+
+
+
 // =============================================================================
 //                         CONSTRAINED POSITION CACHE 
 // =============================================================================
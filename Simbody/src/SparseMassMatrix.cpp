@@ -0,0 +1,183 @@
+/* -------------------------------------------------------------------------- *
+ *                               Simbody(tm)                                  *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "SimTKcommon.h"
+#include "simbody/internal/common.h"
+#include "simbody/internal/SparseMassMatrix.h"
+
+#include <cmath>
+#include <utility>
+
+namespace SimTK {
+
+// Row k of the lower triangle is stored as the run of values for columns
+// k, lambda(k), lambda(lambda(k)), ... so the row's length is the depth of k
+// and the tail of row k starting at column i is exactly row i's column list.
+// The factorizations below rely on that.
+
+void SparseMassMatrix::setStructure(const Array_<int>& parent) {
+    const int n = (int)parent.size();
+    m_parent = parent;
+    m_rowStart.resize(n+1);
+    Array_<int> depth(n);
+    m_rowStart[0] = 0;
+    for (int k=0; k < n; ++k) {
+        SimTK_APIARGCHECK3_ALWAYS(-1 <= parent[k] && parent[k] < k,
+            "SparseMassMatrix", "setStructure",
+            "Parent of mobility %d was %d but must be in [-1,%d).",
+            k, parent[k], k);
+        depth[k] = parent[k] < 0 ? 1 : depth[parent[k]] + 1;
+        m_rowStart[k+1] = m_rowStart[k] + depth[k];
+    }
+    m_vals.resize(m_rowStart[n]);
+    m_vals.fill(0);
+    m_contents = MassMatrix;
+}
+
+Real SparseMassMatrix::getEntry(int i, int j) const {
+    assert(0 <= i && i < nrow() && 0 <= j && j < ncol());
+    if (i < j) {
+        if (isFactored()) return 0;
+        std::swap(i,j);
+    }
+    // Walk up i's ancestors looking for j.
+    int col = i;
+    for (int p = m_rowStart[i]; col >= j; ++p, col = m_parent[col])
+        if (col == j) return m_vals[p];
+    return 0;
+}
+
+void SparseMassMatrix::multiply(const Vector& v, Vector& Mv) const {
+    SimTK_ERRCHK_ALWAYS(!isFactored(), "SparseMassMatrix::multiply()",
+        "The matrix has been factored and no longer holds M.");
+    const int n = nrow();
+    assert(v.size() == n);
+    Mv.resize(n);
+    Mv.setToZero();
+    for (int k=0; k < n; ++k) {
+        const Real* row = &m_vals[m_rowStart[k]];
+        Mv[k] += row[0]*v[k];
+        int p=1;
+        for (int j=m_parent[k]; j >= 0; j=m_parent[j], ++p) {
+            Mv[k] += row[p]*v[j];
+            Mv[j] += row[p]*v[k];
+        }
+    }
+}
+
+void SparseMassMatrix::toDense(Matrix& M) const {
+    const int n = nrow();
+    M.resize(n,n);
+    M.setToZero();
+    for (int k=0; k < n; ++k) {
+        int p = m_rowStart[k];
+        for (int j=k; j >= 0; j=m_parent[j], ++p) {
+            M(k,j) = m_vals[p];
+            if (!isFactored()) M(j,k) = m_vals[p];
+        }
+    }
+}
+
+// Featherstone's Table 6.3, working from the tips toward the root. Row k
+// becomes row k of L once the contributions of all its descendants have been
+// subtracted, which is why the loop runs backwards.
+void SparseMassMatrix::factorLTL() {
+    SimTK_ERRCHK_ALWAYS(!isFactored(), "SparseMassMatrix::factorLTL()",
+        "The matrix has already been factored.");
+    for (int k=nrow()-1; k >= 0; --k) {
+        Real* rowk = &m_vals[m_rowStart[k]];
+        const int len = m_rowStart[k+1] - m_rowStart[k];
+        SimTK_ERRCHK2_ALWAYS(rowk[0] > 0, "SparseMassMatrix::factorLTL()",
+            "The mass matrix is not positive definite; pivot %d was %g.",
+            k, rowk[0]);
+        rowk[0] = std::sqrt(rowk[0]);
+        const Real oodiag = 1/rowk[0];
+        for (int p=1; p < len; ++p)
+            rowk[p] *= oodiag;
+        int i = m_parent[k];
+        for (int p=1; p < len; ++p, i=m_parent[i]) {
+            Real* rowi = &m_vals[m_rowStart[i]];
+            const Real lki = rowk[p];
+            for (int q=p; q < len; ++q)
+                rowi[q-p] -= lki*rowk[q];
+        }
+    }
+    m_contents = LTL;
+}
+
+// Featherstone's Table 6.4; as above but leaves D on the diagonal.
+void SparseMassMatrix::factorLTDL() {
+    SimTK_ERRCHK_ALWAYS(!isFactored(), "SparseMassMatrix::factorLTDL()",
+        "The matrix has already been factored.");
+    for (int k=nrow()-1; k >= 0; --k) {
+        Real* rowk = &m_vals[m_rowStart[k]];
+        const int len = m_rowStart[k+1] - m_rowStart[k];
+        const Real d = rowk[0];
+        SimTK_ERRCHK2_ALWAYS(d > 0, "SparseMassMatrix::factorLTDL()",
+            "The mass matrix is not positive definite; pivot %d was %g.",
+            k, d);
+        int i = m_parent[k];
+        for (int p=1; p < len; ++p, i=m_parent[i]) {
+            Real* rowi = &m_vals[m_rowStart[i]];
+            const Real a = rowk[p]/d;
+            for (int q=p; q < len; ++q)
+                rowi[q-p] -= a*rowk[q];
+            rowk[p] = a;
+        }
+    }
+    m_contents = LTDL;
+}
+
+void SparseMassMatrix::solve(const Vector& b, Vector& x) const {
+    SimTK_ERRCHK_ALWAYS(isFactored(), "SparseMassMatrix::solve()",
+        "The matrix must be factored first with factorLTL() or factorLTDL().");
+    const int n = nrow();
+    assert(b.size() == n);
+    if (&x != &b) x = b;
+
+    // Solve ~L*y = b, from the tips in.
+    for (int k=n-1; k >= 0; --k) {
+        const Real* rowk = &m_vals[m_rowStart[k]];
+        if (m_contents == LTL) x[k] /= rowk[0];
+        const Real xk = x[k];
+        int p=1;
+        for (int j=m_parent[k]; j >= 0; j=m_parent[j], ++p)
+            x[j] -= rowk[p]*xk;
+    }
+
+    if (m_contents == LTDL)
+        for (int k=0; k < n; ++k)
+            x[k] /= m_vals[m_rowStart[k]];
+
+    // Solve L*x = y, from the root out.
+    for (int k=0; k < n; ++k) {
+        const Real* rowk = &m_vals[m_rowStart[k]];
+        Real xk = x[k];
+        int p=1;
+        for (int j=m_parent[k]; j >= 0; j=m_parent[j], ++p)
+            xk -= rowk[p]*x[j];
+        x[k] = m_contents == LTL ? xk/rowk[0] : xk;
+    }
+}
+
+} // namespace SimTK
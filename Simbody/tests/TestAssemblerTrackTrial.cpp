@@ -0,0 +1,207 @@
+/* -------------------------------------------------------------------------- *
+ *                               Simbody(tm)                                  *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Tests Assembler::trackTrial(), checking that tracking a marker trial with
+several threads gives the same answers as tracking it serially, and that
+both recover the motion that generated the marker data. */
+
+#include "SimTKsimbody.h"
+#include "SimTKcommon/Testing.h"
+
+using namespace SimTK;
+
+namespace {
+
+// Pre-recorded marker locations in Ground, one row per frame.
+class MarkerTrial : public Assembler::Trial {
+public:
+    MarkerTrial(const Markers& prototype, const Array_<Real>& times,
+                const Array_< Array_<Vec3> >& observations)
+    :   prototype(prototype), times(times), observations(observations) {}
+
+    int getNumFrames() const override {return times.size();}
+    Real getFrameTime(int frame) const override {return times[frame];}
+
+    void configureAssembler(Assembler& worker) const override {
+        Markers* markers = new Markers();
+        for (Markers::MarkerIx mx(0); mx < prototype.getNumMarkers(); ++mx)
+            markers->addMarker(prototype.getMarkerBody(mx),
+                               prototype.getMarkerStation(mx));
+        worker.adoptAssemblyGoal(markers);
+    }
+
+    void setFrame(Assembler& assembler, int frame) const override {
+        Markers& markers = dynamic_cast<Markers&>
+           (assembler.updAssemblyCondition(AssemblyConditionIndex(1)));
+        markers.moveAllObservations(observations[frame]);
+    }
+
+private:
+    const Markers&                  prototype;
+    const Array_<Real>&             times;
+    const Array_< Array_<Vec3> >&   observations;
+};
+
+}
+
+void testSerialAndParallelAgree() {
+    MultibodySystem system;
+    SimbodyMatterSubsystem matter(system);
+
+    const Body::Rigid body(MassProperties(1, Vec3(0), UnitInertia(1)));
+    MobilizedBody::Ball    torso(matter.Ground(), Vec3(0), body, Vec3(0));
+    MobilizedBody::Pin     upper(torso, Vec3(0,-1,0), body, Vec3(0));
+    MobilizedBody::Pin     lower(upper, Vec3(0,-1,0), body, Vec3(0));
+
+    State state = system.realizeTopology();
+
+    Markers* markers = new Markers();
+    const MobilizedBody* mobods[] = {&torso, &upper, &lower};
+    for (int b=0; b < 3; ++b) {
+        markers->addMarker(*mobods[b], Vec3(.1, -.5, .2));
+        markers->addMarker(*mobods[b], Vec3(-.2, -.3, 0));
+        markers->addMarker(*mobods[b], Vec3(0, -.7, -.1));
+    }
+
+    // Generate the marker trajectories from a known smooth motion.
+    const int NFrames = 40;
+    Array_<Real> times(NFrames);
+    Array_< Array_<Vec3> > observations(NFrames);
+    Array_<Vector> truth(NFrames);
+    for (int f=0; f < NFrames; ++f) {
+        const Real t = f*0.02;
+        times[f] = t;
+        torso.setQToFitRotation(state,
+            Rotation(BodyRotationSequence, .3*std::sin(2*t), XAxis,
+                                           .2*std::cos(3*t), YAxis,
+                                           .1*t, ZAxis));
+        upper.setOneQ(state, 0, .5*std::sin(4*t));
+        lower.setOneQ(state, 0, -.3 + .4*std::cos(5*t));
+        system.realize(state, Stage::Position);
+        truth[f] = state.getQ();
+        for (Markers::MarkerIx mx(0); mx < markers->getNumMarkers(); ++mx)
+            observations[f].push_back(
+                matter.getMobilizedBody(markers->getMarkerBody(mx))
+                    .findStationLocationInGround(state,
+                        markers->getMarkerStation(mx)));
+    }
+
+    Assembler serial(system);
+    serial.setAccuracy(1e-8);
+    serial.adoptAssemblyGoal(markers);
+    MarkerTrial trial(*markers, times, observations);
+
+    Assembler parallel(system);
+    parallel.setAccuracy(1e-8);
+    trial.configureAssembler(parallel);
+
+    const Vector initialQ = state.updQ() = truth[0] + Vector(state.getNQ(), .05);
+    Array_<Vector> serialQs, parallelQs;
+    serial.trackTrial(trial, state, serialQs, 1);
+    state.updQ() = initialQ;
+    parallel.trackTrial(trial, state, parallelQs, 3);
+
+    SimTK_TEST(serialQs.size() == NFrames);
+    SimTK_TEST(parallelQs.size() == NFrames);
+    for (int f=0; f < NFrames; ++f) {
+        // Quaternion sign is arbitrary so compare configurations instead.
+        State s1(state), s2(state);
+        s1.updQ() = serialQs[f]; s2.updQ() = parallelQs[f];
+        State s3(state); s3.updQ() = truth[f];
+        system.realize(s1, Stage::Position);
+        system.realize(s2, Stage::Position);
+        system.realize(s3, Stage::Position);
+        for (int b=0; b < 3; ++b) {
+            const Transform& X1 = mobods[b]->getBodyTransform(s1);
+            const Transform& X2 = mobods[b]->getBodyTransform(s2);
+            const Transform& X3 = mobods[b]->getBodyTransform(s3);
+            SimTK_TEST_EQ_TOL(X1.p(), X2.p(), 1e-5);
+            SimTK_TEST_EQ_TOL(X1.p(), X3.p(), 1e-5);
+            SimTK_TEST_EQ_TOL(X1.R(), X2.R(), 1e-5);
+        }
+    }
+
+    // The returned state is left at the last frame.
+    SimTK_TEST_EQ(state.getTime(), times[NFrames-1]);
+    SimTK_TEST_EQ(state.getQ(), parallelQs[NFrames-1]);
+}
+
+// A planar two-link arm observed only at its tip can reach each frame with
+// the elbow bent either way. Serial tracking keeps the elbow on the side it
+// started on, and so must each chunk of a parallel run, even though a
+// chunk's seed is solved from a configuration many frames away.
+void testChunksStayOnSerialBranch() {
+    MultibodySystem system;
+    SimbodyMatterSubsystem matter(system);
+
+    const Body::Rigid body(MassProperties(1, Vec3(0), UnitInertia(1)));
+    MobilizedBody::Pin upper(matter.Ground(), Vec3(0), body, Vec3(0,1,0));
+    MobilizedBody::Pin lower(upper, Vec3(0), body, Vec3(0,1,0));
+
+    State state = system.realizeTopology();
+
+    Markers* markers = new Markers();
+    markers->addMarker(lower, Vec3(0,-1,0));
+
+    // The shoulder swings most of a turn with the elbow bent slightly.
+    const int NFrames = 40;
+    Array_<Real> times(NFrames);
+    Array_< Array_<Vec3> > observations(NFrames);
+    for (int f=0; f < NFrames; ++f) {
+        times[f] = f*0.02;
+        upper.setOneQ(state, 0, -5*Real(f)/NFrames);
+        lower.setOneQ(state, 0, .3);
+        system.realize(state, Stage::Position);
+        observations[f].push_back(
+            lower.findStationLocationInGround(state, Vec3(0,-1,0)));
+    }
+
+    Assembler serial(system);
+    serial.setAccuracy(1e-8);
+    serial.adoptAssemblyGoal(markers);
+    MarkerTrial trial(*markers, times, observations);
+
+    Assembler parallel(system);
+    parallel.setAccuracy(1e-8);
+    trial.configureAssembler(parallel);
+
+    upper.setOneQ(state, 0, 0);
+    lower.setOneQ(state, 0, .3);
+    const Vector initialQ = state.getQ();
+    Array_<Vector> serialQs, parallelQs;
+    serial.trackTrial(trial, state, serialQs, 1);
+    state.updQ() = initialQ;
+    parallel.trackTrial(trial, state, parallelQs, 4);
+
+    for (int f=0; f < NFrames; ++f) {
+        SimTK_TEST(serialQs[f][1] > 0);
+        SimTK_TEST_EQ_TOL(serialQs[f], parallelQs[f], 1e-5);
+    }
+}
+
+int main() {
+    SimTK_START_TEST("TestAssemblerTrackTrial");
+        SimTK_SUBTEST(testSerialAndParallelAgree);
+        SimTK_SUBTEST(testChunksStayOnSerialBranch);
+    SimTK_END_TEST();
+}
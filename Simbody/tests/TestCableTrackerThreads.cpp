@@ -0,0 +1,143 @@
+/* -------------------------------------------------------------------------- *
+ *                               Simbody(tm)                                  *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Tests concurrent cable path solving in CableTrackerSubsystem: the paths
+must come out the same as when solved serially, and the per-cable statistics
+must account for the work. */
+
+#include "SimTKsimbody.h"
+#include "SimTKcommon/Testing.h"
+
+using namespace SimTK;
+
+namespace {
+const int NumCables = 4;
+const Real SphereRad = .5;
+
+// Each cable runs from a point on Ground over a sphere fixed to Ground to the
+// tip of its own pendulum. If shareSphere is true, every cable uses the same
+// ContactGeometry object.
+void makeCables(MultibodySystem& system, SimbodyMatterSubsystem& matter,
+                CableTrackerSubsystem& cables, bool shareSphere) {
+    GeneralForceSubsystem forces(system);
+    Force::UniformGravity(forces, matter, Vec3(0, -9.8, 0));
+    const Body::Rigid bob(MassProperties(1, Vec3(0), UnitInertia(.1)));
+    const ContactGeometry::Sphere shared(SphereRad);
+    for (int i=0; i < NumCables; ++i) {
+        const Real x = 3*i;
+        MobilizedBody::Pin pendulum(matter.Ground(), Vec3(x+1, 2, 0),
+                                    bob, Vec3(0, 2, 0));
+        CablePath path(cables, matter.Ground(), Vec3(x-1, 0, 0),
+                               pendulum, Vec3(0));
+        CableObstacle::Surface obstacle(path, matter.Ground(),
+            Vec3(x, .3, 0), shareSphere ? ContactGeometry(shared)
+                                        : ContactGeometry::Sphere(SphereRad));
+        obstacle.setContactPointHints(SphereRad*UnitVec3(-1,1,0),
+                                      SphereRad*UnitVec3(1,1,0));
+    }
+}
+
+// Simulate briefly and return each cable's length at the end.
+Vector simulate(int numThreads, bool shareSphere,
+                Array_<int>& solves, Array_<int>& iterations) {
+    MultibodySystem system;
+    SimbodyMatterSubsystem matter(system);
+    CableTrackerSubsystem cables(system);
+    makeCables(system, matter, cables, shareSphere);
+    cables.setNumThreads(numThreads);
+    SimTK_TEST(cables.getNumThreads() == numThreads);
+
+    State state = system.realizeTopology();
+    for (int i=0; i < NumCables; ++i)
+        matter.getMobilizedBody(MobilizedBodyIndex(i+1))
+            .setOneU(state, 0, .5 + .1*i);
+
+    RungeKuttaMersonIntegrator integ(system);
+    integ.setAccuracy(1e-5);
+    TimeStepper ts(system, integ);
+    ts.initialize(state);
+    ts.stepTo(0.05);
+
+    Vector lengths(NumCables);
+    solves.resize(NumCables); iterations.resize(NumCables);
+    for (CablePathIndex cx(0); cx < NumCables; ++cx) {
+        const CablePath& path = cables.getCablePath(cx);
+        lengths[cx] = path.getCableLength(ts.getState());
+        solves[cx] = path.getNumPathSolves();
+        iterations[cx] = path.getNumPathIterations();
+        SimTK_TEST(path.getPathSolveCpuTime() >= 0);
+    }
+    return lengths;
+}
+}
+
+void testThreadsGiveSameAnswers() {
+    Array_<int> solves1, iters1, solves3, iters3;
+    const Vector serial   = simulate(1, false, solves1, iters1);
+    const Vector parallel = simulate(3, false, solves3, iters3);
+    for (int i=0; i < NumCables; ++i) {
+        SimTK_TEST(parallel[i] == serial[i]);
+        SimTK_TEST(solves3[i] == solves1[i]);
+        SimTK_TEST(iters3[i] == iters1[i]);
+        SimTK_TEST(solves1[i] > 0);
+        // The cable wraps the sphere so there is something to solve, but
+        // warm starting should keep that to a few iterations per solve.
+        SimTK_TEST(iters1[i] >= solves1[i]);
+        SimTK_TEST(iters1[i] <= 3*solves1[i]);
+    }
+}
+
+// Paths sharing a geometry object are solved by one thread, in order.
+void testSharedGeometry() {
+    Array_<int> solves1, iters1, solves3, iters3;
+    const Vector serial   = simulate(1, true, solves1, iters1);
+    const Vector parallel = simulate(3, true, solves3, iters3);
+    for (int i=0; i < NumCables; ++i) {
+        SimTK_TEST(parallel[i] == serial[i]);
+        SimTK_TEST(iters3[i] == iters1[i]);
+    }
+}
+
+void testStatistics() {
+    MultibodySystem system;
+    SimbodyMatterSubsystem matter(system);
+    CableTrackerSubsystem cables(system);
+    makeCables(system, matter, cables, false);
+    SimTK_TEST_MUST_THROW(cables.setNumThreads(-1));
+    State state = system.realizeTopology();
+    system.realize(state, Stage::Position);
+    CablePath& path = cables.updCablePath(CablePathIndex(0));
+    SimTK_TEST(path.getNumPathSolves() == 1);
+    path.resetStatistics();
+    SimTK_TEST(path.getNumPathSolves() == 0);
+    SimTK_TEST(path.getNumPathIterations() == 0);
+    SimTK_TEST(path.getPathSolveCpuTime() == 0);
+}
+
+int main() {
+    SimTK_START_TEST("TestCableTrackerThreads");
+        SimTK_SUBTEST(testThreadsGiveSameAnswers);
+        SimTK_SUBTEST(testSharedGeometry);
+        SimTK_SUBTEST(testStatistics);
+    SimTK_END_TEST();
+}
@@ -0,0 +1,262 @@
+/* -------------------------------------------------------------------------- *
+ *                               Simbody(tm)                                  *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Tests the batched evaluation of HuntCrossleyForce and ElasticFoundationForce
+with many contacts: the results must be exactly the same with any number of
+threads, and must agree with evaluating each contact on its own. */
+
+#include "SimTKsimbody.h"
+#include "SimTKcommon/Testing.h"
+
+#include <iostream>
+
+using namespace SimTK;
+using std::cout;
+using std::endl;
+
+namespace {
+const int GridSize = 25; // spheres along each side of the grid
+const Real Radius = .1;
+const Real Ground[] = {1e6, .5, .8, .5, .1}; // k, c, us, ud, uv
+const Real Ball[]   = {2e6, 1., .7, .2, .05};
+
+// A grid of free spheres, most of them pressed into a half space y < 0.
+struct SphereModel {
+    SphereModel()
+    :   matter(system), contacts(system), forces(system),
+        set(contacts.createContactSet()),
+        hc(forces, contacts, set) {
+        contacts.addBody(set, matter.updGround(), ContactGeometry::HalfSpace(),
+                         Transform(Rotation(-Pi/2, ZAxis), Vec3(0)));
+        hc.setBodyParameters(ContactSurfaceIndex(0), Ground[0], Ground[1],
+                             Ground[2], Ground[3], Ground[4]);
+        Body::Rigid body(MassProperties(1, Vec3(0), UnitInertia(1)));
+        for (int i=0; i < GridSize*GridSize; ++i) {
+            MobilizedBody::Free sphere(matter.updGround(), body);
+            contacts.addBody(set, sphere, ContactGeometry::Sphere(Radius),
+                             Transform());
+            hc.setBodyParameters(ContactSurfaceIndex(i+1), Ball[0], Ball[1],
+                                 Ball[2], Ball[3], Ball[4]);
+            spheres.push_back(sphere);
+        }
+        hc.setTransitionVelocity(.01);
+        system.realizeTopology();
+    }
+
+    State makeState() const {
+        State state = system.getDefaultState();
+        Random::Uniform random(-1, 1); random.setSeed(7);
+        for (int i=0; i < (int)spheres.size(); ++i) {
+            const Real height = Radius*(.98 - .03*random.getValue());
+            spheres[i].setQToFitTransform(state, Transform(
+                Rotation(random.getValue(), UnitVec3(1, 2, 3)),
+                Vec3(3*Radius*(i%GridSize), height, 3*Radius*(i/GridSize))));
+            // Every fifth sphere is leaving the surface fast enough for the
+            // dissipation to cancel the contact force.
+            const Real vy = i%5 == 0 ? Real(10) : random.getValue();
+            spheres[i].setUToFitVelocity(state, SpatialVec(
+                Vec3(random.getValue(), random.getValue(), random.getValue()),
+                Vec3(random.getValue(), vy, random.getValue())));
+        }
+        return state;
+    }
+
+    MultibodySystem         system;
+    SimbodyMatterSubsystem  matter;
+    GeneralContactSubsystem contacts;
+    GeneralForceSubsystem   forces;
+    ContactSetIndex         set;
+    HuntCrossleyForce       hc;
+    Array_<MobilizedBody>   spheres;
+};
+
+// The combined friction coefficient.
+Real combine(Real u1, Real u2) {return 2*u1*u2/(u1+u2);}
+
+// Evaluate the Hunt-Crossley model one contact at a time.
+void calcExpectedForces(const SphereModel& model, const State& state,
+                        Vector_<SpatialVec>& bodyForces, Real& pe) {
+    bodyForces.resize(model.matter.getNumBodies());
+    bodyForces = SpatialVec(Vec3(0), Vec3(0));
+    pe = 0;
+    const Array_<Contact>& contacts =
+        model.contacts.getContacts(state, model.set);
+    for (const Contact& c0 : contacts) {
+        const PointContact& contact = static_cast<const PointContact&>(c0);
+        const Real* p1 = contact.getSurface1() == 0 ? Ground : Ball;
+        const Real* p2 = contact.getSurface2() == 0 ? Ground : Ball;
+        const Real k1 = std::pow(p1[0], Real(2./3.));
+        const Real k2 = std::pow(p2[0], Real(2./3.));
+        const Real s1 = k2/(k1+k2);
+        const Real k = k1*s1, c = p1[1]*s1 + p2[1]*(1-s1);
+        const Real us = combine(p1[2], p2[2]);
+        const Real ud = combine(p1[3], p2[3]);
+        const Real uv = combine(p1[4], p2[4]);
+
+        const MobilizedBody& body1 =
+            model.contacts.getBody(model.set, contact.getSurface1());
+        const MobilizedBody& body2 =
+            model.contacts.getBody(model.set, contact.getSurface2());
+        const Real depth = contact.getDepth();
+        const Vec3 normal = contact.getNormal();
+        const Vec3 location = contact.getLocation() + (depth*(.5-s1))*normal;
+        const Real fH = Real(4./3.)*k*depth
+                        *std::sqrt(contact.getEffectiveRadiusOfCurvature()*k*depth);
+        pe += Real(.4)*fH*depth;
+        const Vec3 station1 = body1.findStationAtGroundPoint(state, location);
+        const Vec3 station2 = body2.findStationAtGroundPoint(state, location);
+        const Vec3 v = body1.findStationVelocityInGround(state, station1)
+                     - body2.findStationVelocityInGround(state, station2);
+        const Real vnormal = dot(v, normal);
+        const Vec3 vtangent = v - vnormal*normal;
+        const Real f = fH*(1 + 1.5*c*vnormal);
+        if (f <= 0)
+            continue;
+        Vec3 force = f*normal;
+        const Real vslip = vtangent.norm();
+        const Real vrel = vslip/.01;
+        force += f*(std::min(vrel, Real(1))*(ud+2*(us-ud)/(1+vrel*vrel))
+                    + uv*vslip)*vtangent/vslip;
+        body1.applyForceToBodyPoint(state, station1, -force, bodyForces);
+        body2.applyForceToBodyPoint(state, station2, force, bodyForces);
+    }
+}
+}
+
+void testHuntCrossley() {
+    SphereModel model;
+    State state = model.makeState();
+    model.system.realize(state, Stage::Dynamics);
+    const int nContacts = model.contacts.getContacts(state, model.set).size();
+    SimTK_TEST(nContacts > 400);
+    const Vector_<SpatialVec> serial =
+        model.system.getRigidBodyForces(state, Stage::Dynamics);
+    const Real serialPE = model.system.calcPotentialEnergy(state);
+
+    // Every sphere in contact that isn't leaving feels a force, including
+    // those listed after a sphere that's leaving.
+    Vector_<SpatialVec> expected; Real expectedPE;
+    calcExpectedForces(model, state, expected, expectedPE);
+    SimTK_TEST_EQ_TOL(serialPE, expectedPE, 1e-12);
+    int nPushed = 0;
+    for (MobilizedBodyIndex b(1); b < model.matter.getNumBodies(); ++b) {
+        SimTK_TEST_EQ_TOL(serial[b], expected[b], 1e-10);
+        if (expected[b][1] != Vec3(0)) ++nPushed;
+    }
+    SimTK_TEST(nPushed > nContacts/2 && nPushed < nContacts);
+
+    const int threads[] = {0, 3, 16};
+    for (int n : threads) {
+        model.hc.setNumThreads(n);
+        SimTK_TEST(model.hc.getNumThreads() == n);
+        state.invalidateAllCacheAtOrAbove(Stage::Dynamics);
+        model.system.realize(state, Stage::Dynamics);
+        const Vector_<SpatialVec>& threaded =
+            model.system.getRigidBodyForces(state, Stage::Dynamics);
+        for (int b=0; b < serial.size(); ++b)
+            SimTK_TEST(threaded[b] == serial[b]);
+        SimTK_TEST(model.system.calcPotentialEnergy(state) == serialPE);
+    }
+    SimTK_TEST_MUST_THROW(model.hc.setNumThreads(-1));
+
+    // Copies of the force element keep the setting.
+    SphereModel copy;
+    copy.hc.setNumThreads(2);
+    const HuntCrossleyForce hcCopy = copy.hc;
+    SimTK_TEST(hcCopy.getNumThreads() == 2);
+}
+
+void testElasticFoundation() {
+    MultibodySystem system;
+    SimbodyMatterSubsystem matter(system);
+    GeneralContactSubsystem contacts(system);
+    GeneralForceSubsystem forces(system);
+    const ContactSetIndex set = contacts.createContactSet();
+    contacts.addBody(set, matter.updGround(), ContactGeometry::HalfSpace(),
+                     Transform(Rotation(-Pi/2, ZAxis), Vec3(0)));
+    ElasticFoundationForce ef(forces, contacts, set);
+    const ContactGeometry::TriangleMesh
+        ball(PolygonalMesh::createSphereMesh(1, 4));
+    Body::Rigid body(MassProperties(1, Vec3(0), UnitInertia(1)));
+    Random::Uniform random(-1, 1); random.setSeed(11);
+    Array_<MobilizedBody::Free> balls;
+    for (int i=0; i < 4; ++i) {
+        MobilizedBody::Free mobod(matter.updGround(), body);
+        contacts.addBody(set, mobod, ball, Transform());
+        ef.setBodyParameters(ContactSurfaceIndex(i+1), 1e6, .5, .8, .5, .1);
+        balls.push_back(mobod);
+    }
+    State state = system.realizeTopology();
+    for (int i=0; i < (int)balls.size(); ++i) {
+        balls[i].setQToFitTransform(state,
+            Transform(Rotation(random.getValue(), UnitVec3(1, 2, 3)),
+                      Vec3(3*i, .6 + .1*random.getValue(), 0)));
+        balls[i].setUToFitVelocity(state, SpatialVec(
+            Vec3(random.getValue(), random.getValue(), random.getValue()),
+            Vec3(random.getValue(), random.getValue(), random.getValue())));
+    }
+    system.realize(state, Stage::Dynamics);
+    const Vector_<SpatialVec> serial =
+        system.getRigidBodyForces(state, Stage::Dynamics);
+    const Real serialPE = system.calcPotentialEnergy(state);
+    SimTK_TEST(serialPE > 0);
+    for (int i=0; i < (int)balls.size(); ++i)
+        SimTK_TEST(serial[balls[i].getMobilizedBodyIndex()][1][1] > 0);
+
+    ef.setNumThreads(4);
+    SimTK_TEST(ef.getNumThreads() == 4);
+    state.invalidateAllCacheAtOrAbove(Stage::Dynamics);
+    system.realize(state, Stage::Dynamics);
+    const Vector_<SpatialVec>& threaded =
+        system.getRigidBodyForces(state, Stage::Dynamics);
+    for (int b=0; b < serial.size(); ++b)
+        SimTK_TEST(threaded[b] == serial[b]);
+    SimTK_TEST(system.calcPotentialEnergy(state) == serialPE);
+}
+
+// Report the time to evaluate the sphere grid's contact forces.
+void timeHuntCrossley() {
+    SphereModel model;
+    State state = model.makeState();
+    const int threads[] = {1, 0};
+    for (int n : threads) {
+        model.hc.setNumThreads(n);
+        const int NRepeats = 200;
+        const double t0 = realTime();
+        for (int i=0; i < NRepeats; ++i) {
+            state.invalidateAllCacheAtOrAbove(Stage::Dynamics);
+            model.system.realize(state, Stage::Dynamics);
+        }
+        cout << "Hunt-Crossley, " << (n ? "serial" : "all threads") << ": "
+             << 1e3*(realTime()-t0)/NRepeats << "ms per realize(Dynamics)"
+             << endl;
+    }
+}
+
+int main() {
+    SimTK_START_TEST("TestContactForceThreads");
+        SimTK_SUBTEST(testHuntCrossley);
+        SimTK_SUBTEST(testElasticFoundation);
+        SimTK_SUBTEST(timeHuntCrossley);
+    SimTK_END_TEST();
+}
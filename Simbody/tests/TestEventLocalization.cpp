@@ -0,0 +1,163 @@
+/* -------------------------------------------------------------------------- *
+ *                               Simbody(tm)                                  *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Tests that the integrators localize events whose trigger functions depend
+only on positions without evaluating forces at the trial times, and that the
+events are found at the same times as when the trigger functions are declared
+to depend on accelerations. */
+
+#include "SimTKsimbody.h"
+#include "SimTKcommon/Testing.h"
+
+#include <iostream>
+
+using namespace SimTK;
+using std::cout;
+using std::endl;
+
+namespace {
+// Gravity as a custom force, counting how often it is evaluated.
+class CountingGravity : public Force::Custom::Implementation {
+public:
+    explicit CountingGravity(const SimbodyMatterSubsystem& matter)
+    :   matter(matter), count(0) {}
+    void calcForce(const State& state, Vector_<SpatialVec>& bodyForces,
+                   Vector_<Vec3>& particleForces,
+                   Vector& mobilityForces) const override {
+        ++count;
+        for (MobilizedBodyIndex b(1); b < matter.getNumBodies(); ++b) {
+            const MobilizedBody& body = matter.getMobilizedBody(b);
+            body.applyBodyForce(state,
+                SpatialVec(Vec3(0), Vec3(0,-9.8*body.getBodyMass(state),0)),
+                bodyForces);
+        }
+    }
+    Real calcPotentialEnergy(const State&) const override {return 0;}
+
+    const SimbodyMatterSubsystem& matter;
+    mutable int count;
+};
+
+// Records the times at which a pin angle passes through zero.
+class ZeroAngleHandler : public TriggeredEventHandler {
+public:
+    ZeroAngleHandler(const MobilizedBody& body, Stage stage)
+    :   TriggeredEventHandler(stage), body(body) {}
+    Real getValue(const State& state) const override {
+        return body.getOneQ(state, 0);
+    }
+    void handleEvent(State& state, Real accuracy,
+                     bool& shouldTerminate) const override {
+        times.push_back(state.getTime());
+    }
+
+    const MobilizedBody body;
+    mutable Array_<Real> times;
+};
+
+struct Model {
+    explicit Model(Stage stage) : matter(system), forces(system) {
+        Body::Rigid body(MassProperties(1, Vec3(0), UnitInertia(.1)));
+        MobilizedBody::Pin pendulum(matter.Ground(), Vec3(0),
+                                    body, Vec3(0,1,0));
+        gravity = new CountingGravity(matter);
+        Force::Custom(forces, gravity);
+        handler = new ZeroAngleHandler(pendulum, stage);
+        system.addEventHandler(handler);
+        system.realizeTopology();
+    }
+
+    // Returns the number of force evaluations.
+    int simulate(Integrator& integ) {
+        State state = system.getDefaultState();
+        state.updQ()[0] = .8;
+        integ.setAccuracy(1e-6);
+        TimeStepper ts(system, integ);
+        ts.initialize(state);
+        gravity->count = 0;
+        ts.stepTo(5);
+        cout << handler->getRequiredStage() << " trigger: "
+             << handler->times.size() << " events, " << gravity->count
+             << " force evaluations, " << integ.getNumRealizations()
+             << " realizations" << endl;
+        return gravity->count;
+    }
+
+    MultibodySystem         system;
+    SimbodyMatterSubsystem  matter;
+    GeneralForceSubsystem   forces;
+    CountingGravity*        gravity; // owned by the Force
+    ZeroAngleHandler*       handler; // owned by the System
+};
+
+template <class IntegratorType>
+void testSameEventsWithFewerForces() {
+    Model position(Stage::Position), acceleration(Stage::Acceleration);
+    IntegratorType integPosition(position.system);
+    IntegratorType integAcceleration(acceleration.system);
+    const int nPosition = position.simulate(integPosition);
+    const int nAcceleration = acceleration.simulate(integAcceleration);
+
+    const Array_<Real>& times = position.handler->times;
+    SimTK_TEST(times.size() >= 4);
+    SimTK_TEST(times.size() == acceleration.handler->times.size());
+    for (unsigned i=0; i < times.size(); ++i)
+        SimTK_TEST_EQ_TOL(times[i], acceleration.handler->times[i], 1e-10);
+    SimTK_TEST(nPosition < nAcceleration);
+}
+
+// Trigger functions below Acceleration stage are read from states that have
+// been realized only through their own stage; in Debug builds an attempt to
+// read all the triggers together from such a state throws.
+template <class IntegratorType>
+void testLowStageTriggers() {
+    Model position(Stage::Position), velocity(Stage::Velocity);
+    IntegratorType integPosition(position.system);
+    IntegratorType integVelocity(velocity.system);
+    position.simulate(integPosition);
+    velocity.simulate(integVelocity);
+
+    const Array_<Real>& times = position.handler->times;
+    SimTK_TEST(times.size() >= 4);
+    SimTK_TEST(times.size() == velocity.handler->times.size());
+    for (unsigned i=0; i < times.size(); ++i)
+        SimTK_TEST_EQ_TOL(times[i], velocity.handler->times[i], 1e-10);
+}
+
+void testExplicitIntegrator() {
+    testSameEventsWithFewerForces<RungeKuttaMersonIntegrator>();
+    testLowStageTriggers<RungeKuttaMersonIntegrator>();
+}
+
+void testCPodesIntegrator() {
+    testSameEventsWithFewerForces<CPodesIntegrator>();
+    testLowStageTriggers<CPodesIntegrator>();
+}
+}
+
+int main() {
+    SimTK_START_TEST("TestEventLocalization");
+        SimTK_SUBTEST(testExplicitIntegrator);
+        SimTK_SUBTEST(testCPodesIntegrator);
+    SimTK_END_TEST();
+}
@@ -0,0 +1,193 @@
+/* -------------------------------------------------------------------------- *
+ *                               Simbody(tm)                                  *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Tests that GeneralForceSubsystem adds up the forces from many parallel and
+non-parallel force elements with bitwise identical results for any number of
+threads, with and without cached position-only forces. */
+
+#include "SimTKsimbody.h"
+#include "SimTKcommon/Testing.h"
+
+#include <iostream>
+
+using namespace SimTK;
+using std::cout;
+using std::endl;
+
+namespace {
+const int NumBodies = 30;
+
+// Applies forces of wildly different magnitudes, so that the sums depend on
+// the order in which they are added, to every body and mobility.
+class NoisyForce : public Force::Custom::Implementation {
+public:
+    NoisyForce(int seed, bool parallel, bool positionOnly, int work=0)
+    :   seed(seed), parallel(parallel), positionOnly(positionOnly),
+        work(work), shouldThrow(false) {}
+
+    void calcForce(const State& state, Vector_<SpatialVec>& bodyForces,
+                   Vector_<Vec3>& particleForces,
+                   Vector& mobilityForces) const override {
+        SimTK_ERRCHK_ALWAYS(!shouldThrow, "NoisyForce::calcForce",
+                            "Failed on purpose.");
+        const Real q = state.getQ()[0];
+        const Real scale = std::pow(Real(10), seed%7 - 3);
+        for (int b=0; b < bodyForces.size(); ++b)
+            bodyForces[b] += SpatialVec(Vec3(scale*(b+q)/(seed+1)),
+                                        Vec3(scale/(b+seed+3)));
+        for (int i=0; i < mobilityForces.size(); ++i)
+            mobilityForces[i] += scale*std::sin(seed + i + q);
+        // Some busy work, to make some forces more expensive than others.
+        Real x = q;
+        for (int i=0; i < work; ++i) x = std::sin(x);
+        mobilityForces[0] += 1e-20*x;
+    }
+    Real calcPotentialEnergy(const State&) const override {return 0;}
+    bool dependsOnlyOnPositions() const override {return positionOnly;}
+    bool shouldBeParallelIfPossible() const override {return parallel;}
+
+    const int seed;
+    const bool parallel, positionOnly;
+    const int work;
+    mutable bool shouldThrow;
+};
+
+struct Model {
+    // If positionOnly, some of the forces are cached.
+    explicit Model(bool positionOnly) : matter(system), forces(system) {
+        Body::Rigid body(MassProperties(1, Vec3(0), UnitInertia(1)));
+        MobilizedBody parent = matter.Ground();
+        for (int i=0; i < NumBodies; ++i)
+            parent = MobilizedBody::Pin(parent, Vec3(0,-1,0), body, Vec3(0));
+        for (int i=0; i < 100; ++i) {
+            NoisyForce* impl = new NoisyForce(i, i%4 != 0,
+                                              positionOnly && i%3 == 0,
+                                              i%10 == 0 ? 20000 : 0);
+            Force::Custom(forces, impl);
+            impls.push_back(impl);
+        }
+        system.realizeTopology();
+    }
+
+    Vector_<SpatialVec> calcForces(int numThreads, State& state) {
+        forces.setNumberOfThreads(numThreads);
+        state.invalidateAllCacheAtOrAbove(Stage::Position);
+        system.realize(state, Stage::Dynamics);
+        return system.getRigidBodyForces(state, Stage::Dynamics);
+    }
+
+    MultibodySystem         system;
+    SimbodyMatterSubsystem  matter;
+    GeneralForceSubsystem   forces;
+    Array_<NoisyForce*>     impls; // owned by the Force handles
+};
+
+bool isSame(const Vector_<SpatialVec>& a, const Vector_<SpatialVec>& b) {
+    if (a.size() != b.size()) return false;
+    for (int i=0; i < a.size(); ++i)
+        if (a[i] != b[i]) return false;
+    return true;
+}
+
+bool isSame(const Vector& a, const Vector& b) {
+    if (a.size() != b.size()) return false;
+    for (int i=0; i < a.size(); ++i)
+        if (a[i] != b[i]) return false;
+    return true;
+}
+}
+
+void testSameForAnyThreadCount() {
+    for (int positionOnly=0; positionOnly < 2; ++positionOnly) {
+        Model model(positionOnly != 0);
+        State state = model.system.getDefaultState();
+        state.updQ() = .1;
+        const Vector_<SpatialVec> serial = model.calcForces(1, state);
+        const Vector serialMobility =
+            model.system.getMobilityForces(state, Stage::Dynamics);
+        for (int n=2; n <= 8; n *= 2) {
+            // Repeating lets the measured costs change the schedule.
+            for (int repeat=0; repeat < 3; ++repeat) {
+                SimTK_TEST(isSame(model.calcForces(n, state), serial));
+                SimTK_TEST(isSame(
+                    model.system.getMobilityForces(state, Stage::Dynamics),
+                    serialMobility));
+            }
+            SimTK_TEST(model.forces.getNumberOfThreads() == n);
+        }
+
+        // With cached forces, a velocity change reuses the cache.
+        if (positionOnly) {
+            state.updU() = 1;
+            model.system.realize(state, Stage::Dynamics);
+            SimTK_TEST(isSame(
+                model.system.getRigidBodyForces(state, Stage::Dynamics),
+                serial));
+        }
+
+        // Disabling forces changes the blocks but not their agreement.
+        for (int i=0; i < 100; i += 7)
+            model.forces.setForceIsDisabled(state, ForceIndex(i), true);
+        const Vector_<SpatialVec> fewer = model.calcForces(1, state);
+        SimTK_TEST(!isSame(fewer, serial));
+        SimTK_TEST(isSame(model.calcForces(4, state), fewer));
+    }
+}
+
+// An exception from a force evaluated on a worker thread reaches the caller.
+void testException() {
+    Model model(false);
+    State state = model.system.getDefaultState();
+    for (int n=1; n <= 4; n *= 4) {
+        model.impls[5]->shouldThrow = true;
+        model.forces.setNumberOfThreads(n);
+        state.invalidateAllCacheAtOrAbove(Stage::Position);
+        SimTK_TEST_MUST_THROW(model.system.realize(state, Stage::Dynamics));
+        model.impls[5]->shouldThrow = false;
+        model.calcForces(n, state); // fine again
+    }
+}
+
+// Report the time for many cheap forces and a few expensive ones.
+void timeForces() {
+    Model model(false);
+    State state = model.system.getDefaultState();
+    const int threads[] = {1, 4};
+    for (int n : threads) {
+        model.calcForces(n, state);
+        const int NRepeats = 50;
+        const double t0 = realTime();
+        for (int i=0; i < NRepeats; ++i)
+            model.calcForces(n, state);
+        cout << n << " threads: " << 1e3*(realTime()-t0)/NRepeats
+             << "ms per realize(Dynamics)" << endl;
+    }
+}
+
+int main() {
+    SimTK_START_TEST("TestForceReduction");
+        SimTK_SUBTEST(testSameForAnyThreadCount);
+        SimTK_SUBTEST(testException);
+        SimTK_SUBTEST(timeForces);
+    SimTK_END_TEST();
+}
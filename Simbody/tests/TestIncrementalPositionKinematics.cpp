@@ -0,0 +1,249 @@
+/* -------------------------------------------------------------------------- *
+ *                               Simbody(tm)                                  *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Tests SimbodyMatterSubsystem::setUseIncrementalPositionKinematics() by
+comparing incrementally realized positions with full realizations. */
+
+#include "SimTKsimbody.h"
+#include "SimTKcommon/Testing.h"
+
+#include <iostream>
+
+using namespace SimTK;
+using std::cout;
+using std::endl;
+
+namespace {
+// Counts how many times its transform is calculated.
+int numCustomTransforms = 0;
+
+class CountingSlider : public MobilizedBody::Custom::Implementation {
+public:
+    explicit CountingSlider(SimbodyMatterSubsystem& matter)
+    :   Implementation(matter, 1, 1, 0) {}
+    Implementation* clone() const override
+    {   return new CountingSlider(*this); }
+    Transform calcMobilizerTransformFromQ
+       (const State&, int nq, const Real* q) const override
+    {   ++numCustomTransforms; return Transform(Vec3(q[0],0,0)); }
+    SpatialVec multiplyByHMatrix
+       (const State&, int nu, const Real* u) const override
+    {   return SpatialVec(Vec3(0), Vec3(u[0],0,0)); }
+    void multiplyByHTranspose
+       (const State&, const SpatialVec& F, int nu, Real* f) const override
+    {   f[0] = F[1][0]; }
+    SpatialVec multiplyByHDotMatrix
+       (const State&, int nu, const Real* u) const override
+    {   return SpatialVec(Vec3(0), Vec3(0)); }
+    void multiplyByHDotTranspose
+       (const State&, const SpatialVec& F, int nu, Real* f) const override
+    {   f[0] = 0; }
+    void setQToFitTransform
+       (const State&, const Transform& X_FM, int nq, Real* q) const override
+    {   q[0] = X_FM.p()[0]; }
+    void setUToFitVelocity
+       (const State&, const SpatialVec& V_FM, int nu, Real* u) const override
+    {   u[0] = V_FM[1][0]; }
+};
+
+// Three branches: a chain with quaternion and Euler-angle mobilizers and a
+// weld in the middle, a short pin chain, and a custom slider. There is a
+// constraint within the first branch (so its ancestor isn't Ground) and one
+// connecting the first two branches.
+struct Model {
+    Model() : matter(system) {
+        Body::Rigid body(MassProperties(1.1, Vec3(.1,-.2,.05),
+                                        UnitInertia(1,1.2,1.1,.1,.02,-.03)));
+        MobilizedBody parent = matter.Ground();
+        for (int i=0; i < 8; ++i) {
+            const Transform X_PF(Rotation(.1*i, XAxis), Vec3(0,-.5,.1));
+            const Transform X_BM(Vec3(.05,.4,0));
+            if (i==0) parent = MobilizedBody::Free(parent,X_PF,body,X_BM);
+            else if (i==3) parent = MobilizedBody::Weld(parent,X_PF,body,X_BM);
+            else if (i%2) parent = MobilizedBody::Ball(parent,X_PF,body,X_BM);
+            else parent = MobilizedBody::Gimbal(parent,X_PF,body,X_BM);
+            chain.push_back(parent);
+        }
+        parent = matter.Ground();
+        for (int i=0; i < 4; ++i) {
+            parent = MobilizedBody::Pin(parent, Vec3(1,0,0), body, Vec3(0,.3,0));
+            pins.push_back(parent);
+        }
+        slider = MobilizedBody::Custom(matter.Ground(),
+                                       new CountingSlider(matter), body);
+
+        Constraint::Ball(chain[2], Vec3(.1,0,0), chain[6], Vec3(0,.1,0));
+        Constraint::Rod(chain[7], Vec3(0), pins[3], Vec3(0), 1.5);
+        matter.setUseIncrementalPositionKinematics(true);
+        system.realizeTopology();
+    }
+
+    State makeState() const {
+        State s = system.getDefaultState();
+        Random::Uniform random(-1, 1); random.setSeed(7);
+        for (int i=0; i < s.getNQ(); ++i) s.updQ()[i] = random.getValue();
+        system.realize(s, Stage::Position);
+        return s;
+    }
+
+    // Realize a copy of s from scratch and compare it with s, which must
+    // already have been realized.
+    void checkAgainstFullRealization(const State& s) const {
+        State full = s;
+        matter.invalidatePositionKinematics(full);
+        system.realize(full, Stage::Velocity);
+        system.realize(s, Stage::Velocity);
+        for (MobilizedBodyIndex mbx(0); mbx < matter.getNumBodies(); ++mbx) {
+            const MobilizedBody& mobod = matter.getMobilizedBody(mbx);
+            SimTK_TEST_EQ(mobod.getBodyTransform(s),
+                          mobod.getBodyTransform(full));
+            SimTK_TEST_EQ(mobod.getBodyVelocity(s),
+                          mobod.getBodyVelocity(full));
+        }
+        SimTK_TEST_EQ(s.getQErr(), full.getQErr());
+        SimTK_TEST_EQ(s.getUErr(), full.getUErr());
+    }
+
+    MultibodySystem                 system;
+    SimbodyMatterSubsystem          matter;
+    Array_<MobilizedBody>           chain, pins;
+    MobilizedBody                   slider;
+};
+}
+
+void testMatchesFullRealization() {
+    Model model;
+    State s = model.makeState();
+    Random::Uniform random(-.1, .1); random.setSeed(11);
+
+    // Change one q at a time, then a few together.
+    for (int i=0; i < s.getNQ(); ++i) {
+        s.updQ()[i] += random.getValue();
+        model.system.realize(s, Stage::Position);
+        model.checkAgainstFullRealization(s);
+    }
+    for (int i=0; i < 10; ++i) {
+        s.updQ()[(7*i) % s.getNQ()] += random.getValue();
+        s.updQ()[(3*i) % s.getNQ()] += random.getValue();
+        model.matter.realizePositionKinematics(s);
+        model.checkAgainstFullRealization(s);
+    }
+
+    // Setting a q to the same value changes nothing.
+    model.chain[5].setQFromVector(s, model.chain[5].getQAsVector(s));
+    model.checkAgainstFullRealization(s);
+}
+
+void testOnlyAffectedBodiesRecalculated() {
+    Model model;
+    State s = model.makeState();
+    const int n0 = numCustomTransforms;
+
+    // Moving other branches doesn't recalculate the slider.
+    model.chain[4].setOneQ(s, 0, model.chain[4].getOneQ(s, 0) + .1);
+    model.pins[0].setOneQ(s, 0, .3);
+    model.system.realize(s, Stage::Position);
+    SimTK_TEST(numCustomTransforms == n0);
+    model.checkAgainstFullRealization(s);
+
+    // But moving the slider does.
+    model.slider.setOneQ(s, 0, .7);
+    model.system.realize(s, Stage::Position);
+    SimTK_TEST(numCustomTransforms > n0);
+    SimTK_TEST_EQ(model.slider.getBodyOriginLocation(s), Vec3(.7,0,0));
+}
+
+// Anything that might make the cached results stale must cause a full
+// realization.
+void testFullRealizationWhenNeeded() {
+    Model model;
+    State s = model.makeState();
+
+    // An Instance-stage change.
+    Constraint& rod = model.matter.updConstraint(ConstraintIndex(1));
+    rod.disable(s);
+    model.pins[1].setOneQ(s, 0, .2);
+    model.system.realize(s, Stage::Position);
+    model.checkAgainstFullRealization(s);
+    rod.enable(s);
+    model.system.realize(s, Stage::Position);
+    model.checkAgainstFullRealization(s);
+
+    // Switching incremental mode off and back on.
+    const Real q0 = model.slider.getOneQ(s, 0);
+    model.matter.setUseIncrementalPositionKinematics(false);
+    model.slider.setOneQ(s, 0, q0 + .5);
+    model.system.realize(s, Stage::Position);
+    model.matter.setUseIncrementalPositionKinematics(true);
+    model.slider.setOneQ(s, 0, q0);
+    model.system.realize(s, Stage::Position);
+    SimTK_TEST_EQ(model.slider.getBodyOriginLocation(s), Vec3(q0,0,0));
+    model.checkAgainstFullRealization(s);
+
+    // A copied state.
+    State copy = s;
+    model.pins[2].setOneQ(copy, 0, -.4);
+    model.system.realize(copy, Stage::Position);
+    model.checkAgainstFullRealization(copy);
+}
+
+// Time perturbing the last q of a long chain with and without incremental
+// realization.
+void timeLongChain() {
+    MultibodySystem system;
+    SimbodyMatterSubsystem matter(system);
+    Body::Rigid body(MassProperties(1, Vec3(0), UnitInertia(1)));
+    MobilizedBody parent = matter.Ground();
+    for (int i=0; i < 200; ++i)
+        parent = MobilizedBody::Ball(parent, Vec3(0,-.1,0), body, Vec3(0));
+    system.realizeTopology();
+    State s = system.getDefaultState();
+    system.realize(s, Stage::Instance);
+    const int Reps = 2000;
+
+    double times[2];
+    for (int incr=0; incr < 2; ++incr) {
+        matter.setUseIncrementalPositionKinematics(incr != 0);
+        matter.realizePositionKinematics(s);
+        const double t0 = cpuTime();
+        for (int r=0; r < Reps; ++r) {
+            parent.setOneQ(s, 1, (r%2) ? .1 : -.1);
+            matter.realizePositionKinematics(s);
+        }
+        times[incr] = cpuTime() - t0;
+    }
+    SimTK_TEST_EQ(parent.getBodyRotation(s),
+                  Rotation(Quaternion(Vec4(1,.1,0,0))));
+    cout << "200-body chain, last q perturbed: full "
+         << 1e6*times[0]/Reps << "us, incremental "
+         << 1e6*times[1]/Reps << "us per realization" << endl;
+}
+
+int main() {
+    SimTK_START_TEST("TestIncrementalPositionKinematics");
+        SimTK_SUBTEST(testMatchesFullRealization);
+        SimTK_SUBTEST(testOnlyAffectedBodiesRecalculated);
+        SimTK_SUBTEST(testFullRealizationWhenNeeded);
+        SimTK_SUBTEST(timeLongChain);
+    SimTK_END_TEST();
+}
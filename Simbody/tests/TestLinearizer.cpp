@@ -0,0 +1,315 @@
+/* -------------------------------------------------------------------------- *
+ *                               Simbody(tm)                                  *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Tests Linearizer against pendulums whose linearizations are known, with a
+pin, with a ball (quaternions), as a particle held by a rod constraint, and
+as a free body held by a ball constraint. */
+
+#include "SimTKsimbody.h"
+#include "SimTKcommon/Testing.h"
+
+#include <iostream>
+
+using namespace SimTK;
+using std::cout;
+using std::endl;
+
+namespace {
+const Real Mass = 2, Length = 1.5, Radius = .1, G = 9.8;
+
+// The x coordinate of a body's origin in Ground.
+template <class T>
+class OriginX : public Measure_<T> {
+public:
+    SimTK_MEASURE_HANDLE_PREAMBLE(OriginX, Measure_<T>);
+
+    OriginX(Subsystem& sub, const MobilizedBody& body)
+    :   Measure_<T>(sub, new Implementation(body),
+                    AbstractMeasure::SetHandle()) {}
+    SimTK_MEASURE_HANDLE_POSTSCRIPT(OriginX, Measure_<T>);
+};
+
+template <class T>
+class OriginX<T>::Implementation : public Measure_<T>::Implementation {
+public:
+    explicit Implementation(const MobilizedBody& body)
+    :   Measure_<T>::Implementation(1), body(body) {}
+    Implementation* cloneVirtual() const override
+    {   return new Implementation(*this); }
+    int getNumTimeDerivativesVirtual() const override {return 0;}
+    Stage getDependsOnStageVirtual(int) const override
+    {   return Stage::Position; }
+    void calcCachedValueVirtual(const State& s, int, T& value) const
+        override {
+        value = body.getBodyOriginLocation(s)[0];
+    }
+private:
+    const MobilizedBody body;
+};
+
+bool isSame(const Matrix& a, const Matrix& b) {
+    if (a.nrow() != b.nrow() || a.ncol() != b.ncol()) return false;
+    for (int j=0; j < a.ncol(); ++j)
+        for (int i=0; i < a.nrow(); ++i)
+            if (a(i,j) != b(i,j)) return false;
+    return true;
+}
+
+Body::Rigid bob() {
+    return Body::Rigid(MassProperties(Mass, Vec3(0),
+                                      UnitInertia(Radius*Radius)));
+}
+}
+
+void testPin() {
+    MultibodySystem system;
+    SimbodyMatterSubsystem matter(system);
+    GeneralForceSubsystem forces(system);
+    Force::Gravity(forces, matter, -YAxis, G);
+    MobilizedBody::Pin pendulum(matter.Ground(), Vec3(0),
+                                bob(), Vec3(0,Length,0));
+    OriginX<Real> x(matter, pendulum);
+    system.realizeTopology();
+    const State state = system.getDefaultState();
+
+    Linearizer lin(system);
+    lin.addAllMobilityInputs().addOutput(x);
+    Matrix A, B, C, D;
+    lin.linearize(state, A, B, C, D);
+
+    const Real J = Mass*(Radius*Radius + Length*Length);
+    SimTK_TEST_EQ_TOL(A, Matrix(Mat22(0, 1, -Mass*G*Length/J, 0)), 1e-6);
+    SimTK_TEST_EQ(B, Matrix(Mat21(0, 1/J)));
+    SimTK_TEST_EQ_TOL(C, Matrix(Mat12(Length, 0)), 1e-6);
+    SimTK_TEST_EQ(D, Matrix(Mat11(0)));
+    SimTK_TEST_EQ(lin.getStateBasis(), Matrix(Mat22(1)));
+
+    // Forward differences are good to about half the digits.
+    lin.setMethod(Differentiator::ForwardDifference);
+    Matrix Afwd, Bfwd, Cfwd, Dfwd;
+    lin.linearize(state, Afwd, Bfwd, Cfwd, Dfwd);
+    SimTK_TEST_EQ_TOL(Afwd, A, 1e-4);
+
+    Array_<int> rows, cols;
+    Array_<Real> values;
+    Linearizer::findNonzeros(A, 1e-8, rows, cols, values);
+    SimTK_TEST(rows.size() == 2);
+    SimTK_TEST(rows[0] == 1 && cols[0] == 0);
+    SimTK_TEST(rows[1] == 0 && cols[1] == 1);
+    SimTK_TEST_EQ(values[1], A(0,1));
+
+    SimTK_TEST_MUST_THROW(lin.setNumThreads(-1));
+}
+
+// With a ball joint the q's are a quaternion, but the linearization is in
+// terms of angles: the pendulum swings about x and z and spins freely about y.
+// The result agrees with a gimbal, which uses angles for its q's.
+void testBall() {
+    MultibodySystem system;
+    SimbodyMatterSubsystem matter(system);
+    GeneralForceSubsystem forces(system);
+    Force::Gravity(forces, matter, -YAxis, G);
+    MobilizedBody::Ball pendulum(matter.Ground(), Vec3(0),
+                                 bob(), Vec3(0,Length,0));
+    system.realizeTopology();
+    State state = system.getDefaultState();
+    SimTK_TEST(state.getNQ() == 4 && state.getNU() == 3);
+
+    Linearizer lin(system);
+    lin.addInput(pendulum, MobilizerUIndex(1));
+    Matrix A, B, C, D;
+    lin.linearize(state, A, B, C, D);
+    SimTK_TEST(A.nrow() == 6 && A.ncol() == 6);
+    SimTK_TEST(C.nrow() == 0 && C.ncol() == 6 && D.nrow() == 0);
+
+    const Real swing = -Mass*G*Length/(Mass*(Radius*Radius+Length*Length));
+    Matrix expected(6, 6, Real(0));
+    expected(0,3,3,3) = 1;
+    expected(3,0) = expected(5,2) = swing;
+    SimTK_TEST_EQ_TOL(A, expected, 1e-6);
+    Matrix expectedB(6, 1, Real(0));
+    expectedB(4,0) = 1/(Mass*Radius*Radius);
+    SimTK_TEST_EQ(B, expectedB);
+
+    MultibodySystem gimbalSystem;
+    SimbodyMatterSubsystem gimbalMatter(gimbalSystem);
+    GeneralForceSubsystem gimbalForces(gimbalSystem);
+    Force::Gravity(gimbalForces, gimbalMatter, -YAxis, G);
+    MobilizedBody::Gimbal gimbal(gimbalMatter.Ground(), Vec3(0),
+                                 bob(), Vec3(0,Length,0));
+    gimbalSystem.realizeTopology();
+    Linearizer gimbalLin(gimbalSystem);
+    gimbalLin.addInput(gimbal, MobilizerUIndex(1));
+    Matrix Ag, Bg, Cg, Dg;
+    gimbalLin.linearize(gimbalSystem.getDefaultState(), Ag, Bg, Cg, Dg);
+    SimTK_TEST_EQ_TOL(Ag, A, 1e-6);
+    SimTK_TEST_EQ(Bg, B);
+}
+
+// A particle on a rod to the origin. In minimal coordinates it has only two
+// position and two velocity degrees of freedom, which oscillate with
+// frequency sqrt(g/L).
+void testRod() {
+    MultibodySystem system;
+    SimbodyMatterSubsystem matter(system);
+    GeneralForceSubsystem forces(system);
+    Force::Gravity(forces, matter, -YAxis, G);
+    MobilizedBody::Translation particle(matter.Ground(), Vec3(0,-Length,0),
+        Body::Rigid(MassProperties(Mass, Vec3(0), UnitInertia(0))), Vec3(0));
+    Constraint::Rod(matter.Ground(), Vec3(0), particle, Vec3(0), Length);
+    system.realizeTopology();
+    const State state = system.getDefaultState();
+
+    Linearizer lin(system);
+    lin.addAllMobilityInputs();
+    Matrix A, B, C, D;
+    lin.linearize(state, A, B, C, D);
+    SimTK_TEST(A.nrow() == 4 && A.ncol() == 4 && B.ncol() == 3);
+    SimTK_TEST_EQ_TOL(A*A, Matrix(Mat44(-G/Length)), 1e-6);
+
+    // Forces across the rod move the particle; forces along it don't.
+    const Matrix& Z = lin.getStateBasis();
+    SimTK_TEST_EQ(~Z*Z, Matrix(Mat44(1)));
+    Matrix expectedB(6, 3, Real(0));
+    expectedB(3,0) = expectedB(5,2) = 1/Mass;
+    SimTK_TEST_EQ(Z*B, expectedB);
+
+    // Without minimal coordinates the rod direction is still there, but
+    // forces along it still have no effect.
+    lin.setUseMinimalCoordinates(false);
+    lin.linearize(state, A, B, C, D);
+    SimTK_TEST(A.nrow() == 6);
+    SimTK_TEST_EQ(B, expectedB);
+}
+
+// The ball pendulum again, but with the bob on a free mobilizer (seven q's,
+// six u's) held at the pivot by a ball constraint. The basis must keep the
+// constraint errors zero to first order, A must match central differences of
+// the state derivatives along it, and A must have the same dynamics as the
+// ball mobilizer's.
+void testConstrainedFree() {
+    MultibodySystem system;
+    SimbodyMatterSubsystem matter(system);
+    GeneralForceSubsystem forces(system);
+    Force::Gravity(forces, matter, -YAxis, G);
+    MobilizedBody::Free bobBody(matter.Ground(), bob());
+    Constraint::Ball(matter.Ground(), Vec3(0), bobBody, Vec3(0,Length,0));
+    system.realizeTopology();
+    State state = system.getDefaultState();
+    bobBody.setQToFitTranslation(state, Vec3(0,-Length,0));
+    SimTK_TEST(state.getNQ() == 7 && state.getNU() == 6);
+
+    Linearizer lin(system);
+    lin.addAllMobilityInputs();
+    Matrix A, B, C, D;
+    lin.linearize(state, A, B, C, D);
+    SimTK_TEST(A.nrow() == 6 && A.ncol() == 6 && B.ncol() == 6);
+
+    const int nu = state.getNU();
+    const Matrix& Z = lin.getStateBasis();
+    SimTK_TEST(Z.nrow() == 2*nu && Z.ncol() == 6);
+    SimTK_TEST_EQ(~Z*Z, Matrix(Mat66(1)));
+
+    system.realize(state, Stage::Acceleration);
+    Matrix P;
+    matter.calcP(state, P);
+    SimTK_TEST_EQ_TOL(P*Z(0, 0, nu, Z.ncol()), Matrix(3, 6, Real(0)), 1e-10);
+
+    // The state derivative (dtheta/dt, udot) at the operating point plus
+    // x, where dq = N*dtheta.
+    auto xdot = [&](const Vector& x) {
+        State s = state;
+        Vector dq;
+        matter.multiplyByN(state, false, x(0,nu), dq);
+        s.updQ() = state.getQ() + dq;
+        s.updU() = state.getU() + x(nu,nu);
+        system.realize(s, Stage::Acceleration);
+        Vector dtheta, result(2*nu);
+        matter.multiplyByNInv(state, false, s.getQDot(), dtheta);
+        result(0,nu) = dtheta;
+        result(nu,nu) = s.getUDot();
+        return result;
+    };
+    const Real h = 1e-5;
+    Matrix Afd(Z.ncol(), Z.ncol());
+    for (int j=0; j < Z.ncol(); ++j)
+        Afd(j) = ~Z * ((xdot(h*Z(j)) - xdot(-h*Z(j))) / (2*h));
+    SimTK_TEST_EQ_TOL(A, Afd, 1e-5);
+
+    // Two swinging modes and the free spin about the rod, as for the ball
+    // mobilizer: the traces of A^2 and A^4 are 4*swing and 4*swing^2.
+    const Real swing = -Mass*G*Length/(Mass*(Radius*Radius+Length*Length));
+    const Matrix A2 = A*A;
+    Real trace2 = 0, trace4 = 0;
+    const Matrix A4 = A2*A2;
+    for (int i=0; i < A.nrow(); ++i) {
+        trace2 += A2(i,i);
+        trace4 += A4(i,i);
+    }
+    SimTK_TEST_EQ_TOL(trace2, 4*swing, 1e-5);
+    SimTK_TEST_EQ_TOL(trace4, 4*swing*swing, 1e-4);
+}
+
+// A chain with springs gives the same matrices whatever the number of
+// threads.
+void testThreads() {
+    MultibodySystem system;
+    SimbodyMatterSubsystem matter(system);
+    GeneralForceSubsystem forces(system);
+    Force::Gravity(forces, matter, -YAxis, G);
+    MobilizedBody parent = matter.Ground();
+    for (int i=0; i < 20; ++i) {
+        parent = MobilizedBody::Gimbal(parent, Vec3(0,-.2,0), bob(), Vec3(0));
+        Force::MobilityLinearSpring(forces, parent, MobilizerQIndex(0),
+                                    10, .1);
+    }
+    system.realizeTopology();
+    State state = system.getDefaultState();
+    state.updQ() = .05;
+    state.updU() = .1;
+
+    Linearizer lin(system);
+    lin.addAllMobilityInputs();
+    Matrix A1, B1, C1, D1;
+    double t0 = realTime();
+    lin.linearize(state, A1, B1, C1, D1);
+    cout << "1 thread: " << 1e3*(realTime()-t0) << "ms" << endl;
+    lin.setNumThreads(4);
+    Matrix A4, B4, C4, D4;
+    t0 = realTime();
+    lin.linearize(state, A4, B4, C4, D4);
+    cout << "4 threads: " << 1e3*(realTime()-t0) << "ms" << endl;
+    SimTK_TEST(A4.nrow() == 120 && B4.ncol() == 60);
+    SimTK_TEST(isSame(A4, A1));
+    SimTK_TEST(isSame(B4, B1));
+}
+
+int main() {
+    SimTK_START_TEST("TestLinearizer");
+        SimTK_SUBTEST(testPin);
+        SimTK_SUBTEST(testBall);
+        SimTK_SUBTEST(testRod);
+        SimTK_SUBTEST(testConstrainedFree);
+        SimTK_SUBTEST(testThreads);
+    SimTK_END_TEST();
+}
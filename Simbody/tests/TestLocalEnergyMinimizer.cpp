@@ -0,0 +1,167 @@
+/* -------------------------------------------------------------------------- *
+ *                               Simbody(tm)                                  *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Tests LocalEnergyMinimizer with both of its methods on a constrained model
+with quaternions, mobility springs and point springs. */
+
+#include "SimTKsimbody.h"
+#include "SimTKcommon/Testing.h"
+
+#include <iostream>
+
+using namespace SimTK;
+using std::cout;
+using std::endl;
+
+namespace {
+// A chain of pins with mobility springs and a chain of balls with a point
+// spring, hanging under gravity and joined at their ends by a rod.
+struct Model {
+    explicit Model(int nBalls=3) : matter(system), forces(system) {
+        Force::Gravity(forces, matter, -YAxis, 9.8);
+        Body::Rigid body(MassProperties(1, Vec3(0), UnitInertia(.1)));
+        MobilizedBody parent = matter.Ground();
+        for (int i=0; i < 4; ++i) {
+            parent = MobilizedBody::Pin(parent, Vec3(0,-.5,0), body, Vec3(0));
+            Force::MobilityLinearSpring(forces, parent, MobilizerQIndex(0),
+                                        20, .3);
+        }
+        MobilizedBody pinTip = parent;
+        parent = matter.Ground();
+        for (int i=0; i < nBalls; ++i) {
+            parent = MobilizedBody::Ball(parent, Vec3(i ? 0 : 1,-.5,0),
+                                         body, Vec3(0));
+            balls.push_back(parent);
+        }
+        Force::TwoPointLinearSpring(forces, matter.Ground(), Vec3(3,0,0),
+                                    parent, Vec3(0), 15, .5);
+        Constraint::Rod(pinTip, Vec3(0), balls[1], Vec3(0), 1.2);
+        system.realizeTopology();
+    }
+
+    // A state that satisfies the constraints.
+    State makeState() const {
+        State s = system.getDefaultState();
+        Random::Uniform random(-.2, .2); random.setSeed(5);
+        for (int i=0; i < s.getNQ(); ++i) s.updQ()[i] += random.getValue();
+        system.project(s, 1e-10);
+        return s;
+    }
+
+    // The largest generalized force not resisted by the constraints.
+    Real calcMaxUnresistedForce(const State& state) const {
+        State s = state;
+        s.updU() = 0;
+        system.realize(s, Stage::Acceleration);
+        Vector f;
+        matter.multiplyByM(s, s.getUDot(), f);
+        return max(abs(f));
+    }
+
+    MultibodySystem         system;
+    SimbodyMatterSubsystem  matter;
+    GeneralForceSubsystem   forces;
+    Array_<MobilizedBody>   balls;
+};
+}
+
+void testMethodsAgree() {
+    Model model;
+    const State start = model.makeState();
+    model.system.realize(start, Stage::Dynamics);
+    const Real e0 = model.system.calcPotentialEnergy(start);
+
+    State sOpt = start;
+    LocalEnergyMinimizer::minimizeEnergy(model.system, sOpt, 1e-8);
+    State sFire = start;
+    LocalEnergyMinimizer::minimizeEnergy(model.system, sFire, 1e-8,
+        LocalEnergyMinimizer::FastInertialRelaxation);
+
+    const Real eOpt = model.system.calcPotentialEnergy(sOpt);
+    const Real eFire = model.system.calcPotentialEnergy(sFire);
+    cout << "energy: start " << e0 << ", optimizer " << eOpt
+         << ", FIRE " << eFire << endl;
+    SimTK_TEST(eOpt < e0);
+    SimTK_TEST_EQ_TOL(eOpt, eFire, 1e-8);
+
+    SimTK_TEST(max(abs(sOpt.getQErr())) < 1e-8);
+    SimTK_TEST(max(abs(sFire.getQErr())) < 1e-8);
+    SimTK_TEST(model.calcMaxUnresistedForce(sOpt) < 1e-5);
+    SimTK_TEST(model.calcMaxUnresistedForce(sFire) <= 1e-8);
+
+    // The quaternions weren't converted.
+    SimTK_TEST(!model.matter.getUseEulerAngles(sFire));
+    for (const MobilizedBody& ball : model.balls) {
+        SimTK_TEST_EQ_TOL(ball.getQAsVector(sOpt).norm(), 1, 1e-9);
+        SimTK_TEST_EQ_TOL(ball.getQAsVector(sFire).norm(), 1, 1e-9);
+    }
+
+    // Both also work with Euler angles.
+    State sEuler = start;
+    model.matter.setUseEulerAngles(sEuler, true);
+    model.system.realizeModel(sEuler);
+    model.matter.convertToEulerAngles(start, sEuler);
+    State sEulerFire = sEuler;
+    LocalEnergyMinimizer::minimizeEnergy(model.system, sEuler, 1e-8);
+    LocalEnergyMinimizer::minimizeEnergy(model.system, sEulerFire, 1e-8,
+        LocalEnergyMinimizer::FastInertialRelaxation);
+    SimTK_TEST_EQ_TOL(model.system.calcPotentialEnergy(sEuler), eOpt, 1e-8);
+    SimTK_TEST_EQ_TOL(model.system.calcPotentialEnergy(sEulerFire), eOpt, 1e-8);
+}
+
+void testMaxIterations() {
+    Model model;
+    State s = model.makeState();
+    const Vector q0 = s.getQ();
+    SimTK_TEST_MUST_THROW(LocalEnergyMinimizer::minimizeEnergy(model.system,
+        s, 1e-8, LocalEnergyMinimizer::FastInertialRelaxation, 3));
+    SimTK_TEST_EQ(s.getQ(), q0);
+    SimTK_TEST_MUST_THROW(LocalEnergyMinimizer::minimizeEnergy(model.system,
+        s, 1e-8, LocalEnergyMinimizer::FastInertialRelaxation, 0));
+}
+
+// Report the times for a longer chain.
+void timeLongChain() {
+    Model model(20);
+    const State start = model.makeState();
+    const LocalEnergyMinimizer::Method methods[] =
+    {   LocalEnergyMinimizer::FastInertialRelaxation,
+        LocalEnergyMinimizer::ConstrainedOptimization };
+    for (LocalEnergyMinimizer::Method method : methods) {
+        State s = start;
+        const double t0 = cpuTime();
+        LocalEnergyMinimizer::minimizeEnergy(model.system, s, 1e-6, method);
+        cout << (method==LocalEnergyMinimizer::FastInertialRelaxation
+                 ? "FIRE" : "optimizer") << ": " << s.getNQ() << " q's, "
+             << 1000*(cpuTime()-t0) << "ms, energy "
+             << model.system.calcPotentialEnergy(s) << endl;
+    }
+}
+
+int main() {
+    SimTK_START_TEST("TestLocalEnergyMinimizer");
+        SimTK_SUBTEST(testMethodsAgree);
+        SimTK_SUBTEST(testMaxIterations);
+        SimTK_SUBTEST(timeLongChain);
+    SimTK_END_TEST();
+}
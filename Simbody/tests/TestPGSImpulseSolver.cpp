@@ -0,0 +1,371 @@
+/* -------------------------------------------------------------------------- *
+ *                               Simbody(tm)                                  *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Tests the graph-colored sweep option of PGSImpulseSolver against the
+default serial sweeps, and solves using a sparse A against the dense ones,
+using a contact-like problem in which each multiplier couples only the few
+"bodies" it touches. */
+
+#include "SimTKsimbody.h"
+#include "SimTKcommon/Testing.h"
+
+using namespace SimTK;
+
+namespace {
+// Make A = G W ~G where each of the nc contacts has a normal and two friction
+// rows acting between two of nb six-dof bodies with diagonal mobility W.
+void makeContactProblem(int nb, int nc, Matrix& A, Vector& rhs) {
+    Random::Uniform rand(-1, 1); rand.setSeed(42);
+    const int n = 6*nb, m = 3*nc;
+    Matrix G(m, n, Real(0));
+    for (int c=0; c < nc; ++c) {
+        const int b1 = c % nb, b2 = (c*7+3) % nb;
+        for (int r=0; r < 3; ++r)
+            for (int j=0; j < 6; ++j) {
+                G(3*c+r, 6*b1+j) = rand.getValue();
+                if (b2 != b1) G(3*c+r, 6*b2+j) = rand.getValue();
+            }
+    }
+    Vector w(n);
+    for (int j=0; j < n; ++j) w[j] = 1 + std::abs(rand.getValue());
+    A.resize(m, m);
+    for (int i=0; i < m; ++i)
+        for (int k=0; k < m; ++k) {
+            Real sum = 0;
+            for (int j=0; j < n; ++j) sum += G(i,j)*w[j]*G(k,j);
+            A(i,k) = sum;
+        }
+    rhs.resize(m);
+    for (int i=0; i < m; ++i) rhs[i] = rand.getValue();
+}
+
+void makeSparse(const Matrix& A, ImpulseSolver::SparseMatrix& sparseA) {
+    sparseA.resize(A.nrow());
+    for (int j=0; j < A.ncol(); ++j)
+        for (int i=0; i < A.nrow(); ++i)
+            if (A(i,j) != 0) sparseA.addToEntry(i, j, A(i,j));
+    sparseA.finalize();
+}
+
+// A few free-floating boxes, each with four corner contacts, starting just
+// above the ground plane by the given height.
+void makeBoxes(GeneralForceSubsystem& forces, SimbodyMatterSubsystem& matter,
+               int nBoxes, Real height = .01) {
+    Force::Gravity(forces, matter, -ZAxis, 9.8);
+    const Vec3 halfSize(.2, .3, .1);
+    const Body::Rigid box(MassProperties(1, Vec3(0),
+                                         UnitInertia::brick(halfSize)));
+    for (int b=0; b < nBoxes; ++b) {
+        MobilizedBody::Free mobod(matter.Ground(), 
+            Transform(Rotation(height ? .05*b : 0, XAxis), 
+                      Vec3(b, 0, halfSize[2] + height)), box, Vec3(0));
+        for (int i=-1; i<=1; i+=2)
+        for (int j=-1; j<=1; j+=2) {
+            const Vec3 pt(i*halfSize[0], j*halfSize[1], -halfSize[2]);
+            matter.adoptUnilateralContact(new PointPlaneContact
+               (matter.Ground(), ZAxis, 0., mobod, pt, 0, .5, .4, 0));
+        }
+    }
+}
+}
+
+void testSparseMatrix() {
+    ImpulseSolver::SparseMatrix A(3);
+    A.addToEntry(2, 0, 1.5); A.addToEntry(0, 2, 1.5);
+    A.addToEntry(1, 1, 2);   A.addToEntry(1, 1, 3); // duplicates sum
+    A.addToEntry(0, 0, 4);
+    SimTK_TEST(!A.isFinalized());
+    A.finalize();
+    SimTK_TEST(A.getNumNonzeros() == 4);
+    SimTK_TEST(A.getEntry(1,1) == 5);
+    SimTK_TEST(A.getEntry(0,2) == 1.5);
+    SimTK_TEST(A.getEntry(1,2) == 0);
+
+    // Adding after finalize() merges with what's there.
+    A.addToEntry(1, 2, -1); A.addToEntry(2, 1, -1); A.addToEntry(0, 0, 1);
+    A.finalize();
+    SimTK_TEST(A.getNumNonzeros() == 6);
+    Matrix dense;
+    A.toDense(dense);
+    Matrix expected(3,3, Real(0));
+    expected(0,0) = 5; expected(1,1) = 5; 
+    expected(0,2) = expected(2,0) = 1.5; expected(1,2) = expected(2,1) = -1;
+    SimTK_TEST_EQ(dense, expected);
+
+    const Vector x = Test::randVector(3);
+    Vector Ax;
+    A.multiply(x, Ax);
+    SimTK_TEST_EQ(Ax, expected*x);
+}
+
+void testBilateral() {
+    Matrix A; Vector rhs;
+    makeContactProblem(40, 30, A, rhs);
+    const int m = A.nrow();
+    Vector D(m, Real(1e-3)); // make it nonsingular
+    Array_<MultiplierIndex> participating;
+    for (MultiplierIndex mx(0); mx < m; ++mx) participating.push_back(mx);
+
+    PGSImpulseSolver serial(1e-3), colored1(1e-3), colored4(1e-3);
+    serial.setMaxIterations(10000); serial.setConvergenceTol(1e-12);
+    colored1.setMaxIterations(10000); colored1.setConvergenceTol(1e-12);
+    colored4.setMaxIterations(10000); colored4.setConvergenceTol(1e-12);
+    colored1.enableColoredSweeps(1);
+    colored4.enableColoredSweeps(4);
+    SimTK_TEST(colored4.isUsingColoredSweeps());
+
+    Vector piS, pi1, pi4;
+    SimTK_TEST(serial.solveBilateral(participating, A, D, rhs, piS));
+    SimTK_TEST(colored1.solveBilateral(participating, A, D, rhs, pi1));
+    SimTK_TEST(colored4.solveBilateral(participating, A, D, rhs, pi4));
+
+    // Sparse coupling should need far fewer colors than multipliers.
+    SimTK_TEST(colored1.getNumColorsInLastSolve() < m/2);
+
+    // Unique solution; colored sweeps are bitwise independent of threads.
+    SimTK_TEST_EQ_TOL(pi1, piS, 1e-8);
+    for (int i=0; i < m; ++i)
+        SimTK_TEST(pi1[i] == pi4[i]);
+}
+
+void testFrictionalContact() {
+    Matrix A; Vector rhs;
+    const int nc = 30;
+    makeContactProblem(40, nc, A, rhs);
+    const int m = A.nrow();
+    Vector D(m, Real(1e-3));
+
+    Array_<MultiplierIndex> participating;
+    Array_<ImpulseSolver::UniContactRT> uniContact(nc);
+    for (int c=0; c < nc; ++c) {
+        ImpulseSolver::UniContactRT& rt = uniContact[c];
+        rt.m_Nk = MultiplierIndex(3*c+2);
+        rt.m_Fk.push_back(MultiplierIndex(3*c));
+        rt.m_Fk.push_back(MultiplierIndex(3*c+1));
+        rt.m_sign = 1; rt.m_type = ImpulseSolver::Participating;
+        rt.m_effMu = .5;
+        for (int r=0; r < 3; ++r) participating.push_back(MultiplierIndex(3*c+r));
+    }
+
+    Array_<ImpulseSolver::UncondRT>                 noUncond;
+    Array_<ImpulseSolver::UniSpeedRT>               noUniSpeed;
+    Array_<ImpulseSolver::BoundedRT>                noBounded;
+    Array_<ImpulseSolver::ConstraintLtdFrictionRT>  noConsLtd;
+    Array_<ImpulseSolver::StateLtdFrictionRT>       noStateLtd;
+    Array_<MultiplierIndex> noExpanding;
+
+    Vector pi[2]; Array_<ImpulseSolver::UniContactRT> results[2];
+    for (int threads=1; threads <= 2; ++threads) {
+        PGSImpulseSolver solver(1e-3);
+        solver.enableColoredSweeps(threads == 1 ? 1 : 3);
+        Vector piExpand(m, Real(0)), verr = rhs, verrApplied;
+        results[threads-1] = uniContact;
+        solver.solve(0, participating, A, D, noExpanding, piExpand, verr,
+                     verrApplied, pi[threads-1], noUncond,
+                     results[threads-1], noUniSpeed, noBounded,
+                     noConsLtd, noStateLtd);
+    }
+
+    for (int i=0; i < m; ++i)
+        SimTK_TEST(pi[0][i] == pi[1][i]);
+    for (int c=0; c < nc; ++c) {
+        const ImpulseSolver::UniContactRT& rt = results[0][c];
+        // Normal pushes, friction stays inside its cone.
+        SimTK_TEST(pi[0][rt.m_Nk] <= 0);
+        const Real F = Vec2(pi[0][rt.m_Fk[0]], pi[0][rt.m_Fk[1]]).norm();
+        SimTK_TEST(F <= rt.m_effMu*std::abs(pi[0][rt.m_Nk]) + 1e-12);
+        SimTK_TEST(rt.m_contactCond == results[1][c].m_contactCond);
+    }
+}
+
+// Solving with a sparse A should match solving with the equivalent dense
+// one: exactly when both use colored sweeps, which perform the same
+// operations, and to within tolerance otherwise.
+void testSparseSolve() {
+    Matrix A; Vector rhs;
+    const int nc = 30;
+    makeContactProblem(40, nc, A, rhs);
+    const int m = A.nrow();
+    Vector D(m, Real(1e-3));
+    ImpulseSolver::SparseMatrix sparseA;
+    makeSparse(A, sparseA);
+    SimTK_TEST(sparseA.getNumNonzeros() < m*m/2);
+
+    Array_<MultiplierIndex> participating;
+    for (MultiplierIndex mx(0); mx < m; ++mx) participating.push_back(mx);
+
+    PGSImpulseSolver serial(1e-3), colored(1e-3);
+    serial.setMaxIterations(10000); serial.setConvergenceTol(1e-12);
+    colored.setMaxIterations(10000); colored.setConvergenceTol(1e-12);
+    colored.enableColoredSweeps(2);
+    Vector piDense, piSparse, piColoredDense, piColoredSparse;
+    SimTK_TEST(serial.solveBilateral(participating, A, D, rhs, piDense));
+    SimTK_TEST(serial.solveBilateral(participating, sparseA, D, rhs, piSparse));
+    SimTK_TEST(colored.solveBilateral(participating, A, D, rhs, 
+                                      piColoredDense));
+    SimTK_TEST(colored.solveBilateral(participating, sparseA, D, rhs, 
+                                      piColoredSparse));
+    SimTK_TEST_EQ_TOL(piSparse, piDense, 1e-8);
+    for (int i=0; i < m; ++i)
+        SimTK_TEST(piColoredSparse[i] == piColoredDense[i]);
+
+    // PLUS just expands the sparse A.
+    PLUSImpulseSolver plus(1e-3);
+    Vector piPlusDense, piPlusSparse;
+    plus.solveBilateral(participating, A, D, rhs, piPlusDense);
+    plus.solveBilateral(participating, sparseA, D, rhs, piPlusSparse);
+    SimTK_TEST_EQ(piPlusSparse, piPlusDense);
+
+    // Conditional solve with contacts and friction.
+    Array_<ImpulseSolver::UniContactRT> uniContact(nc);
+    for (int c=0; c < nc; ++c) {
+        ImpulseSolver::UniContactRT& rt = uniContact[c];
+        rt.m_Nk = MultiplierIndex(3*c+2);
+        rt.m_Fk.push_back(MultiplierIndex(3*c));
+        rt.m_Fk.push_back(MultiplierIndex(3*c+1));
+        rt.m_sign = 1; rt.m_type = ImpulseSolver::Participating;
+        rt.m_effMu = .5;
+    }
+    Array_<ImpulseSolver::UncondRT>                 noUncond;
+    Array_<ImpulseSolver::UniSpeedRT>               noUniSpeed;
+    Array_<ImpulseSolver::BoundedRT>                noBounded;
+    Array_<ImpulseSolver::ConstraintLtdFrictionRT>  noConsLtd;
+    Array_<ImpulseSolver::StateLtdFrictionRT>       noStateLtd;
+    Array_<MultiplierIndex> noExpanding;
+
+    Vector piExpand(m, Real(0)), verrDense = rhs, verrSparse = rhs, 
+           verrApplied, pi1, pi2;
+    Array_<ImpulseSolver::UniContactRT> uni1 = uniContact, uni2 = uniContact;
+    colored.solve(0, participating, A, D, noExpanding, piExpand, verrDense,
+                  verrApplied, pi1, noUncond, uni1, noUniSpeed, noBounded,
+                  noConsLtd, noStateLtd);
+    colored.solve(0, participating, sparseA, D, noExpanding, piExpand, 
+                  verrSparse, verrApplied, pi2, noUncond, uni2, noUniSpeed,
+                  noBounded, noConsLtd, noStateLtd);
+    for (int i=0; i < m; ++i)
+        SimTK_TEST(pi1[i] == pi2[i]);
+    SimTK_TEST_EQ(verrSparse, verrDense);
+    for (int c=0; c < nc; ++c)
+        SimTK_TEST(uni1[c].m_contactCond == uni2[c].m_contactCond);
+}
+
+// The time stepper's sparse A has to give the same motion as its dense one.
+void testSparseImpulseMatrixInTimeStepper() {
+    MultibodySystem system;
+    SimbodyMatterSubsystem matter(system);
+    GeneralForceSubsystem forces(system);
+    makeBoxes(forces, matter, 5);
+    system.realizeTopology();
+
+    State states[2];
+    for (int sparse=0; sparse <= 1; ++sparse) {
+        SemiExplicitEulerTimeStepper ts(system);
+        ts.setImpulseSolverType(SemiExplicitEulerTimeStepper::ColoredPGS);
+        ts.setUseSparseImpulseMatrix(sparse != 0);
+        SimTK_TEST(ts.getUseSparseImpulseMatrix() == (sparse != 0));
+        ts.initialize(system.getDefaultState());
+        for (int i=1; i <= 20; ++i)
+            ts.stepTo(i*.005);
+        states[sparse] = ts.getState();
+    }
+    SimTK_TEST_EQ_TOL(states[1].getQ(), states[0].getQ(), 1e-10);
+    SimTK_TEST_EQ_TOL(states[1].getU(), states[0].getU(), 1e-10);
+    // The boxes came to rest on the ground rather than falling through.
+    system.realize(states[1], Stage::Position);
+    for (MobilizedBodyIndex mbx(1); mbx < matter.getNumBodies(); ++mbx)
+        SimTK_TEST(matter.getMobilizedBody(mbx).getBodyOriginLocation
+                                                    (states[1])[2] > .09);
+}
+
+// Starting from a good guess should take very few iterations.
+void testWarmStart() {
+    Matrix A; Vector rhs;
+    makeContactProblem(40, 30, A, rhs);
+    const int m = A.nrow();
+    Vector D(m, Real(1e-3));
+    Array_<MultiplierIndex> participating;
+    for (MultiplierIndex mx(0); mx < m; ++mx) participating.push_back(mx);
+
+    PGSImpulseSolver solver(1e-3);
+    solver.setMaxIterations(10000); solver.setConvergenceTol(1e-10);
+    SimTK_TEST(!solver.getUseWarmStart());
+    Vector pi;
+    SimTK_TEST(solver.solveBilateral(participating, A, D, rhs, pi));
+    const long long coldIters = solver.getNumBilateralIterations();
+    SimTK_TEST(coldIters > 10);
+
+    // Perturb the solution slightly and start from there.
+    const Vector piCold = pi;
+    pi *= 1 + 1e-6;
+    solver.setUseWarmStart(true);
+    SimTK_TEST(solver.solveBilateral(participating, A, D, rhs, pi));
+    const long long warmIters = solver.getNumBilateralIterations() - coldIters;
+    SimTK_TEST(warmIters < coldIters/2);
+    SimTK_TEST_EQ_TOL(pi, piCold, 1e-7);
+
+    // A wrong-sized guess is ignored.
+    pi.resize(3);
+    SimTK_TEST(solver.solveBilateral(participating, A, D, rhs, pi));
+    SimTK_TEST(solver.getNumBilateralIterations() - coldIters - warmIters 
+               == coldIters);
+}
+
+// Resting boxes: warm starting the time stepper's impulse solves from the 
+// previous step's contact forces should give the same motion with far fewer
+// PGS iterations.
+void testWarmStartInTimeStepper() {
+    MultibodySystem system;
+    SimbodyMatterSubsystem matter(system);
+    GeneralForceSubsystem forces(system);
+    makeBoxes(forces, matter, 3, 0);
+    system.realizeTopology();
+
+    State states[2]; long long iters[2];
+    for (int warm=0; warm <= 1; ++warm) {
+        SemiExplicitEulerTimeStepper ts(system);
+        PGSImpulseSolver* pgs = 
+            new PGSImpulseSolver(ts.getDefaultFrictionTransitionVelocityInUse());
+        pgs->setConvergenceTol(1e-8); pgs->setMaxIterations(1000);
+        ts.setImpulseSolver(pgs);
+        ts.setUseWarmStart(warm != 0);
+        ts.initialize(system.getDefaultState());
+        for (int i=1; i <= 50; ++i)
+            ts.stepTo(i*.002);
+        states[warm] = ts.getState();
+        iters[warm] = ts.getImpulseSolver().getNumIterations(0);
+    }
+    SimTK_TEST(iters[1] < iters[0]/2);
+    SimTK_TEST_EQ_TOL(states[1].getQ(), states[0].getQ(), 1e-6);
+}
+
+int main() {
+    SimTK_START_TEST("TestPGSImpulseSolver");
+        SimTK_SUBTEST(testBilateral);
+        SimTK_SUBTEST(testFrictionalContact);
+        SimTK_SUBTEST(testSparseMatrix);
+        SimTK_SUBTEST(testSparseSolve);
+        SimTK_SUBTEST(testSparseImpulseMatrixInTimeStepper);
+        SimTK_SUBTEST(testWarmStart);
+        SimTK_SUBTEST(testWarmStartInTimeStepper);
+    SimTK_END_TEST();
+}
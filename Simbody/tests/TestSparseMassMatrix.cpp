@@ -0,0 +1,189 @@
+/* -------------------------------------------------------------------------- *
+ *                               Simbody(tm)                                  *
+ * -------------------------------------------------------------------------- *
+ * This is part of the SimTK biosimulation toolkit originating from           *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org/home/simbody.  *
+ *                                                                            *
+ * Portions copyright (c) 2026 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/* Tests SimbodyMatterSubsystem::calcSparseM() against the O(n) operators, and
+the in-place sparse factorizations of the result. */
+
+#include "SimTKsimbody.h"
+#include "SimTKcommon/Testing.h"
+
+using namespace SimTK;
+
+namespace {
+// Two branched trees with a mix of mobilizer types, including a weld in the
+// middle of a branch.
+void makeTrees(SimbodyMatterSubsystem& matter) {
+    Body::Rigid body(MassProperties(1.3, Vec3(.1,.2,-.05),
+                                    UnitInertia(1.2,1.1,1,.1,-.05,.02)));
+    for (int t=0; t < 2; ++t) {
+        MobilizedBody::Free base(matter.Ground(), Vec3(t,0,0),
+                                 body, Vec3(0,.3,0));
+        MobilizedBody::Pin left(base, Vec3(.2,-.1,0), body, Vec3(0,.5,.1));
+        MobilizedBody::Ball leftTip(left, Vec3(0,-.4,.1), body, Vec3(.1,.3,0));
+        MobilizedBody::Weld glued(base, Vec3(-.2,-.1,0), body, Vec3(0,.2,0));
+        MobilizedBody::Universal right(glued, Vec3(0,-.3,0),
+                                       body, Vec3(0,.4,0));
+        MobilizedBody::Slider rightTip(right, Vec3(0,-.2,.1),
+                                       body, Vec3(.05,0,0));
+        MobilizedBody::Gimbal other(base, Vec3(0,0,.3), body, Vec3(0,.1,0));
+    }
+}
+
+void setRandomState(const MultibodySystem& system, State& state) {
+    Random::Uniform rand(-1, 1); rand.setSeed(7);
+    for (int i=0; i < state.getNQ(); ++i) state.updQ()[i] = rand.getValue();
+    system.realize(state, Stage::Position);
+}
+}
+
+void testStructure() {
+    // Pinned chain of 3 on a pinned base, plus a second branch of 2 off the
+    // base: mobilities 0 | 1 2 3 | 4 5.
+    Array_<int> parent;
+    parent.push_back(-1);
+    parent.push_back(0); parent.push_back(1); parent.push_back(2);
+    parent.push_back(0); parent.push_back(4);
+    SparseMassMatrix M;
+    M.setStructure(parent);
+    SimTK_TEST(M.nrow() == 6);
+    SimTK_TEST(M.getNumNonzeros() == 1+2+3+4+2+3);
+    SimTK_TEST(!M.isFactored());
+    M.updValues()[M.getRowStarts()[5]+1] = 2.5; // (5,4)
+    SimTK_TEST(M.getEntry(5,4) == 2.5);
+    SimTK_TEST(M.getEntry(4,5) == 2.5);
+    SimTK_TEST(M.getEntry(5,3) == 0); // different branches
+
+    parent[3] = 3; // not allowed
+    SimTK_TEST_MUST_THROW(M.setStructure(parent));
+}
+
+void testAgainstOperators() {
+    MultibodySystem system;
+    SimbodyMatterSubsystem matter(system);
+    makeTrees(matter);
+    State state = system.realizeTopology();
+    setRandomState(system, state);
+    const int n = state.getNU();
+
+    SparseMassMatrix sparseM;
+    matter.calcSparseM(state, sparseM);
+    SimTK_TEST(sparseM.nrow() == n);
+    // Each tree has its own block and the branches are uncoupled.
+    SimTK_TEST(2*sparseM.getNumNonzeros() < n*(n+1)/2);
+
+    // Build M column by column the old way.
+    Matrix Mref(n,n); Vector e(n, Real(0));
+    for (int i=0; i < n; ++i) {
+        e[i] = 1;
+        Vector col;
+        matter.multiplyByM(state, e, col);
+        Mref(i) = col;
+        e[i] = 0;
+    }
+
+    Matrix Msparse;
+    sparseM.toDense(Msparse);
+    SimTK_TEST_EQ_SIZE(Msparse, Mref, n);
+    Matrix M;
+    matter.calcM(state, M);
+    SimTK_TEST_EQ_SIZE(M, Mref, n);
+
+    Random::Uniform rand(-1, 1); rand.setSeed(11);
+    Vector v(n);
+    for (int i=0; i < n; ++i) v[i] = rand.getValue();
+    Vector Mv, Mvref;
+    sparseM.multiply(v, Mv);
+    matter.multiplyByM(state, v, Mvref);
+    SimTK_TEST_EQ_SIZE(Mv, Mvref, n);
+
+    // Recalculating at a new configuration reuses the structure.
+    state.updQ() *= Real(.5);
+    system.realize(state, Stage::Position);
+    matter.calcSparseM(state, sparseM);
+    matter.calcM(state, M);
+    sparseM.toDense(Msparse);
+    SimTK_TEST_EQ_SIZE(Msparse, M, n);
+}
+
+void testFactorizations() {
+    MultibodySystem system;
+    SimbodyMatterSubsystem matter(system);
+    makeTrees(matter);
+    State state = system.realizeTopology();
+    setRandomState(system, state);
+    const int n = state.getNU();
+
+    Random::Uniform rand(-1, 1); rand.setSeed(3);
+    Vector f(n);
+    for (int i=0; i < n; ++i) f[i] = rand.getValue();
+    Vector MInvf;
+    matter.multiplyByMInv(state, f, MInvf);
+
+    SparseMassMatrix L, LD;
+    matter.calcSparseM(state, L);
+    LD = L;
+    L.factorLTL();
+    LD.factorLTDL();
+    SimTK_TEST(L.getContents() == SparseMassMatrix::LTL);
+    SimTK_TEST(LD.getContents() == SparseMassMatrix::LTDL);
+    SimTK_TEST_MUST_THROW(L.factorLTL());
+    Vector x;
+    SimTK_TEST_MUST_THROW(L.multiply(f, x));
+
+    L.solve(f, x);
+    SimTK_TEST_EQ_SIZE(x, MInvf, n);
+    x = f;
+    LD.solve(x, x); // in place
+    SimTK_TEST_EQ_SIZE(x, MInvf, n);
+
+    // Reassemble M from the factors.
+    Matrix M, Ld, LDd;
+    matter.calcM(state, M);
+    L.toDense(Ld);
+    SimTK_TEST_EQ_SIZE(~Ld*Ld, M, n);
+    LD.toDense(LDd);
+    Matrix U(n,n, Real(0)), DU(n,n, Real(0));
+    for (int i=0; i < n; ++i) {
+        for (int j=0; j < i; ++j) U(i,j) = LDd(i,j);
+        U(i,i) = 1;
+        DU[i] = LDd(i,i)*U[i];
+    }
+    SimTK_TEST_EQ_SIZE(~U*DU, M, n);
+
+    // Not positive definite.
+    SparseMassMatrix bad;
+    matter.calcSparseM(state, bad);
+    bad.updValues()[0] = -1;
+    SimTK_TEST_MUST_THROW(bad.factorLTDL());
+    SparseMassMatrix unfactored;
+    matter.calcSparseM(state, unfactored);
+    SimTK_TEST_MUST_THROW(unfactored.solve(f, x));
+}
+
+int main() {
+    SimTK_START_TEST("TestSparseMassMatrix");
+        SimTK_SUBTEST(testStructure);
+        SimTK_SUBTEST(testAgainstOperators);
+        SimTK_SUBTEST(testFactorizations);
+    SimTK_END_TEST();
+}
@@ -0,0 +1,415 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/Platform/CMakeLists.txt"
+  "/root/repo/SimTKcommon/CMakeLists.txt"
+  "/root/repo/SimTKcommon/sharedTarget/CMakeLists.txt"
+  "/root/repo/SimTKcommon/tests/CMakeLists.txt"
+  "/root/repo/SimTKcommon/tests/adhoc/CMakeLists.txt"
+  "/root/repo/SimTKmath/CMakeLists.txt"
+  "/root/repo/SimTKmath/Geometry/CMakeLists.txt"
+  "/root/repo/SimTKmath/Integrators/CMakeLists.txt"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/CMakeLists.txt"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/CMakeLists.txt"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/tests/CMakeLists.txt"
+  "/root/repo/SimTKmath/LinearAlgebra/CMakeLists.txt"
+  "/root/repo/SimTKmath/Optimizers/CMakeLists.txt"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/CMakeLists.txt"
+  "/root/repo/SimTKmath/Optimizers/src/c-cmaes/CMakeLists.txt"
+  "/root/repo/SimTKmath/sharedTarget/CMakeLists.txt"
+  "/root/repo/SimTKmath/tests/CMakeLists.txt"
+  "/root/repo/SimTKmath/tests/adhoc/CMakeLists.txt"
+  "/root/repo/Simbody/CMakeLists.txt"
+  "/root/repo/Simbody/sharedTarget/CMakeLists.txt"
+  "/root/repo/Simbody/tests/CMakeLists.txt"
+  "/root/repo/Simbody/tests/adhoc/CMakeLists.txt"
+  "/root/repo/Simbody/tests/adhoc/CableOverBicubicSurfaces-femur.vtp"
+  "/root/repo/Simbody/tests/adhoc/CableOverBicubicSurfaces-tibia.vtp"
+  "/root/repo/Simbody/tests/adhoc/ContactBigMeshes_Femur.obj"
+  "/root/repo/Simbody/tests/adhoc/ContactBigMeshes_Patella.obj"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/SimbodyConfig.cmake.in"
+  "/root/repo/cmake/cmake_uninstall.cmake.in"
+  "/root/repo/cmake/pkgconfig/simbody.pc.in"
+  "/root/repo/doc/CMakeLists.txt"
+  "/root/repo/doc/Doxyfile.in"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompilerABI.c"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompilerABI.cpp"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Bruce-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Comeau-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-C-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-CXX-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SDCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TinyCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Dart.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindBLAS.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDart.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLAPACK.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-Determine-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "DartConfiguration.tcl"
+  "cmake/cmake_uninstall.cmake"
+  "cmake/SimbodyConfigForInstall.cmake"
+  "cmake/SimbodyConfigVersion.cmake"
+  "cmake/pkgconfig/simbody.pc"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doc/Doxyfile"
+  "doc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Platform/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKcommon/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKcommon/sharedTarget/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKcommon/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKcommon/tests/adhoc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKmath/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKmath/LinearAlgebra/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKmath/Integrators/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKmath/Integrators/src/CPodes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKmath/Integrators/src/CPodes/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKmath/Optimizers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKmath/Optimizers/src/IpOpt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKmath/Optimizers/src/c-cmaes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKmath/Geometry/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKmath/sharedTarget/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKmath/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "SimTKmath/tests/adhoc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Simbody/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Simbody/sharedTarget/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Simbody/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Simbody/tests/adhoc/CableOverBicubicSurfaces-femur.vtp"
+  "Simbody/tests/adhoc/CableOverBicubicSurfaces-tibia.vtp"
+  "Simbody/tests/adhoc/ContactBigMeshes_Femur.obj"
+  "Simbody/tests/adhoc/ContactBigMeshes_Patella.obj"
+  "Simbody/tests/adhoc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/RUN_TESTS_PARALLEL.dir/DependInfo.cmake"
+  "CMakeFiles/PlatformFiles.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "doc/CMakeFiles/doxygen.dir/DependInfo.cmake"
+  "Platform/CMakeFiles/PlatformFiles_subdir.dir/DependInfo.cmake"
+  "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/BNTTest.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/MatVecTest.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/OrientationTest.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/PolynomialTest.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/RandomTest.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/RotationTest.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/SFMTTest.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/SpatialAlgebraTest.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/StateTest.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestArray.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestAtomic.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestBigMatrix.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestCloneOnWritePtr.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestFunction.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestIteratorRange.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestMassProperties.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestMatrixAllocator.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestMeasureDelay.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestNiceTypeName.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestParallel2DExecutor.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestParallelExecutor.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestParallelWorkQueue.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestPlugin.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestPolygonalMesh.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestPrivateImplementation.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestScalar.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestSimulation.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestSmallArray.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestSmallMatrix.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestSmallMatrixBatch.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestSmallMatrixSIMD.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestVectorMath.dir/DependInfo.cmake"
+  "SimTKcommon/tests/CMakeFiles/TestXml.dir/DependInfo.cmake"
+  "SimTKcommon/tests/adhoc/CMakeFiles/BigMatrixTest.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/cpsAdvDiff_bnd.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/cpsAdvDiff_bndL.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/cpsAdvDiff_non.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/cpsNewtCrd_dns.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/cpsPend_dns.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/cpsPend_dnsL.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/cpsRoberts_dns.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/cpsRoberts_dnsL.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/cpsVanDPol_non.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/cpsadamsx.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/cpsbanx.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/cpsbanx_lap.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/cpsdenx.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/cpsdenx_lap.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/initroot1.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/newton.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/pend.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/pendEs.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/pendLr.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/pend_test.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/tests/CMakeFiles/CpsAdamsXCpp.dir/DependInfo.cmake"
+  "SimTKmath/Integrators/src/CPodes/tests/CMakeFiles/PendLrCpp.dir/DependInfo.cmake"
+  "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/BestAvailableTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/CMAESTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/CPodesIntegratorTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/DifferentiatorTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/EigenTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/ExplicitEulerIntegratorTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/FactorCholeskyTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/FactorLUTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/FactorQTZTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/FactorSVDTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/IntegratorTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/IpoptDiffTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/IpoptTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/LBFGSBDiffTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/LBFGSBTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/LBFGSDiffTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/LBFGSTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/RungeKutta2IntegratorTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/RungeKutta3IntegratorTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/RungeKuttaFeldbergIntegratorTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/RungeKuttaMersonIntegratorTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/SemiExplicitEuler2IntegratorTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/SemiExplicitEulerIntegratorTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/SimpleDifferentiatorTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/TestBicubicSurface.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/TestContactGeometry.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/TestDifferentiatorThreads.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/TestGeo.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/TestMultibodyGraphMaker.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/TestParallelOptimizerDerivatives.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/TestSparseDerivatives.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/TestSpline.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/TestTriangleMesh.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/TimeStepperTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/CMakeFiles/VerletIntegratorTest.dir/DependInfo.cmake"
+  "SimTKmath/tests/adhoc/CMakeFiles/nlpqlp.dir/DependInfo.cmake"
+  "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/GazeboBasicControllerResponse.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/GazeboInelasticCollision.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/GazeboReactionForce.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/GazeboReactionForceWithAppliedForceCompliant.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/GazeboReactionForceWithAppliedForceRigid.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestAngleConversions.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestAssemblerTrackTrial.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestCableTrackerThreads.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestCollisionDetectionAlgorithm.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestConstraints.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestContactForceThreads.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestCustomConstraints.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestCustomMobilizedBodies.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestElasticFoundationForce.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestEventLocalization.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestForceReduction.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestForces.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestFunctionBasedMobilizedBodies.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestGravity.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestHuntCrossleyForce.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestIncrementalPositionKinematics.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestLinearBushing.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestLinearizer.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestLocalEnergyMinimizer.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestLoneParticle.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestMassMatrix.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestMobilizedBody.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestMobilizerReactionForces.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestNoseHooverThermostat.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestObservedPointFitter.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestOrientedBoundingBox.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestPGSImpulseSolver.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestParallelForces.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestPimpl1.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestReverseMobilizers.dir/DependInfo.cmake"
+  "Simbody/tests/CMakeFiles/TestSparseMassMatrix.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/BilateralContactConstraints.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/CableOverBicubicSurfaces.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/CoarseRNA.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/CompliantBlockImpact.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/ContactBigMeshes.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/ContactBrickTest.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/ContactTest.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/ElasticFoundation.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/FreeWater.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/GeometryPlayground.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/JunkMain1.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/JunkMain2.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/LockUnlockConstraint.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/LookAtPolygonalMesh.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/MiscConstraints.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/MovingMusclePointMomentArm.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/OpenSimPartyDemoCable.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/ParallelIpoptTest.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/PassThrough.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/PendulumExample.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/PrescribedMotionPlayground.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/RadusDrifter.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/RattleBack_ReverseEllipsoid.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/RigidContact1.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/SBPendulum1.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/SphericalCoordsMobilizerTest.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/TestMultibodyPerformance.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/TestPLUS_SingleBrick.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/TestRiboseMobilizer.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/TestThermostat.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/TimsBox.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/TimsBoxBristle.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/TimsBoxHybrid.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/TimsBoxPGS.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/TwoPendulums.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/UnilateralPointContact.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/UnilateralPointContactWithFriction.dir/DependInfo.cmake"
+  "Simbody/tests/adhoc/CMakeFiles/WristMomentArm.dir/DependInfo.cmake"
+  )
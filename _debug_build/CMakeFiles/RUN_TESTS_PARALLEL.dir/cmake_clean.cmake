@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RUN_TESTS_PARALLEL"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/RUN_TESTS_PARALLEL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_debug_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("doc")
+subdirs("Platform")
+subdirs("SimTKcommon")
+subdirs("SimTKmath")
+subdirs("Simbody")
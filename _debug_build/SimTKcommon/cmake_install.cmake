@@ -0,0 +1,161 @@
+# Install script for directory: /root/repo/SimTKcommon
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/simbody" TYPE FILE FILES
+    "/root/repo/SimTKcommon/include/SimTKcommon.h"
+    "/root/repo/SimTKcommon/include/SimTKlapack.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/simbody/SimTKcommon" TYPE FILE FILES
+    "/root/repo/SimTKcommon/Mechanics/include/SimTKcommon/Mechanics.h"
+    "/root/repo/SimTKcommon/Mechanics/include/SimTKcommon/Orientation.h"
+    "/root/repo/SimTKcommon/Scalar/include/SimTKcommon/Scalar.h"
+    "/root/repo/SimTKcommon/SmallMatrix/include/SimTKcommon/SmallMatrix.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/Constants.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/Simmatrix.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/TemplatizedLapack.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/Testing.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/basics.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/simbody/SimTKcommon/internal" TYPE FILE FILES
+    "/root/repo/SimTKcommon/BigMatrix/include/SimTKcommon/internal/BigMatrix.h"
+    "/root/repo/SimTKcommon/BigMatrix/include/SimTKcommon/internal/MatrixAllocator.h"
+    "/root/repo/SimTKcommon/BigMatrix/include/SimTKcommon/internal/MatrixBase.h"
+    "/root/repo/SimTKcommon/BigMatrix/include/SimTKcommon/internal/MatrixCharacteristics.h"
+    "/root/repo/SimTKcommon/BigMatrix/include/SimTKcommon/internal/MatrixHelper.h"
+    "/root/repo/SimTKcommon/BigMatrix/include/SimTKcommon/internal/MatrixView_.h"
+    "/root/repo/SimTKcommon/BigMatrix/include/SimTKcommon/internal/Matrix_.h"
+    "/root/repo/SimTKcommon/BigMatrix/include/SimTKcommon/internal/RowVectorBase.h"
+    "/root/repo/SimTKcommon/BigMatrix/include/SimTKcommon/internal/RowVectorView_.h"
+    "/root/repo/SimTKcommon/BigMatrix/include/SimTKcommon/internal/RowVector_.h"
+    "/root/repo/SimTKcommon/BigMatrix/include/SimTKcommon/internal/VectorBase.h"
+    "/root/repo/SimTKcommon/BigMatrix/include/SimTKcommon/internal/VectorIterator.h"
+    "/root/repo/SimTKcommon/BigMatrix/include/SimTKcommon/internal/VectorView_.h"
+    "/root/repo/SimTKcommon/BigMatrix/include/SimTKcommon/internal/Vector_.h"
+    "/root/repo/SimTKcommon/Geometry/include/SimTKcommon/internal/DecorationGenerator.h"
+    "/root/repo/SimTKcommon/Geometry/include/SimTKcommon/internal/DecorativeGeometry.h"
+    "/root/repo/SimTKcommon/Geometry/include/SimTKcommon/internal/PolygonalMesh.h"
+    "/root/repo/SimTKcommon/Mechanics/include/SimTKcommon/internal/CoordinateAxis.h"
+    "/root/repo/SimTKcommon/Mechanics/include/SimTKcommon/internal/MassProperties.h"
+    "/root/repo/SimTKcommon/Mechanics/include/SimTKcommon/internal/Quaternion.h"
+    "/root/repo/SimTKcommon/Mechanics/include/SimTKcommon/internal/Rotation.h"
+    "/root/repo/SimTKcommon/Mechanics/include/SimTKcommon/internal/SpatialAlgebra.h"
+    "/root/repo/SimTKcommon/Mechanics/include/SimTKcommon/internal/Transform.h"
+    "/root/repo/SimTKcommon/Mechanics/include/SimTKcommon/internal/UnitVec.h"
+    "/root/repo/SimTKcommon/Polynomial/include/SimTKcommon/internal/PolynomialRootFinder.h"
+    "/root/repo/SimTKcommon/Random/include/SimTKcommon/internal/Random.h"
+    "/root/repo/SimTKcommon/Scalar/include/SimTKcommon/internal/CompositeNumericalTypes.h"
+    "/root/repo/SimTKcommon/Scalar/include/SimTKcommon/internal/NTraits.h"
+    "/root/repo/SimTKcommon/Scalar/include/SimTKcommon/internal/conjugate.h"
+    "/root/repo/SimTKcommon/Scalar/include/SimTKcommon/internal/negator.h"
+    "/root/repo/SimTKcommon/Simulation/include/SimTKcommon/internal/Event.h"
+    "/root/repo/SimTKcommon/Simulation/include/SimTKcommon/internal/EventHandler.h"
+    "/root/repo/SimTKcommon/Simulation/include/SimTKcommon/internal/EventReporter.h"
+    "/root/repo/SimTKcommon/Simulation/include/SimTKcommon/internal/Measure.h"
+    "/root/repo/SimTKcommon/Simulation/include/SimTKcommon/internal/MeasureImplementation.h"
+    "/root/repo/SimTKcommon/Simulation/include/SimTKcommon/internal/Stage.h"
+    "/root/repo/SimTKcommon/Simulation/include/SimTKcommon/internal/State.h"
+    "/root/repo/SimTKcommon/Simulation/include/SimTKcommon/internal/StateImpl.h"
+    "/root/repo/SimTKcommon/Simulation/include/SimTKcommon/internal/Study.h"
+    "/root/repo/SimTKcommon/Simulation/include/SimTKcommon/internal/StudyGuts.h"
+    "/root/repo/SimTKcommon/Simulation/include/SimTKcommon/internal/Subsystem.h"
+    "/root/repo/SimTKcommon/Simulation/include/SimTKcommon/internal/SubsystemGuts.h"
+    "/root/repo/SimTKcommon/Simulation/include/SimTKcommon/internal/System.h"
+    "/root/repo/SimTKcommon/Simulation/include/SimTKcommon/internal/SystemGuts.h"
+    "/root/repo/SimTKcommon/SmallMatrix/include/SimTKcommon/internal/Mat.h"
+    "/root/repo/SimTKcommon/SmallMatrix/include/SimTKcommon/internal/ResultType.h"
+    "/root/repo/SimTKcommon/SmallMatrix/include/SimTKcommon/internal/Row.h"
+    "/root/repo/SimTKcommon/SmallMatrix/include/SimTKcommon/internal/SmallDefsThatNeedBig.h"
+    "/root/repo/SimTKcommon/SmallMatrix/include/SimTKcommon/internal/SmallMatrixBatch.h"
+    "/root/repo/SimTKcommon/SmallMatrix/include/SimTKcommon/internal/SmallMatrixMixed.h"
+    "/root/repo/SimTKcommon/SmallMatrix/include/SimTKcommon/internal/SmallMatrixSIMD.h"
+    "/root/repo/SimTKcommon/SmallMatrix/include/SimTKcommon/internal/SymMat.h"
+    "/root/repo/SimTKcommon/SmallMatrix/include/SimTKcommon/internal/Vec.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/Array.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/CloneOnWritePtr.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/ClonePtr.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/Exception.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/ExceptionMacros.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/Fortran.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/Function.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/IteratorRange.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/Parallel2DExecutor.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/ParallelExecutor.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/ParallelWorkQueue.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/Pathname.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/Plugin.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/PrivateImplementation.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/PrivateImplementation_Defs.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/ReferencePtr.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/ReinitOnCopy.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/ResetOnCopy.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/Serialize.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/SmallArray.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/StableArray.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/String.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/Timing.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/Value.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/VectorMath.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/Xml.h"
+    "/root/repo/SimTKcommon/include/SimTKcommon/internal/common.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/doc/simbody" TYPE FILE FILES "/root/repo/SimTKcommon/doc/Simmatrix.pdf")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_debug_build/SimTKcommon/sharedTarget/cmake_install.cmake")
+  include("/root/repo/_debug_build/SimTKcommon/tests/cmake_install.cmake")
+
+endif()
+
@@ -0,0 +1,64 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/SimTKcommon/BigMatrix/src/ElementFilter.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/BigMatrix/src/ElementFilter.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/BigMatrix/src/ElementFilter.cpp.o.d"
+  "/root/repo/SimTKcommon/BigMatrix/src/MatrixAllocator.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/BigMatrix/src/MatrixAllocator.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/BigMatrix/src/MatrixAllocator.cpp.o.d"
+  "/root/repo/SimTKcommon/BigMatrix/src/MatrixCharacteristics.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/BigMatrix/src/MatrixCharacteristics.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/BigMatrix/src/MatrixCharacteristics.cpp.o.d"
+  "/root/repo/SimTKcommon/BigMatrix/src/MatrixHelper.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/BigMatrix/src/MatrixHelper.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/BigMatrix/src/MatrixHelper.cpp.o.d"
+  "/root/repo/SimTKcommon/Geometry/src/DecorativeGeometry.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Geometry/src/DecorativeGeometry.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Geometry/src/DecorativeGeometry.cpp.o.d"
+  "/root/repo/SimTKcommon/Geometry/src/PolygonalMesh.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Geometry/src/PolygonalMesh.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Geometry/src/PolygonalMesh.cpp.o.d"
+  "/root/repo/SimTKcommon/Mechanics/src/CoordinateAxis.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Mechanics/src/CoordinateAxis.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Mechanics/src/CoordinateAxis.cpp.o.d"
+  "/root/repo/SimTKcommon/Mechanics/src/MassProperties.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Mechanics/src/MassProperties.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Mechanics/src/MassProperties.cpp.o.d"
+  "/root/repo/SimTKcommon/Mechanics/src/Quaternion.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Mechanics/src/Quaternion.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Mechanics/src/Quaternion.cpp.o.d"
+  "/root/repo/SimTKcommon/Mechanics/src/Rotation.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Mechanics/src/Rotation.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Mechanics/src/Rotation.cpp.o.d"
+  "/root/repo/SimTKcommon/Mechanics/src/Transform.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Mechanics/src/Transform.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Mechanics/src/Transform.cpp.o.d"
+  "/root/repo/SimTKcommon/Mechanics/src/UnitVec.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Mechanics/src/UnitVec.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Mechanics/src/UnitVec.cpp.o.d"
+  "/root/repo/SimTKcommon/Polynomial/src/PolynomialRootFinder.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Polynomial/src/PolynomialRootFinder.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Polynomial/src/PolynomialRootFinder.cpp.o.d"
+  "/root/repo/SimTKcommon/Polynomial/src/cpoly.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Polynomial/src/cpoly.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Polynomial/src/cpoly.cpp.o.d"
+  "/root/repo/SimTKcommon/Polynomial/src/rpoly.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Polynomial/src/rpoly.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Polynomial/src/rpoly.cpp.o.d"
+  "/root/repo/SimTKcommon/Random/src/Random.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Random/src/Random.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Random/src/Random.cpp.o.d"
+  "/root/repo/SimTKcommon/Random/src/SFMT.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Random/src/SFMT.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Random/src/SFMT.cpp.o.d"
+  "/root/repo/SimTKcommon/Scalar/src/Scalar.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Scalar/src/Scalar.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Scalar/src/Scalar.cpp.o.d"
+  "/root/repo/SimTKcommon/Simulation/src/Event.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Simulation/src/Event.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Simulation/src/Event.cpp.o.d"
+  "/root/repo/SimTKcommon/Simulation/src/EventHandler.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Simulation/src/EventHandler.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Simulation/src/EventHandler.cpp.o.d"
+  "/root/repo/SimTKcommon/Simulation/src/EventReporter.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Simulation/src/EventReporter.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Simulation/src/EventReporter.cpp.o.d"
+  "/root/repo/SimTKcommon/Simulation/src/Measure.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Simulation/src/Measure.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Simulation/src/Measure.cpp.o.d"
+  "/root/repo/SimTKcommon/Simulation/src/State.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Simulation/src/State.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Simulation/src/State.cpp.o.d"
+  "/root/repo/SimTKcommon/Simulation/src/Study.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Simulation/src/Study.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Simulation/src/Study.cpp.o.d"
+  "/root/repo/SimTKcommon/Simulation/src/Subsystem.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Simulation/src/Subsystem.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Simulation/src/Subsystem.cpp.o.d"
+  "/root/repo/SimTKcommon/Simulation/src/System.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Simulation/src/System.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/Simulation/src/System.cpp.o.d"
+  "/root/repo/SimTKcommon/SmallMatrix/src/SmallMatrix.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/SmallMatrix/src/SmallMatrix.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/SmallMatrix/src/SmallMatrix.cpp.o.d"
+  "/root/repo/SimTKcommon/src/About.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/About.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/About.cpp.o.d"
+  "/root/repo/SimTKcommon/src/NiceTypeName.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/NiceTypeName.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/NiceTypeName.cpp.o.d"
+  "/root/repo/SimTKcommon/src/Parallel2DExecutor.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/Parallel2DExecutor.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/Parallel2DExecutor.cpp.o.d"
+  "/root/repo/SimTKcommon/src/ParallelExecutor.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/ParallelExecutor.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/ParallelExecutor.cpp.o.d"
+  "/root/repo/SimTKcommon/src/ParallelWorkQueue.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/ParallelWorkQueue.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/ParallelWorkQueue.cpp.o.d"
+  "/root/repo/SimTKcommon/src/Pathname.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/Pathname.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/Pathname.cpp.o.d"
+  "/root/repo/SimTKcommon/src/Plugin.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/Plugin.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/Plugin.cpp.o.d"
+  "/root/repo/SimTKcommon/src/PrivateInstantiations.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/PrivateInstantiations.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/PrivateInstantiations.cpp.o.d"
+  "/root/repo/SimTKcommon/src/String.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/String.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/String.cpp.o.d"
+  "/root/repo/SimTKcommon/src/Timing.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/Timing.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/Timing.cpp.o.d"
+  "/root/repo/SimTKcommon/src/Xml.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/Xml.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/Xml.cpp.o.d"
+  "/root/repo/SimTKcommon/src/tinyxml.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/tinyxml.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/tinyxml.cpp.o.d"
+  "/root/repo/SimTKcommon/src/tinyxmlparser.cpp" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/tinyxmlparser.cpp.o" "gcc" "SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/__/src/tinyxmlparser.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_debug_build/libSimTKcommon_d.so" "/root/repo/_debug_build/libSimTKcommon_d.so.3.6"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
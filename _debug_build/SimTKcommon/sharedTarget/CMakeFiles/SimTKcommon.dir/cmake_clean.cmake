@@ -0,0 +1,90 @@
+file(REMOVE_RECURSE
+  "../../libSimTKcommon_d.pdb"
+  "../../libSimTKcommon_d.so"
+  "../../libSimTKcommon_d.so.3.6"
+  "CMakeFiles/SimTKcommon.dir/__/BigMatrix/src/ElementFilter.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/BigMatrix/src/ElementFilter.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/BigMatrix/src/MatrixAllocator.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/BigMatrix/src/MatrixAllocator.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/BigMatrix/src/MatrixCharacteristics.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/BigMatrix/src/MatrixCharacteristics.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/BigMatrix/src/MatrixHelper.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/BigMatrix/src/MatrixHelper.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Geometry/src/DecorativeGeometry.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Geometry/src/DecorativeGeometry.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Geometry/src/PolygonalMesh.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Geometry/src/PolygonalMesh.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Mechanics/src/CoordinateAxis.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Mechanics/src/CoordinateAxis.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Mechanics/src/MassProperties.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Mechanics/src/MassProperties.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Mechanics/src/Quaternion.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Mechanics/src/Quaternion.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Mechanics/src/Rotation.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Mechanics/src/Rotation.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Mechanics/src/Transform.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Mechanics/src/Transform.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Mechanics/src/UnitVec.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Mechanics/src/UnitVec.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Polynomial/src/PolynomialRootFinder.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Polynomial/src/PolynomialRootFinder.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Polynomial/src/cpoly.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Polynomial/src/cpoly.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Polynomial/src/rpoly.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Polynomial/src/rpoly.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Random/src/Random.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Random/src/Random.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Random/src/SFMT.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Random/src/SFMT.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Scalar/src/Scalar.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Scalar/src/Scalar.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Simulation/src/Event.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Simulation/src/Event.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Simulation/src/EventHandler.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Simulation/src/EventHandler.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Simulation/src/EventReporter.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Simulation/src/EventReporter.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Simulation/src/Measure.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Simulation/src/Measure.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Simulation/src/State.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Simulation/src/State.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Simulation/src/Study.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Simulation/src/Study.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Simulation/src/Subsystem.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Simulation/src/Subsystem.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/Simulation/src/System.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/Simulation/src/System.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/SmallMatrix/src/SmallMatrix.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/SmallMatrix/src/SmallMatrix.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/src/About.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/src/About.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/src/NiceTypeName.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/src/NiceTypeName.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/src/Parallel2DExecutor.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/src/Parallel2DExecutor.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/src/ParallelExecutor.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/src/ParallelExecutor.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/src/ParallelWorkQueue.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/src/ParallelWorkQueue.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/src/Pathname.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/src/Pathname.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/src/Plugin.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/src/Plugin.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/src/PrivateInstantiations.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/src/PrivateInstantiations.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/src/String.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/src/String.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/src/Timing.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/src/Timing.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/src/Xml.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/src/Xml.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/src/tinyxml.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/src/tinyxml.cpp.o.d"
+  "CMakeFiles/SimTKcommon.dir/__/src/tinyxmlparser.cpp.o"
+  "CMakeFiles/SimTKcommon.dir/__/src/tinyxmlparser.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SimTKcommon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../BNTTest"
+  "../../BNTTest.pdb"
+  "CMakeFiles/BNTTest.dir/BNTTest.cpp.o"
+  "CMakeFiles/BNTTest.dir/BNTTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BNTTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
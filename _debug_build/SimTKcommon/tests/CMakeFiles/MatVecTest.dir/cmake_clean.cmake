@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../MatVecTest"
+  "../../MatVecTest.pdb"
+  "CMakeFiles/MatVecTest.dir/MatVecTest.cpp.o"
+  "CMakeFiles/MatVecTest.dir/MatVecTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MatVecTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
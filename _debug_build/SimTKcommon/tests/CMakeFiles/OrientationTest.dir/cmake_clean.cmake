@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../OrientationTest"
+  "../../OrientationTest.pdb"
+  "CMakeFiles/OrientationTest.dir/OrientationTest.cpp.o"
+  "CMakeFiles/OrientationTest.dir/OrientationTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/OrientationTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../PolynomialTest"
+  "../../PolynomialTest.pdb"
+  "CMakeFiles/PolynomialTest.dir/PolynomialTest.cpp.o"
+  "CMakeFiles/PolynomialTest.dir/PolynomialTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PolynomialTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../RandomTest"
+  "../../RandomTest.pdb"
+  "CMakeFiles/RandomTest.dir/RandomTest.cpp.o"
+  "CMakeFiles/RandomTest.dir/RandomTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RandomTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../RotationTest"
+  "../../RotationTest.pdb"
+  "CMakeFiles/RotationTest.dir/RotationTest.cpp.o"
+  "CMakeFiles/RotationTest.dir/RotationTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RotationTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
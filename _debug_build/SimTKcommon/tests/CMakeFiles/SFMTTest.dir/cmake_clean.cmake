@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../SFMTTest"
+  "../../SFMTTest.pdb"
+  "CMakeFiles/SFMTTest.dir/SFMTTest.cpp.o"
+  "CMakeFiles/SFMTTest.dir/SFMTTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SFMTTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
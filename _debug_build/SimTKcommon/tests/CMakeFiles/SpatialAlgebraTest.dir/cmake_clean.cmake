@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../SpatialAlgebraTest"
+  "../../SpatialAlgebraTest.pdb"
+  "CMakeFiles/SpatialAlgebraTest.dir/SpatialAlgebraTest.cpp.o"
+  "CMakeFiles/SpatialAlgebraTest.dir/SpatialAlgebraTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SpatialAlgebraTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../StateTest"
+  "../../StateTest.pdb"
+  "CMakeFiles/StateTest.dir/StateTest.cpp.o"
+  "CMakeFiles/StateTest.dir/StateTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StateTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
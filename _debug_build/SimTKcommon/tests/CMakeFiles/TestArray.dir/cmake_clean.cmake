@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestArray"
+  "../../TestArray.pdb"
+  "CMakeFiles/TestArray.dir/TestArray.cpp.o"
+  "CMakeFiles/TestArray.dir/TestArray.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestArray.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestAtomic"
+  "../../TestAtomic.pdb"
+  "CMakeFiles/TestAtomic.dir/TestAtomic.cpp.o"
+  "CMakeFiles/TestAtomic.dir/TestAtomic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestAtomic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestBigMatrix"
+  "../../TestBigMatrix.pdb"
+  "CMakeFiles/TestBigMatrix.dir/TestBigMatrix.cpp.o"
+  "CMakeFiles/TestBigMatrix.dir/TestBigMatrix.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestBigMatrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
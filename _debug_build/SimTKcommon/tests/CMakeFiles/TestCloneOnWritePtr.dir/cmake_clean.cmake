@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestCloneOnWritePtr"
+  "../../TestCloneOnWritePtr.pdb"
+  "CMakeFiles/TestCloneOnWritePtr.dir/TestCloneOnWritePtr.cpp.o"
+  "CMakeFiles/TestCloneOnWritePtr.dir/TestCloneOnWritePtr.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCloneOnWritePtr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestFunction"
+  "../../TestFunction.pdb"
+  "CMakeFiles/TestFunction.dir/TestFunction.cpp.o"
+  "CMakeFiles/TestFunction.dir/TestFunction.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestFunction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
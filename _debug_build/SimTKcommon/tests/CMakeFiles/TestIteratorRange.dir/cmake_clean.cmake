@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestIteratorRange"
+  "../../TestIteratorRange.pdb"
+  "CMakeFiles/TestIteratorRange.dir/TestIteratorRange.cpp.o"
+  "CMakeFiles/TestIteratorRange.dir/TestIteratorRange.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestIteratorRange.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestMassProperties"
+  "../../TestMassProperties.pdb"
+  "CMakeFiles/TestMassProperties.dir/TestMassProperties.cpp.o"
+  "CMakeFiles/TestMassProperties.dir/TestMassProperties.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestMassProperties.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestMatrixAllocator"
+  "../../TestMatrixAllocator.pdb"
+  "CMakeFiles/TestMatrixAllocator.dir/TestMatrixAllocator.cpp.o"
+  "CMakeFiles/TestMatrixAllocator.dir/TestMatrixAllocator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestMatrixAllocator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
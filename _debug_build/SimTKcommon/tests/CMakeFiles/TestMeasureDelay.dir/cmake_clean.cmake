@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestMeasureDelay"
+  "../../TestMeasureDelay.pdb"
+  "CMakeFiles/TestMeasureDelay.dir/TestMeasureDelay.cpp.o"
+  "CMakeFiles/TestMeasureDelay.dir/TestMeasureDelay.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestMeasureDelay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
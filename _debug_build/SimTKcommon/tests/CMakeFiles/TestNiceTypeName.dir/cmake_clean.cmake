@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestNiceTypeName"
+  "../../TestNiceTypeName.pdb"
+  "CMakeFiles/TestNiceTypeName.dir/TestNiceTypeName.cpp.o"
+  "CMakeFiles/TestNiceTypeName.dir/TestNiceTypeName.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestNiceTypeName.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
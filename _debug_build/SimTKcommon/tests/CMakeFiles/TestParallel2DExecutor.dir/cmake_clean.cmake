@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestParallel2DExecutor"
+  "../../TestParallel2DExecutor.pdb"
+  "CMakeFiles/TestParallel2DExecutor.dir/TestParallel2DExecutor.cpp.o"
+  "CMakeFiles/TestParallel2DExecutor.dir/TestParallel2DExecutor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestParallel2DExecutor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestParallelExecutor"
+  "../../TestParallelExecutor.pdb"
+  "CMakeFiles/TestParallelExecutor.dir/TestParallelExecutor.cpp.o"
+  "CMakeFiles/TestParallelExecutor.dir/TestParallelExecutor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestParallelExecutor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestParallelWorkQueue"
+  "../../TestParallelWorkQueue.pdb"
+  "CMakeFiles/TestParallelWorkQueue.dir/TestParallelWorkQueue.cpp.o"
+  "CMakeFiles/TestParallelWorkQueue.dir/TestParallelWorkQueue.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestParallelWorkQueue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestPlugin"
+  "../../TestPlugin.pdb"
+  "CMakeFiles/TestPlugin.dir/TestPlugin.cpp.o"
+  "CMakeFiles/TestPlugin.dir/TestPlugin.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestPlugin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
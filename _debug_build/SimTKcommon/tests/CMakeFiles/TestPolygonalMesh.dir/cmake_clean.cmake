@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestPolygonalMesh"
+  "../../TestPolygonalMesh.pdb"
+  "CMakeFiles/TestPolygonalMesh.dir/TestPolygonalMesh.cpp.o"
+  "CMakeFiles/TestPolygonalMesh.dir/TestPolygonalMesh.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestPolygonalMesh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
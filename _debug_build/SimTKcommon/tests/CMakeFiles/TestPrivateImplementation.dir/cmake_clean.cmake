@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestPrivateImplementation"
+  "../../TestPrivateImplementation.pdb"
+  "CMakeFiles/TestPrivateImplementation.dir/TestPrivateImplementation.cpp.o"
+  "CMakeFiles/TestPrivateImplementation.dir/TestPrivateImplementation.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestPrivateImplementation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestScalar"
+  "../../TestScalar.pdb"
+  "CMakeFiles/TestScalar.dir/TestScalar.cpp.o"
+  "CMakeFiles/TestScalar.dir/TestScalar.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestScalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestSimulation"
+  "../../TestSimulation.pdb"
+  "CMakeFiles/TestSimulation.dir/TestSimulation.cpp.o"
+  "CMakeFiles/TestSimulation.dir/TestSimulation.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestSimulation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestSmallArray"
+  "../../TestSmallArray.pdb"
+  "CMakeFiles/TestSmallArray.dir/TestSmallArray.cpp.o"
+  "CMakeFiles/TestSmallArray.dir/TestSmallArray.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestSmallArray.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestSmallMatrix"
+  "../../TestSmallMatrix.pdb"
+  "CMakeFiles/TestSmallMatrix.dir/TestSmallMatrix.cpp.o"
+  "CMakeFiles/TestSmallMatrix.dir/TestSmallMatrix.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestSmallMatrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestSmallMatrixBatch"
+  "../../TestSmallMatrixBatch.pdb"
+  "CMakeFiles/TestSmallMatrixBatch.dir/TestSmallMatrixBatch.cpp.o"
+  "CMakeFiles/TestSmallMatrixBatch.dir/TestSmallMatrixBatch.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestSmallMatrixBatch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestSmallMatrixSIMD"
+  "../../TestSmallMatrixSIMD.pdb"
+  "CMakeFiles/TestSmallMatrixSIMD.dir/TestSmallMatrixSIMD.cpp.o"
+  "CMakeFiles/TestSmallMatrixSIMD.dir/TestSmallMatrixSIMD.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestSmallMatrixSIMD.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
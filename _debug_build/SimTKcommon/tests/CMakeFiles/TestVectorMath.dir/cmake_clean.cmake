@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestVectorMath"
+  "../../TestVectorMath.pdb"
+  "CMakeFiles/TestVectorMath.dir/TestVectorMath.cpp.o"
+  "CMakeFiles/TestVectorMath.dir/TestVectorMath.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestVectorMath.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
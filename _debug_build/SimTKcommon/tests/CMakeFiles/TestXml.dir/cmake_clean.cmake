@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestXml"
+  "../../TestXml.pdb"
+  "CMakeFiles/TestXml.dir/TestXml.cpp.o"
+  "CMakeFiles/TestXml.dir/TestXml.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestXml.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,73 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/SimTKcommon/tests
+# Build directory: /root/repo/_debug_build/SimTKcommon/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(BNTTest "/root/repo/_debug_build/BNTTest")
+set_tests_properties(BNTTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(MatVecTest "/root/repo/_debug_build/MatVecTest")
+set_tests_properties(MatVecTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(OrientationTest "/root/repo/_debug_build/OrientationTest")
+set_tests_properties(OrientationTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(PolynomialTest "/root/repo/_debug_build/PolynomialTest")
+set_tests_properties(PolynomialTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(RandomTest "/root/repo/_debug_build/RandomTest")
+set_tests_properties(RandomTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(RotationTest "/root/repo/_debug_build/RotationTest")
+set_tests_properties(RotationTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(SFMTTest "/root/repo/_debug_build/SFMTTest")
+set_tests_properties(SFMTTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(SpatialAlgebraTest "/root/repo/_debug_build/SpatialAlgebraTest")
+set_tests_properties(SpatialAlgebraTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(StateTest "/root/repo/_debug_build/StateTest")
+set_tests_properties(StateTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestArray "/root/repo/_debug_build/TestArray")
+set_tests_properties(TestArray PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestAtomic "/root/repo/_debug_build/TestAtomic")
+set_tests_properties(TestAtomic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestBigMatrix "/root/repo/_debug_build/TestBigMatrix")
+set_tests_properties(TestBigMatrix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestCloneOnWritePtr "/root/repo/_debug_build/TestCloneOnWritePtr")
+set_tests_properties(TestCloneOnWritePtr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestFunction "/root/repo/_debug_build/TestFunction")
+set_tests_properties(TestFunction PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestIteratorRange "/root/repo/_debug_build/TestIteratorRange")
+set_tests_properties(TestIteratorRange PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestMassProperties "/root/repo/_debug_build/TestMassProperties")
+set_tests_properties(TestMassProperties PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestMatrixAllocator "/root/repo/_debug_build/TestMatrixAllocator")
+set_tests_properties(TestMatrixAllocator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestMeasureDelay "/root/repo/_debug_build/TestMeasureDelay")
+set_tests_properties(TestMeasureDelay PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestNiceTypeName "/root/repo/_debug_build/TestNiceTypeName")
+set_tests_properties(TestNiceTypeName PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestParallel2DExecutor "/root/repo/_debug_build/TestParallel2DExecutor")
+set_tests_properties(TestParallel2DExecutor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestParallelExecutor "/root/repo/_debug_build/TestParallelExecutor")
+set_tests_properties(TestParallelExecutor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestParallelWorkQueue "/root/repo/_debug_build/TestParallelWorkQueue")
+set_tests_properties(TestParallelWorkQueue PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestPlugin "/root/repo/_debug_build/TestPlugin")
+set_tests_properties(TestPlugin PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestPolygonalMesh "/root/repo/_debug_build/TestPolygonalMesh")
+set_tests_properties(TestPolygonalMesh PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestPrivateImplementation "/root/repo/_debug_build/TestPrivateImplementation")
+set_tests_properties(TestPrivateImplementation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestScalar "/root/repo/_debug_build/TestScalar")
+set_tests_properties(TestScalar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestSimulation "/root/repo/_debug_build/TestSimulation")
+set_tests_properties(TestSimulation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestSmallArray "/root/repo/_debug_build/TestSmallArray")
+set_tests_properties(TestSmallArray PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestSmallMatrix "/root/repo/_debug_build/TestSmallMatrix")
+set_tests_properties(TestSmallMatrix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestSmallMatrixBatch "/root/repo/_debug_build/TestSmallMatrixBatch")
+set_tests_properties(TestSmallMatrixBatch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestSmallMatrixSIMD "/root/repo/_debug_build/TestSmallMatrixSIMD")
+set_tests_properties(TestSmallMatrixSIMD PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestVectorMath "/root/repo/_debug_build/TestVectorMath")
+set_tests_properties(TestVectorMath PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+add_test(TestXml "/root/repo/_debug_build/TestXml")
+set_tests_properties(TestXml PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKcommon/tests/CMakeLists.txt;36;add_test;/root/repo/SimTKcommon/tests/CMakeLists.txt;0;")
+subdirs("adhoc")
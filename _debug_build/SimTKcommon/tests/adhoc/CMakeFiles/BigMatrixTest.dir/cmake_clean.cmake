@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../BigMatrixTest"
+  "../../../BigMatrixTest.pdb"
+  "CMakeFiles/BigMatrixTest.dir/BigMatrixTest.cpp.o"
+  "CMakeFiles/BigMatrixTest.dir/BigMatrixTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BigMatrixTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/SimTKmath
+# Build directory: /root/repo/_debug_build/SimTKmath
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("LinearAlgebra")
+subdirs("Integrators")
+subdirs("Optimizers")
+subdirs("Geometry")
+subdirs("sharedTarget")
+subdirs("tests")
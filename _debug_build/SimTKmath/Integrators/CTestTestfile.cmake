@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/SimTKmath/Integrators
+# Build directory: /root/repo/_debug_build/SimTKmath/Integrators
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("src/CPodes")
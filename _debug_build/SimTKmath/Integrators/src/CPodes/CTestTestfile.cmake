@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/SimTKmath/Integrators/src/CPodes
+# Build directory: /root/repo/_debug_build/SimTKmath/Integrators/src/CPodes
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("sundials")
+subdirs("tests")
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/SimTKmath/Integrators/src/CPodes/sundials
+# Build directory: /root/repo/_debug_build/SimTKmath/Integrators/src/CPodes/sundials
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("tests")
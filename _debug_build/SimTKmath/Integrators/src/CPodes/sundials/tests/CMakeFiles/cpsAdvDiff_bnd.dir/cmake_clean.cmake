@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../cpsAdvDiff_bnd"
+  "../../../../../../cpsAdvDiff_bnd.pdb"
+  "CMakeFiles/cpsAdvDiff_bnd.dir/cpsAdvDiff_bnd.c.o"
+  "CMakeFiles/cpsAdvDiff_bnd.dir/cpsAdvDiff_bnd.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpsAdvDiff_bnd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/cpsAdvDiff_bndL.c" "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/cpsAdvDiff_bndL.dir/cpsAdvDiff_bndL.c.o" "gcc" "SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeFiles/cpsAdvDiff_bndL.dir/cpsAdvDiff_bndL.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
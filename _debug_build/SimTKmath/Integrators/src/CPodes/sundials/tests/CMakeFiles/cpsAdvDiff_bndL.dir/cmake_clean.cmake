@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../cpsAdvDiff_bndL"
+  "../../../../../../cpsAdvDiff_bndL.pdb"
+  "CMakeFiles/cpsAdvDiff_bndL.dir/cpsAdvDiff_bndL.c.o"
+  "CMakeFiles/cpsAdvDiff_bndL.dir/cpsAdvDiff_bndL.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpsAdvDiff_bndL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../cpsAdvDiff_non"
+  "../../../../../../cpsAdvDiff_non.pdb"
+  "CMakeFiles/cpsAdvDiff_non.dir/cpsAdvDiff_non.c.o"
+  "CMakeFiles/cpsAdvDiff_non.dir/cpsAdvDiff_non.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpsAdvDiff_non.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
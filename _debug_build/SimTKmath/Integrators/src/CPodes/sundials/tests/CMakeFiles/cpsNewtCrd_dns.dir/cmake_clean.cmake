@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../cpsNewtCrd_dns"
+  "../../../../../../cpsNewtCrd_dns.pdb"
+  "CMakeFiles/cpsNewtCrd_dns.dir/cpsNewtCrd_dns.c.o"
+  "CMakeFiles/cpsNewtCrd_dns.dir/cpsNewtCrd_dns.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpsNewtCrd_dns.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
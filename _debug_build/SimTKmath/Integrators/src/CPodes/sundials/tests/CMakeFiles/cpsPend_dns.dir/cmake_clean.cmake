@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../cpsPend_dns"
+  "../../../../../../cpsPend_dns.pdb"
+  "CMakeFiles/cpsPend_dns.dir/cpsPend_dns.c.o"
+  "CMakeFiles/cpsPend_dns.dir/cpsPend_dns.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpsPend_dns.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
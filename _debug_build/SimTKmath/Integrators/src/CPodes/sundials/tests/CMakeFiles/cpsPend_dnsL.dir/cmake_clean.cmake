@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../cpsPend_dnsL"
+  "../../../../../../cpsPend_dnsL.pdb"
+  "CMakeFiles/cpsPend_dnsL.dir/cpsPend_dnsL.c.o"
+  "CMakeFiles/cpsPend_dnsL.dir/cpsPend_dnsL.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpsPend_dnsL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
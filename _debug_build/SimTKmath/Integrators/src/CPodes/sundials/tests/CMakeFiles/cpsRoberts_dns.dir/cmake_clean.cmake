@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../cpsRoberts_dns"
+  "../../../../../../cpsRoberts_dns.pdb"
+  "CMakeFiles/cpsRoberts_dns.dir/cpsRoberts_dns.c.o"
+  "CMakeFiles/cpsRoberts_dns.dir/cpsRoberts_dns.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpsRoberts_dns.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../cpsRoberts_dnsL"
+  "../../../../../../cpsRoberts_dnsL.pdb"
+  "CMakeFiles/cpsRoberts_dnsL.dir/cpsRoberts_dnsL.c.o"
+  "CMakeFiles/cpsRoberts_dnsL.dir/cpsRoberts_dnsL.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpsRoberts_dnsL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../cpsVanDPol_non"
+  "../../../../../../cpsVanDPol_non.pdb"
+  "CMakeFiles/cpsVanDPol_non.dir/cpsVanDPol_non.c.o"
+  "CMakeFiles/cpsVanDPol_non.dir/cpsVanDPol_non.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpsVanDPol_non.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../cpsadamsx"
+  "../../../../../../cpsadamsx.pdb"
+  "CMakeFiles/cpsadamsx.dir/cpsadamsx.c.o"
+  "CMakeFiles/cpsadamsx.dir/cpsadamsx.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpsadamsx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../cpsbanx"
+  "../../../../../../cpsbanx.pdb"
+  "CMakeFiles/cpsbanx.dir/cpsbanx.c.o"
+  "CMakeFiles/cpsbanx.dir/cpsbanx.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpsbanx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../cpsbanx_lap"
+  "../../../../../../cpsbanx_lap.pdb"
+  "CMakeFiles/cpsbanx_lap.dir/cpsbanx_lap.c.o"
+  "CMakeFiles/cpsbanx_lap.dir/cpsbanx_lap.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpsbanx_lap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../cpsdenx"
+  "../../../../../../cpsdenx.pdb"
+  "CMakeFiles/cpsdenx.dir/cpsdenx.c.o"
+  "CMakeFiles/cpsdenx.dir/cpsdenx.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpsdenx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
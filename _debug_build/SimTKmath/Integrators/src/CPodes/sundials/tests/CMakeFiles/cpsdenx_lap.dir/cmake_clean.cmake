@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../cpsdenx_lap"
+  "../../../../../../cpsdenx_lap.pdb"
+  "CMakeFiles/cpsdenx_lap.dir/cpsdenx_lap.c.o"
+  "CMakeFiles/cpsdenx_lap.dir/cpsdenx_lap.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpsdenx_lap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../initroot1"
+  "../../../../../../initroot1.pdb"
+  "CMakeFiles/initroot1.dir/initroot1.c.o"
+  "CMakeFiles/initroot1.dir/initroot1.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/initroot1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
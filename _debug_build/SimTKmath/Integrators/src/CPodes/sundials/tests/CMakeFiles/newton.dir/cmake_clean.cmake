@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../newton"
+  "../../../../../../newton.pdb"
+  "CMakeFiles/newton.dir/newton.c.o"
+  "CMakeFiles/newton.dir/newton.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/newton.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../pend"
+  "../../../../../../pend.pdb"
+  "CMakeFiles/pend.dir/pend.c.o"
+  "CMakeFiles/pend.dir/pend.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
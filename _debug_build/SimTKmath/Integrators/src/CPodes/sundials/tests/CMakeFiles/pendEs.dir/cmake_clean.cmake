@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../pendEs"
+  "../../../../../../pendEs.pdb"
+  "CMakeFiles/pendEs.dir/pendEs.c.o"
+  "CMakeFiles/pendEs.dir/pendEs.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pendEs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
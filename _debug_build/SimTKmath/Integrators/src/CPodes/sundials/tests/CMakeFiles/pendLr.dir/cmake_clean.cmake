@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../pendLr"
+  "../../../../../../pendLr.pdb"
+  "CMakeFiles/pendLr.dir/pendLr.c.o"
+  "CMakeFiles/pendLr.dir/pendLr.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pendLr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../../pend_test"
+  "../../../../../../pend_test.pdb"
+  "CMakeFiles/pend_test.dir/pend_test.c.o"
+  "CMakeFiles/pend_test.dir/pend_test.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pend_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
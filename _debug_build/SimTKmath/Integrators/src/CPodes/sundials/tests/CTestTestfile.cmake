@@ -0,0 +1,46 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests
+# Build directory: /root/repo/_debug_build/SimTKmath/Integrators/src/CPodes/sundials/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(cpsAdvDiff_bnd "/root/repo/_debug_build/cpsAdvDiff_bnd")
+set_tests_properties(cpsAdvDiff_bnd PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(cpsAdvDiff_bndL "/root/repo/_debug_build/cpsAdvDiff_bndL")
+set_tests_properties(cpsAdvDiff_bndL PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(cpsAdvDiff_non "/root/repo/_debug_build/cpsAdvDiff_non")
+set_tests_properties(cpsAdvDiff_non PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(cpsNewtCrd_dns "/root/repo/_debug_build/cpsNewtCrd_dns")
+set_tests_properties(cpsNewtCrd_dns PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(cpsPend_dns "/root/repo/_debug_build/cpsPend_dns")
+set_tests_properties(cpsPend_dns PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(cpsPend_dnsL "/root/repo/_debug_build/cpsPend_dnsL")
+set_tests_properties(cpsPend_dnsL PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(cpsRoberts_dns "/root/repo/_debug_build/cpsRoberts_dns")
+set_tests_properties(cpsRoberts_dns PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(cpsRoberts_dnsL "/root/repo/_debug_build/cpsRoberts_dnsL")
+set_tests_properties(cpsRoberts_dnsL PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(cpsVanDPol_non "/root/repo/_debug_build/cpsVanDPol_non")
+set_tests_properties(cpsVanDPol_non PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(cpsadamsx "/root/repo/_debug_build/cpsadamsx")
+set_tests_properties(cpsadamsx PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(cpsbanx "/root/repo/_debug_build/cpsbanx")
+set_tests_properties(cpsbanx PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(cpsbanx_lap "/root/repo/_debug_build/cpsbanx_lap")
+set_tests_properties(cpsbanx_lap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(cpsdenx "/root/repo/_debug_build/cpsdenx")
+set_tests_properties(cpsdenx PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(cpsdenx_lap "/root/repo/_debug_build/cpsdenx_lap")
+set_tests_properties(cpsdenx_lap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(initroot1 "/root/repo/_debug_build/initroot1")
+set_tests_properties(initroot1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(newton "/root/repo/_debug_build/newton")
+set_tests_properties(newton PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(pend "/root/repo/_debug_build/pend")
+set_tests_properties(pend PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(pendEs "/root/repo/_debug_build/pendEs")
+set_tests_properties(pendEs PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(pendLr "/root/repo/_debug_build/pendLr")
+set_tests_properties(pendLr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
+add_test(pend_test "/root/repo/_debug_build/pend_test")
+set_tests_properties(pend_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;46;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/sundials/tests/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../CpsAdamsXCpp"
+  "../../../../../CpsAdamsXCpp.pdb"
+  "CMakeFiles/CpsAdamsXCpp.dir/CpsAdamsXCpp.cpp.o"
+  "CMakeFiles/CpsAdamsXCpp.dir/CpsAdamsXCpp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CpsAdamsXCpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
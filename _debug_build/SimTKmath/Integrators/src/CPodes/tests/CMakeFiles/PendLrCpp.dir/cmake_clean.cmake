@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../PendLrCpp"
+  "../../../../../PendLrCpp.pdb"
+  "CMakeFiles/PendLrCpp.dir/PendLrCpp.cpp.o"
+  "CMakeFiles/PendLrCpp.dir/PendLrCpp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PendLrCpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/SimTKmath/Integrators/src/CPodes/tests
+# Build directory: /root/repo/_debug_build/SimTKmath/Integrators/src/CPodes/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CpsAdamsXCpp "/root/repo/_debug_build/CpsAdamsXCpp")
+set_tests_properties(CpsAdamsXCpp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/tests/CMakeLists.txt;38;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/tests/CMakeLists.txt;0;")
+add_test(PendLrCpp "/root/repo/_debug_build/PendLrCpp")
+set_tests_properties(PendLrCpp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/Integrators/src/CPodes/tests/CMakeLists.txt;38;add_test;/root/repo/SimTKmath/Integrators/src/CPodes/tests/CMakeLists.txt;0;")
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/SimTKmath/Optimizers
+# Build directory: /root/repo/_debug_build/SimTKmath/Optimizers
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("src/IpOpt")
+subdirs("src/c-cmaes")
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/SimTKmath/Optimizers/src/c-cmaes
+# Build directory: /root/repo/_debug_build/SimTKmath/Optimizers/src/c-cmaes
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,114 @@
+# Install script for directory: /root/repo/SimTKmath
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/simbody" TYPE FILE FILES "/root/repo/SimTKmath/include/SimTKmath.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/simbody/simmath" TYPE FILE FILES
+    "/root/repo/SimTKmath/Integrators/include/simmath/CPodesIntegrator.h"
+    "/root/repo/SimTKmath/Integrators/include/simmath/ExplicitEulerIntegrator.h"
+    "/root/repo/SimTKmath/Integrators/include/simmath/Integrator.h"
+    "/root/repo/SimTKmath/Integrators/include/simmath/RungeKutta2Integrator.h"
+    "/root/repo/SimTKmath/Integrators/include/simmath/RungeKutta3Integrator.h"
+    "/root/repo/SimTKmath/Integrators/include/simmath/RungeKuttaFeldbergIntegrator.h"
+    "/root/repo/SimTKmath/Integrators/include/simmath/RungeKuttaMersonIntegrator.h"
+    "/root/repo/SimTKmath/Integrators/include/simmath/SemiExplicitEuler2Integrator.h"
+    "/root/repo/SimTKmath/Integrators/include/simmath/SemiExplicitEulerIntegrator.h"
+    "/root/repo/SimTKmath/Integrators/include/simmath/TimeStepper.h"
+    "/root/repo/SimTKmath/Integrators/include/simmath/VerletIntegrator.h"
+    "/root/repo/SimTKmath/include/simmath/Differentiator.h"
+    "/root/repo/SimTKmath/include/simmath/LinearAlgebra.h"
+    "/root/repo/SimTKmath/include/simmath/MultibodyGraphMaker.h"
+    "/root/repo/SimTKmath/include/simmath/Optimizer.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/simbody/simmath/internal" TYPE FILE FILES
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/BicubicSurface.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/CollisionDetectionAlgorithm.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/Contact.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/ContactGeometry.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/ContactTracker.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/GCVSPLUtil.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/Geo.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/Geo_BicubicBezierPatch.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/Geo_BicubicHermitePatch.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/Geo_Box.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/Geo_CubicBezierCurve.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/Geo_CubicHermiteCurve.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/Geo_LineSeg.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/Geo_Point.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/Geo_Sphere.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/Geo_Triangle.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/Geodesic.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/GeodesicIntegrator.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/OBBTree.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/OrientedBoundingBox.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/ParticleConSurfaceSystem.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/Spline.h"
+    "/root/repo/SimTKmath/Geometry/include/simmath/internal/SplineFitter.h"
+    "/root/repo/SimTKmath/Integrators/include/simmath/internal/SimTKcpodes.h"
+    "/root/repo/SimTKmath/include/simmath/internal/OptimizerRep.h"
+    "/root/repo/SimTKmath/include/simmath/internal/common.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/doc/simbody" TYPE FILE FILES "/root/repo/SimTKmath/doc/SimmathUserGuide.pdf")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_debug_build/SimTKmath/LinearAlgebra/cmake_install.cmake")
+  include("/root/repo/_debug_build/SimTKmath/Integrators/cmake_install.cmake")
+  include("/root/repo/_debug_build/SimTKmath/Optimizers/cmake_install.cmake")
+  include("/root/repo/_debug_build/SimTKmath/Geometry/cmake_install.cmake")
+  include("/root/repo/_debug_build/SimTKmath/sharedTarget/cmake_install.cmake")
+  include("/root/repo/_debug_build/SimTKmath/tests/cmake_install.cmake")
+
+endif()
+
@@ -0,0 +1,189 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/cpodes/cpodes.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/cpodes/cpodes_band.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_band.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_band.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/cpodes/cpodes_bandpre.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_bandpre.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_bandpre.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/cpodes/cpodes_bbdpre.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_bbdpre.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_bbdpre.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/cpodes/cpodes_dense.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_dense.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_dense.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/cpodes/cpodes_direct.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_direct.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_direct.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/cpodes/cpodes_ic.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_ic.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_ic.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/cpodes/cpodes_io.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_io.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_io.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/cpodes/cpodes_lapack.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_lapack.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_lapack.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/cpodes/cpodes_nls.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_nls.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_nls.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/cpodes/cpodes_proj.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_proj.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_proj.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/cpodes/cpodes_root.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_root.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_root.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/cpodes/cpodes_spbcgs.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_spbcgs.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_spbcgs.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/cpodes/cpodes_spgmr.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_spgmr.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_spgmr.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/cpodes/cpodes_spils.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_spils.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_spils.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/cpodes/cpodes_sptfqmr.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_sptfqmr.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_sptfqmr.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/nvec_ser/fnvector_serial.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/nvec_ser/fnvector_serial.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/nvec_ser/fnvector_serial.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/nvec_ser/nvector_serial.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/nvec_ser/nvector_serial.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/nvec_ser/nvector_serial.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/sundials/sundials_band.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_band.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_band.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/sundials/sundials_dense.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_dense.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_dense.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/sundials/sundials_direct.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_direct.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_direct.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/sundials/sundials_iterative.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_iterative.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_iterative.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/sundials/sundials_lapack.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_lapack.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_lapack.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/sundials/sundials_math.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_math.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_math.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/sundials/sundials_nvector.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_nvector.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_nvector.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/sundials/sundials_spbcgs.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_spbcgs.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_spbcgs.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/sundials/sundials_spgmr.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_spgmr.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_spgmr.c.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/sundials/src/sundials/sundials_sptfqmr.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_sptfqmr.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_sptfqmr.c.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/c-cmaes/cmaes.c" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/c-cmaes/cmaes.c.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/c-cmaes/cmaes.c.o.d"
+  "/root/repo/SimTKmath/Geometry/src/BicubicSurface.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/BicubicSurface.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/BicubicSurface.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/CollisionDetectionAlgorithm.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/CollisionDetectionAlgorithm.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/CollisionDetectionAlgorithm.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/Contact.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/Contact.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/Contact.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/ContactGeometry.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/ContactGeometry_Brick.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Brick.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Brick.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/ContactGeometry_Cylinder.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Cylinder.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Cylinder.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/ContactGeometry_Ellipsoid.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Ellipsoid.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Ellipsoid.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/ContactGeometry_HalfSpace.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_HalfSpace.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_HalfSpace.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/ContactGeometry_SmoothHeightMap.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_SmoothHeightMap.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_SmoothHeightMap.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/ContactGeometry_Sphere.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Sphere.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Sphere.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/ContactGeometry_Torus.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Torus.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Torus.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/ContactGeometry_TriangleMesh.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_TriangleMesh.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_TriangleMesh.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/ContactTracker.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactTracker.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactTracker.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/GCVSPLUtil.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/GCVSPLUtil.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/GCVSPLUtil.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/Geo.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/Geo_Box.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo_Box.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo_Box.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/Geo_Point.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo_Point.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo_Point.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/Geo_Sphere.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo_Sphere.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo_Sphere.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/Geo_Triangle.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo_Triangle.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo_Triangle.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/Geodesic.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/Geodesic.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/Geodesic.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/OBBTree.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/OBBTree.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/OBBTree.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/OrientedBoundingBox.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/OrientedBoundingBox.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/OrientedBoundingBox.cpp.o.d"
+  "/root/repo/SimTKmath/Geometry/src/gcvspl.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/gcvspl.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Geometry/src/gcvspl.cpp.o.d"
+  "/root/repo/SimTKmath/Integrators/src/AbstractIntegratorRep.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/AbstractIntegratorRep.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/AbstractIntegratorRep.cpp.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/SimTKcpodes.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/SimTKcpodes.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/SimTKcpodes.cpp.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodes/nvector_SimTK.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/nvector_SimTK.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/nvector_SimTK.cpp.o.d"
+  "/root/repo/SimTKmath/Integrators/src/CPodesIntegrator.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodesIntegrator.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodesIntegrator.cpp.o.d"
+  "/root/repo/SimTKmath/Integrators/src/ExplicitEulerIntegrator.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/ExplicitEulerIntegrator.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/ExplicitEulerIntegrator.cpp.o.d"
+  "/root/repo/SimTKmath/Integrators/src/Integrator.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/Integrator.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/Integrator.cpp.o.d"
+  "/root/repo/SimTKmath/Integrators/src/RungeKutta2Integrator.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/RungeKutta2Integrator.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/RungeKutta2Integrator.cpp.o.d"
+  "/root/repo/SimTKmath/Integrators/src/RungeKutta3Integrator.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/RungeKutta3Integrator.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/RungeKutta3Integrator.cpp.o.d"
+  "/root/repo/SimTKmath/Integrators/src/RungeKuttaFeldbergIntegrator.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/RungeKuttaFeldbergIntegrator.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/RungeKuttaFeldbergIntegrator.cpp.o.d"
+  "/root/repo/SimTKmath/Integrators/src/RungeKuttaMersonIntegrator.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/RungeKuttaMersonIntegrator.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/RungeKuttaMersonIntegrator.cpp.o.d"
+  "/root/repo/SimTKmath/Integrators/src/SemiExplicitEuler2Integrator.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/SemiExplicitEuler2Integrator.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/SemiExplicitEuler2Integrator.cpp.o.d"
+  "/root/repo/SimTKmath/Integrators/src/SemiExplicitEulerIntegrator.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/SemiExplicitEulerIntegrator.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/SemiExplicitEulerIntegrator.cpp.o.d"
+  "/root/repo/SimTKmath/Integrators/src/TimeStepper.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/TimeStepper.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/TimeStepper.cpp.o.d"
+  "/root/repo/SimTKmath/Integrators/src/VerletIntegrator.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/VerletIntegrator.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Integrators/src/VerletIntegrator.cpp.o.d"
+  "/root/repo/SimTKmath/LinearAlgebra/src/Eigen.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/Eigen.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/Eigen.cpp.o.d"
+  "/root/repo/SimTKmath/LinearAlgebra/src/Factor.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/Factor.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/Factor.cpp.o.d"
+  "/root/repo/SimTKmath/LinearAlgebra/src/FactorCholesky.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/FactorCholesky.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/FactorCholesky.cpp.o.d"
+  "/root/repo/SimTKmath/LinearAlgebra/src/FactorQTZ.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/FactorQTZ.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/FactorQTZ.cpp.o.d"
+  "/root/repo/SimTKmath/LinearAlgebra/src/FactorSVD.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/FactorSVD.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/FactorSVD.cpp.o.d"
+  "/root/repo/SimTKmath/LinearAlgebra/src/LapackConvert.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/LapackConvert.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/LapackConvert.cpp.o.d"
+  "/root/repo/SimTKmath/LinearAlgebra/src/LapackInterface.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/LapackInterface.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/LapackInterface.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/CFSQPOptimizer.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/CFSQPOptimizer.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/CFSQPOptimizer.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/CMAESOptimizer.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/CMAESOptimizer.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/CMAESOptimizer.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/InteriorPointOptimizer.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/InteriorPointOptimizer.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/InteriorPointOptimizer.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpAdaptiveMuUpdate.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpAdaptiveMuUpdate.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpAdaptiveMuUpdate.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpAlgBuilder.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpAlgBuilder.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpAlgBuilder.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpAlgorithmRegOp.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpAlgorithmRegOp.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpAlgorithmRegOp.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpAugRestoSystemSolver.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpAugRestoSystemSolver.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpAugRestoSystemSolver.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpBacktrackingLineSearch.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpBacktrackingLineSearch.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpBacktrackingLineSearch.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpBlas.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpBlas.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpBlas.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpCompoundMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpCompoundMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpCompoundMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpCompoundSymMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpCompoundSymMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpCompoundSymMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpCompoundVector.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpCompoundVector.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpCompoundVector.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpDebug.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDebug.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDebug.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpDefaultIterateInitializer.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDefaultIterateInitializer.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDefaultIterateInitializer.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpDenseGenMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDenseGenMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDenseGenMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpDenseSymMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDenseSymMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDenseSymMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpDenseVector.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDenseVector.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDenseVector.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpDiagMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDiagMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDiagMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpExactHessianUpdater.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpExactHessianUpdater.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpExactHessianUpdater.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpExpansionMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpExpansionMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpExpansionMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpFilter.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpFilter.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpFilter.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpFilterLSAcceptor.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpFilterLSAcceptor.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpFilterLSAcceptor.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpGenTMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpGenTMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpGenTMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpGradientScaling.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpGradientScaling.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpGradientScaling.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpIdentityMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIdentityMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIdentityMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpInterfacesRegOp.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpInterfacesRegOp.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpInterfacesRegOp.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpIpoptAlg.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIpoptAlg.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIpoptAlg.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpIpoptApplication.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIpoptApplication.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIpoptApplication.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpIpoptCalculatedQuantities.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIpoptCalculatedQuantities.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIpoptCalculatedQuantities.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpIpoptData.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIpoptData.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIpoptData.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpIteratesVector.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIteratesVector.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIteratesVector.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpJournalist.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpJournalist.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpJournalist.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpLapack.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLapack.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLapack.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpLapackSolverInterface.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLapackSolverInterface.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLapackSolverInterface.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpLeastSquareMults.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLeastSquareMults.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLeastSquareMults.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpLimMemQuasiNewtonUpdater.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLimMemQuasiNewtonUpdater.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLimMemQuasiNewtonUpdater.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpLinearSolversRegOp.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLinearSolversRegOp.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLinearSolversRegOp.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpLoqoMuOracle.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLoqoMuOracle.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLoqoMuOracle.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpLowRankAugSystemSolver.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLowRankAugSystemSolver.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLowRankAugSystemSolver.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpLowRankUpdateSymMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLowRankUpdateSymMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLowRankUpdateSymMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpMonotoneMuUpdate.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpMonotoneMuUpdate.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpMonotoneMuUpdate.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpMultiVectorMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpMultiVectorMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpMultiVectorMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpNLPScaling.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpNLPScaling.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpNLPScaling.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpObserver.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpObserver.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpObserver.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpOptErrorConvCheck.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpOptErrorConvCheck.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpOptErrorConvCheck.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpOptionsList.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpOptionsList.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpOptionsList.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpOrigIpoptNLP.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpOrigIpoptNLP.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpOrigIpoptNLP.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpOrigIterationOutput.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpOrigIterationOutput.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpOrigIterationOutput.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpPDFullSpaceSolver.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpPDFullSpaceSolver.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpPDFullSpaceSolver.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpPDPerturbationHandler.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpPDPerturbationHandler.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpPDPerturbationHandler.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpProbingMuOracle.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpProbingMuOracle.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpProbingMuOracle.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpQualityFunctionMuOracle.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpQualityFunctionMuOracle.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpQualityFunctionMuOracle.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpRegOptions.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRegOptions.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRegOptions.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpRestoFilterConvCheck.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoFilterConvCheck.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoFilterConvCheck.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpRestoIpoptNLP.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoIpoptNLP.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoIpoptNLP.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpRestoIterateInitializer.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoIterateInitializer.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoIterateInitializer.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpRestoIterationOutput.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoIterationOutput.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoIterationOutput.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpRestoMinC_1Nrm.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoMinC_1Nrm.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoMinC_1Nrm.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpRestoRestoPhase.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoRestoPhase.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoRestoPhase.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpScaledMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpScaledMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpScaledMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpSolveStatistics.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSolveStatistics.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSolveStatistics.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpStdAugSystemSolver.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpStdAugSystemSolver.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpStdAugSystemSolver.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpStdCInterface.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpStdCInterface.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpStdCInterface.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpStdInterfaceTNLP.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpStdInterfaceTNLP.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpStdInterfaceTNLP.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpSumMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSumMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSumMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpSumSymMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSumSymMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSumSymMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpSymMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSymMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSymMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpSymScaledMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSymScaledMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSymScaledMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpSymTMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSymTMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSymTMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpTNLPAdapter.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTNLPAdapter.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTNLPAdapter.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpTSymLinearSolver.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTSymLinearSolver.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTSymLinearSolver.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpTaggedObject.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTaggedObject.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTaggedObject.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpTimingStatistics.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTimingStatistics.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTimingStatistics.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpTripletHelper.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTripletHelper.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTripletHelper.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpTripletToCSRConverter.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTripletToCSRConverter.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTripletToCSRConverter.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpTripletToDenseConverter.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTripletToDenseConverter.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTripletToDenseConverter.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpUserScaling.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpUserScaling.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpUserScaling.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpUtils.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpUtils.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpUtils.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpVector.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpVector.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpVector.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpWarmStartIterateInitializer.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpWarmStartIterateInitializer.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpWarmStartIterateInitializer.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/IpOpt/IpZeroMatrix.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpZeroMatrix.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpZeroMatrix.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/LBFGSBOptimizer.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/LBFGSBOptimizer.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/LBFGSBOptimizer.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/LBFGSOptimizer.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/LBFGSOptimizer.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/LBFGSOptimizer.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/Optimizer.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/Optimizer.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/Optimizer.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/OptimizerRep.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/OptimizerRep.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/OptimizerRep.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/lbfgs.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/lbfgs.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/lbfgs.cpp.o.d"
+  "/root/repo/SimTKmath/Optimizers/src/lbfgsb.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/lbfgsb.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/Optimizers/src/lbfgsb.cpp.o.d"
+  "/root/repo/SimTKmath/src/About.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/src/About.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/src/About.cpp.o.d"
+  "/root/repo/SimTKmath/src/Differentiator.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/src/Differentiator.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/src/Differentiator.cpp.o.d"
+  "/root/repo/SimTKmath/src/MultibodyGraphMaker.cpp" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/src/MultibodyGraphMaker.cpp.o" "gcc" "SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/__/src/MultibodyGraphMaker.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_debug_build/libSimTKmath_d.so" "/root/repo/_debug_build/libSimTKmath_d.so.3.6"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,338 @@
+file(REMOVE_RECURSE
+  "../../libSimTKmath_d.pdb"
+  "../../libSimTKmath_d.so"
+  "../../libSimTKmath_d.so.3.6"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/BicubicSurface.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/BicubicSurface.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/CollisionDetectionAlgorithm.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/CollisionDetectionAlgorithm.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/Contact.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/Contact.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Brick.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Brick.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Cylinder.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Cylinder.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Ellipsoid.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Ellipsoid.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_HalfSpace.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_HalfSpace.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_SmoothHeightMap.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_SmoothHeightMap.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Sphere.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Sphere.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Torus.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_Torus.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_TriangleMesh.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactGeometry_TriangleMesh.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactTracker.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/ContactTracker.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/GCVSPLUtil.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/GCVSPLUtil.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo_Box.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo_Box.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo_Point.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo_Point.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo_Sphere.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo_Sphere.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo_Triangle.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/Geo_Triangle.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/Geodesic.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/Geodesic.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/OBBTree.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/OBBTree.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/OrientedBoundingBox.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/OrientedBoundingBox.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/gcvspl.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Geometry/src/gcvspl.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/AbstractIntegratorRep.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/AbstractIntegratorRep.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/SimTKcpodes.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/SimTKcpodes.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/nvector_SimTK.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/nvector_SimTK.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_band.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_band.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_bandpre.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_bandpre.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_bbdpre.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_bbdpre.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_dense.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_dense.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_direct.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_direct.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_ic.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_ic.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_io.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_io.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_lapack.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_lapack.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_nls.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_nls.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_proj.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_proj.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_root.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_root.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_spbcgs.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_spbcgs.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_spgmr.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_spgmr.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_spils.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_spils.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_sptfqmr.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/cpodes/cpodes_sptfqmr.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/nvec_ser/fnvector_serial.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/nvec_ser/fnvector_serial.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/nvec_ser/nvector_serial.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/nvec_ser/nvector_serial.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_band.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_band.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_dense.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_dense.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_direct.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_direct.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_iterative.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_iterative.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_lapack.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_lapack.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_math.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_math.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_nvector.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_nvector.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_spbcgs.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_spbcgs.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_spgmr.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_spgmr.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_sptfqmr.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodes/sundials/src/sundials/sundials_sptfqmr.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodesIntegrator.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/CPodesIntegrator.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/ExplicitEulerIntegrator.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/ExplicitEulerIntegrator.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/Integrator.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/Integrator.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/RungeKutta2Integrator.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/RungeKutta2Integrator.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/RungeKutta3Integrator.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/RungeKutta3Integrator.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/RungeKuttaFeldbergIntegrator.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/RungeKuttaFeldbergIntegrator.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/RungeKuttaMersonIntegrator.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/RungeKuttaMersonIntegrator.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/SemiExplicitEuler2Integrator.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/SemiExplicitEuler2Integrator.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/SemiExplicitEulerIntegrator.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/SemiExplicitEulerIntegrator.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/TimeStepper.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/TimeStepper.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/VerletIntegrator.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Integrators/src/VerletIntegrator.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/Eigen.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/Eigen.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/Factor.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/Factor.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/FactorCholesky.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/FactorCholesky.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/FactorQTZ.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/FactorQTZ.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/FactorSVD.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/FactorSVD.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/LapackConvert.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/LapackConvert.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/LapackInterface.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/LinearAlgebra/src/LapackInterface.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/CFSQPOptimizer.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/CFSQPOptimizer.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/CMAESOptimizer.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/CMAESOptimizer.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/InteriorPointOptimizer.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/InteriorPointOptimizer.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpAdaptiveMuUpdate.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpAdaptiveMuUpdate.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpAlgBuilder.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpAlgBuilder.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpAlgorithmRegOp.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpAlgorithmRegOp.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpAugRestoSystemSolver.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpAugRestoSystemSolver.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpBacktrackingLineSearch.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpBacktrackingLineSearch.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpBlas.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpBlas.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpCompoundMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpCompoundMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpCompoundSymMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpCompoundSymMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpCompoundVector.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpCompoundVector.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDebug.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDebug.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDefaultIterateInitializer.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDefaultIterateInitializer.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDenseGenMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDenseGenMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDenseSymMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDenseSymMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDenseVector.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDenseVector.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDiagMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpDiagMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpExactHessianUpdater.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpExactHessianUpdater.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpExpansionMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpExpansionMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpFilter.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpFilter.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpFilterLSAcceptor.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpFilterLSAcceptor.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpGenTMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpGenTMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpGradientScaling.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpGradientScaling.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIdentityMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIdentityMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpInterfacesRegOp.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpInterfacesRegOp.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIpoptAlg.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIpoptAlg.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIpoptApplication.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIpoptApplication.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIpoptCalculatedQuantities.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIpoptCalculatedQuantities.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIpoptData.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIpoptData.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIteratesVector.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpIteratesVector.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpJournalist.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpJournalist.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLapack.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLapack.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLapackSolverInterface.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLapackSolverInterface.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLeastSquareMults.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLeastSquareMults.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLimMemQuasiNewtonUpdater.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLimMemQuasiNewtonUpdater.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLinearSolversRegOp.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLinearSolversRegOp.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLoqoMuOracle.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLoqoMuOracle.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLowRankAugSystemSolver.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLowRankAugSystemSolver.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLowRankUpdateSymMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpLowRankUpdateSymMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpMonotoneMuUpdate.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpMonotoneMuUpdate.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpMultiVectorMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpMultiVectorMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpNLPScaling.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpNLPScaling.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpObserver.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpObserver.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpOptErrorConvCheck.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpOptErrorConvCheck.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpOptionsList.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpOptionsList.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpOrigIpoptNLP.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpOrigIpoptNLP.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpOrigIterationOutput.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpOrigIterationOutput.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpPDFullSpaceSolver.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpPDFullSpaceSolver.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpPDPerturbationHandler.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpPDPerturbationHandler.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpProbingMuOracle.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpProbingMuOracle.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpQualityFunctionMuOracle.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpQualityFunctionMuOracle.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRegOptions.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRegOptions.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoFilterConvCheck.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoFilterConvCheck.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoIpoptNLP.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoIpoptNLP.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoIterateInitializer.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoIterateInitializer.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoIterationOutput.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoIterationOutput.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoMinC_1Nrm.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoMinC_1Nrm.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoRestoPhase.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpRestoRestoPhase.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpScaledMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpScaledMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSolveStatistics.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSolveStatistics.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpStdAugSystemSolver.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpStdAugSystemSolver.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpStdCInterface.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpStdCInterface.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpStdInterfaceTNLP.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpStdInterfaceTNLP.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSumMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSumMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSumSymMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSumSymMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSymMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSymMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSymScaledMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSymScaledMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSymTMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpSymTMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTNLPAdapter.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTNLPAdapter.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTSymLinearSolver.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTSymLinearSolver.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTaggedObject.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTaggedObject.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTimingStatistics.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTimingStatistics.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTripletHelper.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTripletHelper.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTripletToCSRConverter.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTripletToCSRConverter.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTripletToDenseConverter.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpTripletToDenseConverter.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpUserScaling.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpUserScaling.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpUtils.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpUtils.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpVector.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpVector.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpWarmStartIterateInitializer.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpWarmStartIterateInitializer.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpZeroMatrix.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/IpOpt/IpZeroMatrix.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/LBFGSBOptimizer.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/LBFGSBOptimizer.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/LBFGSOptimizer.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/LBFGSOptimizer.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/Optimizer.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/Optimizer.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/OptimizerRep.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/OptimizerRep.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/c-cmaes/cmaes.c.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/c-cmaes/cmaes.c.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/lbfgs.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/lbfgs.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/lbfgsb.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/Optimizers/src/lbfgsb.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/src/About.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/src/About.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/src/Differentiator.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/src/Differentiator.cpp.o.d"
+  "CMakeFiles/SimTKmath.dir/__/src/MultibodyGraphMaker.cpp.o"
+  "CMakeFiles/SimTKmath.dir/__/src/MultibodyGraphMaker.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/SimTKmath.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
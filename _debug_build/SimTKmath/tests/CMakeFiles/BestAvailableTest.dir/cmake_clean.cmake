@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../BestAvailableTest"
+  "../../BestAvailableTest.pdb"
+  "CMakeFiles/BestAvailableTest.dir/BestAvailableTest.cpp.o"
+  "CMakeFiles/BestAvailableTest.dir/BestAvailableTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BestAvailableTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../CMAESTest"
+  "../../CMAESTest.pdb"
+  "CMakeFiles/CMAESTest.dir/CMAESTest.cpp.o"
+  "CMakeFiles/CMAESTest.dir/CMAESTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CMAESTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../CPodesIntegratorTest"
+  "../../CPodesIntegratorTest.pdb"
+  "CMakeFiles/CPodesIntegratorTest.dir/CPodesIntegratorTest.cpp.o"
+  "CMakeFiles/CPodesIntegratorTest.dir/CPodesIntegratorTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CPodesIntegratorTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../DifferentiatorTest"
+  "../../DifferentiatorTest.pdb"
+  "CMakeFiles/DifferentiatorTest.dir/DifferentiatorTest.cpp.o"
+  "CMakeFiles/DifferentiatorTest.dir/DifferentiatorTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DifferentiatorTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
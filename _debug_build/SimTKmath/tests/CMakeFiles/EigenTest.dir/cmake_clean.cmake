@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../EigenTest"
+  "../../EigenTest.pdb"
+  "CMakeFiles/EigenTest.dir/EigenTest.cpp.o"
+  "CMakeFiles/EigenTest.dir/EigenTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/EigenTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
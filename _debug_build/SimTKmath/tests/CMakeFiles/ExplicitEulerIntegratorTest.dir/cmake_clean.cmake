@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../ExplicitEulerIntegratorTest"
+  "../../ExplicitEulerIntegratorTest.pdb"
+  "CMakeFiles/ExplicitEulerIntegratorTest.dir/ExplicitEulerIntegratorTest.cpp.o"
+  "CMakeFiles/ExplicitEulerIntegratorTest.dir/ExplicitEulerIntegratorTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ExplicitEulerIntegratorTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../FactorCholeskyTest"
+  "../../FactorCholeskyTest.pdb"
+  "CMakeFiles/FactorCholeskyTest.dir/FactorCholeskyTest.cpp.o"
+  "CMakeFiles/FactorCholeskyTest.dir/FactorCholeskyTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FactorCholeskyTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
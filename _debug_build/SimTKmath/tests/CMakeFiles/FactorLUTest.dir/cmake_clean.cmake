@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../FactorLUTest"
+  "../../FactorLUTest.pdb"
+  "CMakeFiles/FactorLUTest.dir/FactorLUTest.cpp.o"
+  "CMakeFiles/FactorLUTest.dir/FactorLUTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FactorLUTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../FactorQTZTest"
+  "../../FactorQTZTest.pdb"
+  "CMakeFiles/FactorQTZTest.dir/FactorQTZTest.cpp.o"
+  "CMakeFiles/FactorQTZTest.dir/FactorQTZTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FactorQTZTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
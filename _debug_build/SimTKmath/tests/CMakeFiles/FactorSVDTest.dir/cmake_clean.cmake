@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../FactorSVDTest"
+  "../../FactorSVDTest.pdb"
+  "CMakeFiles/FactorSVDTest.dir/FactorSVDTest.cpp.o"
+  "CMakeFiles/FactorSVDTest.dir/FactorSVDTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FactorSVDTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
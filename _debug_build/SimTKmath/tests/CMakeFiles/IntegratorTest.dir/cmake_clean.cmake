@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../IntegratorTest"
+  "../../IntegratorTest.pdb"
+  "CMakeFiles/IntegratorTest.dir/IntegratorTest.cpp.o"
+  "CMakeFiles/IntegratorTest.dir/IntegratorTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IntegratorTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
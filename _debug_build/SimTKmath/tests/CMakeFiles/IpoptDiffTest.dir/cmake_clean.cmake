@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../IpoptDiffTest"
+  "../../IpoptDiffTest.pdb"
+  "CMakeFiles/IpoptDiffTest.dir/IpoptDiffTest.cpp.o"
+  "CMakeFiles/IpoptDiffTest.dir/IpoptDiffTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IpoptDiffTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
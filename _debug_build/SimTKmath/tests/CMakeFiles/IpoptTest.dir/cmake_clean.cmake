@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../IpoptTest"
+  "../../IpoptTest.pdb"
+  "CMakeFiles/IpoptTest.dir/IpoptTest.cpp.o"
+  "CMakeFiles/IpoptTest.dir/IpoptTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IpoptTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../LBFGSBDiffTest"
+  "../../LBFGSBDiffTest.pdb"
+  "CMakeFiles/LBFGSBDiffTest.dir/LBFGSBDiffTest.cpp.o"
+  "CMakeFiles/LBFGSBDiffTest.dir/LBFGSBDiffTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LBFGSBDiffTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
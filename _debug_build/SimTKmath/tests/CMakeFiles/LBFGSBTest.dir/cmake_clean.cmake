@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../LBFGSBTest"
+  "../../LBFGSBTest.pdb"
+  "CMakeFiles/LBFGSBTest.dir/LBFGSBTest.cpp.o"
+  "CMakeFiles/LBFGSBTest.dir/LBFGSBTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LBFGSBTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
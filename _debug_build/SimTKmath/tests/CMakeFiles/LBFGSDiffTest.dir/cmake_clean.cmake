@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../LBFGSDiffTest"
+  "../../LBFGSDiffTest.pdb"
+  "CMakeFiles/LBFGSDiffTest.dir/LBFGSDiffTest.cpp.o"
+  "CMakeFiles/LBFGSDiffTest.dir/LBFGSDiffTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LBFGSDiffTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../LBFGSTest"
+  "../../LBFGSTest.pdb"
+  "CMakeFiles/LBFGSTest.dir/LBFGSTest.cpp.o"
+  "CMakeFiles/LBFGSTest.dir/LBFGSTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LBFGSTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
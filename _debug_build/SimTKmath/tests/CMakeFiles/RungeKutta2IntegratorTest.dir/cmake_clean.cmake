@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../RungeKutta2IntegratorTest"
+  "../../RungeKutta2IntegratorTest.pdb"
+  "CMakeFiles/RungeKutta2IntegratorTest.dir/RungeKutta2IntegratorTest.cpp.o"
+  "CMakeFiles/RungeKutta2IntegratorTest.dir/RungeKutta2IntegratorTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RungeKutta2IntegratorTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
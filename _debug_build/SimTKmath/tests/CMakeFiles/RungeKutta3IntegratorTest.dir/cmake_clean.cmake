@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../RungeKutta3IntegratorTest"
+  "../../RungeKutta3IntegratorTest.pdb"
+  "CMakeFiles/RungeKutta3IntegratorTest.dir/RungeKutta3IntegratorTest.cpp.o"
+  "CMakeFiles/RungeKutta3IntegratorTest.dir/RungeKutta3IntegratorTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RungeKutta3IntegratorTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../RungeKuttaFeldbergIntegratorTest"
+  "../../RungeKuttaFeldbergIntegratorTest.pdb"
+  "CMakeFiles/RungeKuttaFeldbergIntegratorTest.dir/RungeKuttaFeldbergIntegratorTest.cpp.o"
+  "CMakeFiles/RungeKuttaFeldbergIntegratorTest.dir/RungeKuttaFeldbergIntegratorTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RungeKuttaFeldbergIntegratorTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
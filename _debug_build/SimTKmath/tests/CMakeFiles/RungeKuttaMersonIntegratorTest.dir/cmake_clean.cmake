@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../RungeKuttaMersonIntegratorTest"
+  "../../RungeKuttaMersonIntegratorTest.pdb"
+  "CMakeFiles/RungeKuttaMersonIntegratorTest.dir/RungeKuttaMersonIntegratorTest.cpp.o"
+  "CMakeFiles/RungeKuttaMersonIntegratorTest.dir/RungeKuttaMersonIntegratorTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RungeKuttaMersonIntegratorTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../SemiExplicitEuler2IntegratorTest"
+  "../../SemiExplicitEuler2IntegratorTest.pdb"
+  "CMakeFiles/SemiExplicitEuler2IntegratorTest.dir/SemiExplicitEuler2IntegratorTest.cpp.o"
+  "CMakeFiles/SemiExplicitEuler2IntegratorTest.dir/SemiExplicitEuler2IntegratorTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SemiExplicitEuler2IntegratorTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../SemiExplicitEulerIntegratorTest"
+  "../../SemiExplicitEulerIntegratorTest.pdb"
+  "CMakeFiles/SemiExplicitEulerIntegratorTest.dir/SemiExplicitEulerIntegratorTest.cpp.o"
+  "CMakeFiles/SemiExplicitEulerIntegratorTest.dir/SemiExplicitEulerIntegratorTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SemiExplicitEulerIntegratorTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
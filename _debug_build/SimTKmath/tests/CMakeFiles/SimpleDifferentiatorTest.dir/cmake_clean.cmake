@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../SimpleDifferentiatorTest"
+  "../../SimpleDifferentiatorTest.pdb"
+  "CMakeFiles/SimpleDifferentiatorTest.dir/SimpleDifferentiatorTest.cpp.o"
+  "CMakeFiles/SimpleDifferentiatorTest.dir/SimpleDifferentiatorTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SimpleDifferentiatorTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
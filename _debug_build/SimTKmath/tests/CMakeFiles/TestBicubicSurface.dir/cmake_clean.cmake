@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestBicubicSurface"
+  "../../TestBicubicSurface.pdb"
+  "CMakeFiles/TestBicubicSurface.dir/TestBicubicSurface.cpp.o"
+  "CMakeFiles/TestBicubicSurface.dir/TestBicubicSurface.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestBicubicSurface.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
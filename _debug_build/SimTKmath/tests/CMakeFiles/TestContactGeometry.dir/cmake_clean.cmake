@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestContactGeometry"
+  "../../TestContactGeometry.pdb"
+  "CMakeFiles/TestContactGeometry.dir/TestContactGeometry.cpp.o"
+  "CMakeFiles/TestContactGeometry.dir/TestContactGeometry.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestContactGeometry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
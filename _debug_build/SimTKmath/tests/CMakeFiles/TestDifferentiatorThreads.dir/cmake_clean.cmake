@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestDifferentiatorThreads"
+  "../../TestDifferentiatorThreads.pdb"
+  "CMakeFiles/TestDifferentiatorThreads.dir/TestDifferentiatorThreads.cpp.o"
+  "CMakeFiles/TestDifferentiatorThreads.dir/TestDifferentiatorThreads.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestDifferentiatorThreads.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestGeo"
+  "../../TestGeo.pdb"
+  "CMakeFiles/TestGeo.dir/TestGeo.cpp.o"
+  "CMakeFiles/TestGeo.dir/TestGeo.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestGeo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
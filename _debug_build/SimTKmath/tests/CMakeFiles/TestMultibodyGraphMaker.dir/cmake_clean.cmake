@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestMultibodyGraphMaker"
+  "../../TestMultibodyGraphMaker.pdb"
+  "CMakeFiles/TestMultibodyGraphMaker.dir/TestMultibodyGraphMaker.cpp.o"
+  "CMakeFiles/TestMultibodyGraphMaker.dir/TestMultibodyGraphMaker.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestMultibodyGraphMaker.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
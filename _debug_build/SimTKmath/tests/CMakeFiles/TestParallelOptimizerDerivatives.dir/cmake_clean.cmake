@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestParallelOptimizerDerivatives"
+  "../../TestParallelOptimizerDerivatives.pdb"
+  "CMakeFiles/TestParallelOptimizerDerivatives.dir/TestParallelOptimizerDerivatives.cpp.o"
+  "CMakeFiles/TestParallelOptimizerDerivatives.dir/TestParallelOptimizerDerivatives.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestParallelOptimizerDerivatives.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestSparseDerivatives"
+  "../../TestSparseDerivatives.pdb"
+  "CMakeFiles/TestSparseDerivatives.dir/TestSparseDerivatives.cpp.o"
+  "CMakeFiles/TestSparseDerivatives.dir/TestSparseDerivatives.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestSparseDerivatives.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestSpline"
+  "../../TestSpline.pdb"
+  "CMakeFiles/TestSpline.dir/TestSpline.cpp.o"
+  "CMakeFiles/TestSpline.dir/TestSpline.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestSpline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
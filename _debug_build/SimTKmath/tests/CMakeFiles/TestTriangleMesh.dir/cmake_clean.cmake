@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestTriangleMesh"
+  "../../TestTriangleMesh.pdb"
+  "CMakeFiles/TestTriangleMesh.dir/TestTriangleMesh.cpp.o"
+  "CMakeFiles/TestTriangleMesh.dir/TestTriangleMesh.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestTriangleMesh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
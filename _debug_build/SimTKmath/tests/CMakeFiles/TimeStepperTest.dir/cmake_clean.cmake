@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TimeStepperTest"
+  "../../TimeStepperTest.pdb"
+  "CMakeFiles/TimeStepperTest.dir/TimeStepperTest.cpp.o"
+  "CMakeFiles/TimeStepperTest.dir/TimeStepperTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TimeStepperTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
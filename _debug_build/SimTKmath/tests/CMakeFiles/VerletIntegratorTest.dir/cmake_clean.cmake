@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../VerletIntegratorTest"
+  "../../VerletIntegratorTest.pdb"
+  "CMakeFiles/VerletIntegratorTest.dir/VerletIntegratorTest.cpp.o"
+  "CMakeFiles/VerletIntegratorTest.dir/VerletIntegratorTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/VerletIntegratorTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,77 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/SimTKmath/tests
+# Build directory: /root/repo/_debug_build/SimTKmath/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(BestAvailableTest "/root/repo/_debug_build/BestAvailableTest")
+set_tests_properties(BestAvailableTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(CMAESTest "/root/repo/_debug_build/CMAESTest")
+set_tests_properties(CMAESTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(CPodesIntegratorTest "/root/repo/_debug_build/CPodesIntegratorTest")
+set_tests_properties(CPodesIntegratorTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(DifferentiatorTest "/root/repo/_debug_build/DifferentiatorTest")
+set_tests_properties(DifferentiatorTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(EigenTest "/root/repo/_debug_build/EigenTest")
+set_tests_properties(EigenTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(ExplicitEulerIntegratorTest "/root/repo/_debug_build/ExplicitEulerIntegratorTest")
+set_tests_properties(ExplicitEulerIntegratorTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(FactorCholeskyTest "/root/repo/_debug_build/FactorCholeskyTest")
+set_tests_properties(FactorCholeskyTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(FactorLUTest "/root/repo/_debug_build/FactorLUTest")
+set_tests_properties(FactorLUTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(FactorQTZTest "/root/repo/_debug_build/FactorQTZTest")
+set_tests_properties(FactorQTZTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(FactorSVDTest "/root/repo/_debug_build/FactorSVDTest")
+set_tests_properties(FactorSVDTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(IntegratorTest "/root/repo/_debug_build/IntegratorTest")
+set_tests_properties(IntegratorTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(IpoptDiffTest "/root/repo/_debug_build/IpoptDiffTest")
+set_tests_properties(IpoptDiffTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(IpoptTest "/root/repo/_debug_build/IpoptTest")
+set_tests_properties(IpoptTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(LBFGSBDiffTest "/root/repo/_debug_build/LBFGSBDiffTest")
+set_tests_properties(LBFGSBDiffTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(LBFGSBTest "/root/repo/_debug_build/LBFGSBTest")
+set_tests_properties(LBFGSBTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(LBFGSDiffTest "/root/repo/_debug_build/LBFGSDiffTest")
+set_tests_properties(LBFGSDiffTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(LBFGSTest "/root/repo/_debug_build/LBFGSTest")
+set_tests_properties(LBFGSTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(RungeKutta2IntegratorTest "/root/repo/_debug_build/RungeKutta2IntegratorTest")
+set_tests_properties(RungeKutta2IntegratorTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(RungeKutta3IntegratorTest "/root/repo/_debug_build/RungeKutta3IntegratorTest")
+set_tests_properties(RungeKutta3IntegratorTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(RungeKuttaFeldbergIntegratorTest "/root/repo/_debug_build/RungeKuttaFeldbergIntegratorTest")
+set_tests_properties(RungeKuttaFeldbergIntegratorTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(RungeKuttaMersonIntegratorTest "/root/repo/_debug_build/RungeKuttaMersonIntegratorTest")
+set_tests_properties(RungeKuttaMersonIntegratorTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(SemiExplicitEuler2IntegratorTest "/root/repo/_debug_build/SemiExplicitEuler2IntegratorTest")
+set_tests_properties(SemiExplicitEuler2IntegratorTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(SemiExplicitEulerIntegratorTest "/root/repo/_debug_build/SemiExplicitEulerIntegratorTest")
+set_tests_properties(SemiExplicitEulerIntegratorTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(SimpleDifferentiatorTest "/root/repo/_debug_build/SimpleDifferentiatorTest")
+set_tests_properties(SimpleDifferentiatorTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(TestBicubicSurface "/root/repo/_debug_build/TestBicubicSurface")
+set_tests_properties(TestBicubicSurface PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(TestContactGeometry "/root/repo/_debug_build/TestContactGeometry")
+set_tests_properties(TestContactGeometry PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(TestDifferentiatorThreads "/root/repo/_debug_build/TestDifferentiatorThreads")
+set_tests_properties(TestDifferentiatorThreads PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(TestGeo "/root/repo/_debug_build/TestGeo")
+set_tests_properties(TestGeo PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(TestMultibodyGraphMaker "/root/repo/_debug_build/TestMultibodyGraphMaker")
+set_tests_properties(TestMultibodyGraphMaker PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(TestParallelOptimizerDerivatives "/root/repo/_debug_build/TestParallelOptimizerDerivatives")
+set_tests_properties(TestParallelOptimizerDerivatives PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(TestSparseDerivatives "/root/repo/_debug_build/TestSparseDerivatives")
+set_tests_properties(TestSparseDerivatives PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(TestSpline "/root/repo/_debug_build/TestSpline")
+set_tests_properties(TestSpline PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(TestTriangleMesh "/root/repo/_debug_build/TestTriangleMesh")
+set_tests_properties(TestTriangleMesh PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(TimeStepperTest "/root/repo/_debug_build/TimeStepperTest")
+set_tests_properties(TimeStepperTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+add_test(VerletIntegratorTest "/root/repo/_debug_build/VerletIntegratorTest")
+set_tests_properties(VerletIntegratorTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/SimTKmath/tests/CMakeLists.txt;41;add_test;/root/repo/SimTKmath/tests/CMakeLists.txt;0;")
+subdirs("adhoc")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../nlpqlp"
+  "../../../nlpqlp.pdb"
+  "CMakeFiles/nlpqlp.dir/nlpqlp.cpp.o"
+  "CMakeFiles/nlpqlp.dir/nlpqlp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nlpqlp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Simbody
+# Build directory: /root/repo/_debug_build/Simbody
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("sharedTarget")
+subdirs("tests")
@@ -0,0 +1,154 @@
+# Install script for directory: /root/repo/Simbody
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/simbody" TYPE FILE FILES
+    "/root/repo/Simbody/include/SimTKsimbody.h"
+    "/root/repo/Simbody/include/SimTKsimbody_aux.h"
+    "/root/repo/Simbody/include/Simbody.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/simbody/simbody/internal" TYPE FILE FILES
+    "/root/repo/Simbody/Visualizer/include/simbody/internal/Visualizer.h"
+    "/root/repo/Simbody/Visualizer/include/simbody/internal/Visualizer_InputListener.h"
+    "/root/repo/Simbody/Visualizer/include/simbody/internal/Visualizer_Reporter.h"
+    "/root/repo/Simbody/include/simbody/internal/Assembler.h"
+    "/root/repo/Simbody/include/simbody/internal/AssemblyCondition.h"
+    "/root/repo/Simbody/include/simbody/internal/AssemblyCondition_Markers.h"
+    "/root/repo/Simbody/include/simbody/internal/AssemblyCondition_OrientationSensors.h"
+    "/root/repo/Simbody/include/simbody/internal/AssemblyCondition_QValue.h"
+    "/root/repo/Simbody/include/simbody/internal/Body.h"
+    "/root/repo/Simbody/include/simbody/internal/CablePath.h"
+    "/root/repo/Simbody/include/simbody/internal/CableSpring.h"
+    "/root/repo/Simbody/include/simbody/internal/CableTrackerSubsystem.h"
+    "/root/repo/Simbody/include/simbody/internal/CompliantContactSubsystem.h"
+    "/root/repo/Simbody/include/simbody/internal/ConditionalConstraint.h"
+    "/root/repo/Simbody/include/simbody/internal/Constraint.h"
+    "/root/repo/Simbody/include/simbody/internal/Constraint_Ball.h"
+    "/root/repo/Simbody/include/simbody/internal/Constraint_BuiltIns.h"
+    "/root/repo/Simbody/include/simbody/internal/Constraint_LineOnLineContact.h"
+    "/root/repo/Simbody/include/simbody/internal/Constraint_PointInPlane.h"
+    "/root/repo/Simbody/include/simbody/internal/Constraint_PointOnPlaneContact.h"
+    "/root/repo/Simbody/include/simbody/internal/Constraint_Rod.h"
+    "/root/repo/Simbody/include/simbody/internal/Constraint_SphereOnPlaneContact.h"
+    "/root/repo/Simbody/include/simbody/internal/Constraint_SphereOnSphereContact.h"
+    "/root/repo/Simbody/include/simbody/internal/Constraint_Weld.h"
+    "/root/repo/Simbody/include/simbody/internal/ContactSurface.h"
+    "/root/repo/Simbody/include/simbody/internal/ContactTrackerSubsystem.h"
+    "/root/repo/Simbody/include/simbody/internal/DecorationSubsystem.h"
+    "/root/repo/Simbody/include/simbody/internal/ElasticFoundationForce.h"
+    "/root/repo/Simbody/include/simbody/internal/Force.h"
+    "/root/repo/Simbody/include/simbody/internal/ForceSubsystem.h"
+    "/root/repo/Simbody/include/simbody/internal/ForceSubsystemGuts.h"
+    "/root/repo/Simbody/include/simbody/internal/Force_BuiltIns.h"
+    "/root/repo/Simbody/include/simbody/internal/Force_Custom.h"
+    "/root/repo/Simbody/include/simbody/internal/Force_DiscreteForces.h"
+    "/root/repo/Simbody/include/simbody/internal/Force_Gravity.h"
+    "/root/repo/Simbody/include/simbody/internal/Force_LinearBushing.h"
+    "/root/repo/Simbody/include/simbody/internal/Force_MobilityConstantForce.h"
+    "/root/repo/Simbody/include/simbody/internal/Force_MobilityDiscreteForce.h"
+    "/root/repo/Simbody/include/simbody/internal/Force_MobilityLinearDamper.h"
+    "/root/repo/Simbody/include/simbody/internal/Force_MobilityLinearSpring.h"
+    "/root/repo/Simbody/include/simbody/internal/Force_MobilityLinearStop.h"
+    "/root/repo/Simbody/include/simbody/internal/Force_Thermostat.h"
+    "/root/repo/Simbody/include/simbody/internal/GeneralContactSubsystem.h"
+    "/root/repo/Simbody/include/simbody/internal/GeneralForceSubsystem.h"
+    "/root/repo/Simbody/include/simbody/internal/HuntCrossleyContact.h"
+    "/root/repo/Simbody/include/simbody/internal/HuntCrossleyForce.h"
+    "/root/repo/Simbody/include/simbody/internal/ImpulseSolver.h"
+    "/root/repo/Simbody/include/simbody/internal/Linearizer.h"
+    "/root/repo/Simbody/include/simbody/internal/LocalEnergyMinimizer.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_Ball.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_BendStretch.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_BuiltIns.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_Bushing.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_Custom.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_Cylinder.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_Ellipsoid.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_Free.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_FreeLine.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_FunctionBased.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_Gimbal.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_Ground.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_LineOrientation.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_Pin.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_Planar.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_Screw.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_Slider.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_SphericalCoords.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_Translation.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_Universal.h"
+    "/root/repo/Simbody/include/simbody/internal/MobilizedBody_Weld.h"
+    "/root/repo/Simbody/include/simbody/internal/Motion.h"
+    "/root/repo/Simbody/include/simbody/internal/MultibodySystem.h"
+    "/root/repo/Simbody/include/simbody/internal/ObservedPointFitter.h"
+    "/root/repo/Simbody/include/simbody/internal/PGSImpulseSolver.h"
+    "/root/repo/Simbody/include/simbody/internal/PLUSImpulseSolver.h"
+    "/root/repo/Simbody/include/simbody/internal/SemiExplicitEulerTimeStepper.h"
+    "/root/repo/Simbody/include/simbody/internal/SimbodyMatterSubsystem.h"
+    "/root/repo/Simbody/include/simbody/internal/SimbodyMatterSubtree.h"
+    "/root/repo/Simbody/include/simbody/internal/SparseMassMatrix.h"
+    "/root/repo/Simbody/include/simbody/internal/TextDataEventReporter.h"
+    "/root/repo/Simbody/include/simbody/internal/common.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/doc/simbody" TYPE FILE FILES
+    "/root/repo/Simbody/doc/SimbodyAdvancedProgrammingGuide.pdf"
+    "/root/repo/Simbody/doc/SimbodyAndMolmodelUserGuide.pdf"
+    "/root/repo/Simbody/doc/SimbodyTheoryManual.pdf"
+    )
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_debug_build/Simbody/sharedTarget/cmake_install.cmake")
+  include("/root/repo/_debug_build/Simbody/tests/cmake_install.cmake")
+
+endif()
+
@@ -0,0 +1,82 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Simbody/Visualizer/src/Visualizer.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/Visualizer.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/Visualizer.cpp.o.d"
+  "/root/repo/Simbody/Visualizer/src/VisualizerGeometry.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/VisualizerGeometry.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/VisualizerGeometry.cpp.o.d"
+  "/root/repo/Simbody/Visualizer/src/VisualizerProtocol.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/VisualizerProtocol.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/VisualizerProtocol.cpp.o.d"
+  "/root/repo/Simbody/Visualizer/src/Visualizer_InputListener.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/Visualizer_InputListener.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/Visualizer_InputListener.cpp.o.d"
+  "/root/repo/Simbody/Visualizer/src/Visualizer_Reporter.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/Visualizer_Reporter.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/Visualizer_Reporter.cpp.o.d"
+  "/root/repo/Simbody/src/About.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/About.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/About.cpp.o.d"
+  "/root/repo/Simbody/src/Assembler.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Assembler.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Assembler.cpp.o.d"
+  "/root/repo/Simbody/src/AssemblyCondition_Markers.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/AssemblyCondition_Markers.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/AssemblyCondition_Markers.cpp.o.d"
+  "/root/repo/Simbody/src/AssemblyCondition_OrientationSensors.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/AssemblyCondition_OrientationSensors.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/AssemblyCondition_OrientationSensors.cpp.o.d"
+  "/root/repo/Simbody/src/Body.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Body.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Body.cpp.o.d"
+  "/root/repo/Simbody/src/CablePath.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/CablePath.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/CablePath.cpp.o.d"
+  "/root/repo/Simbody/src/CableSpring.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/CableSpring.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/CableSpring.cpp.o.d"
+  "/root/repo/Simbody/src/CableTrackerSubsystem.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/CableTrackerSubsystem.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/CableTrackerSubsystem.cpp.o.d"
+  "/root/repo/Simbody/src/CompliantContactSubsystem.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/CompliantContactSubsystem.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/CompliantContactSubsystem.cpp.o.d"
+  "/root/repo/Simbody/src/ConditionalConstraint.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/ConditionalConstraint.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/ConditionalConstraint.cpp.o.d"
+  "/root/repo/Simbody/src/Constraint.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Constraint.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Constraint.cpp.o.d"
+  "/root/repo/Simbody/src/Constraint_LineOnLineContact.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Constraint_LineOnLineContact.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Constraint_LineOnLineContact.cpp.o.d"
+  "/root/repo/Simbody/src/Constraint_PointOnPlaneContact.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Constraint_PointOnPlaneContact.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Constraint_PointOnPlaneContact.cpp.o.d"
+  "/root/repo/Simbody/src/Constraint_Rod.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Constraint_Rod.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Constraint_Rod.cpp.o.d"
+  "/root/repo/Simbody/src/Constraint_SphereOnPlaneContact.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Constraint_SphereOnPlaneContact.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Constraint_SphereOnPlaneContact.cpp.o.d"
+  "/root/repo/Simbody/src/Constraint_SphereOnSphereContact.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Constraint_SphereOnSphereContact.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Constraint_SphereOnSphereContact.cpp.o.d"
+  "/root/repo/Simbody/src/ContactTrackerSubsystem.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/ContactTrackerSubsystem.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/ContactTrackerSubsystem.cpp.o.d"
+  "/root/repo/Simbody/src/DecorationSubsystem.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/DecorationSubsystem.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/DecorationSubsystem.cpp.o.d"
+  "/root/repo/Simbody/src/ElasticFoundationForce.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/ElasticFoundationForce.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/ElasticFoundationForce.cpp.o.d"
+  "/root/repo/Simbody/src/Force.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Force.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Force.cpp.o.d"
+  "/root/repo/Simbody/src/ForceSubsystem.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/ForceSubsystem.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/ForceSubsystem.cpp.o.d"
+  "/root/repo/Simbody/src/Force_Gravity.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Force_Gravity.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Force_Gravity.cpp.o.d"
+  "/root/repo/Simbody/src/Force_Instantiations.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Force_Instantiations.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Force_Instantiations.cpp.o.d"
+  "/root/repo/Simbody/src/Force_LinearBushing.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Force_LinearBushing.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Force_LinearBushing.cpp.o.d"
+  "/root/repo/Simbody/src/Force_Thermostat.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Force_Thermostat.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Force_Thermostat.cpp.o.d"
+  "/root/repo/Simbody/src/GeneralContactSubsystem.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/GeneralContactSubsystem.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/GeneralContactSubsystem.cpp.o.d"
+  "/root/repo/Simbody/src/GeneralForceSubsystem.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/GeneralForceSubsystem.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/GeneralForceSubsystem.cpp.o.d"
+  "/root/repo/Simbody/src/HuntCrossleyContact.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/HuntCrossleyContact.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/HuntCrossleyContact.cpp.o.d"
+  "/root/repo/Simbody/src/HuntCrossleyForce.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/HuntCrossleyForce.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/HuntCrossleyForce.cpp.o.d"
+  "/root/repo/Simbody/src/ImpulseSolver.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/ImpulseSolver.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/ImpulseSolver.cpp.o.d"
+  "/root/repo/Simbody/src/Linearizer.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Linearizer.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Linearizer.cpp.o.d"
+  "/root/repo/Simbody/src/LocalEnergyMinimizer.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/LocalEnergyMinimizer.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/LocalEnergyMinimizer.cpp.o.d"
+  "/root/repo/Simbody/src/Matter_Instantiations.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Matter_Instantiations.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Matter_Instantiations.cpp.o.d"
+  "/root/repo/Simbody/src/MobilizedBody.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/MobilizedBody.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/MobilizedBody.cpp.o.d"
+  "/root/repo/Simbody/src/Motion.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Motion.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/Motion.cpp.o.d"
+  "/root/repo/Simbody/src/MultibodySystem.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/MultibodySystem.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/MultibodySystem.cpp.o.d"
+  "/root/repo/Simbody/src/OBSOLETE_LengthConstraints.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/OBSOLETE_LengthConstraints.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/OBSOLETE_LengthConstraints.cpp.o.d"
+  "/root/repo/Simbody/src/ObservedPointFitter.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/ObservedPointFitter.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/ObservedPointFitter.cpp.o.d"
+  "/root/repo/Simbody/src/PGSImpulseSolver.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/PGSImpulseSolver.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/PGSImpulseSolver.cpp.o.d"
+  "/root/repo/Simbody/src/PLUSImpulseSolver.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/PLUSImpulseSolver.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/PLUSImpulseSolver.cpp.o.d"
+  "/root/repo/Simbody/src/RigidBodyNode.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNode.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNode.cpp.o.d"
+  "/root/repo/Simbody/src/RigidBodyNodeSpec.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNodeSpec.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNodeSpec.cpp.o.d"
+  "/root/repo/Simbody/src/RigidBodyNodeSpec_Derived.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNodeSpec_Derived.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNodeSpec_Derived.cpp.o.d"
+  "/root/repo/Simbody/src/RigidBodyNode_LoneParticle.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNode_LoneParticle.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNode_LoneParticle.cpp.o.d"
+  "/root/repo/Simbody/src/RigidBodyNode_Weld.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNode_Weld.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNode_Weld.cpp.o.d"
+  "/root/repo/Simbody/src/SemiExplicitEulerTimeStepper.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/SemiExplicitEulerTimeStepper.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/SemiExplicitEulerTimeStepper.cpp.o.d"
+  "/root/repo/Simbody/src/SimbodyMatterSubsystem.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/SimbodyMatterSubsystem.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/SimbodyMatterSubsystem.cpp.o.d"
+  "/root/repo/Simbody/src/SimbodyMatterSubsystemRep.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/SimbodyMatterSubsystemRep.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/SimbodyMatterSubsystemRep.cpp.o.d"
+  "/root/repo/Simbody/src/SimbodyMatterSubtree.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/SimbodyMatterSubtree.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/SimbodyMatterSubtree.cpp.o.d"
+  "/root/repo/Simbody/src/SparseMassMatrix.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/SparseMassMatrix.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/SparseMassMatrix.cpp.o.d"
+  "/root/repo/Simbody/src/TextDataEventReporter.cpp" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/TextDataEventReporter.cpp.o" "gcc" "Simbody/sharedTarget/CMakeFiles/SimTKsimbody.dir/__/src/TextDataEventReporter.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_debug_build/libSimTKsimbody_d.so" "/root/repo/_debug_build/libSimTKsimbody_d.so.3.6"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/SimTKmath/sharedTarget/CMakeFiles/SimTKmath.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/SimTKcommon/sharedTarget/CMakeFiles/SimTKcommon.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
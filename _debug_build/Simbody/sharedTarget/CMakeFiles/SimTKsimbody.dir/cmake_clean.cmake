@@ -0,0 +1,122 @@
+file(REMOVE_RECURSE
+  "../../libSimTKsimbody_d.pdb"
+  "../../libSimTKsimbody_d.so"
+  "../../libSimTKsimbody_d.so.3.6"
+  "CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/Visualizer.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/Visualizer.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/VisualizerGeometry.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/VisualizerGeometry.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/VisualizerProtocol.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/VisualizerProtocol.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/Visualizer_InputListener.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/Visualizer_InputListener.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/Visualizer_Reporter.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/Visualizer/src/Visualizer_Reporter.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/About.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/About.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Assembler.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Assembler.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/AssemblyCondition_Markers.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/AssemblyCondition_Markers.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/AssemblyCondition_OrientationSensors.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/AssemblyCondition_OrientationSensors.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Body.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Body.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/CablePath.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/CablePath.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/CableSpring.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/CableSpring.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/CableTrackerSubsystem.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/CableTrackerSubsystem.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/CompliantContactSubsystem.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/CompliantContactSubsystem.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/ConditionalConstraint.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/ConditionalConstraint.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Constraint.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Constraint.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Constraint_LineOnLineContact.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Constraint_LineOnLineContact.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Constraint_PointOnPlaneContact.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Constraint_PointOnPlaneContact.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Constraint_Rod.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Constraint_Rod.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Constraint_SphereOnPlaneContact.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Constraint_SphereOnPlaneContact.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Constraint_SphereOnSphereContact.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Constraint_SphereOnSphereContact.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/ContactTrackerSubsystem.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/ContactTrackerSubsystem.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/DecorationSubsystem.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/DecorationSubsystem.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/ElasticFoundationForce.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/ElasticFoundationForce.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Force.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Force.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/ForceSubsystem.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/ForceSubsystem.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Force_Gravity.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Force_Gravity.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Force_Instantiations.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Force_Instantiations.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Force_LinearBushing.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Force_LinearBushing.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Force_Thermostat.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Force_Thermostat.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/GeneralContactSubsystem.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/GeneralContactSubsystem.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/GeneralForceSubsystem.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/GeneralForceSubsystem.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/HuntCrossleyContact.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/HuntCrossleyContact.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/HuntCrossleyForce.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/HuntCrossleyForce.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/ImpulseSolver.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/ImpulseSolver.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Linearizer.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Linearizer.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/LocalEnergyMinimizer.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/LocalEnergyMinimizer.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Matter_Instantiations.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Matter_Instantiations.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/MobilizedBody.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/MobilizedBody.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Motion.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/Motion.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/MultibodySystem.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/MultibodySystem.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/OBSOLETE_LengthConstraints.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/OBSOLETE_LengthConstraints.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/ObservedPointFitter.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/ObservedPointFitter.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/PGSImpulseSolver.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/PGSImpulseSolver.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/PLUSImpulseSolver.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/PLUSImpulseSolver.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNode.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNode.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNodeSpec.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNodeSpec.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNodeSpec_Derived.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNodeSpec_Derived.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNode_LoneParticle.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNode_LoneParticle.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNode_Weld.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/RigidBodyNode_Weld.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/SemiExplicitEulerTimeStepper.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/SemiExplicitEulerTimeStepper.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/SimbodyMatterSubsystem.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/SimbodyMatterSubsystem.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/SimbodyMatterSubsystemRep.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/SimbodyMatterSubsystemRep.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/SimbodyMatterSubtree.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/SimbodyMatterSubtree.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/SparseMassMatrix.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/SparseMassMatrix.cpp.o.d"
+  "CMakeFiles/SimTKsimbody.dir/__/src/TextDataEventReporter.cpp.o"
+  "CMakeFiles/SimTKsimbody.dir/__/src/TextDataEventReporter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SimTKsimbody.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
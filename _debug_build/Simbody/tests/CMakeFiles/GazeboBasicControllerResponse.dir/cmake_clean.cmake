@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../GazeboBasicControllerResponse"
+  "../../GazeboBasicControllerResponse.pdb"
+  "CMakeFiles/GazeboBasicControllerResponse.dir/GazeboBasicControllerResponse.cpp.o"
+  "CMakeFiles/GazeboBasicControllerResponse.dir/GazeboBasicControllerResponse.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GazeboBasicControllerResponse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
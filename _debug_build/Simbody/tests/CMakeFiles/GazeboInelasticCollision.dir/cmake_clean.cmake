@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../GazeboInelasticCollision"
+  "../../GazeboInelasticCollision.pdb"
+  "CMakeFiles/GazeboInelasticCollision.dir/GazeboInelasticCollision.cpp.o"
+  "CMakeFiles/GazeboInelasticCollision.dir/GazeboInelasticCollision.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GazeboInelasticCollision.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
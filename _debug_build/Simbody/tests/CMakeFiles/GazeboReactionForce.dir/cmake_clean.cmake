@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../GazeboReactionForce"
+  "../../GazeboReactionForce.pdb"
+  "CMakeFiles/GazeboReactionForce.dir/GazeboReactionForce.cpp.o"
+  "CMakeFiles/GazeboReactionForce.dir/GazeboReactionForce.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GazeboReactionForce.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../GazeboReactionForceWithAppliedForceCompliant"
+  "../../GazeboReactionForceWithAppliedForceCompliant.pdb"
+  "CMakeFiles/GazeboReactionForceWithAppliedForceCompliant.dir/GazeboReactionForceWithAppliedForceCompliant.cpp.o"
+  "CMakeFiles/GazeboReactionForceWithAppliedForceCompliant.dir/GazeboReactionForceWithAppliedForceCompliant.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GazeboReactionForceWithAppliedForceCompliant.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../GazeboReactionForceWithAppliedForceRigid"
+  "../../GazeboReactionForceWithAppliedForceRigid.pdb"
+  "CMakeFiles/GazeboReactionForceWithAppliedForceRigid.dir/GazeboReactionForceWithAppliedForceRigid.cpp.o"
+  "CMakeFiles/GazeboReactionForceWithAppliedForceRigid.dir/GazeboReactionForceWithAppliedForceRigid.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GazeboReactionForceWithAppliedForceRigid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestAngleConversions"
+  "../../TestAngleConversions.pdb"
+  "CMakeFiles/TestAngleConversions.dir/TestAngleConversions.cpp.o"
+  "CMakeFiles/TestAngleConversions.dir/TestAngleConversions.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestAngleConversions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestAssemblerTrackTrial"
+  "../../TestAssemblerTrackTrial.pdb"
+  "CMakeFiles/TestAssemblerTrackTrial.dir/TestAssemblerTrackTrial.cpp.o"
+  "CMakeFiles/TestAssemblerTrackTrial.dir/TestAssemblerTrackTrial.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestAssemblerTrackTrial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
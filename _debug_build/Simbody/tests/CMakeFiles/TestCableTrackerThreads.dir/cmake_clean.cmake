@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestCableTrackerThreads"
+  "../../TestCableTrackerThreads.pdb"
+  "CMakeFiles/TestCableTrackerThreads.dir/TestCableTrackerThreads.cpp.o"
+  "CMakeFiles/TestCableTrackerThreads.dir/TestCableTrackerThreads.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCableTrackerThreads.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestCollisionDetectionAlgorithm"
+  "../../TestCollisionDetectionAlgorithm.pdb"
+  "CMakeFiles/TestCollisionDetectionAlgorithm.dir/TestCollisionDetectionAlgorithm.cpp.o"
+  "CMakeFiles/TestCollisionDetectionAlgorithm.dir/TestCollisionDetectionAlgorithm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCollisionDetectionAlgorithm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestConstraints"
+  "../../TestConstraints.pdb"
+  "CMakeFiles/TestConstraints.dir/TestConstraints.cpp.o"
+  "CMakeFiles/TestConstraints.dir/TestConstraints.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestConstraints.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestContactForceThreads"
+  "../../TestContactForceThreads.pdb"
+  "CMakeFiles/TestContactForceThreads.dir/TestContactForceThreads.cpp.o"
+  "CMakeFiles/TestContactForceThreads.dir/TestContactForceThreads.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestContactForceThreads.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestCustomConstraints"
+  "../../TestCustomConstraints.pdb"
+  "CMakeFiles/TestCustomConstraints.dir/TestCustomConstraints.cpp.o"
+  "CMakeFiles/TestCustomConstraints.dir/TestCustomConstraints.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCustomConstraints.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestCustomMobilizedBodies"
+  "../../TestCustomMobilizedBodies.pdb"
+  "CMakeFiles/TestCustomMobilizedBodies.dir/TestCustomMobilizedBodies.cpp.o"
+  "CMakeFiles/TestCustomMobilizedBodies.dir/TestCustomMobilizedBodies.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCustomMobilizedBodies.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
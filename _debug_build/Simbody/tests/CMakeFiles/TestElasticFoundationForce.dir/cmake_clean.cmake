@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestElasticFoundationForce"
+  "../../TestElasticFoundationForce.pdb"
+  "CMakeFiles/TestElasticFoundationForce.dir/TestElasticFoundationForce.cpp.o"
+  "CMakeFiles/TestElasticFoundationForce.dir/TestElasticFoundationForce.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestElasticFoundationForce.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
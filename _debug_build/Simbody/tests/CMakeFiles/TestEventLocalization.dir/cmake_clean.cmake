@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestEventLocalization"
+  "../../TestEventLocalization.pdb"
+  "CMakeFiles/TestEventLocalization.dir/TestEventLocalization.cpp.o"
+  "CMakeFiles/TestEventLocalization.dir/TestEventLocalization.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestEventLocalization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestForceReduction"
+  "../../TestForceReduction.pdb"
+  "CMakeFiles/TestForceReduction.dir/TestForceReduction.cpp.o"
+  "CMakeFiles/TestForceReduction.dir/TestForceReduction.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestForceReduction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestForces"
+  "../../TestForces.pdb"
+  "CMakeFiles/TestForces.dir/TestForces.cpp.o"
+  "CMakeFiles/TestForces.dir/TestForces.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestForces.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestFunctionBasedMobilizedBodies"
+  "../../TestFunctionBasedMobilizedBodies.pdb"
+  "CMakeFiles/TestFunctionBasedMobilizedBodies.dir/TestFunctionBasedMobilizedBodies.cpp.o"
+  "CMakeFiles/TestFunctionBasedMobilizedBodies.dir/TestFunctionBasedMobilizedBodies.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestFunctionBasedMobilizedBodies.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
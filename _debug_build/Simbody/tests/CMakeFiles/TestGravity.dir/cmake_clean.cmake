@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestGravity"
+  "../../TestGravity.pdb"
+  "CMakeFiles/TestGravity.dir/TestGravity.cpp.o"
+  "CMakeFiles/TestGravity.dir/TestGravity.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestGravity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestHuntCrossleyForce"
+  "../../TestHuntCrossleyForce.pdb"
+  "CMakeFiles/TestHuntCrossleyForce.dir/TestHuntCrossleyForce.cpp.o"
+  "CMakeFiles/TestHuntCrossleyForce.dir/TestHuntCrossleyForce.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestHuntCrossleyForce.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
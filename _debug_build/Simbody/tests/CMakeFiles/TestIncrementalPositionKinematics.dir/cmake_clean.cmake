@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestIncrementalPositionKinematics"
+  "../../TestIncrementalPositionKinematics.pdb"
+  "CMakeFiles/TestIncrementalPositionKinematics.dir/TestIncrementalPositionKinematics.cpp.o"
+  "CMakeFiles/TestIncrementalPositionKinematics.dir/TestIncrementalPositionKinematics.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestIncrementalPositionKinematics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
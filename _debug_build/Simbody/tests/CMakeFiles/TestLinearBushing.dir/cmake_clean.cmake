@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestLinearBushing"
+  "../../TestLinearBushing.pdb"
+  "CMakeFiles/TestLinearBushing.dir/TestLinearBushing.cpp.o"
+  "CMakeFiles/TestLinearBushing.dir/TestLinearBushing.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestLinearBushing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestLinearizer"
+  "../../TestLinearizer.pdb"
+  "CMakeFiles/TestLinearizer.dir/TestLinearizer.cpp.o"
+  "CMakeFiles/TestLinearizer.dir/TestLinearizer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestLinearizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
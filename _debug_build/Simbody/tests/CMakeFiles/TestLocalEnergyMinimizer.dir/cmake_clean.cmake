@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestLocalEnergyMinimizer"
+  "../../TestLocalEnergyMinimizer.pdb"
+  "CMakeFiles/TestLocalEnergyMinimizer.dir/TestLocalEnergyMinimizer.cpp.o"
+  "CMakeFiles/TestLocalEnergyMinimizer.dir/TestLocalEnergyMinimizer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestLocalEnergyMinimizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestLoneParticle"
+  "../../TestLoneParticle.pdb"
+  "CMakeFiles/TestLoneParticle.dir/TestLoneParticle.cpp.o"
+  "CMakeFiles/TestLoneParticle.dir/TestLoneParticle.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestLoneParticle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
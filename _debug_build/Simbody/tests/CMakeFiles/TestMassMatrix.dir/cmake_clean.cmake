@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestMassMatrix"
+  "../../TestMassMatrix.pdb"
+  "CMakeFiles/TestMassMatrix.dir/TestMassMatrix.cpp.o"
+  "CMakeFiles/TestMassMatrix.dir/TestMassMatrix.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestMassMatrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
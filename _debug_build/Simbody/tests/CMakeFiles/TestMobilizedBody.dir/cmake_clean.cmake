@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestMobilizedBody"
+  "../../TestMobilizedBody.pdb"
+  "CMakeFiles/TestMobilizedBody.dir/TestMobilizedBody.cpp.o"
+  "CMakeFiles/TestMobilizedBody.dir/TestMobilizedBody.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestMobilizedBody.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
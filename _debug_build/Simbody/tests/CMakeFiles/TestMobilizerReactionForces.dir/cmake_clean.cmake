@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestMobilizerReactionForces"
+  "../../TestMobilizerReactionForces.pdb"
+  "CMakeFiles/TestMobilizerReactionForces.dir/TestMobilizerReactionForces.cpp.o"
+  "CMakeFiles/TestMobilizerReactionForces.dir/TestMobilizerReactionForces.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestMobilizerReactionForces.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
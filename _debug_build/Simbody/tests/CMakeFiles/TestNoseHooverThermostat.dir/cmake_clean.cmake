@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestNoseHooverThermostat"
+  "../../TestNoseHooverThermostat.pdb"
+  "CMakeFiles/TestNoseHooverThermostat.dir/TestNoseHooverThermostat.cpp.o"
+  "CMakeFiles/TestNoseHooverThermostat.dir/TestNoseHooverThermostat.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestNoseHooverThermostat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestObservedPointFitter"
+  "../../TestObservedPointFitter.pdb"
+  "CMakeFiles/TestObservedPointFitter.dir/TestObservedPointFitter.cpp.o"
+  "CMakeFiles/TestObservedPointFitter.dir/TestObservedPointFitter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestObservedPointFitter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
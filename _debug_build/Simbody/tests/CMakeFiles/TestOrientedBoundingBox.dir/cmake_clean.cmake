@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestOrientedBoundingBox"
+  "../../TestOrientedBoundingBox.pdb"
+  "CMakeFiles/TestOrientedBoundingBox.dir/TestOrientedBoundingBox.cpp.o"
+  "CMakeFiles/TestOrientedBoundingBox.dir/TestOrientedBoundingBox.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestOrientedBoundingBox.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestPGSImpulseSolver"
+  "../../TestPGSImpulseSolver.pdb"
+  "CMakeFiles/TestPGSImpulseSolver.dir/TestPGSImpulseSolver.cpp.o"
+  "CMakeFiles/TestPGSImpulseSolver.dir/TestPGSImpulseSolver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestPGSImpulseSolver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestParallelForces"
+  "../../TestParallelForces.pdb"
+  "CMakeFiles/TestParallelForces.dir/TestParallelForces.cpp.o"
+  "CMakeFiles/TestParallelForces.dir/TestParallelForces.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestParallelForces.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestPimpl1"
+  "../../TestPimpl1.pdb"
+  "CMakeFiles/TestPimpl1.dir/TestPimpl1.cpp.o"
+  "CMakeFiles/TestPimpl1.dir/TestPimpl1.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestPimpl1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestReverseMobilizers"
+  "../../TestReverseMobilizers.pdb"
+  "CMakeFiles/TestReverseMobilizers.dir/TestReverseMobilizers.cpp.o"
+  "CMakeFiles/TestReverseMobilizers.dir/TestReverseMobilizers.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestReverseMobilizers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
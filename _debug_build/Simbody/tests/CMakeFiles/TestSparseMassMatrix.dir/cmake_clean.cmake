@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../TestSparseMassMatrix"
+  "../../TestSparseMassMatrix.pdb"
+  "CMakeFiles/TestSparseMassMatrix.dir/TestSparseMassMatrix.cpp.o"
+  "CMakeFiles/TestSparseMassMatrix.dir/TestSparseMassMatrix.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestSparseMassMatrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
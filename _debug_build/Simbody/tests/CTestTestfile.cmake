@@ -0,0 +1,79 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Simbody/tests
+# Build directory: /root/repo/_debug_build/Simbody/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(GazeboBasicControllerResponse "/root/repo/_debug_build/GazeboBasicControllerResponse")
+set_tests_properties(GazeboBasicControllerResponse PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(GazeboInelasticCollision "/root/repo/_debug_build/GazeboInelasticCollision")
+set_tests_properties(GazeboInelasticCollision PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(GazeboReactionForce "/root/repo/_debug_build/GazeboReactionForce")
+set_tests_properties(GazeboReactionForce PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(GazeboReactionForceWithAppliedForceCompliant "/root/repo/_debug_build/GazeboReactionForceWithAppliedForceCompliant")
+set_tests_properties(GazeboReactionForceWithAppliedForceCompliant PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(GazeboReactionForceWithAppliedForceRigid "/root/repo/_debug_build/GazeboReactionForceWithAppliedForceRigid")
+set_tests_properties(GazeboReactionForceWithAppliedForceRigid PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestAngleConversions "/root/repo/_debug_build/TestAngleConversions")
+set_tests_properties(TestAngleConversions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestAssemblerTrackTrial "/root/repo/_debug_build/TestAssemblerTrackTrial")
+set_tests_properties(TestAssemblerTrackTrial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestCableTrackerThreads "/root/repo/_debug_build/TestCableTrackerThreads")
+set_tests_properties(TestCableTrackerThreads PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestCollisionDetectionAlgorithm "/root/repo/_debug_build/TestCollisionDetectionAlgorithm")
+set_tests_properties(TestCollisionDetectionAlgorithm PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestConstraints "/root/repo/_debug_build/TestConstraints")
+set_tests_properties(TestConstraints PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestContactForceThreads "/root/repo/_debug_build/TestContactForceThreads")
+set_tests_properties(TestContactForceThreads PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestCustomConstraints "/root/repo/_debug_build/TestCustomConstraints")
+set_tests_properties(TestCustomConstraints PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestCustomMobilizedBodies "/root/repo/_debug_build/TestCustomMobilizedBodies")
+set_tests_properties(TestCustomMobilizedBodies PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestElasticFoundationForce "/root/repo/_debug_build/TestElasticFoundationForce")
+set_tests_properties(TestElasticFoundationForce PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestEventLocalization "/root/repo/_debug_build/TestEventLocalization")
+set_tests_properties(TestEventLocalization PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestForceReduction "/root/repo/_debug_build/TestForceReduction")
+set_tests_properties(TestForceReduction PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestForces "/root/repo/_debug_build/TestForces")
+set_tests_properties(TestForces PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestFunctionBasedMobilizedBodies "/root/repo/_debug_build/TestFunctionBasedMobilizedBodies")
+set_tests_properties(TestFunctionBasedMobilizedBodies PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestGravity "/root/repo/_debug_build/TestGravity")
+set_tests_properties(TestGravity PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestHuntCrossleyForce "/root/repo/_debug_build/TestHuntCrossleyForce")
+set_tests_properties(TestHuntCrossleyForce PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestIncrementalPositionKinematics "/root/repo/_debug_build/TestIncrementalPositionKinematics")
+set_tests_properties(TestIncrementalPositionKinematics PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestLinearBushing "/root/repo/_debug_build/TestLinearBushing")
+set_tests_properties(TestLinearBushing PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestLinearizer "/root/repo/_debug_build/TestLinearizer")
+set_tests_properties(TestLinearizer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestLocalEnergyMinimizer "/root/repo/_debug_build/TestLocalEnergyMinimizer")
+set_tests_properties(TestLocalEnergyMinimizer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestLoneParticle "/root/repo/_debug_build/TestLoneParticle")
+set_tests_properties(TestLoneParticle PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestMassMatrix "/root/repo/_debug_build/TestMassMatrix")
+set_tests_properties(TestMassMatrix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestMobilizedBody "/root/repo/_debug_build/TestMobilizedBody")
+set_tests_properties(TestMobilizedBody PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestMobilizerReactionForces "/root/repo/_debug_build/TestMobilizerReactionForces")
+set_tests_properties(TestMobilizerReactionForces PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestNoseHooverThermostat "/root/repo/_debug_build/TestNoseHooverThermostat")
+set_tests_properties(TestNoseHooverThermostat PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestObservedPointFitter "/root/repo/_debug_build/TestObservedPointFitter")
+set_tests_properties(TestObservedPointFitter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestOrientedBoundingBox "/root/repo/_debug_build/TestOrientedBoundingBox")
+set_tests_properties(TestOrientedBoundingBox PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestPGSImpulseSolver "/root/repo/_debug_build/TestPGSImpulseSolver")
+set_tests_properties(TestPGSImpulseSolver PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestParallelForces "/root/repo/_debug_build/TestParallelForces")
+set_tests_properties(TestParallelForces PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestPimpl1 "/root/repo/_debug_build/TestPimpl1")
+set_tests_properties(TestPimpl1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestReverseMobilizers "/root/repo/_debug_build/TestReverseMobilizers")
+set_tests_properties(TestReverseMobilizers PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+add_test(TestSparseMassMatrix "/root/repo/_debug_build/TestSparseMassMatrix")
+set_tests_properties(TestSparseMassMatrix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simbody/tests/CMakeLists.txt;36;add_test;/root/repo/Simbody/tests/CMakeLists.txt;0;")
+subdirs("adhoc")
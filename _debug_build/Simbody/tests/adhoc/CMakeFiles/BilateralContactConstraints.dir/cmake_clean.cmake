@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../BilateralContactConstraints"
+  "../../../BilateralContactConstraints.pdb"
+  "CMakeFiles/BilateralContactConstraints.dir/BilateralContactConstraints.cpp.o"
+  "CMakeFiles/BilateralContactConstraints.dir/BilateralContactConstraints.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BilateralContactConstraints.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
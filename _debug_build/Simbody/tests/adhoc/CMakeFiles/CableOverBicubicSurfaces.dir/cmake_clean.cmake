@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../CableOverBicubicSurfaces"
+  "../../../CableOverBicubicSurfaces.pdb"
+  "CMakeFiles/CableOverBicubicSurfaces.dir/CableOverBicubicSurfaces.cpp.o"
+  "CMakeFiles/CableOverBicubicSurfaces.dir/CableOverBicubicSurfaces.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CableOverBicubicSurfaces.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
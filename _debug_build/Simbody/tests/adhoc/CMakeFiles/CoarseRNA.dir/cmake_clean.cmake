@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../CoarseRNA"
+  "../../../CoarseRNA.pdb"
+  "CMakeFiles/CoarseRNA.dir/CoarseRNA.cpp.o"
+  "CMakeFiles/CoarseRNA.dir/CoarseRNA.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CoarseRNA.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
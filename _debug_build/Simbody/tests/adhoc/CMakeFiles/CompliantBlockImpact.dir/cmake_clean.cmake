@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../CompliantBlockImpact"
+  "../../../CompliantBlockImpact.pdb"
+  "CMakeFiles/CompliantBlockImpact.dir/CompliantBlockImpact.cpp.o"
+  "CMakeFiles/CompliantBlockImpact.dir/CompliantBlockImpact.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CompliantBlockImpact.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
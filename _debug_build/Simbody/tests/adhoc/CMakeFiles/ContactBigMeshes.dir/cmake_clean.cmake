@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../ContactBigMeshes"
+  "../../../ContactBigMeshes.pdb"
+  "CMakeFiles/ContactBigMeshes.dir/ContactBigMeshes.cpp.o"
+  "CMakeFiles/ContactBigMeshes.dir/ContactBigMeshes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ContactBigMeshes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
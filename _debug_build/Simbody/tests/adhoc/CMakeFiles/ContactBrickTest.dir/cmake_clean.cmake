@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../ContactBrickTest"
+  "../../../ContactBrickTest.pdb"
+  "CMakeFiles/ContactBrickTest.dir/ContactBrickTest.cpp.o"
+  "CMakeFiles/ContactBrickTest.dir/ContactBrickTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ContactBrickTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
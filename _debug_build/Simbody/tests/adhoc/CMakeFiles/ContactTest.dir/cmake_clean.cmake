@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../ContactTest"
+  "../../../ContactTest.pdb"
+  "CMakeFiles/ContactTest.dir/ContactTest.cpp.o"
+  "CMakeFiles/ContactTest.dir/ContactTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ContactTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../ElasticFoundation"
+  "../../../ElasticFoundation.pdb"
+  "CMakeFiles/ElasticFoundation.dir/ElasticFoundation.cpp.o"
+  "CMakeFiles/ElasticFoundation.dir/ElasticFoundation.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ElasticFoundation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../FreeWater"
+  "../../../FreeWater.pdb"
+  "CMakeFiles/FreeWater.dir/FreeWater.cpp.o"
+  "CMakeFiles/FreeWater.dir/FreeWater.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FreeWater.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../GeometryPlayground"
+  "../../../GeometryPlayground.pdb"
+  "CMakeFiles/GeometryPlayground.dir/GeometryPlayground.cpp.o"
+  "CMakeFiles/GeometryPlayground.dir/GeometryPlayground.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GeometryPlayground.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../JunkMain1"
+  "../../../JunkMain1.pdb"
+  "CMakeFiles/JunkMain1.dir/JunkMain1.cpp.o"
+  "CMakeFiles/JunkMain1.dir/JunkMain1.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/JunkMain1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
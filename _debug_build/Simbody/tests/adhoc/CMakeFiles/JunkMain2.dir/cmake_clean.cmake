@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../JunkMain2"
+  "../../../JunkMain2.pdb"
+  "CMakeFiles/JunkMain2.dir/JunkMain2.cpp.o"
+  "CMakeFiles/JunkMain2.dir/JunkMain2.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/JunkMain2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../LockUnlockConstraint"
+  "../../../LockUnlockConstraint.pdb"
+  "CMakeFiles/LockUnlockConstraint.dir/LockUnlockConstraint.cpp.o"
+  "CMakeFiles/LockUnlockConstraint.dir/LockUnlockConstraint.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LockUnlockConstraint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
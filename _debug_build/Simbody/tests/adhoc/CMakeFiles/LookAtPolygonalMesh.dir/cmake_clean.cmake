@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../LookAtPolygonalMesh"
+  "../../../LookAtPolygonalMesh.pdb"
+  "CMakeFiles/LookAtPolygonalMesh.dir/LookAtPolygonalMesh.cpp.o"
+  "CMakeFiles/LookAtPolygonalMesh.dir/LookAtPolygonalMesh.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LookAtPolygonalMesh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
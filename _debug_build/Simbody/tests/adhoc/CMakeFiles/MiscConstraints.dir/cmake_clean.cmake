@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../MiscConstraints"
+  "../../../MiscConstraints.pdb"
+  "CMakeFiles/MiscConstraints.dir/MiscConstraints.cpp.o"
+  "CMakeFiles/MiscConstraints.dir/MiscConstraints.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MiscConstraints.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../MovingMusclePointMomentArm"
+  "../../../MovingMusclePointMomentArm.pdb"
+  "CMakeFiles/MovingMusclePointMomentArm.dir/MovingMusclePointMomentArm.cpp.o"
+  "CMakeFiles/MovingMusclePointMomentArm.dir/MovingMusclePointMomentArm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MovingMusclePointMomentArm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
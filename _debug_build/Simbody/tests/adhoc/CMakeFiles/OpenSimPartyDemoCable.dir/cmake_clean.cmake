@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../OpenSimPartyDemoCable"
+  "../../../OpenSimPartyDemoCable.pdb"
+  "CMakeFiles/OpenSimPartyDemoCable.dir/OpenSimPartyDemoCable.cpp.o"
+  "CMakeFiles/OpenSimPartyDemoCable.dir/OpenSimPartyDemoCable.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/OpenSimPartyDemoCable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../ParallelIpoptTest"
+  "../../../ParallelIpoptTest.pdb"
+  "CMakeFiles/ParallelIpoptTest.dir/ParallelIpoptTest.cpp.o"
+  "CMakeFiles/ParallelIpoptTest.dir/ParallelIpoptTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ParallelIpoptTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../PassThrough"
+  "../../../PassThrough.pdb"
+  "CMakeFiles/PassThrough.dir/PassThrough.cpp.o"
+  "CMakeFiles/PassThrough.dir/PassThrough.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PassThrough.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
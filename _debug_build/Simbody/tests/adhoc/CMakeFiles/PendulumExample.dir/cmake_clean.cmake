@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../PendulumExample"
+  "../../../PendulumExample.pdb"
+  "CMakeFiles/PendulumExample.dir/PendulumExample.cpp.o"
+  "CMakeFiles/PendulumExample.dir/PendulumExample.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PendulumExample.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../PrescribedMotionPlayground"
+  "../../../PrescribedMotionPlayground.pdb"
+  "CMakeFiles/PrescribedMotionPlayground.dir/PrescribedMotionPlayground.cpp.o"
+  "CMakeFiles/PrescribedMotionPlayground.dir/PrescribedMotionPlayground.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PrescribedMotionPlayground.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../RadusDrifter"
+  "../../../RadusDrifter.pdb"
+  "CMakeFiles/RadusDrifter.dir/RadusDrifter.cpp.o"
+  "CMakeFiles/RadusDrifter.dir/RadusDrifter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RadusDrifter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
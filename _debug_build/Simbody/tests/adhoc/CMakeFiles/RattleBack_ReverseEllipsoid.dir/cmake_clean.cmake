@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../RattleBack_ReverseEllipsoid"
+  "../../../RattleBack_ReverseEllipsoid.pdb"
+  "CMakeFiles/RattleBack_ReverseEllipsoid.dir/RattleBack_ReverseEllipsoid.cpp.o"
+  "CMakeFiles/RattleBack_ReverseEllipsoid.dir/RattleBack_ReverseEllipsoid.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RattleBack_ReverseEllipsoid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
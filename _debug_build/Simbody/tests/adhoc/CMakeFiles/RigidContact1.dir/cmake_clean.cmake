@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../RigidContact1"
+  "../../../RigidContact1.pdb"
+  "CMakeFiles/RigidContact1.dir/RigidContact1.cpp.o"
+  "CMakeFiles/RigidContact1.dir/RigidContact1.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RigidContact1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
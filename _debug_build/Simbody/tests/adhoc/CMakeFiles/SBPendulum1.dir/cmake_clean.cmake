@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../SBPendulum1"
+  "../../../SBPendulum1.pdb"
+  "CMakeFiles/SBPendulum1.dir/SBPendulum1.cpp.o"
+  "CMakeFiles/SBPendulum1.dir/SBPendulum1.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SBPendulum1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
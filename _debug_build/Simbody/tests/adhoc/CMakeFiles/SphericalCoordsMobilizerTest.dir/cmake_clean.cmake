@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../SphericalCoordsMobilizerTest"
+  "../../../SphericalCoordsMobilizerTest.pdb"
+  "CMakeFiles/SphericalCoordsMobilizerTest.dir/SphericalCoordsMobilizerTest.cpp.o"
+  "CMakeFiles/SphericalCoordsMobilizerTest.dir/SphericalCoordsMobilizerTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SphericalCoordsMobilizerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
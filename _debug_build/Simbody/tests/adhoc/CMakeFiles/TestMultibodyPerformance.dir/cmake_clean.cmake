@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../TestMultibodyPerformance"
+  "../../../TestMultibodyPerformance.pdb"
+  "CMakeFiles/TestMultibodyPerformance.dir/TestMultibodyPerformance.cpp.o"
+  "CMakeFiles/TestMultibodyPerformance.dir/TestMultibodyPerformance.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestMultibodyPerformance.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
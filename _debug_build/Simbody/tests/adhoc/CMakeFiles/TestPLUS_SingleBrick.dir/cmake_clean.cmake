@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../TestPLUS_SingleBrick"
+  "../../../TestPLUS_SingleBrick.pdb"
+  "CMakeFiles/TestPLUS_SingleBrick.dir/TestPLUS_SingleBrick.cpp.o"
+  "CMakeFiles/TestPLUS_SingleBrick.dir/TestPLUS_SingleBrick.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestPLUS_SingleBrick.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../TestRiboseMobilizer"
+  "../../../TestRiboseMobilizer.pdb"
+  "CMakeFiles/TestRiboseMobilizer.dir/TestRiboseMobilizer.cpp.o"
+  "CMakeFiles/TestRiboseMobilizer.dir/TestRiboseMobilizer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestRiboseMobilizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../TestThermostat"
+  "../../../TestThermostat.pdb"
+  "CMakeFiles/TestThermostat.dir/TestThermostat.cpp.o"
+  "CMakeFiles/TestThermostat.dir/TestThermostat.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestThermostat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
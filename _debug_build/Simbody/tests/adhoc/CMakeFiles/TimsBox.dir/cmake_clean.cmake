@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../TimsBox"
+  "../../../TimsBox.pdb"
+  "CMakeFiles/TimsBox.dir/TimsBox.cpp.o"
+  "CMakeFiles/TimsBox.dir/TimsBox.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TimsBox.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../TimsBoxBristle"
+  "../../../TimsBoxBristle.pdb"
+  "CMakeFiles/TimsBoxBristle.dir/TimsBoxBristle.cpp.o"
+  "CMakeFiles/TimsBoxBristle.dir/TimsBoxBristle.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TimsBoxBristle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../TimsBoxHybrid"
+  "../../../TimsBoxHybrid.pdb"
+  "CMakeFiles/TimsBoxHybrid.dir/TimsBoxHybrid.cpp.o"
+  "CMakeFiles/TimsBoxHybrid.dir/TimsBoxHybrid.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TimsBoxHybrid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../TimsBoxPGS"
+  "../../../TimsBoxPGS.pdb"
+  "CMakeFiles/TimsBoxPGS.dir/TimsBoxPGS.cpp.o"
+  "CMakeFiles/TimsBoxPGS.dir/TimsBoxPGS.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TimsBoxPGS.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../TwoPendulums"
+  "../../../TwoPendulums.pdb"
+  "CMakeFiles/TwoPendulums.dir/TwoPendulums.cpp.o"
+  "CMakeFiles/TwoPendulums.dir/TwoPendulums.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TwoPendulums.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../UnilateralPointContact"
+  "../../../UnilateralPointContact.pdb"
+  "CMakeFiles/UnilateralPointContact.dir/UnilateralPointContact.cpp.o"
+  "CMakeFiles/UnilateralPointContact.dir/UnilateralPointContact.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnilateralPointContact.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
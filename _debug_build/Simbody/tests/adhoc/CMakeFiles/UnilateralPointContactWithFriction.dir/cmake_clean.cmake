@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../UnilateralPointContactWithFriction"
+  "../../../UnilateralPointContactWithFriction.pdb"
+  "CMakeFiles/UnilateralPointContactWithFriction.dir/UnilateralPointContactWithFriction.cpp.o"
+  "CMakeFiles/UnilateralPointContactWithFriction.dir/UnilateralPointContactWithFriction.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnilateralPointContactWithFriction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
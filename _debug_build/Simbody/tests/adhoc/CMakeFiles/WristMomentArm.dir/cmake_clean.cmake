@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../WristMomentArm"
+  "../../../WristMomentArm.pdb"
+  "CMakeFiles/WristMomentArm.dir/WristMomentArm.cpp.o"
+  "CMakeFiles/WristMomentArm.dir/WristMomentArm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WristMomentArm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Simbody/tests/adhoc
+# Build directory: /root/repo/_debug_build/Simbody/tests/adhoc
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.